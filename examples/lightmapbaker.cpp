@@ -0,0 +1,215 @@
+/**
+ * Parcel Example -- Lightmap Baker
+ *
+ * This example is a command line tool that bakes lightmaps for a static scene
+ * offline, using every processor of the machine it runs on. It needs no window
+ * or OpenGL context, so it can be run on a build machine.
+ *
+ * It's run with the name of a scene file, which has one model or light on
+ * every line:
+ *
+ *     model <model.dmf> <lightmap.tga> <x> <y> <z> <red> <green> <blue>
+ *     point <x> <y> <z> <red> <green> <blue> <constant> <linear> <quadratic>
+ *     directional <x> <y> <z> <red> <green> <blue>
+ *     probes <grid file> <x> <y> <z> <spacing> <amount x> <amount y> <amount z>
+ *
+ * Models are placed at the given position and bounce the given colour of the
+ * light that hits them. The direction of directional lights points towards the
+ * light. Every model is unwrapped with LightmapUnwrapper (using its default
+ * settings) and its lightmap is saved to the TGA file given. Unwrapping gives
+ * the same coordinates every time, so the game unwraps the models again when
+ * it loads them and draws them as ILightmapped renderables with the lightmaps.
+ *
+ * Each probes line bakes a grid of light probes starting at the given position
+ * for lighting dynamic objects, which is saved with LightProbeGrid::SaveToFile()
+ * so it can be shipped and streamed in with the rest of the level.
+ *
+ * For this example to work, Parcel's include directory must be to the list of
+ * include subdirectories used at compilation.
+**/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <Logger.h>
+#include <NullBackend.h>
+#include <SkinManager.h>
+#include <DMFModelLoader.h>
+#include <LightmapUnwrapper.h>
+#include <LightmapBaker.h>
+#include <LightProbeGrid.h>
+#include <ThreadPool.h>
+
+using namespace parcel;
+
+/* A light read from the scene file. It never changes, so it's the simplest light there is. */
+class SceneLight : public graphics::ALight
+{
+public:
+
+    SceneLight(graphics::LightType lightType, const maths::vector3f& lightVector, const graphics::colourf& lightColour,
+        float constant, float linear, float quadratic) :
+        type(lightType), vector(lightVector), colour(lightColour)
+    {
+        attenuation[0] = constant;
+        attenuation[1] = linear;
+        attenuation[2] = quadratic;
+    }
+
+    bool IsEnabled() { return true; }
+    graphics::LightType GetType() { return type; }
+    graphics::colourf GetAmbientColour() { return graphics::colourf(0.0f, 0.0f, 0.0f, 1.0f); }
+    graphics::colourf GetDiffuseColour() { return colour; }
+    graphics::colourf GetSpecularColour() { return colour; }
+    maths::vector3f GetPosition() { return vector; }
+    maths::vector3f GetDirection() { return vector; }
+    float GetConstantAttenuation() { return attenuation[0]; }
+    float GetLinearAttenuation() { return attenuation[1]; }
+    float GetQuadraticAttenuation() { return attenuation[2]; }
+
+private:
+    graphics::LightType type;
+    maths::vector3f vector;
+    graphics::colourf colour;
+    float attenuation[3];
+};
+
+/* A grid of light probes read from the scene file, and where it goes. */
+struct SceneProbes
+{
+    std::string filename;
+    maths::vector3f origin;
+    float spacing;
+    unsigned int amount[3];
+};
+
+/* A model read from the scene file, and where its lightmap goes. */
+struct SceneModel
+{
+    graphics::LightmapMesh mesh;
+    std::string lightmapFilename;
+    float matrix[16];
+    graphics::colourf albedo;
+};
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "Usage: lightmapbaker <scene file>" << std::endl;
+        return 1;
+    }
+
+    std::ifstream sceneFile(argv[1]);
+    if (!sceneFile)
+    {
+        std::cout << "Could not open " << argv[1] << std::endl;
+        return 1;
+    }
+
+    // Models are loaded through a skin manager, which doesn't need a real graphics API
+    debug::Logger log;
+    graphics::NullBackend backend;
+    graphics::SkinManager skinManager(&backend, &log);
+    graphics::LightmapUnwrapper unwrapper((graphics::LightmapUnwrapSettings()));
+
+    std::vector<SceneModel*> models;
+    std::vector<SceneLight*> lights;
+    std::vector<SceneProbes> probeGrids;
+    std::string line;
+    while (std::getline(sceneFile, line))
+    {
+        std::istringstream stream(line);
+        std::string kind;
+        if (!(stream >> kind)) continue;
+
+        float x, y, z, r, g, b;
+        if (kind == "model")
+        {
+            std::string modelFilename;
+            SceneModel* model = new SceneModel();
+            stream >> modelFilename >> model->lightmapFilename >> x >> y >> z >> r >> g >> b;
+
+            graphics::DMFModelLoader loader(&skinManager);
+            if (!loader.LoadFromFile(modelFilename))
+            {
+                std::cout << "Could not load " << modelFilename << std::endl;
+                delete model;
+                continue;
+            }
+            unwrapper.Unwrap(&loader, model->mesh);
+
+            const float translation[16] = { 1.0f, 0.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f, 0.0f,
+                                            0.0f, 0.0f, 1.0f, 0.0f,  x, y, z, 1.0f };
+            for (unsigned int i = 0; (i < 16); i++) model->matrix[i] = translation[i];
+            model->albedo = graphics::colourf(r, g, b, 1.0f);
+            models.push_back(model);
+        }
+        else if (kind == "point")
+        {
+            float constant, linear, quadratic;
+            stream >> x >> y >> z >> r >> g >> b >> constant >> linear >> quadratic;
+            lights.push_back(new SceneLight(graphics::LIGHTTYPE_POSITION, maths::vector3f(x, y, z),
+                graphics::colourf(r, g, b, 1.0f), constant, linear, quadratic));
+        }
+        else if (kind == "directional")
+        {
+            stream >> x >> y >> z >> r >> g >> b;
+            lights.push_back(new SceneLight(graphics::LIGHTTYPE_DIRECTION, maths::vector3f(x, y, z),
+                graphics::colourf(r, g, b, 1.0f), 1.0f, 0.0f, 0.0f));
+        }
+        else if (kind == "probes")
+        {
+            SceneProbes probes;
+            stream >> probes.filename >> x >> y >> z >> probes.spacing >> probes.amount[0] >> probes.amount[1] >> probes.amount[2];
+            probes.origin = maths::vector3f(x, y, z);
+            probeGrids.push_back(probes);
+        }
+    }
+
+    // Bakes every model's lightmap at once, since they all shadow and bounce light onto each other
+    graphics::LightmapBaker baker((graphics::LightmapBakeSettings()));
+    for (unsigned int i = 0; (i < models.size()); i++)
+    {
+        baker.AddMesh(&models[i]->mesh, models[i]->matrix, models[i]->albedo);
+    }
+    for (unsigned int i = 0; (i < lights.size()); i++)
+    {
+        baker.AddLight(lights[i]);
+    }
+
+    general::ThreadPool threadPool(0);
+    baker.Bake(&threadPool);
+
+    for (unsigned int i = 0; (i < probeGrids.size()); i++)
+    {
+        const SceneProbes& probes = probeGrids[i];
+        graphics::LightProbeGrid grid;
+        grid.Create(probes.origin, maths::vector3f(probes.spacing, probes.spacing, probes.spacing),
+            probes.amount[0], probes.amount[1], probes.amount[2]);
+        baker.BakeProbes(grid, &threadPool);
+
+        if (grid.SaveToFile(probes.filename))
+            std::cout << "Saved " << probes.filename << std::endl;
+        else
+            std::cout << "Could not save " << probes.filename << std::endl;
+    }
+
+    for (unsigned int i = 0; (i < models.size()); i++)
+    {
+        if (baker.SaveLightmap(i, models[i]->lightmapFilename))
+            std::cout << "Saved " << models[i]->lightmapFilename << std::endl;
+        else
+            std::cout << "Could not save " << models[i]->lightmapFilename << std::endl;
+        delete models[i];
+    }
+    for (unsigned int i = 0; (i < lights.size()); i++)
+    {
+        delete lights[i];
+    }
+
+    return 0;
+}
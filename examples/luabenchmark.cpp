@@ -0,0 +1,119 @@
+/**
+ * Parcel Example -- Lua Benchmark
+ *
+ * This example is a command line tool that times a script-heavy gameplay loop,
+ * for comparing Parcel built against stock Lua with Parcel built against LuaJIT
+ * (with PARCEL_LUAJIT defined). Build it both ways and run each.
+ *
+ * The script (luabenchmark.lua, or the file given as the first argument) steers
+ * a few thousand agents every frame. It's run two ways:
+ *
+ *     classic - positions are handed to the script as an array of maths.Vector3
+ *               userdata and read back afterwards. Works on both backends.
+ *     ffi     - the script changes the C++ array of positions in place through
+ *               LuaJIT's FFI. Only run on LuaJIT.
+ *
+ * Both start from the same positions and do the same steering, so the checksums
+ * printed should be about the same (they're rounded differently).
+ *
+ * For this example to work, Parcel's include directory must be to the list of
+ * include subdirectories used at compilation.
+**/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <windows.h>
+
+#include <LuaManager.h>
+
+using namespace parcel;
+
+const unsigned int AGENT_COUNT = 2000;
+const unsigned int FRAME_COUNT = 300;
+const float FRAME_TIME = 1.0f / 60.0f;
+
+/* Returns the time in seconds, from the high resolution counter. */
+double GetSeconds()
+{
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return static_cast<double>(counter.QuadPart) / static_cast<double>(frequency.QuadPart);
+}
+
+/* Places the agents in a grid, a metre apart. */
+void ResetPositions(std::vector<maths::vector3f>& positions)
+{
+    positions.resize(AGENT_COUNT);
+    for (unsigned int i = 0; (i < AGENT_COUNT); i++)
+    {
+        positions[i] = maths::vector3f(static_cast<float>(i % 50), 0.0f, static_cast<float>(i / 50));
+    }
+}
+
+/* Sums every component, so runs can be compared. */
+double GetChecksum(const std::vector<maths::vector3f>& positions)
+{
+    double sum = 0.0;
+    for (unsigned int i = 0; (i < positions.size()); i++) sum += positions[i].x + positions[i].y + positions[i].z;
+    return sum;
+}
+
+void PrintResult(const std::string& name, double seconds, const std::vector<maths::vector3f>& positions)
+{
+    std::cout << name << ": " << (seconds * 1000.0 / FRAME_COUNT) << " ms per frame (checksum "
+        << GetChecksum(positions) << ")" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    std::string scriptFilename = (argc > 1) ? argv[1] : "luabenchmark.lua";
+
+    try
+    {
+        lua::LuaManager lua;
+        lua.RegisterMathsLibrary();
+        bool hasFFI = lua.RegisterFFIModule();
+        lua.SetIntToVariable("agentCount", AGENT_COUNT);
+        lua.LoadAndExecuteScript(scriptFilename);
+
+        std::cout << "Backend: " << lua.GetBackendName() << ", " << AGENT_COUNT << " agents, "
+            << FRAME_COUNT << " frames" << std::endl;
+
+        std::vector<maths::vector3f> positions;
+
+        // The update functions are looked up once, rather than by name every frame
+        ResetPositions(positions);
+        lua::LuaFunctionRef updateClassic = lua.GetFunctionRef("UpdateClassic");
+        double start = GetSeconds();
+        for (unsigned int frame = 0; (frame < FRAME_COUNT); frame++)
+        {
+            lua.SetUserdataArrayToVariable("agentPositions", &positions[0], AGENT_COUNT);
+            updateClassic.Call(FRAME_TIME);
+            lua.GetUserdataArrayFromVariable("agentPositions", positions);
+        }
+        PrintResult("classic", GetSeconds() - start, positions);
+
+        if (hasFFI)
+        {
+            ResetPositions(positions);
+            lua.SetPointerToVariable("agentPointer", &positions[0]);
+            lua::LuaFunctionRef updateFFI = lua.GetFunctionRef("UpdateFFI");
+            start = GetSeconds();
+            for (unsigned int frame = 0; (frame < FRAME_COUNT); frame++) updateFFI.Call(FRAME_TIME);
+            PrintResult("ffi", GetSeconds() - start, positions);
+        }
+        else
+        {
+            std::cout << "ffi: skipped, Parcel isn't built against LuaJIT" << std::endl;
+        }
+    }
+    catch (const debug::Exception& ex)
+    {
+        std::cout << "Error: " << ex.Message() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+-- Script for the Lua benchmark example (luabenchmark.cpp). Each update steers every
+-- agent towards a target moving in a circle while keeping it apart from its
+-- neighbours, which is the kind of maths AI scripts do every frame. The same
+-- steering is written twice: once with the maths userdata, which works with any
+-- Lua, and once with LuaJIT's FFI.
+
+local MAX_SPEED = 5.0
+local MAX_FORCE = 10.0
+local NEIGHBOURS = 8
+local SEPARATION_DISTANCE = 2.0
+local SEPARATION_FORCE = 4.0
+
+-- Where the agents are heading at time 't'
+local function GetTarget(t)
+    return 20.0 * math.cos(t * 0.5), 0.0, 20.0 * math.sin(t * 0.5)
+end
+
+
+-- C++ sets agentPositions to an array of Vector3s before each update and reads it
+-- back afterwards, so every position crosses between C++ and Lua every frame.
+local classicVelocities = {}
+for i = 1, agentCount do classicVelocities[i] = maths.Vector3(0, 0, 0) end
+local classicTime = 0.0
+
+function UpdateClassic(dt)
+    classicTime = classicTime + dt
+    local target = maths.Vector3(GetTarget(classicTime))
+    local positions = agentPositions
+    local velocities = classicVelocities
+    local n = #positions
+    local separation = SEPARATION_DISTANCE * SEPARATION_DISTANCE
+
+    for i = 1, n do
+        local p = positions[i]
+        local steer = (target - p):Normalised() * MAX_FORCE
+        for k = 1, NEIGHBOURS do
+            local away = p - positions[(i + k - 1) % n + 1]
+            local distance = away:SqrLength()
+            if distance > 0 and distance < separation then
+                steer = steer + away * (SEPARATION_FORCE / distance)
+            end
+        end
+
+        local v = velocities[i] + steer * dt
+        local speed = v:Length()
+        if speed > MAX_SPEED then v = v * (MAX_SPEED / speed) end
+        velocities[i] = v
+        positions[i] = p + v * dt
+    end
+end
+
+
+-- Only there when running on LuaJIT. C++ sets agentPointer to its array of
+-- positions once, and this changes them in place with plain numbers, which the
+-- JIT keeps in registers instead of making a userdata for every result.
+if jit and package.loaded["parcel.ffi"] then
+    local ffi = require("ffi")
+    local parcel = require("parcel.ffi")
+    local sqrt = math.sqrt
+    local ffiVelocities = ffi.new("parcel_vector3f[?]", agentCount)
+    local ffiTime = 0.0
+
+    function UpdateFFI(dt)
+        ffiTime = ffiTime + dt
+        local tx, ty, tz = GetTarget(ffiTime)
+        local positions = parcel.ArrayFrom(agentPointer, "parcel_vector3f")
+        local velocities = ffiVelocities
+        local n = agentCount
+        local separation = SEPARATION_DISTANCE * SEPARATION_DISTANCE
+
+        for i = 0, n - 1 do
+            local p = positions[i]
+            local dx, dy, dz = tx - p.x, ty - p.y, tz - p.z
+            local length = sqrt(dx * dx + dy * dy + dz * dz)
+            local sx, sy, sz = 0.0, 0.0, 0.0
+            if length > 0 then
+                local s = MAX_FORCE / length
+                sx, sy, sz = dx * s, dy * s, dz * s
+            end
+
+            for k = 1, NEIGHBOURS do
+                local other = positions[(i + k) % n]
+                local ax, ay, az = p.x - other.x, p.y - other.y, p.z - other.z
+                local distance = ax * ax + ay * ay + az * az
+                if distance > 0 and distance < separation then
+                    local s = SEPARATION_FORCE / distance
+                    sx, sy, sz = sx + ax * s, sy + ay * s, sz + az * s
+                end
+            end
+
+            local v = velocities[i]
+            local vx, vy, vz = v.x + sx * dt, v.y + sy * dt, v.z + sz * dt
+            local speed = sqrt(vx * vx + vy * vy + vz * vz)
+            if speed > MAX_SPEED then
+                local s = MAX_SPEED / speed
+                vx, vy, vz = vx * s, vy * s, vz * s
+            end
+            v.x, v.y, v.z = vx, vy, vz
+            p.x, p.y, p.z = p.x + vx * dt, p.y + vy * dt, p.z + vz * dt
+        end
+    end
+end
@@ -1,116 +1,151 @@
- /*
- * File:   ILight.h
- * Author: Donald "Datriot" Whyte
- *
- * Created on February 24, 2009, 9:49 AM
- */
-
-#ifndef ILIGHT_H
-#define ILIGHT_H
-
-#include "Colour.h"
-#include "Vector.h"
-#include "Exceptions.h"
-
-namespace parcel
-{
-
-namespace graphics
-{
-
-
-    /* Enumerator that lists the different types of lights possible. */
-    enum LightType
-    {
-        LIGHTTYPE_POSITION,
-        LIGHTTYPE_DIRECTION,
-        LIGHTTYPE_SPOTLIGHT,
-    };
-
-
-    /* Abstract light class. All lights used by the light manager uase this interface.
-     * It contains all the methods that the manager uses. It's initial implementation
-     * is just to throw an exception to say the operation is unsupported; the subclasses
-     * have to overload and provide their own implementation. This is done instead of
-     * abstract methods so the subclasses don't have to provide an implementation of
-     * methods they won't even need, resulting in duplicate code.
-     *
-     * IsEnabled(), GetType() and the GetColour() methods should always be implemented,
-     * regardless of the type of light.
-     * GetPosition() are for position lights and spotlights.
-     * GetDirection() are for directional lights and spotlights.
-     * GetConstant/Linear/QuadraticAttenuation() are for position lights only.
-     * GetSpotlightCutoff() and GetSpotlightFocus() are only for spotlights. */
-    class ALight
-    {
-
-    public:
-
-        virtual bool IsEnabled()
-        {
-            throw debug::UnsupportedOperationException("IsEnabled() is not supported by this class!");
-        }
-
-        virtual LightType GetType()
-        {
-            throw debug::UnsupportedOperationException("GetType() is not supported by this class!");
-        }
-
-        virtual colourf GetAmbientColour()
-        {
-            throw debug::UnsupportedOperationException("GetColour() is not supported by this class!");
-        }
-
-        virtual colourf GetDiffuseColour()
-        {
-            throw debug::UnsupportedOperationException("GetColour() is not supported by this class!");
-        }
-
-        virtual colourf GetSpecularColour()
-        {
-            throw debug::UnsupportedOperationException("GetColour() is not supported by this class!");
-        }
-
-        virtual maths::vector3f GetDirection()
-        {
-            throw debug::UnsupportedOperationException("GetDirection() is not supported by this class!");
-        }
-
-        virtual maths::vector3f GetPosition()
-        {
-            throw debug::UnsupportedOperationException("GetPosition() is not supported by this class!");
-        }
-
-        virtual float GetSpotlightCutoff()
-        {
-            throw debug::UnsupportedOperationException("GetSpotlightCutoff() is not supported by this class!");
-        }
-
-        virtual float GetSpotlightFocus()
-        {
-            throw debug::UnsupportedOperationException("GetSpotlightFocus() is not supported by this class!");
-        }
-
-        virtual float GetConstantAttenuation()
-        {
-            throw debug::UnsupportedOperationException("GetConstantAttenuation() is not supported by this class!");
-        }
-
-        virtual float GetLinearAttenuation()
-        {
-            throw debug::UnsupportedOperationException("GetLinearAttenuation() is not supported by this class!");
-        }
-
-        virtual float GetQuadraticAttenuation()
-        {
-            throw debug::UnsupportedOperationException("GetQuadraticAttenuation() is not supported by this class!");
-        }
-
-    };
-
-
-}
-
-}
-
-#endif
+ /*
+ * File:   ILight.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on February 24, 2009, 9:49 AM
+ * Added change versions on October 18, 2026, 11:50 PM
+ * Changed to be read through a LightPool on October 19, 2026, 1:05 AM
+ */
+
+#ifndef ILIGHT_H
+#define ILIGHT_H
+
+#include "Colour.h"
+#include "Vector.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+
+    /* Enumerator that lists the different types of lights possible. */
+    enum LightType
+    {
+        LIGHTTYPE_POSITION,
+        LIGHTTYPE_DIRECTION,
+        LIGHTTYPE_SPOTLIGHT,
+    };
+
+
+    /* Abstract light class, for lights that are given to a light manager as objects of their
+     * own. The manager's LightPool reads them through this interface and keeps their values
+     * in its arrays, so it's only an adapter; lights can also be created in the pool directly
+     * (see ALighting::CreateLight()), which skips this class altogether.
+     *
+     * It's initial implementation is just to throw an exception to say the operation is
+     * unsupported; the subclasses
+     * have to overload and provide their own implementation. This is done instead of
+     * abstract methods so the subclasses don't have to provide an implementation of
+     * methods they won't even need, resulting in duplicate code.
+     *
+     * IsEnabled(), GetType() and the GetColour() methods should always be implemented,
+     * regardless of the type of light.
+     * GetPosition() are for position lights and spotlights.
+     * GetDirection() are for directional lights and spotlights.
+     * GetConstant/Linear/QuadraticAttenuation() are for position lights only.
+     * GetSpotlightCutoff() and GetSpotlightFocus() are only for spotlights.
+     *
+     * Lights can also say when they change, so light managers don't have to call every
+     * getter every frame. A subclass that calls MarkChanged() whenever anything its getters
+     * return changes (including being enabled or disabled) is only read again by the
+     * pool after its version has moved on. Lights that never call it keep version 0,
+     * which means they don't track changes and are read every time the lights are updated. */
+    class ALight
+    {
+
+    private:
+
+        unsigned int version; // Goes up every time the light changes, 0 if it doesn't track changes
+
+
+    protected:
+
+        /* Must be called by subclasses that track changes whenever the light changes. */
+        void MarkChanged()
+        {
+            ++version;
+            // Wrapping round to 0 would make the light look like it doesn't track changes
+            if (version == 0) version = 1;
+        }
+
+
+    public:
+
+        ALight() : version(0) {}
+        // Lights are deleted through this class by the light managers
+        virtual ~ALight() {}
+
+        unsigned int GetVersion() const { return version; }
+
+
+        virtual bool IsEnabled()
+        {
+            throw debug::UnsupportedOperationException("IsEnabled() is not supported by this class!");
+        }
+
+        virtual LightType GetType()
+        {
+            throw debug::UnsupportedOperationException("GetType() is not supported by this class!");
+        }
+
+        virtual colourf GetAmbientColour()
+        {
+            throw debug::UnsupportedOperationException("GetColour() is not supported by this class!");
+        }
+
+        virtual colourf GetDiffuseColour()
+        {
+            throw debug::UnsupportedOperationException("GetColour() is not supported by this class!");
+        }
+
+        virtual colourf GetSpecularColour()
+        {
+            throw debug::UnsupportedOperationException("GetColour() is not supported by this class!");
+        }
+
+        virtual maths::vector3f GetDirection()
+        {
+            throw debug::UnsupportedOperationException("GetDirection() is not supported by this class!");
+        }
+
+        virtual maths::vector3f GetPosition()
+        {
+            throw debug::UnsupportedOperationException("GetPosition() is not supported by this class!");
+        }
+
+        virtual float GetSpotlightCutoff()
+        {
+            throw debug::UnsupportedOperationException("GetSpotlightCutoff() is not supported by this class!");
+        }
+
+        virtual float GetSpotlightFocus()
+        {
+            throw debug::UnsupportedOperationException("GetSpotlightFocus() is not supported by this class!");
+        }
+
+        virtual float GetConstantAttenuation()
+        {
+            throw debug::UnsupportedOperationException("GetConstantAttenuation() is not supported by this class!");
+        }
+
+        virtual float GetLinearAttenuation()
+        {
+            throw debug::UnsupportedOperationException("GetLinearAttenuation() is not supported by this class!");
+        }
+
+        virtual float GetQuadraticAttenuation()
+        {
+            throw debug::UnsupportedOperationException("GetQuadraticAttenuation() is not supported by this class!");
+        }
+
+    };
+
+
+}
+
+}
+
+#endif
@@ -1,141 +1,151 @@
- /*
- * File:   ALighting.h
- * Author: Donald "Datriot" Whyte
- *
- * Created on February 28, 2009, 6:16 PM
- */
-
-#ifndef ALIGHTING_H
-#define ALIGHTING_H
-
-#include <vector>
-#include "ALight.h"
-#include "Logger.h" // For logging
-#include "Util.h" // For logging as well
-
-namespace parcel
-{
-
-namespace graphics
-{
-
-    /* Abstract lighting class. Provides an interface for the RenderDevide to use.
-     * Classes can derive from this to create their own lighting managed, such as fixed
-     * function lighting, shader lighting an so on without the RenderDevice knowing. */
-    class ALighting
-    {
-
-
-    protected:
-
-        debug::Logger* logger; // Pointer to the application's logger
-        unsigned int logID; // ID of the renderer's log
-
-        bool deleteAll; // Determines if all renderables get deleted when this renderer does
-
-        std::vector<ALight*> lights; // Stores pointers to all the lights used by this class
-        std::vector<unsigned int> lightIDs; // Stores the IDs of every light
-        unsigned int idCount; // Amount of IDs distributed, used for giving renderable's correct clean IDs
-
-
-    public:
-
-        ALighting(debug::Logger* log, const bool& willDeleteAll) : logger(log), deleteAll(willDeleteAll), idCount(0)
-        {
-            logID = log->StartLog("Lighting");
-            log->WriteTextAndNewLine(logID, "Light manager created.");
-        }
-
-        virtual ~ALighting()
-        {
-            // Makes sure to release all the resources used by the lights if deleteAll is true
-            if (deleteAll)
-            {
-
-                for (unsigned int i = 0; (i < lights.size()); i++)
-                {
-                    delete lights[i];
-                    lights[i] = NULL;
-                }
-            }
-
-            logger->WriteTextAndNewLine(logID, "Light manager destroyed.");
-        }
-
-
-        virtual unsigned int AddLight(ALight* light)
-        {
-            // Pushes new light into the array and adds its new ID lightIDs array
-            lights.push_back(light);
-            idCount++;
-            lightIDs.push_back(idCount);
-
-            // Creates message and logs it
-            std::string message = "Light #";
-            message += general::ToString(idCount); message += " added.";
-            logger->WriteTextAndNewLine(logID, message);
-
-            // Returns the light's new ID
-            return idCount;
-        }
-
-        virtual void RemoveLight(const unsigned int& lightID)
-        {
-            unsigned int i;
-            bool deleted = false; // Turns to true if it finds the light and deletes it
-
-            // Searches through every light
-            for (i = 0; (i < lights.size()); i++)
-            {
-                // If ID of light is the same as the given one, erase it!
-                if (lightIDs[i] == lightID)
-                {
-                    try
-                    {
-                        // Erase the light from the vector
-                        lights.erase(lights.begin() + i);
-                        // Also erase the light's ID from the array
-                        lightIDs.erase(lightIDs.begin() + i);
-
-                        deleted = true;
-                    }
-                    catch (...)
-                    {
-                        logger->WriteTextAndNewLine(logID, "Could not remove light! Vector erase failed!");
-                    }
-                }
-            }
-
-            // Start of log message
-            std::string message = "Light #";
-            // If it found the light and deleted it
-            if (deleted)
-            {
-                message += general::ToString(lightID); message += " removed.";
-                logger->WriteTextAndNewLine(logID, message);
-            }
-            // If it never found it
-            else
-            {
-                message += general::ToString(lightID); message += " doesn't exist. Cannot remove.";
-                logger->WriteTextAndNewLine(logID, message);
-            }
-        }
-
-
-        /* Must be implemented by subclasses. Enables and disables lighting. */
-        virtual void EnableLighting() = 0;
-        virtual void DisableLighting() = 0;
-
-        /* Updates the light's colour, positon and so on. Most likely called every frame. */
-        virtual void Update() = 0;
-
-
-
-    };
-
-}
-
-}
-
-#endif
+ /*
+ * File:   ALighting.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on February 28, 2009, 6:16 PM
+ * Added InvalidateTransforms() on October 18, 2026, 11:50 PM
+ * Added per-object light binding on October 19, 2026, 12:05 AM
+ * Changed to keep the lights in a LightPool on October 19, 2026, 1:05 AM
+ */
+
+#ifndef ALIGHTING_H
+#define ALIGHTING_H
+
+#include <vector>
+#include "ALight.h"
+#include "LightPool.h"
+#include "Bounds.h"
+#include "Logger.h" // For logging
+#include "Util.h" // For logging as well
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Abstract lighting class. Provides an interface for the RenderDevide to use.
+     * Classes can derive from this to create their own lighting managed, such as fixed
+     * function lighting, shader lighting an so on without the RenderDevice knowing.
+     *
+     * The lights are kept in a LightPool, which subclasses go through as arrays. Lights can
+     * be created in the pool with CreateLight() and set through GetLightPool(), or added as
+     * ALights with AddLight(), which the pool reads whenever they change (subclasses call
+     * LightPool::SyncAdapters() at the start of every update). Either way, the light's ID is
+     * its handle in the pool. */
+    class ALighting
+    {
+
+
+    protected:
+
+        debug::Logger* logger; // Pointer to the application's logger
+        unsigned int logID; // ID of the renderer's log
+
+        bool deleteAll; // Determines if all the ALights added get deleted when this manager does
+
+        LightPool lightPool; // Stores all the lights used by this class
+
+
+    public:
+
+        ALighting(debug::Logger* log, const bool& willDeleteAll) : logger(log), deleteAll(willDeleteAll)
+        {
+            logID = log->StartLog("Lighting");
+            log->WriteTextAndNewLine(logID, "Light manager created.");
+        }
+
+        virtual ~ALighting()
+        {
+            // Makes sure to release all the resources used by the lights if deleteAll is true
+            if (deleteAll)
+            {
+                const std::vector<ALight*>& adapters = lightPool.GetAdapters();
+                for (unsigned int i = 0; (i < adapters.size()); i++)
+                {
+                    delete adapters[i];
+                }
+                lightPool.Clear();
+            }
+
+            logger->WriteTextAndNewLine(logID, "Light manager destroyed.");
+        }
+
+
+        virtual unsigned int AddLight(ALight* light)
+        {
+            // Adds the light to the pool, which reads it from now on
+            LightHandle handle = lightPool.AddAdapter(light);
+
+            // Creates message and logs it
+            std::string message = "Light #";
+            message += general::ToString(handle); message += " added.";
+            logger->WriteTextAndNewLine(logID, message);
+
+            // Returns the light's new ID
+            return handle;
+        }
+
+        /* Creates a light of the given type straight in the pool, returning its ID. Its values
+         * are set with GetLightPool(). */
+        virtual unsigned int CreateLight(LightType type)
+        {
+            LightHandle handle = lightPool.Create(type);
+
+            std::string message = "Light #";
+            message += general::ToString(handle); message += " created.";
+            logger->WriteTextAndNewLine(logID, message);
+
+            return handle;
+        }
+
+        virtual void RemoveLight(const unsigned int& lightID)
+        {
+            // Start of log message
+            std::string message = "Light #";
+            // If it finds the light, remove it
+            if (lightPool.Contains(lightID))
+            {
+                lightPool.Remove(lightID);
+                message += general::ToString(lightID); message += " removed.";
+                logger->WriteTextAndNewLine(logID, message);
+            }
+            // If it never found it
+            else
+            {
+                message += general::ToString(lightID); message += " doesn't exist. Cannot remove.";
+                logger->WriteTextAndNewLine(logID, message);
+            }
+        }
+
+
+        /* Must be implemented by subclasses. Enables and disables lighting. */
+        virtual void EnableLighting() = 0;
+        virtual void DisableLighting() = 0;
+
+        /* Updates the light's colour, positon and so on. Most likely called every frame. */
+        virtual void Update() = 0;
+
+        /* Called when the modelview matrix the lights are set up under changes. Managers
+         * that let the graphics API transform the lights need to send them again. */
+        virtual void InvalidateTransforms() {}
+
+        /* Managers that pick different lights for each object return true here, and renderers
+         * then call BindLightsFor() before drawing each object, with the modelview matrix the
+         * device loaded (before the object's own matrix is applied). 'object' identifies the
+         * object and 'bounds' is its box in world space. */
+        virtual bool SelectsLightsPerObject() { return false; }
+        virtual void BindLightsFor(const void* /*object*/, const maths::AABB& /*bounds*/) {}
+
+        LightPool& GetLightPool() { return lightPool; }
+        const LightPool& GetLightPool() const { return lightPool; }
+
+
+
+    };
+
+}
+
+}
+
+#endif
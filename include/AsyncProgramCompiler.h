@@ -0,0 +1,137 @@
+/*
+ * File:   AsyncProgramCompiler.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 2:30 AM
+ */
+
+#ifndef ASYNCPROGRAMCOMPILER_H
+#define ASYNCPROGRAMCOMPILER_H
+
+#include <vector>
+#include <deque>
+#include <windows.h>
+#include "Program.h"
+#include "ProgramCache.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Identifies a program given to an AsyncProgramCompiler. 0 is never a program. */
+    typedef unsigned int CompileHandle;
+
+    /* How far along a program given to an AsyncProgramCompiler is. */
+    enum CompileState
+    {
+        COMPILESTATE_PENDING,
+        COMPILESTATE_READY,
+        COMPILESTATE_FAILED
+    };
+
+    /* How an AsyncProgramCompiler compiles programs. */
+    enum CompileMode
+    {
+        COMPILEMODE_PARALLEL, // The driver compiles on its own threads (GL_KHR_parallel_shader_compile)
+        COMPILEMODE_WORKER, // A thread of the compiler's own, with a context shared with the render thread's
+        COMPILEMODE_BLOCKING // Neither was available, so programs are compiled as they're given
+    };
+
+
+    /* Compiles and links programs without stalling the render thread, so the first time an
+     * effect is drawn doesn't cause a hitch.
+     *
+     * Each program is given with a fallback program (something simple that's already linked),
+     * and the compiler hands back a handle for it. Renderers draw with GetProgram(handle),
+     * which is the fallback until the real program is ready, and the real one after that.
+     *
+     * With GL_KHR_parallel_shader_compile, the program's shaders are compiled and it's linked
+     * straight away, without reading their status, and the driver does the work on threads of
+     * its own. Update() asks the driver which programs are done, only reading the status of
+     * those, so nothing ever waits. Without the extension, a worker thread makes a context that
+     * shares objects with the render thread's and links every program there, while the render
+     * thread carries on. If that can't be made either, programs are linked as they're given.
+     *
+     * Programs are linked through the ProgramCache if there is one, so a program in the cache
+     * is ready as soon as it's given (with parallel compiling) or almost (with the worker).
+     *
+     * The compiler must be created and used on the render thread, while its context is
+     * current. Programs given to it aren't owned, and must not be used (or deleted) until
+     * they're ready or have failed. */
+    class AsyncProgramCompiler
+    {
+
+
+    private:
+
+        /* A program given to the compiler. */
+        struct Request
+        {
+            Program* program;
+            Program* fallback;
+            volatile LONG state; // A CompileState, set by the worker thread
+        };
+
+        CompileMode mode;
+        ProgramCache* cache; // Not owned, can be NULL
+
+        std::vector<Request*> requests; // Indexed by handle - 1
+        std::vector<Request*> linking; // Programs the driver's compiling, in parallel mode
+
+        // The worker thread, in worker mode
+        HANDLE workerThread;
+        HANDLE workEvent; // Signalled when requests are added to the queue (or the worker has to exit)
+        CRITICAL_SECTION queueLock; // Guards 'queue'
+        std::deque<Request*> queue; // Requests the worker hasn't started yet
+        HDC deviceContext; // The window's, which the worker makes its context current with
+        HGLRC workerContext; // Shares objects with the render thread's context
+        volatile LONG quit; // Set to 1 when the worker has to exit
+
+
+        /* Entry point of the worker thread. */
+        static DWORD WINAPI WorkerMain(void* parameter);
+        /* Creates the worker's context and thread, returning false if either can't be. */
+        bool StartWorker();
+        const Request* GetRequest(CompileHandle handle) const;
+
+
+    public:
+
+        /* Creates a compiler using parallel compiling if the driver supports it, a worker
+         * thread if not (unless 'allowWorker' is false) and blocking compiles if neither
+         * works. Programs are linked through 'programCache' if it isn't NULL. */
+        AsyncProgramCompiler(ProgramCache* programCache, bool allowWorker);
+        /* Waits for the worker to finish what it's doing and stops it. Programs that haven't
+         * been linked yet are left unlinked. */
+        ~AsyncProgramCompiler();
+
+        /* Starts compiling and linking a program, whose shaders have been added to it (they
+         * don't need to be compiled). Until it's ready, GetProgram() returns 'fallback'.
+         * Throws a NullPointerException if the program is NULL. */
+        CompileHandle Compile(Program* program, Program* fallback);
+
+        /* Finishes every program the driver is done compiling, in parallel mode. Must be
+         * called on the render thread, once a frame. */
+        void Update();
+
+        /* The state of a program. Throws an InvalidArgumentException if the handle's invalid. */
+        CompileState GetState(CompileHandle handle) const;
+        bool IsReady(CompileHandle handle) const { return (GetState(handle) == COMPILESTATE_READY); }
+        /* Returns the program to draw with: the real one once it's ready, the fallback until
+         * then (and forever, if it failed). */
+        Program* GetProgram(CompileHandle handle) const;
+
+        CompileMode GetMode() const { return mode; }
+        /* Amount of programs that aren't ready and haven't failed. */
+        unsigned int GetAmountPending() const;
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,200 @@
+/*
+ * File:   BoundingVolumeHierarchy.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 10:50 PM
+ * Added GetTotalBounds() on October 19, 2026, 5:05 AM
+ */
+
+#ifndef BOUNDINGVOLUMEHIERARCHY_H
+#define BOUNDINGVOLUMEHIERARCHY_H
+
+#include <vector>
+#include "Bounds.h"
+#include "RenderInterfaces.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Tree of bounding boxes over renderables, so questions like "what can the camera see",
+     * "what does this ray hit first" and "what's near this point" only have to look at the
+     * objects in the parts of the world they're about, instead of every object there is.
+     * It doesn't own the renderables and can be shared by renderers and game logic alike.
+     *
+     * Every object is a leaf of the tree, and every other node holds two children and the
+     * box around both. Objects can be inserted and removed at any time; each one is put
+     * next to whatever it makes the tree grow least with. Moving objects just have their
+     * box updated, and the boxes above them are fixed up (refitted) before the next query.
+     * After lots of changes the tree can get worse to search, so Rebuild() builds it again
+     * from scratch using the surface area heuristic (SAH), which splits objects where the
+     * chance of a query having to look at both halves is smallest.
+     *
+     * Queries don't go through the tree itself, but through a copy of it flattened into an
+     * array in depth-first order, so a node's first child is always right after it and
+     * skipping a node's children is just a jump forward in the array. The copy is made
+     * again on the first query after any change. */
+    class BoundingVolumeHierarchy
+    {
+
+
+    public:
+
+        // Identifies an object in the tree. Stays the same until the object is removed
+        typedef unsigned int ProxyID;
+
+        /* The closest object a ray's hit. The distance is where the ray enters the object's box,
+         * in multiples of the ray direction's length. */
+        struct RayHit
+        {
+            IRenderable* object;
+            ProxyID proxy;
+            float distance;
+        };
+
+
+    private:
+
+        static const int nullNode = -1;
+        static const unsigned int amountOfBins = 12; // Amount of places split along each axis when building
+
+        /* A node in the tree. Leaves have an object and no children. Nodes that aren't
+         * being used are kept in a list, linked by 'parent', so they can be used again. */
+        struct Node
+        {
+            maths::AABB bounds;
+            int parent, left, right;
+            IRenderable* object;
+            bool boundsFromRenderable; // True if added with InsertRenderable()
+        };
+
+        /* A node in the flattened copy. The first child is the next node in the array, and
+         * 'skip' is the node after all of this node's children. Leaves have an object. */
+        struct FlatNode
+        {
+            maths::AABB bounds;
+            unsigned int rightChild; // 0 for leaves, since no node's child can be the root
+            unsigned int skip;
+            IRenderable* object;
+            ProxyID proxy;
+        };
+
+        // Objects in a range being built, along with their box centres
+        struct BuildItem
+        {
+            int leaf;
+            maths::vector3f centre;
+        };
+
+        std::vector<Node> nodes;
+        int root;
+        int freeNodes; // First node in the list of ones that aren't used
+        unsigned int amountOfObjects;
+
+        std::vector<FlatNode> flatNodes;
+        bool layoutChanged; // True if nodes have been added or removed since flatNodes was made
+        bool boundsChanged; // True if a leaf's box has changed since the nodes above it were refitted
+
+        // Reused between calls so they don't have to allocate
+        std::vector<int> nodeStack;
+        std::vector<BuildItem> buildItems;
+
+
+        int AllocateNode();
+        void FreeNode(int node);
+
+        /* Puts a leaf into the tree next to the node it costs the least to put it next to. */
+        void InsertLeaf(int leaf);
+        /* Takes a leaf out of the tree, without freeing it. */
+        void RemoveLeaf(int leaf);
+        /* Recalculates the boxes of the node and every node above it. */
+        void RefitAncestors(int node);
+        /* Builds a subtree out of buildItems[first] to buildItems[last - 1], returning its root. */
+        int BuildRange(unsigned int first, unsigned int last);
+
+        /* Makes flatNodes from the tree, recalculating every node's box on the way. */
+        void Flatten();
+        /* Makes sure the flattened copy is up to date. */
+        void PrepareForQuery()
+        {
+            if (layoutChanged || boundsChanged) Flatten();
+        }
+
+        /* Checks that the proxy is for an object in the tree, throwing an exception if not. */
+        void CheckProxy(ProxyID proxy, const char* method) const;
+
+        /* Adds the world space positions of the renderable's vertices, and those of its
+         * children, to 'bounds'. */
+        static void AddRenderableBounds(IRenderable* renderable, const float* parentMatrix,
+            maths::AABB& bounds);
+
+
+    public:
+
+        BoundingVolumeHierarchy();
+
+        /* Adds an object with the given box, returning the ID used to update or remove it.
+         * Throws a NullPointerException if the object is NULL and an InvalidArgumentException
+         * if the box is empty. The same object can be added more than once. */
+        ProxyID Insert(IRenderable* object, const maths::AABB& bounds);
+        /* Adds a renderable with the box around its vertices (and those of its children) in
+         * world space. Throws an InvalidArgumentException if it has no vertices. */
+        ProxyID InsertRenderable(IRenderable* renderable);
+        /* Removes an object. Throws an InvalidArgumentException if the proxy isn't in the tree. */
+        void Remove(ProxyID proxy);
+        /* Removes everything. */
+        void Clear();
+
+        /* Gives an object a new box, for when it has moved. The boxes above it are only
+         * refitted at the next query (or call to Refit()), so moving lots of objects at once
+         * costs one pass over the tree. */
+        void Update(ProxyID proxy, const maths::AABB& bounds);
+        /* Updates the boxes of every object that was added with InsertRenderable(), working
+         * them out from the renderables' current vertices and matrices. */
+        void UpdateRenderables();
+        /* Refits every node's box to its children. Done automatically before queries. */
+        void Refit();
+        /* Builds the whole tree again using the surface area heuristic. Proxies stay the same. */
+        void Rebuild();
+
+
+        /* Queries. Each one clears 'results' and fills it with the objects found. */
+
+        // Objects whose boxes are at least partly inside the frustum
+        void QueryFrustum(const maths::Frustum& frustum, std::vector<IRenderable*>& results);
+        // Objects whose boxes overlap the given box
+        void QueryAABB(const maths::AABB& bounds, std::vector<IRenderable*>& results);
+        // Objects whose boxes overlap the sphere
+        void QuerySphere(const maths::vector3f& centre, float radius, std::vector<IRenderable*>& results);
+        /* Up to 'amount' objects whose boxes are closest to the point, closest first. Objects
+         * the point is inside are 0 away, and are given in no particular order. */
+        void QueryNearest(const maths::vector3f& point, unsigned int amount, std::vector<IRenderable*>& results);
+        /* Finds the object whose box the ray hits first, up to 'maxDistance' along the ray.
+         * Returns false if it doesn't hit anything. */
+        bool RayCast(const maths::Ray& ray, float maxDistance, RayHit& hit);
+
+
+        IRenderable* GetObject(ProxyID proxy) const;
+        const maths::AABB& GetBounds(ProxyID proxy) const;
+        unsigned int GetAmountOfObjects() const { return amountOfObjects; }
+        /* Box around every object in the tree, which is empty if there aren't any. */
+        maths::AABB GetTotalBounds();
+        /* Sum of the surface area of every node but the root, divided by the root's. This is
+         * how many nodes a random ray going through the root would be expected to have to
+         * test, so lower is better. Useful for deciding when to call Rebuild(). */
+        float GetCost();
+
+        /* Works out the box around a renderable's vertices, and those of its children, in
+         * world space. Returns false if there are no vertices. */
+        static bool ComputeWorldBounds(IRenderable* renderable, maths::AABB& bounds);
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,276 @@
+/*
+ * File:   Bounds.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 10:50 PM
+ */
+
+#ifndef BOUNDS_H
+#define BOUNDS_H
+
+#include <float.h>
+#include "Vector.h"
+
+namespace parcel
+{
+
+namespace maths
+{
+
+    /* Axis-aligned bounding box, stored as its minimum and maximum corners. A box with a
+     * minimum larger than its maximum is empty, which is what the default constructor
+     * makes, so points and other boxes can be added to it straight away. */
+    struct AABB
+    {
+
+        vector3f minimum, maximum;
+
+
+        AABB() : minimum(FLT_MAX, FLT_MAX, FLT_MAX), maximum(-FLT_MAX, -FLT_MAX, -FLT_MAX)
+        {
+        }
+
+        AABB(const vector3f& boxMinimum, const vector3f& boxMaximum) :
+            minimum(boxMinimum), maximum(boxMaximum)
+        {
+        }
+
+        bool IsEmpty() const
+        {
+            return (minimum.x > maximum.x) || (minimum.y > maximum.y) || (minimum.z > maximum.z);
+        }
+
+        /* Grows the box so it holds the given point or box. */
+        void Expand(const vector3f& point)
+        {
+            for (unsigned int i = 0; (i < 3); i++)
+            {
+                if (point.values[i] < minimum.values[i]) minimum.values[i] = point.values[i];
+                if (point.values[i] > maximum.values[i]) maximum.values[i] = point.values[i];
+            }
+        }
+        void Expand(const AABB& box)
+        {
+            for (unsigned int i = 0; (i < 3); i++)
+            {
+                if (box.minimum.values[i] < minimum.values[i]) minimum.values[i] = box.minimum.values[i];
+                if (box.maximum.values[i] > maximum.values[i]) maximum.values[i] = box.maximum.values[i];
+            }
+        }
+
+        /* Returns the smallest box holding both boxes. */
+        static AABB Union(const AABB& a, const AABB& b)
+        {
+            AABB result(a);
+            result.Expand(b);
+            return result;
+        }
+
+        vector3f GetCentre() const
+        {
+            return vector3f((minimum.x + maximum.x) * 0.5f, (minimum.y + maximum.y) * 0.5f,
+                (minimum.z + maximum.z) * 0.5f);
+        }
+
+        /* Surface area of the box, which is what the chance of a random ray hitting it goes up
+         * with. Empty boxes have an area of 0. */
+        float GetSurfaceArea() const
+        {
+            if (IsEmpty()) return 0.0f;
+            float x = maximum.x - minimum.x, y = maximum.y - minimum.y, z = maximum.z - minimum.z;
+            return 2.0f * ((x * y) + (y * z) + (z * x));
+        }
+
+        /* Returns true if the boxes touch or overlap. */
+        bool Overlaps(const AABB& box) const
+        {
+            return (minimum.x <= box.maximum.x) && (maximum.x >= box.minimum.x)
+                && (minimum.y <= box.maximum.y) && (maximum.y >= box.minimum.y)
+                && (minimum.z <= box.maximum.z) && (maximum.z >= box.minimum.z);
+        }
+
+        /* Returns true if the given box is completely inside this one. */
+        bool Contains(const AABB& box) const
+        {
+            return (box.minimum.x >= minimum.x) && (box.maximum.x <= maximum.x)
+                && (box.minimum.y >= minimum.y) && (box.maximum.y <= maximum.y)
+                && (box.minimum.z >= minimum.z) && (box.maximum.z <= maximum.z);
+        }
+
+        /* Returns the box around this box once it's been transformed by the given column-major
+         * matrix (which mustn't project). Empty boxes stay empty. */
+        AABB Transformed(const float* matrix) const
+        {
+            if (IsEmpty()) return *this;
+
+            // Starts at the translation, then adds the smallest and largest each axis can add to it
+            AABB result(vector3f(matrix[12], matrix[13], matrix[14]), vector3f(matrix[12], matrix[13], matrix[14]));
+            for (unsigned int column = 0; (column < 3); column++)
+            {
+                for (unsigned int row = 0; (row < 3); row++)
+                {
+                    float a = matrix[(column * 4) + row] * minimum.values[column];
+                    float b = matrix[(column * 4) + row] * maximum.values[column];
+                    result.minimum.values[row] += (a < b) ? a : b;
+                    result.maximum.values[row] += (a < b) ? b : a;
+                }
+            }
+            return result;
+        }
+
+        /* Returns where the box's centre ends up once it's been transformed by the given
+         * column-major matrix (which mustn't project). An empty box has no centre, so it gives
+         * the matrix's translation. */
+        vector3f GetTransformedCentre(const float* matrix) const
+        {
+            if (IsEmpty()) return vector3f(matrix[12], matrix[13], matrix[14]);
+
+            vector3f c = GetCentre();
+            return vector3f((matrix[0] * c.x) + (matrix[4] * c.y) + (matrix[8] * c.z) + matrix[12],
+                (matrix[1] * c.x) + (matrix[5] * c.y) + (matrix[9] * c.z) + matrix[13],
+                (matrix[2] * c.x) + (matrix[6] * c.y) + (matrix[10] * c.z) + matrix[14]);
+        }
+
+        /* Squared distance from the point to the closest point in the box, 0 if it's inside. */
+        float GetSqrDistanceTo(const vector3f& point) const
+        {
+            float sqrDistance = 0.0f;
+            for (unsigned int i = 0; (i < 3); i++)
+            {
+                float d = 0.0f;
+                if (point.values[i] < minimum.values[i]) d = minimum.values[i] - point.values[i];
+                else if (point.values[i] > maximum.values[i]) d = point.values[i] - maximum.values[i];
+                sqrDistance += d * d;
+            }
+            return sqrDistance;
+        }
+
+    };
+
+
+    /* Half-line starting at 'origin' and going in 'direction', which doesn't have to be
+     * normalised (distances along the ray are in multiples of its length). */
+    struct Ray
+    {
+
+        vector3f origin, direction;
+
+
+        Ray() {}
+        Ray(const vector3f& rayOrigin, const vector3f& rayDirection) :
+            origin(rayOrigin), direction(rayDirection)
+        {
+        }
+
+        /* Tests the ray against a box, only counting hits between 0 and 'maxDistance' along
+         * the ray. 'inverseDirection' is 1 divided by each component of the direction, which
+         * is passed in so it only has to be worked out once when testing lots of boxes.
+         * If it hits, 'distance' is set to where it enters the box (0 if it starts inside). */
+        bool Intersects(const AABB& box, const vector3f& inverseDirection, float maxDistance,
+            float& distance) const
+        {
+            float nearest = 0.0f, farthest = maxDistance;
+            for (unsigned int i = 0; (i < 3); i++)
+            {
+                // Distances to the two planes of the box along this axis (the slab method)
+                float t1 = (box.minimum.values[i] - origin.values[i]) * inverseDirection.values[i];
+                float t2 = (box.maximum.values[i] - origin.values[i]) * inverseDirection.values[i];
+                if (t1 > t2) { float t = t1; t1 = t2; t2 = t; }
+
+                if (t1 > nearest) nearest = t1;
+                if (t2 < farthest) farthest = t2;
+                if (nearest > farthest) return false;
+            }
+
+            distance = nearest;
+            return true;
+        }
+
+    };
+
+
+    /* What a Frustum::Classify() test found. */
+    enum Containment
+    {
+        CONTAINMENT_OUTSIDE,
+        CONTAINMENT_INTERSECTING,
+        CONTAINMENT_INSIDE
+    };
+
+    /* The six planes of a camera's view volume, used for working out what can be seen. */
+    class Frustum
+    {
+
+
+    private:
+
+        /* Planes in the form ax + by + cz + d = 0, with the normal (a, b, c) pointing into
+         * the frustum, in the order left, right, bottom, top, near, far. */
+        float planes[6][4];
+
+
+    public:
+
+        Frustum()
+        {
+            for (unsigned int i = 0; (i < 6); i++)
+            {
+                planes[i][0] = planes[i][1] = planes[i][2] = planes[i][3] = 0.0f;
+            }
+        }
+
+        /* Gets the planes from a projection matrix multiplied by a view matrix, stored in
+         * column-major order. The planes end up in world space (or whatever space the view
+         * matrix transforms from); given just a projection matrix, they're in view space. */
+        void ExtractFromMatrix(const float* m)
+        {
+            for (unsigned int i = 0; (i < 3); i++)
+            {
+                // Each pair of planes is the matrix's last row plus and minus one of the others
+                for (unsigned int j = 0; (j < 4); j++)
+                {
+                    planes[i * 2][j] = m[(j * 4) + 3] + m[(j * 4) + i];
+                    planes[(i * 2) + 1][j] = m[(j * 4) + 3] - m[(j * 4) + i];
+                }
+            }
+        }
+
+        /* Returns whether the box is completely outside the frustum, completely inside it
+         * or crossing one of its planes. Boxes close to the frustum's corners can be said to
+         * be intersecting when they're actually outside, which only costs a bit of time. */
+        Containment Classify(const AABB& box) const
+        {
+            Containment result = CONTAINMENT_INSIDE;
+            for (unsigned int i = 0; (i < 6); i++)
+            {
+                const float* plane = planes[i];
+                // The corners of the box furthest along and furthest against the plane's normal
+                float farthest = plane[3], nearest = plane[3];
+                for (unsigned int j = 0; (j < 3); j++)
+                {
+                    if (plane[j] > 0.0f)
+                    {
+                        farthest += plane[j] * box.maximum.values[j];
+                        nearest += plane[j] * box.minimum.values[j];
+                    }
+                    else
+                    {
+                        farthest += plane[j] * box.minimum.values[j];
+                        nearest += plane[j] * box.maximum.values[j];
+                    }
+                }
+
+                if (farthest < 0.0f) return CONTAINMENT_OUTSIDE;
+                if (nearest < 0.0f) result = CONTAINMENT_INTERSECTING;
+            }
+            return result;
+        }
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,115 @@
+/*
+ * File:   ClusteredLighting.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 11:30 PM
+ */
+
+#ifndef CLUSTEREDLIGHTING_H
+#define CLUSTEREDLIGHTING_H
+
+#include "ALighting.h"
+#include "LightClusters.h"
+#include "RenderDevice.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Lighting manager for shaders, which has no limit on the amount of lights.
+     *
+     * Every frame, the lights are moved into view space and binned into the clusters of a
+     * LightClusterGrid built from the device's 3D projection. The lights and the list of
+     * lights in every cluster are then uploaded into a buffer texture, which the fragment
+     * shader reads to light each pixel with only the lights in its cluster. Lighting costs
+     * as much as the amount of lights actually reaching each pixel, not the amount in the
+     * scene. Directional lights, and lights whose attenuation never drops off, reach every
+     * cluster, so they're kept in a separate list that every pixel goes through.
+     *
+     * This lights nothing by itself; it's read by shaders such as the ones in
+     * shaders/ClusteredLighting.vert and shaders/ClusteredLighting.frag, which describe the
+     * layout of the buffer. Give it to a ShaderRenderer with ShaderRenderer::SetLighting()
+     * and to the device with RenderDevice::SetLighting(), which calls Update() at the start
+     * of every frame. Needs texture buffer support (GL_ARB_texture_buffer_object). */
+    class ClusteredLighting : public ALighting
+    {
+
+
+    private:
+
+        // Sizes of the different parts of the light data, in texels (four floats each)
+        static const unsigned int headerTexels = 4;
+        static const unsigned int texelsPerLight = 6;
+
+        RenderDevice* renderDevice; // Gives the camera and the size of the scene on screen
+        IRenderBackend* backend; // Used for uploading and binding the light data
+        general::ThreadPool* threadPool; // Lights are binned across this, can be NULL
+
+        LightClusterGrid grid;
+        bool clustered; // False if the 3D projection isn't a perspective one, then every light is global
+        float projection[16]; // Projection the grid was last set up for
+
+        unsigned int bufferID; // Buffer the light data is uploaded to
+        unsigned int textureID; // Buffer texture the shaders read the light data through
+
+        bool enabled;
+        colourf globalAmbient;
+        float attenuationThreshold; // Attenuation below which a light is treated as having no effect
+
+        /* Rebuilt every frame. Global and clustered lights are packed separately, since the
+         * global ones come first in the buffer. */
+        std::vector<float> globalLights, localLights;
+        std::vector<ClusterLight> clusterLights; // Spheres of the clustered lights, in the same order
+        std::vector<float> lightData; // Everything uploaded
+
+        /* Packs the values of the light at 'index' in the pool onto the end of 'packed', with
+         * its position and direction already in view space. */
+        void PackLight(std::vector<float>& packed, unsigned int index, const float* position,
+            const float* direction, float range);
+        /* Sets the grid up for the device's current projection, if it's changed. */
+        void UpdateProjection();
+
+
+    public:
+
+        /* Creates the buffer the lights are uploaded to. 'pool' can be NULL. Throws a
+         * GLExtensionUnavailableException if texture buffers aren't supported. */
+        ClusteredLighting(RenderDevice* device, general::ThreadPool* pool, debug::Logger* log,
+            const ClusterGridSettings& gridSettings, const bool& willDeleteAll);
+        ~ClusteredLighting();
+
+        /* Lighting is turned on and off by a flag in the light data, since there's no
+         * graphics API state for shader lighting. */
+        void EnableLighting() { enabled = true; }
+        void DisableLighting() { enabled = false; }
+
+        /* Bins the lights using the device's current view and projection matrices, then
+         * uploads them. */
+        void Update();
+
+        /* Binds the light data's buffer texture to the given texture unit. */
+        void Bind(unsigned int unit);
+
+        void SetGlobalAmbientColour(const colourf& colour) { globalAmbient = colour; }
+        /* Lights stop reaching a point once their attenuation is below this (1/256 by
+         * default), which is what decides how many clusters they're binned into. */
+        void SetAttenuationThreshold(float threshold) { attenuationThreshold = threshold; }
+        const LightClusterGrid& GetGrid() const { return grid; }
+        /* Amount of lights that were put in the global list by the last Update(). */
+        unsigned int GetAmountOfGlobalLights() const { return globalLights.size() / (texelsPerLight * 4); }
+        unsigned int GetAmountOfClusteredLights() const { return clusterLights.size(); }
+
+        /* Returns the distance at which a light with the given attenuation drops to the
+         * threshold, or a negative number if it never does. */
+        static float GetLightRange(float constant, float linear, float quadratic, float threshold);
+
+
+    };
+
+}
+
+}
+
+#endif
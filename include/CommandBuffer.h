@@ -0,0 +1,115 @@
+/*
+ * File:   CommandBuffer.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 11:05 AM
+ */
+
+#ifndef COMMANDBUFFER_H
+#define COMMANDBUFFER_H
+
+#include <string>
+#include "LinearAllocator.h"
+#include "Primitives.h"
+#include "Vertex.h"
+#include "Skin.h"
+#include "Program.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    // Forward declarations, the command buffer only stores pointers to these
+    class RenderDevice;
+
+
+    /* Stores a list of render commands (bind skin, set matrix, draw a range and so on)
+     * so they can be recorded on any thread and replayed against the graphics API later
+     * on the thread that owns the context.
+     *
+     * Commands are written into a LinearAllocator given to Begin(), so recording never
+     * allocates and never locks. As long as every thread records into its own allocator,
+     * any amount of command buffers can be recorded at the same time. The allocator
+     * must not be reset until the buffer has been submitted.
+     *
+     * If the allocator runs out of space, the buffer is marked as overflowed and stops
+     * recording. An overflowed buffer is incomplete, so it should be recorded again
+     * (after resetting the allocator, which grows it) instead of being submitted.
+     *
+     * Strings and programs given to the record methods are stored as pointers, so they
+     * must stay alive (and unchanged) until the buffer has been submitted. */
+    class CommandBuffer
+    {
+
+
+    private:
+
+        general::LinearAllocator* allocator; // Where the commands are written to
+        char* start; // Address of the first command
+        unsigned int size; // Amount of bytes taken up by all the commands
+        unsigned int commandCount; // Amount of commands recorded
+        bool recording; // True between Begin() and End()
+        bool overflowed; // True if the allocator ran out of space while recording
+
+        /* Used to skip recording a skin change if the previous one set the same skin. */
+        SkinHandle lastSkin;
+
+
+        /* Allocates a command with the given size and type. Returns NULL if it cannot
+         * be allocated, in which case nothing should be written. */
+        void* AllocateCommand(unsigned int commandSize, unsigned int type);
+
+
+    public:
+
+        CommandBuffer();
+
+        /* Starts recording commands into the given allocator. Any commands recorded
+         * before are forgotten. */
+        void Begin(general::LinearAllocator* commandAllocator);
+        /* Stops recording. Must be called before Submit(). */
+        void End();
+
+        /* Recording methods. Each one returns false if the command could not be
+         * recorded because the allocator is full.
+         *
+         * BindGeometry() binds the given data and index buffers (index buffer can be 0)
+         * and points the vertex arrays at the data buffer using the given layout.
+         * SetSkin() activates the skin with the given handle in the RenderDevice.
+         * PushMatrix() stores the current modelview matrix and multiplies it by the
+         * given matrix (16 floats, column-major). PopMatrix() restores it again.
+         * DrawArrays() draws 'amount' vertices from the bound data buffer.
+         * DrawElements() draws 'amount' indices from the bound index buffer.
+         * SetUniform() sets a float uniform (or array of floats) in a program. The name is
+         * looked up when the command is recorded (throwing an InvalidArgumentException if the
+         * program doesn't have it), so submitting only costs the one GL call. */
+        bool BindGeometry(unsigned int dataBuffer, unsigned int indexBuffer, VertexLayout layout);
+        bool SetSkin(SkinHandle skin);
+        bool PushMatrix(const float* matrix);
+        bool PopMatrix();
+        bool DrawArrays(PrimitiveType type, unsigned int start, unsigned int amount);
+        bool DrawElements(unsigned int start, unsigned int amount);
+        bool SetUniform(Program* program, const std::string& varName,
+            const float* values, unsigned int amount);
+        bool SetUniform(Program* program, UniformLocation location,
+            const float* values, unsigned int amount);
+
+        /* Replays every recorded command. MUST be called on the thread that owns the
+         * graphics context. */
+        void Submit(RenderDevice* renderDevice) const;
+
+        /* Getters. */
+        unsigned int GetCommandCount() const { return commandCount; }
+        unsigned int GetSize() const { return size; }
+        bool HasOverflowed() const { return overflowed; }
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * File:   CommandRecorder.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 12:10 PM
+ */
+
+#ifndef COMMANDRECORDER_H
+#define COMMANDRECORDER_H
+
+#include <vector>
+#include "ThreadPool.h"
+#include "LinearAllocator.h"
+#include "CommandBuffer.h"
+#include "ARenderer.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Records the commands of a list of renderers on every thread of a thread pool,
+     * and then submits them all on the graphics thread in the same order they would
+     * have been rendered in.
+     *
+     * Every renderer's renderables are split into chunks of 'chunkSize' renderables.
+     * Each chunk is recorded into its own CommandBuffer, using the linear allocator of
+     * whatever thread picked the chunk up, so threads never share memory while
+     * recording. Renderers must have been updated (ARenderer::Update()) before they
+     * are recorded, since Update() creates the buffer objects on the graphics thread.
+     *
+     * Usage per frame:
+     *     recorder.Record(renderers); // can be done while the previous frame is on the GPU
+     *     recorder.Submit(renderDevice); // graphics thread only */
+    class CommandRecorder : public general::ITask
+    {
+
+
+    private:
+
+        /* A range of a renderer's renderables and the commands recorded for it. */
+        struct Job
+        {
+            ARenderer* renderer;
+            unsigned int first, last;
+            CommandBuffer buffer;
+        };
+
+        general::ThreadPool* threadPool; // Pool that records the jobs
+        unsigned int chunkSize; // Maximum amount of renderables recorded by one job
+        std::vector<general::LinearAllocator*> allocators; // One per thread in the pool
+        /* Used when re-recording jobs whose thread's allocator ran out of space. */
+        general::LinearAllocator* fallbackAllocator;
+        std::vector<Job> jobs; // Jobs from the last call to Record()
+
+        /* Copying would make two recorders own the same allocators. */
+        CommandRecorder(const CommandRecorder& recorder);
+        CommandRecorder& operator=(const CommandRecorder& recorder);
+
+
+    public:
+
+        /* Creates a linear allocator of 'allocatorSize' bytes for every thread in the pool.
+         * The allocators grow by themselves if a frame's commands do not fit. */
+        CommandRecorder(general::ThreadPool* pool, unsigned int renderablesPerChunk = 64,
+            unsigned int allocatorSize = 65536);
+        ~CommandRecorder();
+
+        /* Records the commands of all the given renderers using the thread pool. Commands
+         * recorded by the previous call are thrown away. */
+        void Record(const std::vector<ARenderer*>& renderers);
+        /* Replays every recorded command buffer in order. MUST be called on the thread
+         * that owns the graphics context. */
+        void Submit(RenderDevice* renderDevice);
+
+        /* Records a single job. Called by the thread pool. */
+        void Execute(unsigned int index, unsigned int threadIndex);
+
+        /* Getters. */
+        unsigned int GetAmountOfJobs() const { return jobs.size(); }
+        unsigned int GetChunkSize() const { return chunkSize; }
+
+
+    };
+
+}
+
+}
+
+#endif
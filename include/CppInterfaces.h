@@ -1,10 +1,10 @@
-/*
- * File:   CppInterfaces.h
- * Author: Donald "Datriot" Whyte
- *
- * Created on February 20, 2009, 10:31 AM
- */
-
-#define interface class
-
-#define implements public
+/*
+ * File:   CppInterfaces.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on February 20, 2009, 10:31 AM
+ */
+
+#define interface class
+
+#define implements public
@@ -0,0 +1,91 @@
+/*
+ * File:   DynamicResolution.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 10:30 PM
+ * Changed to average the cost per pixel of frames drawn at any scale on October 19, 2026, 4:50 AM
+ */
+
+#ifndef DYNAMICRESOLUTION_H
+#define DYNAMICRESOLUTION_H
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Settings for a DynamicResolution controller. Scales are the fraction of the native
+     * resolution the scene is rendered at along each axis, so a scale of 0.5 renders a
+     * quarter of the pixels. Times are in milliseconds. */
+    struct DynamicResolutionSettings
+    {
+        float minScale, maxScale; // Bounds the scale is kept between
+        float targetFrameTime; // Frame time the controller tries to stay under
+        /* How far under the target the frame time has to be before the scale goes back up,
+         * as a fraction of the target. Stops the scale going up and down every frame. */
+        float headroom;
+        float maxIncrease; // Largest fraction the scale can go up by in one frame
+        // Weight of the newest frame time in the moving average (between 0 and 1)
+        float smoothing;
+
+        /* Defaults to rendering between half and full resolution, aiming for 60 FPS. */
+        DynamicResolutionSettings() :
+            minScale(0.5f), maxScale(1.0f), targetFrameTime(16.6f), headroom(0.15f),
+            maxIncrease(0.05f), smoothing(0.1f)
+        {
+        }
+    };
+
+
+    /* Decides what resolution the 3D scene should be rendered at, so frames keep taking
+     * less time than the target. It's given the CPU and GPU time of every frame, and
+     * changes the scale based on the average of the slower of the two. Each time is
+     * scaled to what it would have been at full resolution before it's averaged, so the
+     * average isn't thrown off by frames that were drawn at a different scale.
+     *
+     * The time it takes to fill pixels goes up with the square of the scale, so when
+     * frames are too slow the scale is dropped straight to what should bring them back to
+     * the target. When they have enough headroom, it goes back up slowly, so a single
+     * quick frame doesn't cause it to overshoot. */
+    class DynamicResolution
+    {
+
+
+    private:
+
+        DynamicResolutionSettings settings;
+        float scale; // Current scale
+        /* Moving average of what frames would take at a scale of 1, which is every frame's
+         * time divided by the square of the scale it was rendered at. 0 before the first frame. */
+        float averageCost;
+
+
+    public:
+
+        /* Throws an InvalidArgumentException if the settings don't make sense. */
+        DynamicResolution(const DynamicResolutionSettings& initialSettings);
+
+        /* Adds the times the last frame took, changing the scale if needed. The CPU time is
+         * for the frame drawn at the current scale. The GPU time can be from an earlier frame
+         * (timer query results come in late), so it's given with the scale that frame was drawn
+         * at. 'gpuTime' can be negative if it isn't known (when there's no timer query result
+         * yet, for instance), in which case only the CPU time is used. */
+        void AddFrameTime(float cpuTime, float gpuTime, float gpuScale);
+        /* Goes back to the maximum scale and forgets the frame times. */
+        void Reset();
+
+        void SetSettings(const DynamicResolutionSettings& newSettings);
+        const DynamicResolutionSettings& GetSettings() const { return settings; }
+        float GetScale() const { return scale; }
+        /* Average frame time at the current scale. */
+        float GetAverageFrameTime() const { return averageCost * scale * scale; }
+
+
+    };
+
+}
+
+}
+
+#endif
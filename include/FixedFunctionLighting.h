@@ -1,73 +1,184 @@
- /*
- * File:   FixedFunctionLighting.h
- * Author: Donald "Datriot" Whyte
- *
- * Created on February 24, 2009, 9:45 AM
- */
-
-#ifndef FIXEDFUNCTIONLIGHTING_H
-#define FIXEDFUNCTIONLIGHTING_H
-
-#include "ALight.h"
-#include "ALighting.h"
-#include "Logger.h"
-
-namespace parcel
-{
-
-namespace graphics
-{
-
-    /* This class manages all the lights for fixed function OpenGL lighting. Global light settings
-     * such as two sided lighting, global ambient light and so on can be set here as well. */
-    class FixedFunctionLighting : public ALighting
-    {
-
-
-    private:
-
-        colourf globalAmbient; // The  colour of the global ambient light of the scene
-        bool twoSidedLighting;// If true, the back faces of the geometry is lit corretly as well
-        bool useLocalViewer; // If true, lighting caclulatuions are based on the camera and not globally to increase quality
-        bool generateNormals; // If true, this class enables OpenGL to generate normals for lighting
-
-
-        /* Called before updating to disable all the lights before updating them.
-         * This is done to make sure that any lights removed from the manager
-         * are safely disabled without complications. */
-        void DisableAllGLLights();
-
-
-    public:
-
-        /* The constructor takes a boolean that determines which state the
-         * light manager will start it; enabled or disabled. */
-        FixedFunctionLighting(debug::Logger* log, const bool& enabled, const bool& willDeleteAll);
-        /* Disables lighting for being destroyed. Also */
-        ~FixedFunctionLighting();
-
-
-        /* Enables and disables lighting in a scene respectively. */
-        void EnableLighting();
-        void DisableLighting();
-
-
-        /* This is best being called every frame. Activates and updates all the lights
-         * stored in the array with the graphics API. */
-        void Update();
-
-
-        // Sets various properties of the light manager
-        void SetGlobalAmbientColour(const colourf& colour);
-        void SetTwoSidedLighting(const bool& twoSided);
-        void SetUseLocalViewer(const bool& localViewer);
-        void SetGenerateNormals(const bool& genNorms);
-
-
-    };
-
-}
-
-}
-
-#endif
+ /*
+ * File:   FixedFunctionLighting.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on February 24, 2009, 9:45 AM
+ * Changed to use an IRenderBackend on October 18, 2026, 4:30 PM
+ * Changed to only upload lights that have changed on October 18, 2026, 11:50 PM
+ * Added per-object light selection on October 19, 2026, 12:05 AM
+ * Added ambient light from light probes on October 19, 2026, 12:35 AM
+ * Changed to read the lights from a LightPool on October 19, 2026, 1:05 AM
+ */
+
+#ifndef FIXEDFUNCTIONLIGHTING_H
+#define FIXEDFUNCTIONLIGHTING_H
+
+#include "ALight.h"
+#include "ALighting.h"
+#include "LightSelector.h"
+#include "LightProbeSampler.h"
+#include "Logger.h"
+#include "RenderBackend.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* This class manages all the lights for fixed function OpenGL lighting. Global light settings
+     * such as two sided lighting, global ambient light and so on can be set here as well.
+     *
+     * Only what's changed is sent to the graphics API. The manager keeps a copy of what it
+     * last uploaded into every light slot, along with the version (in the LightPool) of the
+     * light it came from. A light that hasn't changed since is skipped; the rest are read
+     * from the pool's arrays again and only the parameters that differ from the copy are set. The global model is only set after one of its setters
+     * has changed it. Light positions and spotlight directions are transformed by the
+     * modelview matrix when they're set, so InvalidateTransforms() has to be called when
+     * that changes (RenderDevice does this), which sends them all again.
+     *
+     * Normally the first lights added are the ones used, as many as the graphics API has.
+     * Given a LightSelector, every object is lit by the lights that affect it most instead:
+     * Update() just updates the selector, and the lights are bound by BindLightsFor() as
+     * each object is drawn. Lights already in a slot are kept in it, so objects near each
+     * other that pick the same lights don't cause any uploads.
+     *
+     * Given a LightProbeSampler, objects it has probe lighting for are drawn with the average
+     * of their probes as the global ambient colour instead, which is set by BindLightsFor()
+     * too (only when it's different from the last object's). */
+    class FixedFunctionLighting : public ALighting
+    {
+
+
+    private:
+
+        /* Everything set in the graphics API for one light. */
+        struct LightState
+        {
+            LightType type;
+            float ambient[4], diffuse[4], specular[4];
+            float position[4]; // Direction for directional lights, with the fourth float 0
+            float attenuation[3]; // Constant, linear and quadratic
+            float spotDirection[3];
+            float spotCutoff, spotExponent; // Cutoff is 180 for lights that aren't spotlights
+        };
+
+        /* What the manager knows about one of the graphics API's lights. */
+        struct LightSlot
+        {
+            LightHandle light; // Light last uploaded into this slot, 0 if none
+            unsigned int version; // The light's version when it was uploaded
+            bool dirty; // If true, the slot is read and compared again whatever the light's version
+            bool enabled, enabledKnown; // Whether the slot is enabled in the graphics API
+            bool stateKnown; // False until 'state' is what's really in the graphics API
+            bool transformsKnown; // False if the position and spotlight direction have to be sent again
+            LightState state;
+        };
+
+        IRenderBackend* backend; // Used to set up the lights in the graphics API
+
+        colourf globalAmbient; // The  colour of the global ambient light of the scene
+        bool twoSidedLighting;// If true, the back faces of the geometry is lit corretly as well
+        bool useLocalViewer; // If true, lighting caclulatuions are based on the camera and not globally to increase quality
+        bool generateNormals; // If true, this class enables OpenGL to generate normals for lighting
+        bool modelDirty; // True if the global model has changed since it was last set
+        unsigned int modelVersion; // Goes up every time the global model changes
+
+        /* One slot for every light the graphics API has. The amount is asked for on the first
+         * update, since the graphics API might not be ready when the manager is created. */
+        std::vector<LightSlot> slots;
+        bool slotsCreated;
+
+        LightSelector* selector; // Picks the lights for each object, NULL to use the first lights
+        std::vector<int> slotLights; // Index of the light going into each slot (-1 for none), reused by BindLightsFor()
+
+        LightProbeSampler* probeSampler; // Gives objects their ambient colour, NULL to use the global one
+        colourf appliedAmbient; // Ambient colour last set in the graphics API
+
+        // Counters since the last call to Update()
+        unsigned int lightCalls; // Calls made to the backend's light functions
+        unsigned int lightsUploaded; // Slots that had to be read and compared again
+
+
+        /* Reads the values of the light at 'index' in the pool into 'state', starting from
+         * what's in its slot. */
+        void ReadLight(unsigned int index, const LightState& previous, bool previousKnown, LightState& state);
+        /* Sends the parts of 'state' that differ from what's in the slot to the graphics API. */
+        void UploadLight(unsigned int index, const LightState& state);
+        /* Puts the light at 'lightIndex' in the pool into the slot, reading and uploading it if
+         * it's changed since it was last there, or disables the slot if the index is -1. */
+        void SetSlotLight(unsigned int index, int lightIndex);
+        /* Enables or disables the light in the graphics API if it isn't already. */
+        void SetLightEnabled(unsigned int index, bool enabled);
+        // Marks the global model as changed
+        void ModelChanged();
+        /* Sets the global model with the given ambient colour, if that isn't what's already set. */
+        void ApplyAmbient(const colourf& ambient);
+
+
+    public:
+
+        /* The constructor takes a boolean that determines which state the
+         * light manager will start it; enabled or disabled. The lights are
+         * set using the given backend. */
+        FixedFunctionLighting(IRenderBackend* renderBackend, debug::Logger* log,
+            const bool& enabled, const bool& willDeleteAll);
+        /* Disables lighting for being destroyed. Also */
+        ~FixedFunctionLighting();
+
+
+        /* Enables and disables lighting in a scene respectively. */
+        void EnableLighting();
+        void DisableLighting();
+
+
+        /* This is best being called every frame. Activates and updates the lights stored
+         * in the pool with the graphics API, skipping the ones that haven't changed. */
+        void Update();
+
+        /* Makes the manager pick the lights for every object with 'lightSelector', which isn't
+         * owned by the manager. NULL goes back to using the first lights added. */
+        void SetLightSelector(LightSelector* lightSelector);
+        LightSelector* GetLightSelector() { return selector; }
+        /* Makes objects the sampler has probe lighting for use it as their ambient colour. The
+         * sampler isn't owned by the manager, and is updated by whoever moves the objects. NULL
+         * goes back to the global ambient colour for everything. */
+        void SetProbeSampler(LightProbeSampler* sampler);
+        LightProbeSampler* GetProbeSampler() { return probeSampler; }
+        bool SelectsLightsPerObject() { return (selector != NULL) || (probeSampler != NULL); }
+        /* Binds the lights the selector picks for the object and sets its ambient colour from the
+         * probe sampler. Does nothing without either. */
+        void BindLightsFor(const void* object, const maths::AABB& bounds);
+
+        /* Lights after the one removed move down a slot, so every slot is checked again. */
+        void RemoveLight(const unsigned int& lightID);
+        /* Sends every light's position and direction again on the next update. */
+        void InvalidateTransforms();
+        /* Forgets everything that's been uploaded, so the next update reads every light
+         * and sets everything again. Call this if the lights were changed behind the
+         * manager's back. */
+        void InvalidateLights();
+
+
+        // Sets various properties of the light manager
+        void SetGlobalAmbientColour(const colourf& colour);
+        void SetTwoSidedLighting(const bool& twoSided);
+        void SetUseLocalViewer(const bool& localViewer);
+        void SetGenerateNormals(const bool& genNorms);
+
+        unsigned int GetModelVersion() const { return modelVersion; }
+        /* Amount of calls made to the backend's light functions (setting the model or a light
+         * parameter, or enabling or disabling a light) since the last call to Update() started,
+         * which includes binding the lights for every object drawn since. */
+        unsigned int GetLightCalls() const { return lightCalls; }
+        /* Amount of lights read again since the last call to Update() started. */
+        unsigned int GetLightsUploaded() const { return lightsUploaded; }
+
+
+    };
+
+}
+
+}
+
+#endif
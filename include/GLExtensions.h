@@ -0,0 +1,78 @@
+/*
+ * File:   GLExtensions.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 3:50 AM
+ * Added program binaries on October 19, 2026, 4:05 AM
+ * Added parallel shader compiling on October 19, 2026, 4:20 AM
+ */
+
+#ifndef GLEXTENSIONS_H
+#define GLEXTENSIONS_H
+
+#include <GLee.h>
+
+/* Tokens for extensions that GLee doesn't know about. These are the values from the
+ * OpenGL registry, so they're only defined if the GL headers haven't already. */
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED 0x88BF
+#endif
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+#ifndef GL_PROGRAM_BINARY_LENGTH
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Types of the extension functions that have to be loaded by hand. */
+    typedef void (APIENTRY *GetQueryObjectui64vFunction)(GLuint id, GLenum pname, UINT64* params);
+    typedef void (APIENTRY *GetProgramBinaryFunction)(GLuint program, GLsizei bufSize, GLsizei* length,
+        GLenum* binaryFormat, void* binary);
+    typedef void (APIENTRY *ProgramBinaryFunction)(GLuint program, GLenum binaryFormat, const void* binary,
+        GLsizei length);
+    typedef void (APIENTRY *ProgramParameteriFunction)(GLuint program, GLenum pname, GLint value);
+    typedef void (APIENTRY *MaxShaderCompilerThreadsFunction)(GLuint count);
+
+    /* Extensions that GLee doesn't load, which are looked up from the driver instead. The
+     * function pointers are NULL if the driver doesn't support the extension they belong to,
+     * so the flag should be checked before calling them. */
+    struct GLExtensions
+    {
+        bool timerQuery; // GL_ARB_timer_query
+        GetQueryObjectui64vFunction getQueryObjectui64v;
+
+        bool programBinaries; // GL_ARB_get_program_binary
+        GetProgramBinaryFunction getProgramBinary;
+        ProgramBinaryFunction programBinary;
+        ProgramParameteriFunction programParameteri;
+
+        bool parallelShaderCompile; // GL_KHR_parallel_shader_compile (or the ARB version, which is the same)
+        MaxShaderCompilerThreadsFunction maxShaderCompilerThreads;
+    };
+
+    /* Returns true if the current OpenGL context supports the extension with the given
+     * name (e.g. "GL_ARB_timer_query"). */
+    bool IsExtensionSupported(const char* name);
+
+    /* Returns the address of the extension function with the given name, or NULL if the
+     * driver doesn't have it. */
+    void* GetExtensionFunction(const char* name);
+
+    /* Returns the extensions GLee doesn't load. They're looked up the first time this is
+     * called, so an OpenGL context must be current on the calling thread by then. */
+    const GLExtensions& GetGLExtensions();
+
+}
+
+}
+
+#endif
@@ -1,76 +1,114 @@
-/*
- * File:   IndexedVBORenderer.h
- * Author: Donald "Datriot" Whyte
- *
- * Created on March 28, 2009, 10:02 AM
- */
-
-#ifndef INDEXEDVBORENDERER_H
-#define INDEXEDVBORENDERER_H
-
-#include <GLee.h>
-#include "ARenderer.h"
-#include "RenderDevice.h"
-#include "Util.h"
-
-namespace parcel
-{
-
-    namespace graphics
-    {
-
-        /* This is a lot like VBORenderer, except it has holds a normal data VBO and
-         * an element VBO, which holds the indexes to the data. This can be used for
-         * 3D models and other objects that use triangle/face lists to save memory
-         * wastage on reused vertices. */
-        class IndexedVBORenderer : public ARenderer
-        {
-
-
-        private:
-
-            /* IDs to the data and index (element) vertex buffer objects. */
-            GLuint dataVBO, indexVBO;
-
-            float* vboData; // Used to store a pointer to the data VBO
-            int* indexVBOData; // Used to store a pointer to the index VBO
-
-            /* Used to store every renderable's start and end indices for the INDEX VBO.
-             * This is unlike the standard VBORenderer, which stores indices to render
-             * the raw data by itself. This one, however, stores the indices in the ELEMENT
-             * array, wich holds indices for the vertex data. arrayIndices is used with
-             * glDrawElements. */
-            std::vector<general::ArrayIndices> arrayIndices;
-
-            RenderDevice* renderDevice; // Used for activating a renderable's skin and texture
-
-
-            /* Processes one renderable, adding its data to the VBO.
-             * It takes in both VBO's current index and the number of vertices
-             * and faces already processed. */
-            void ProcessRenderable(IRenderable* renderable, unsigned int& dataVBOIndex,
-                unsigned int& elementVBOIndex, unsigned int& triangleNumber);
-            /* Renders a single object by calling glDrawArrays/glDrawElements, activating the
-             * skin and transforming objects by their matrix. */
-            void RenderObject(IRenderable* renderable, unsigned int& index);
-
-
-        public:
-
-            /* Initialises properties and creates two blank VBOs. */
-            IndexedVBORenderer(RenderDevice* renderDevice, debug::Logger* log, const bool& willDeleteAll);
-            /* Destructor, deletes both VBOs. */
-            ~IndexedVBORenderer();
-
-            /* Updates both the data and index VBOs as well as the arrayIndices vector. */
-            void Update();
-            /* This binds both VBOs and renders every renderable in the list. */
-            void Render();
-
-
-        };
-
-    }
-
-}
-#endif
+/*
+ * File:   IndexedVBORenderer.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on March 28, 2009, 10:02 AM
+ * Changed to draw opaque objects first and sort translucent ones on October 19, 2026, 4:40 AM
+ */
+
+#ifndef INDEXEDVBORENDERER_H
+#define INDEXEDVBORENDERER_H
+
+#include "ARenderer.h"
+#include "RenderDevice.h"
+#include "Util.h"
+#include "RadixSort.h"
+#include "Bounds.h"
+
+namespace parcel
+{
+
+    namespace graphics
+    {
+
+        /* This is a lot like VBORenderer, except it has holds a normal data VBO and
+         * an element VBO, which holds the indexes to the data. This can be used for
+         * 3D models and other objects that use triangle/face lists to save memory
+         * wastage on reused vertices.
+         *
+         * Like VBORenderer, Render() draws objects with opaque skins first, in the order
+         * they're stored and with blending turned off, then objects with translucent skins
+         * with blending, sorted from back to front by the view space depth of the centre of
+         * their vertices. */
+        class IndexedVBORenderer : public ARenderer
+        {
+
+
+        private:
+
+            /* IDs to the data and index (element) vertex buffer objects. */
+            unsigned int dataVBO, indexVBO;
+
+            float* vboData; // Used to store a pointer to the data VBO
+            int* indexVBOData; // Used to store a pointer to the index VBO
+
+            /* Used to store every renderable's start and end indices for the INDEX VBO.
+             * This is unlike the standard VBORenderer, which stores indices to render
+             * the raw data by itself. This one, however, stores the indices in the ELEMENT
+             * array, wich holds indices for the vertex data. arrayIndices is used with
+             * glDrawElements. */
+            std::vector<general::ArrayIndices> arrayIndices;
+            /* Stores the index in arrayIndices of every renderable in the renderables vector,
+             * so a range of renderables can be recorded without going through the ones before it. */
+            std::vector<unsigned int> renderableIndices;
+            // Box around the vertices of every renderable, in its own space, indexed like arrayIndices
+            std::vector<maths::AABB> localBounds;
+
+            /* Everything needed to draw one object with indexed geometry. Render() gathers these
+             * before drawing anything, so objects can be drawn in a different order than they're
+             * stored. */
+            struct DrawItem
+            {
+                float matrix[16]; // World matrix, the object's own combined with its parents'
+                bool transformed; // False if neither it nor its parents have a matrix, so 'matrix' is unused
+                SkinHandle skin; // Skin it inherits or has, invalidHandle to use whatever skin is active
+                unsigned int start, amount; // Range of the index VBO it draws
+                maths::vector3f centre; // World space centre of its vertices, only worked out if it's translucent
+            };
+            std::vector<DrawItem> opaqueItems, translucentItems;
+            std::vector<float> depths; // View space depth of every translucent item, used for sorting
+            general::FloatRadixSorter depthSorter;
+
+            RenderDevice* renderDevice; // Used for activating a renderable's skin and texture
+            IRenderBackend* backend; // The render device's backend, used for all the buffer and draw calls
+
+
+            /* Processes one renderable, adding its data to the VBO.
+             * It takes in both VBO's current index and the number of vertices
+             * and faces already processed. */
+            void ProcessRenderable(IRenderable* renderable, unsigned int& dataVBOIndex,
+                unsigned int& elementVBOIndex, unsigned int& triangleNumber);
+            /* Gathers a draw item for the renderable (if it has indexed geometry) and all of its
+             * children, putting each one in the opaque or translucent items depending on its
+             * skin. Takes in the parent's world matrix and skin. */
+            void GatherObject(IRenderable* renderable, const float* parentMatrix, bool transformed,
+                SkinHandle skin, unsigned int& index);
+            /* Draws a single item by calling glDrawElements, activating its skin and transforming
+             * it by its matrix. */
+            void DrawObject(const DrawItem& item);
+            /* Same as RenderObject(), but records the commands into a command buffer. */
+            void RecordObject(IRenderable* renderable, CommandBuffer& buffer, unsigned int& index);
+
+
+        public:
+
+            /* Initialises properties and creates two blank VBOs. */
+            IndexedVBORenderer(RenderDevice* renderDevice, debug::Logger* log, const bool& willDeleteAll);
+            /* Destructor, deletes both VBOs. */
+            ~IndexedVBORenderer();
+
+            /* Updates both the data and index VBOs as well as the arrayIndices vector. */
+            void Update();
+            /* This binds both VBOs, gathers every object, then draws the opaque ones followed by
+             * the translucent ones, sorted by depth. */
+            void Render();
+            /* Records the commands for rendering a range of renderables. Can be called from any thread. */
+            void RecordCommands(CommandBuffer& buffer, unsigned int first, unsigned int last);
+
+
+        };
+
+    }
+
+}
+#endif
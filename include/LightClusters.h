@@ -0,0 +1,134 @@
+/*
+ * File:   LightClusters.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 11:30 PM
+ */
+
+#ifndef LIGHTCLUSTERS_H
+#define LIGHTCLUSTERS_H
+
+#include <vector>
+#include "ThreadPool.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Size of a LightClusterGrid. The screen is split into tilesX by tilesY tiles, and
+     * the distance from the near plane to the far plane into 'slices' slices. */
+    struct ClusterGridSettings
+    {
+        unsigned int tilesX, tilesY, slices;
+
+        ClusterGridSettings() : tilesX(16), tilesY(9), slices(24) {}
+        ClusterGridSettings(unsigned int x, unsigned int y, unsigned int z) : tilesX(x), tilesY(y), slices(z) {}
+    };
+
+    /* A light as far as binning is concerned: a sphere in view space (the camera is at the
+     * origin looking down negative z) that the light has no effect outside of. */
+    struct ClusterLight
+    {
+        float x, y, z, radius;
+    };
+
+
+    /* Splits the camera's view volume into a 3D grid of clusters and works out which lights
+     * reach each cluster, so a pixel only has to be lit by the lights in its cluster instead
+     * of every light in the scene.
+     *
+     * Tiles split the screen evenly. Slices get thicker the further they are from the camera
+     * (each one is the same amount thicker than the last, proportionally), which keeps
+     * clusters roughly cube shaped, so the slice a depth is in is the logarithm of the depth
+     * scaled and biased; GetSliceScale() and GetSliceBias() give the numbers for shaders.
+     *
+     * Binning doesn't touch the graphics API, so it can be run (and tested and timed) without
+     * a GPU. Each slice is binned separately, so given a thread pool the slices are binned in
+     * parallel; the results are then joined into one list of light indices, where every
+     * cluster's lights are next to each other. */
+    class LightClusterGrid : public general::ITask
+    {
+
+
+    private:
+
+        // Lights found for the clusters in one slice, filled in by the task for that slice
+        struct SliceBins
+        {
+            std::vector<unsigned int> hitClusters, hitLights; // Every cluster and light that touch, in pairs
+            std::vector<unsigned int> counts; // Lights in each cluster of the slice
+            std::vector<unsigned int> starts; // Where each cluster's lights go in 'indices' while grouping
+            std::vector<unsigned int> indices; // Light indices grouped by cluster
+        };
+
+        ClusterGridSettings settings;
+        float nearDistance, farDistance;
+        float sliceScale, sliceBias;
+
+        /* Edges of each column and row of clusters in every slice, as (minimum, maximum) pairs.
+         * Tiles are wider further away, so the edges are those of the cluster's bounding box. */
+        std::vector<float> columnBounds, rowBounds;
+        std::vector<float> sliceDepths; // Distance to the front of every slice, plus the far distance
+
+        std::vector<SliceBins> sliceBins;
+        std::vector<unsigned int> clusterRanges; // (offset, count) into lightIndices for every cluster
+        std::vector<unsigned int> lightIndices;
+
+        const std::vector<ClusterLight>* currentLights; // Lights being binned, read by Execute()
+
+
+    public:
+
+        /* Throws an InvalidArgumentException if any of the grid's dimensions are 0. */
+        LightClusterGrid(const ClusterGridSettings& gridSettings);
+
+        /* Sets up the clusters for a symmetric perspective projection. The tangents are of
+         * half the horizontal and vertical fields of view. Must be called before Bin(), and
+         * again whenever the projection changes. Throws an InvalidArgumentException if the
+         * distances don't make sense. */
+        void SetProjection(float tanHalfFovX, float tanHalfFovY, float near, float far);
+        /* Same as above, but gets the values out of a perspective projection matrix (stored
+         * in column-major order), like one made by gluPerspective(). */
+        void SetProjection(const float* projectionMatrix);
+
+        /* Works out which of the lights reach every cluster. 'pool' can be NULL to bin on
+         * the calling thread. */
+        void Bin(const std::vector<ClusterLight>& lights, general::ThreadPool* pool);
+
+        /* Called by the thread pool, bins the lights into one slice. */
+        void Execute(unsigned int index, unsigned int threadIndex);
+
+
+        /* Index of the cluster with the given tile and slice. Clusters are ordered by x, then
+         * y, then slice. */
+        unsigned int GetClusterIndex(unsigned int x, unsigned int y, unsigned int slice) const
+        {
+            return x + (settings.tilesX * (y + (settings.tilesY * slice)));
+        }
+        /* Slice a point the given distance in front of the camera is in, clamped to the grid. */
+        unsigned int GetSlice(float depth) const;
+
+        unsigned int GetAmountOfClusters() const { return settings.tilesX * settings.tilesY * settings.slices; }
+        const ClusterGridSettings& GetSettings() const { return settings; }
+        float GetNearDistance() const { return nearDistance; }
+        float GetFarDistance() const { return farDistance; }
+        float GetSliceScale() const { return sliceScale; }
+        float GetSliceBias() const { return sliceBias; }
+
+        /* Results of the last Bin(). The lights of cluster c are lightIndices[offset] to
+         * lightIndices[offset + count - 1], where offset is clusterRanges[c * 2] and count is
+         * clusterRanges[(c * 2) + 1]. Indices are into the vector given to Bin(). */
+        const std::vector<unsigned int>& GetClusterRanges() const { return clusterRanges; }
+        const std::vector<unsigned int>& GetLightIndices() const { return lightIndices; }
+        unsigned int GetLightCount(unsigned int cluster) const { return clusterRanges[(cluster * 2) + 1]; }
+
+
+    };
+
+}
+
+}
+
+#endif
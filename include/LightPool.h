@@ -0,0 +1,138 @@
+/*
+ * File:   LightPool.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 1:05 AM
+ */
+
+#ifndef LIGHTPOOL_H
+#define LIGHTPOOL_H
+
+#include <vector>
+#include "ALight.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Identifies a light in a LightPool. Handles are never reused, and 0 is never a light. */
+    typedef unsigned int LightHandle;
+
+
+    /* Every light of a light manager, stored as one array for each of their values (structure
+     * of arrays), so going through the lights reads memory in order and doesn't call anything.
+     *
+     * Lights are either created in the pool and set through it, or added as an ALight, which
+     * the pool reads through its getters (once per light, when SyncAdapters() is called) and
+     * copies into the arrays. Nothing after that calls the ALight's getters, so it's only an
+     * adapter for code that already has its lights as ALights.
+     *
+     * Each light has a handle, which stays the same for as long as the light is in the pool,
+     * and an index into the arrays, which is its place in the order the lights were added
+     * (removing a light moves the ones after it down one). Every light also has a version
+     * that goes up whenever one of its values changes, so managers can keep what they've
+     * worked out from a light until its version moves on.
+     *
+     * Values a light's type doesn't use are kept, but not read: directional lights only use
+     * their direction (towards the light, like ALight::GetDirection()), position lights only
+     * their position and attenuation and spotlights all of them, plus their cutoff (in
+     * degrees) and exponent. The attenuation is stored as a vector of the constant, linear and
+     * quadratic attenuation, in x, y and z. */
+    class LightPool
+    {
+
+
+    private:
+
+        // One of each for every light, in the order they were added
+        std::vector<LightHandle> handles;
+        std::vector<LightType> types;
+        std::vector<unsigned char> enabled; // 1 if the light is on, 0 if not
+        std::vector<maths::vector3f> positions;
+        std::vector<maths::vector3f> directions;
+        std::vector<colourf> ambientColours, diffuseColours, specularColours;
+        std::vector<maths::vector3f> attenuations;
+        std::vector<float> spotCutoffs; // 180 (no cone) until they're set
+        std::vector<float> spotExponents;
+        std::vector<unsigned int> versions;
+
+        std::vector<ALight*> adapters; // The ALight each light is read from, NULL if it's set directly
+        std::vector<unsigned int> adapterVersions; // Version of the ALight when it was last read
+        unsigned int amountOfAdapters;
+
+        std::vector<int> indices; // Index of every handle (from 1), -1 for removed lights
+        LightHandle lastHandle;
+
+
+        /* Adds a light with the default values, returning its index. */
+        unsigned int AddEntry();
+        /* Moves a light's version on. */
+        void Changed(unsigned int index);
+        /* Copies an adapter's values into its light. Returns true if any of them changed. */
+        bool ReadAdapter(unsigned int index);
+
+
+    public:
+
+        LightPool();
+
+        /* Creates a light of the given type, which starts enabled with the fixed function
+         * pipeline's default values (white diffuse and specular colours, no attenuation). */
+        LightHandle Create(LightType type);
+        /* Adds a light read from an ALight, which isn't owned by the pool. Throws a
+         * NullPointerException if the light is NULL. */
+        LightHandle AddAdapter(ALight* light);
+        /* Removes a light. Does nothing if the handle isn't in the pool. */
+        void Remove(LightHandle handle);
+        void Clear();
+
+        /* Reads every ALight that's changed since it was last read (see ALight::GetVersion())
+         * into the arrays, and every ALight that doesn't track changes. Lights whose getters
+         * throw are disabled until they can be read. This needs to be called before the lights
+         * are used, whenever the ALights might have changed; light managers do it in Update(). */
+        void SyncAdapters();
+
+        bool Contains(LightHandle handle) const;
+        /* Returns the light's index into the arrays. Throws an InvalidArgumentException if the
+         * handle isn't in the pool. */
+        unsigned int IndexOf(LightHandle handle) const;
+
+        /* Setters for lights that aren't adapters (an adapter's values are replaced the next
+         * time its ALight changes). These throw an InvalidArgumentException if the handle isn't
+         * in the pool, and only move the light's version on if the value is different. */
+        void SetEnabled(LightHandle handle, bool isEnabled);
+        void SetType(LightHandle handle, LightType type);
+        void SetPosition(LightHandle handle, const maths::vector3f& position);
+        void SetDirection(LightHandle handle, const maths::vector3f& direction);
+        void SetColours(LightHandle handle, const colourf& ambient, const colourf& diffuse, const colourf& specular);
+        void SetAttenuation(LightHandle handle, float constant, float linear, float quadratic);
+        void SetSpotlight(LightHandle handle, float cutoff, float exponent);
+
+        unsigned int GetAmountOfLights() const { return handles.size(); }
+        unsigned int GetAmountOfAdapters() const { return amountOfAdapters; }
+
+        // The arrays, all indexed by the lights' indices
+        const std::vector<LightHandle>& GetHandles() const { return handles; }
+        const std::vector<LightType>& GetTypes() const { return types; }
+        const std::vector<unsigned char>& GetEnabled() const { return enabled; }
+        const std::vector<maths::vector3f>& GetPositions() const { return positions; }
+        const std::vector<maths::vector3f>& GetDirections() const { return directions; }
+        const std::vector<colourf>& GetAmbientColours() const { return ambientColours; }
+        const std::vector<colourf>& GetDiffuseColours() const { return diffuseColours; }
+        const std::vector<colourf>& GetSpecularColours() const { return specularColours; }
+        const std::vector<maths::vector3f>& GetAttenuations() const { return attenuations; }
+        const std::vector<float>& GetSpotCutoffs() const { return spotCutoffs; }
+        const std::vector<float>& GetSpotExponents() const { return spotExponents; }
+        const std::vector<unsigned int>& GetVersions() const { return versions; }
+        const std::vector<ALight*>& GetAdapters() const { return adapters; }
+
+
+    };
+
+}
+
+}
+
+#endif
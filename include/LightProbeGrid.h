@@ -0,0 +1,142 @@
+/*
+ * File:   LightProbeGrid.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:35 AM
+ */
+
+#ifndef LIGHTPROBEGRID_H
+#define LIGHTPROBEGRID_H
+
+#include <vector>
+#include <string>
+#include "Vector.h"
+#include "Colour.h"
+#include "Bounds.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* The light arriving at a point from every direction, stored as the nine coefficients of
+     * the first three bands of spherical harmonics (L2), each with a red, green and blue value.
+     *
+     * The coefficients are of the irradiance, not the incoming light, so evaluating them for
+     * a normal gives the light a diffuse surface facing that way receives, the same as the
+     * fixed function pipeline's N.L term (a light straight above gives its full colour to a
+     * surface facing up). Coefficients are stored one after another, each as R, G and B, and
+     * padded to 28 floats so a set is seven whole SSE registers. */
+    struct SHCoefficients
+    {
+        static const unsigned int amountOfCoefficients = 9;
+        static const unsigned int amountOfFloats = 28; // 27 values and one of padding
+
+        float values[amountOfFloats];
+
+        // Every coefficient starts at zero (no light)
+        SHCoefficients();
+
+        /* Light received by a surface facing along 'normal', which must be normalised. */
+        colourf Evaluate(const maths::vector3f& normal) const;
+        /* Light received by a surface averaged over every direction it could face. This is
+         * what's used for the fixed function pipeline's ambient colour, which has no direction. */
+        colourf GetAverage() const;
+        /* Writes the coefficients out as nine RGB vectors, for a shader's vec3 array uniform
+         * (see Program::SetUniform()). The shader evaluates them with the same constants as
+         * EvaluateBasis(). */
+        void GetUniformValues(std::vector<maths::vector3f>& uniformValues) const;
+
+        /* Adds light of the given colour arriving from one direction (like a light far away)
+         * which must be normalised. */
+        void AddDirectional(const maths::vector3f& direction, const colourf& colour);
+        /* Adds light received the same whatever the direction faced, like a light's ambient colour. */
+        void AddAmbient(const colourf& colour);
+
+        /* Works out the nine basis functions for a normalised direction. */
+        static void EvaluateBasis(const maths::vector3f& direction, float basis[amountOfCoefficients]);
+    };
+
+
+    /* A grid of light probes placed evenly through a box of the world, giving dynamic objects
+     * (characters, say) the light from static scenes without working out dozens of lights for
+     * every one of them.
+     *
+     * The probes are baked offline (see LightmapBaker::BakeProbes()) and the grid saved next
+     * to the level's other assets. At run time, the light at any point is found by blending
+     * the eight probes around it (trilinear interpolation); points outside the box get the
+     * light of the closest point inside it. SampleBatch() does this for many points at once
+     * with SSE instructions, which is how LightProbeSampler looks up every object each frame.
+     *
+     * Grids can be loaded from memory as well as files, so they can be streamed in with the
+     * rest of a level's data and handed over as they arrive. A world split into sections can
+     * have a grid for each. */
+    class LightProbeGrid
+    {
+
+
+    private:
+
+        maths::vector3f origin; // Position of the first probe, the corner of the box with the lowest coordinates
+        maths::vector3f spacing; // Distance between probes along each axis
+        unsigned int amount[3]; // Probes along each axis
+        std::vector<float> probes; // SHCoefficients::amountOfFloats for each probe, along x first, then y, then z
+
+        /* Finds the first of the eight probes around a point and how far the point is between
+         * them along each axis, from 0 to 1. 'steps' is how far along 'probes' the next probe is
+         * along each axis, which is zero along axes with only one probe. */
+        void Locate(const maths::vector3f& position, unsigned int& first, unsigned int steps[3],
+            float weights[3]) const;
+
+
+    public:
+
+        LightProbeGrid();
+
+        /* Makes an unlit grid of probes starting at 'gridOrigin', 'probeSpacing' apart. Anything
+         * in the grid before is thrown away. Throws an InvalidArgumentException if there are no
+         * probes along an axis, or the spacing along an axis isn't above zero. */
+        void Create(const maths::vector3f& gridOrigin, const maths::vector3f& probeSpacing,
+            unsigned int amountX, unsigned int amountY, unsigned int amountZ);
+        /* Removes every probe. */
+        void Clear();
+
+        /* Gets and sets the coefficients of a probe. Throws an InvalidArgumentException if any of
+         * the indices are out of range. */
+        void GetProbe(unsigned int x, unsigned int y, unsigned int z, SHCoefficients& coefficients) const;
+        void SetProbe(unsigned int x, unsigned int y, unsigned int z, const SHCoefficients& coefficients);
+        maths::vector3f GetProbePosition(unsigned int x, unsigned int y, unsigned int z) const;
+
+        /* Blends the probes around a point into 'result'. Throws an Exception if the grid is empty. */
+        void Sample(const maths::vector3f& position, SHCoefficients& result) const;
+        /* Same as Sample() for 'amountOfPositions' points at once, writing each into 'results'. */
+        void SampleBatch(const maths::vector3f* positions, unsigned int amountOfPositions,
+            SHCoefficients* results) const;
+
+        /* Saves the grid to a file, returning false if it couldn't be written. */
+        bool SaveToFile(const std::string& filename) const;
+        /* Loads a grid saved by SaveToFile(), replacing this one. Returns false (leaving the grid
+         * as it was) if the file couldn't be read or isn't a probe grid. */
+        bool LoadFromFile(const std::string& filename);
+        /* Same as LoadFromFile(), from the contents of a file already in memory. */
+        bool LoadFromMemory(const void* data, unsigned int size);
+
+        bool IsEmpty() const { return probes.empty(); }
+        const maths::vector3f& GetOrigin() const { return origin; }
+        const maths::vector3f& GetSpacing() const { return spacing; }
+        unsigned int GetAmountX() const { return amount[0]; }
+        unsigned int GetAmountY() const { return amount[1]; }
+        unsigned int GetAmountZ() const { return amount[2]; }
+        unsigned int GetAmountOfProbes() const { return amount[0] * amount[1] * amount[2]; }
+        /* Returns the box the probes are in. */
+        maths::AABB GetBounds() const;
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,101 @@
+/*
+ * File:   LightProbeSampler.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:35 AM
+ */
+
+#ifndef LIGHTPROBESAMPLER_H
+#define LIGHTPROBESAMPLER_H
+
+#include <vector>
+#include <map>
+#include "LightProbeGrid.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Looks up the light probes for every dynamic object once a frame, so an object drawn
+     * several times (or by several passes) doesn't blend its probes again each time.
+     *
+     * Objects are added with the same pointer the renderers pass to a light manager's
+     * BindLightsFor(), and moved by setting their positions. Update() then finds the grid each
+     * object is in and samples all the objects in the same grid together with
+     * LightProbeGrid::SampleBatch(). Grids are added and removed as the sections of the world
+     * they're for are streamed in and out; objects that aren't in any grid aren't lit by probes
+     * until they are.
+     *
+     * The results are used either as shader uniforms (GetUniformValues() fills a vec3 array for
+     * Program::SetUniform()) or, with FixedFunctionLighting::SetProbeSampler(), as the ambient
+     * colour each object is drawn with. */
+    class LightProbeSampler
+    {
+
+
+    private:
+
+        // Objects are stored in arrays, indexed by the map, so Update() goes through them in order
+        std::map<const void*, unsigned int> indices;
+        std::vector<const void*> objects;
+        std::vector<maths::vector3f> positions;
+        std::vector<SHCoefficients> coefficients;
+        std::vector<colourf> ambientColours;
+        std::vector<bool> sampled; // False for objects that weren't in any grid at the last update
+
+        std::vector<const LightProbeGrid*> grids;
+
+        // Reused by Update() so it doesn't have to allocate
+        std::vector<unsigned int> batchObjects;
+        std::vector<maths::vector3f> batchPositions;
+        std::vector<SHCoefficients> batchResults;
+        std::vector<int> objectGrids;
+
+        /* Returns the index of an object, throwing an InvalidArgumentException if it hasn't been added. */
+        unsigned int IndexOf(const void* object) const;
+
+
+    public:
+
+        LightProbeSampler();
+
+        /* Adds a grid to sample objects from. The grid isn't copied or owned, so it has to be
+         * removed before it's destroyed. Where grids overlap, the one added first is used.
+         * Throws a NullPointerException if the grid is NULL. */
+        void AddGrid(const LightProbeGrid* grid);
+        void RemoveGrid(const LightProbeGrid* grid);
+        void ClearGrids();
+
+        /* Adds an object at the given position, or moves it if it's already been added. It isn't
+         * lit by probes until the next update. */
+        void SetPosition(const void* object, const maths::vector3f& position);
+        void RemoveObject(const void* object);
+        void ClearObjects();
+
+        /* Samples the probes for every object. This is best being called once every frame,
+         * after the objects have been moved and before they're drawn. */
+        void Update();
+
+        /* Returns true if the object was in a grid at the last update, so it has probe lighting. */
+        bool HasLighting(const void* object) const;
+        /* Gets an object's coefficients from the last update. These and the functions below throw
+         * an InvalidArgumentException if the object hasn't been added. */
+        const SHCoefficients& GetCoefficients(const void* object) const;
+        /* The object's light averaged over every direction, for use as an ambient colour. */
+        const colourf& GetAmbientColour(const void* object) const;
+        /* Writes the object's coefficients out as nine RGB vectors for a shader uniform. */
+        void GetUniformValues(const void* object, std::vector<maths::vector3f>& uniformValues) const;
+
+        unsigned int GetAmountOfObjects() const { return objects.size(); }
+        unsigned int GetAmountOfGrids() const { return grids.size(); }
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,170 @@
+/*
+ * File:   LightSelector.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:05 AM
+ */
+
+#ifndef LIGHTSELECTOR_H
+#define LIGHTSELECTOR_H
+
+#include <vector>
+#include <map>
+#include "LightPool.h"
+#include "Bounds.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Settings for a LightSelector. */
+    struct LightSelectorSettings
+    {
+        unsigned int lightsPerObject; // Most lights picked for one object
+        float cellSize; // Width of the grid's cells, in world units
+        float attenuationThreshold; // Attenuation below which a light is treated as having no effect
+        unsigned int maxCellsPerLight; // Lights that would cover more cells than this are treated like directional ones
+
+        LightSelectorSettings() : lightsPerObject(8), cellSize(10.0f), attenuationThreshold(1.0f / 256.0f),
+            maxCellsPerLight(512) {}
+    };
+
+
+    /* Picks the few lights that matter most to each object out of any amount of lights, so
+     * scenes with hundreds of lights can still be drawn with the handful of lights the fixed
+     * function pipeline allows at once.
+     *
+     * Lights with a position are put into every cell of a uniform grid (hashed into buckets,
+     * so it covers the whole world) that the sphere they reach touches. The lights for an
+     * object are the ones in the cells its box touches, along with the directional lights
+     * (and any that reach too far to put in the grid), which are considered for every
+     * object. Each is scored by how bright its diffuse colour is, attenuated by its distance
+     * to the closest point of the object's box, and the best are picked.
+     *
+     * The lights picked are kept for every object and reused while the object's box stays
+     * the same and none of the lights that changed since could reach it. The lights are read
+     * from a LightPool's arrays, and only the ones whose versions have moved on since the
+     * last update are read at all. */
+    class LightSelector
+    {
+
+
+    private:
+
+        // Changes kept for checking cached picks, older picks are just made again
+        static const unsigned int maxChanges = 1024;
+        // Amount of buckets the grid's cells are hashed into
+        static const unsigned int amountOfBuckets = 4096;
+        // Picks not used for this many updates are forgotten
+        static const unsigned int selectionLifetime = 64;
+
+        /* What the selector knows about a light, read when it last changed. */
+        struct SelectorLight
+        {
+            LightHandle handle;
+            unsigned int version; // The light's version in the pool when it was read
+            bool enabled;
+            bool global; // True if it's considered for every object instead of being in the grid
+            maths::vector3f position;
+            float attenuation[3];
+            float brightness; // Luminance of the diffuse colour
+            maths::AABB bounds; // Box around the sphere the light reaches, empty if it's global or disabled
+            unsigned int stamp; // Query the light was last found in, so it's only scored once
+        };
+
+        /* Lights picked for one object. */
+        struct Selection
+        {
+            maths::AABB bounds; // The object's box when they were picked
+            unsigned int version; // Changes up to this one have been checked against the box
+            unsigned int lastUsed;
+            std::vector<unsigned int> lights;
+        };
+
+        /* A box that lights changed in. Objects outside every box changed since they picked
+         * their lights can keep them. */
+        struct LightChange
+        {
+            unsigned int version;
+            maths::AABB bounds;
+            bool everywhere; // True if a global light changed, which affects every object
+        };
+
+        typedef std::map<const void*, Selection> SelectionMap;
+
+        LightSelectorSettings settings;
+
+        std::vector<SelectorLight> lights;
+        std::vector<unsigned int> globalLights;
+        std::vector<std::vector<unsigned int> > buckets;
+
+        std::vector<LightChange> changes;
+        unsigned int version; // Goes up with every change
+        unsigned int frame;
+
+        SelectionMap selections;
+        unsigned int selectionsMade, selectionsReused; // Since the last update
+
+        // Reused between calls so they don't have to allocate
+        std::vector<std::pair<float, unsigned int> > candidates;
+        unsigned int queryStamp;
+
+
+        /* Reads the values of the light at 'index' into 'entry'. Returns false if they're the
+         * same as before. */
+        bool ReadLight(const LightPool& pool, unsigned int index, SelectorLight& entry);
+        /* Adds the light at 'index', as described by 'entry', to the cells of its bounds or
+         * to the global lights, or removes it from them. */
+        void InsertLight(const SelectorLight& entry, unsigned int index);
+        void RemoveLight(const SelectorLight& entry, unsigned int index);
+        /* Gets the range of cells the box touches. Returns false if there are too many. */
+        bool GetCells(const maths::AABB& bounds, int* first, int* last) const;
+        unsigned int GetBucket(int x, int y, int z) const;
+
+        /* Records that lights changed inside the box (or everywhere). */
+        void AddChange(const maths::AABB& bounds, bool everywhere);
+        /* Returns true if the selection is still right for its box. */
+        bool IsCurrent(Selection& selection);
+        /* Picks the lights for the box into the selection. */
+        void Choose(const maths::AABB& bounds, Selection& selection);
+        /* Adds the light to the candidates if it reaches the box. */
+        void ScoreLight(unsigned int index, const maths::AABB& bounds);
+
+
+    public:
+
+        LightSelector(const LightSelectorSettings& selectorSettings);
+
+        /* Finds out which lights have changed, moving them in the grid. Needs to be called
+         * before picking lights, whenever the lights might have changed (every frame). The
+         * lights must stay the same until the next update. */
+        void Update(const LightPool& pool);
+
+        /* Returns the indices (into the pool given to the last update) of the most influential
+         * lights for the object with the given world space box, most influential first.
+         * 'object' identifies the object, so its picks can be reused; any pointer that stays
+         * the same for the object will do. The vector returned is changed by the next call. */
+        const std::vector<unsigned int>& Select(const void* object, const maths::AABB& bounds);
+
+        /* Forgets the lights picked for an object, for when it's deleted. Objects that stop
+         * being drawn are forgotten after a while anyway. */
+        void Forget(const void* object);
+        /* Forgets everything, so every light is read again on the next update. */
+        void Clear();
+
+        const LightSelectorSettings& GetSettings() const { return settings; }
+        unsigned int GetAmountOfGlobalLights() const { return globalLights.size(); }
+        // Amount of objects whose lights were picked again, and whose picks were reused, since the last update
+        unsigned int GetSelectionsMade() const { return selectionsMade; }
+        unsigned int GetSelectionsReused() const { return selectionsReused; }
+
+
+    };
+
+}
+
+}
+
+#endif
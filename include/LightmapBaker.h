@@ -0,0 +1,185 @@
+/*
+ * File:   LightmapBaker.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:20 AM
+ * Added light probe baking on October 19, 2026, 12:35 AM
+ */
+
+#ifndef LIGHTMAPBAKER_H
+#define LIGHTMAPBAKER_H
+
+#include <vector>
+#include <string>
+#include "ALight.h"
+#include "LightmapUnwrapper.h"
+#include "TriangleBVH.h"
+#include "LightProbeGrid.h"
+#include "ThreadPool.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Settings for a LightmapBaker. */
+    struct LightmapBakeSettings
+    {
+        unsigned int indirectSamples; // Rays traced from each texel for light bounced off other surfaces, 0 for none
+        float rayBias; // How far rays start from surfaces, so they don't hit the surface they start on
+        colourf skyColour; // Light coming from rays that leave the scene without hitting anything
+        unsigned int dilation; // Texels the edges of charts are grown into their padding by
+        unsigned int probeSamples; // Rays traced from each light probe for bounced light, 0 for none
+
+        LightmapBakeSettings() : indirectSamples(64), rayBias(0.01f), skyColour(0.0f, 0.0f, 0.0f, 1.0f),
+            dilation(2), probeSamples(256) {}
+    };
+
+
+    /* Works out the light reaching every texel of static meshes' lightmaps on the CPU, so it
+     * can be done offline (on a build machine, say) and drawn at run time as one texture.
+     *
+     * Meshes are added with the matrix that places them in the world and the colour of their
+     * surface, and lights are read from ALights when they're added. Bake() finds the texels
+     * each mesh's triangles cover (using the coordinates given by LightmapUnwrapper), then
+     * works out the light at each of them, split across the threads of a ThreadPool:
+     *
+     * - Direct light is what each light would give the texel with the fixed function pipeline's
+     *   equations (attenuation, spotlight cones and the diffuse N.L term, plus each light's
+     *   ambient colour), except that a ray is traced towards every light and the light is
+     *   skipped if anything is in the way, so it casts shadows.
+     * - Indirect light is gathered by tracing rays in random directions (more towards the
+     *   normal, weighted by the cosine) and averaging the direct light on whatever they hit,
+     *   tinted by that surface's colour. That's one bounce, which gives most of the effect.
+     *
+     * Rays are traced through a TriangleBVH over every mesh's triangles. The random numbers
+     * for each texel are seeded from the texel, so the result is the same however many threads
+     * there are. Texels no triangle covers are then filled from the texels next to them
+     * (dilation), so filtering at the edges of charts doesn't pull in black.
+     *
+     * The lightmap is the irradiance, so it's meant to be multiplied with the surface's texture
+     * (which is what a second texture unit in GL_MODULATE mode does) with lighting turned off.
+     * Meshes' normals are transformed with the upper 3x3 part of their matrix, so the matrices
+     * shouldn't scale by different amounts along different axes.
+     *
+     * The same scene can be baked into a LightProbeGrid for lighting dynamic objects, with
+     * BakeProbes(). Each probe gets every light it can see as light from that direction, and
+     * rays traced evenly in every direction give it the light bounced off the meshes (or the
+     * sky) around it. Probes inside meshes only see their insides, so grids should be placed
+     * where dynamic objects can be. */
+    class LightmapBaker : public general::ITask
+    {
+
+
+    private:
+
+        static const unsigned int texelsPerTask = 64; // Texels worked out by each call to Execute()
+        static const unsigned int probesPerTask = 4; // Probes worked out by each call while baking probes
+
+        struct BakeMesh
+        {
+            const LightmapMesh* mesh;
+            colourf albedo;
+            unsigned int firstVertex; // Where its vertices start in scenePositions and sceneNormals
+            std::vector<float> lightmap; // Three floats (RGB) for each texel
+            std::vector<unsigned char> covered; // 1 for each texel that's been worked out or dilated
+        };
+
+        // A light read from an ALight, in the form the baker needs it
+        struct BakeLight
+        {
+            LightType type;
+            maths::vector3f position; // Direction towards the light for directional lights
+            maths::vector3f spotDirection; // Normalised
+            colourf ambient, diffuse;
+            float constant, linear, quadratic;
+            float cosCutoff, exponent;
+        };
+
+        // A texel some triangle covers, and the point on the surface it's for
+        struct Texel
+        {
+            unsigned int mesh;
+            unsigned int index; // In the mesh's lightmap
+            maths::vector3f position, normal;
+        };
+
+        LightmapBakeSettings settings;
+        std::vector<BakeMesh> meshes;
+        std::vector<BakeLight> lights;
+
+        // Every mesh's vertices in world space and triangles, which the rays are traced through
+        std::vector<maths::vector3f> scenePositions;
+        std::vector<maths::vector3f> sceneNormals;
+        std::vector<Triangle> sceneTriangles;
+        std::vector<unsigned int> triangleMeshes; // Mesh each triangle belongs to
+        TriangleBVH bvh;
+
+        std::vector<Texel> texels; // Only used while baking
+        LightProbeGrid* probeGrid; // Only set while baking probes, when Execute() works out probes instead of texels
+
+
+        /* Finds the texels the mesh's triangles cover, adding them to 'texels'. */
+        void Rasterize(unsigned int meshIndex);
+        /* Grows the covered texels of a mesh's lightmap out into the ones next to them. */
+        void Dilate(unsigned int meshIndex);
+        /* Finds the direction from a point to a light, how far away it is (FLT_MAX for directional
+         * lights) and how much it's attenuated by. Returns false if the light can't reach the point
+         * at all, because it's outside a spotlight's cone or right on top of the light. */
+        bool LightTowards(const BakeLight& light, const maths::vector3f& position, maths::vector3f& towardsLight,
+            float& distance, float& attenuation) const;
+        /* Light arriving at a point straight from the lights, taking shadows into account. */
+        colourf GatherDirect(const maths::vector3f& position, const maths::vector3f& normal) const;
+        /* Light arriving at a point after bouncing off one other surface. 'seed' is the
+         * random number generator's state, which is updated. */
+        colourf GatherIndirect(const maths::vector3f& position, const maths::vector3f& normal,
+            unsigned int& seed) const;
+        /* Works out the coefficients of one of probeGrid's probes. */
+        void BakeProbe(unsigned int index);
+
+
+    public:
+
+        LightmapBaker(const LightmapBakeSettings& bakeSettings);
+
+        /* Adds a mesh to bake a lightmap for, which also blocks and bounces light for every
+         * other mesh. 'worldMatrix' (16 floats, column major like OpenGL's) places it in the world
+         * and 'albedo' is how much of the light hitting it is bounced off. The mesh isn't copied,
+         * so it must stay alive until baking is done. Returns the index the mesh's lightmap can
+         * be got with. Throws a NullPointerException if the mesh or matrix are NULL. */
+        unsigned int AddMesh(const LightmapMesh* mesh, const float* worldMatrix, const colourf& albedo);
+        /* Reads a light's current values, so it lights the meshes when they're baked. Disabled
+         * lights are ignored. Any exceptions thrown by the light's getters are passed on. */
+        void AddLight(ALight* light);
+        /* Removes every mesh and light. */
+        void Clear();
+
+        /* Bakes every mesh's lightmap, using the threads of 'threadPool' (or only the calling
+         * thread if it's NULL). Anything baked before is replaced. */
+        void Bake(general::ThreadPool* threadPool);
+        /* Bakes the light at every probe of 'grid', which has to have been created with the
+         * probes where they're wanted, using the threads of 'threadPool' (or only the calling
+         * thread if it's NULL). Throws an InvalidArgumentException if the grid is empty. */
+        void BakeProbes(LightProbeGrid& grid, general::ThreadPool* threadPool);
+        /* Works out one batch of texels or probes. Called by the thread pool. */
+        void Execute(unsigned int index, unsigned int threadIndex);
+
+        unsigned int GetAmountOfMeshes() const { return meshes.size(); }
+        /* Returns the baked lightmap of a mesh as three floats (RGB) for each texel, starting with
+         * the bottom row. Throws an InvalidArgumentException if the index is out of range. */
+        const std::vector<float>& GetLightmap(unsigned int mesh) const;
+        /* Converts the lightmap of a mesh to bytes, clamping anything brighter than 1. */
+        void GetPixels(unsigned int mesh, std::vector<unsigned char>& rgbPixels) const;
+        /* Saves a mesh's lightmap as a TGA file, which SkinManager can load as a texture.
+         * Returns false if the file couldn't be written. */
+        bool SaveLightmap(unsigned int mesh, const std::string& filename) const;
+
+
+    };
+
+}
+
+}
+
+#endif
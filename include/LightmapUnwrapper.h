@@ -0,0 +1,125 @@
+/*
+ * File:   LightmapUnwrapper.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:20 AM
+ */
+
+#ifndef LIGHTMAPUNWRAPPER_H
+#define LIGHTMAPUNWRAPPER_H
+
+#include <vector>
+#include "Vertex.h"
+#include "Primitives.h"
+#include "AModelLoader.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Settings for a LightmapUnwrapper. */
+    struct LightmapUnwrapSettings
+    {
+        unsigned int resolution; // Width and height of the lightmap, in texels
+        float texelsPerUnit; // Texels along one world unit, if everything fits at that density
+        unsigned int padding; // Empty texels kept around each chart, so filtering doesn't bleed between charts
+        float chartAngle; // Most a triangle's normal can be from its chart's, in degrees (below 90)
+
+        LightmapUnwrapSettings() : resolution(256), texelsPerUnit(8.0f), padding(2), chartAngle(60.0f) {}
+    };
+
+
+    /* A mesh that's been given a second set of texture coordinates for its lightmap.
+     * Vertices on the edge between two charts are split, so there are usually more vertices
+     * than in the mesh it was made from. sourceVertices gives the vertex each one was copied
+     * from, for finding the other data that goes with it. */
+    struct LightmapMesh
+    {
+        std::vector<Vertex> vertices;
+        std::vector<maths::vector2f> lightmapCoords; // One for every vertex, from 0 to 1
+        std::vector<Triangle> triangles;
+        std::vector<unsigned int> sourceVertices;
+        unsigned int resolution; // Size of the lightmap the coordinates are for
+        unsigned int amountOfCharts;
+        float texelsPerUnit; // Density actually used, lower than asked for if the charts didn't fit
+
+        LightmapMesh() : resolution(0), amountOfCharts(0), texelsPerUnit(0.0f) {}
+
+        /* Writes out the mesh as a triangle list (three vertices for every triangle), the way
+         * IGeometry renderables give their vertices, with the lightmap coordinates to match. */
+        void Expand(std::vector<Vertex>& listVertices, std::vector<maths::vector2f>& listCoords) const;
+    };
+
+
+    /* Gives meshes (like the ones loaded by DMFModelLoader) a unique set of texture coordinates
+     * for lightmaps, where no two triangles share any texels.
+     *
+     * Triangles are grouped into charts, starting from the biggest triangle that isn't in one
+     * yet and adding the triangles next to it (that share an edge) which face in roughly the same
+     * direction. Each chart is flattened by projecting it onto the plane its first triangle lies
+     * in, which stretches no triangle by much since they all face nearly the same way. The charts
+     * are then packed into the lightmap in rows (tallest first), and if they don't all fit, they're
+     * shrunk and packed again.
+     *
+     * Unwrapping is deterministic, so the same mesh with the same settings always gets the same
+     * coordinates. A lightmap baked offline can be matched up with a mesh unwrapped again when
+     * it's loaded, instead of having to store the coordinates. */
+    class LightmapUnwrapper
+    {
+
+
+    private:
+
+        // A group of triangles flattened together, and the rectangle it takes up in the lightmap
+        struct Chart
+        {
+            unsigned int firstTriangle, amountOfTriangles; // Range in chartTriangles
+            maths::vector3f tangent, bitangent; // Axes of the plane it's projected onto
+            float minimumU, minimumV, maximumU, maximumV; // Bounds of the projection, in world units
+            unsigned int width, height; // Size of the rectangle in texels, including padding
+            unsigned int x, y; // Where the rectangle was packed
+        };
+
+        LightmapUnwrapSettings settings;
+
+        // Reused between calls so they don't have to allocate
+        std::vector<maths::vector3f> faceNormals;
+        std::vector<float> faceAreas;
+        std::vector<int> triangleCharts; // Chart of each triangle, -1 if it isn't in one yet
+        std::vector<unsigned int> chartTriangles; // Triangles of each chart, one chart after another
+        std::vector<Chart> charts;
+        std::vector<unsigned int> packOrder;
+
+
+        /* Groups the triangles into charts. */
+        void BuildCharts(const std::vector<Vertex>& vertices, const std::vector<Triangle>& triangles);
+        /* Tries to pack every chart at the given scale (texels per world unit). Returns false
+         * if they don't fit. */
+        bool PackCharts(float scale);
+
+
+    public:
+
+        /* Throws an InvalidArgumentException if any of the settings are out of range. */
+        LightmapUnwrapper(const LightmapUnwrapSettings& unwrapSettings);
+
+        /* Makes 'mesh' out of the given vertices and triangles, with lightmap coordinates.
+         * Throws an InvalidArgumentException if a triangle uses a vertex that doesn't exist,
+         * and an Exception if the charts can't be made to fit at any size. */
+        void Unwrap(const std::vector<Vertex>& vertices, const std::vector<Triangle>& triangles,
+            LightmapMesh& mesh);
+        /* Same as above, using the vertices and triangles of a loaded model. */
+        void Unwrap(AModelLoader* model, LightmapMesh& mesh);
+
+        const LightmapUnwrapSettings& GetSettings() const { return settings; }
+
+
+    };
+
+}
+
+}
+
+#endif
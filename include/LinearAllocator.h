@@ -0,0 +1,78 @@
+/*
+ * File:   LinearAllocator.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 10:40 AM
+ */
+
+#ifndef LINEARALLOCATOR_H
+#define LINEARALLOCATOR_H
+
+namespace parcel
+{
+
+namespace general
+{
+
+    /* A block of memory that is handed out by simply moving an offset forward.
+     * Allocating never touches the heap and nothing is freed individually; the
+     * whole block is reused by calling Reset(). Every allocation is rounded up
+     * to 'alignment' bytes, so allocations made one after the other are always
+     * contiguous in memory.
+     *
+     * If there isn't enough space left, Allocate() returns NULL and marks the
+     * allocator as overflowed. The next call to Reset() then doubles the block's
+     * size (or grows it to fit the largest allocation that failed), so the
+     * allocator grows to fit the work given to it without ever allocating while
+     * it is being used. */
+    class LinearAllocator
+    {
+
+
+    private:
+
+        static const unsigned int alignment = 8; // Every allocation's size is rounded up to this
+        static const unsigned int minimumCapacity = 64; // Smallest block, so doubling always grows it
+
+        char* memory; // The block of memory allocations are made from
+        unsigned int capacity; // Size of the block, in bytes
+        unsigned int offset; // Amount of bytes that have been handed out
+        bool overflowed; // True if an allocation failed since the last Reset()
+        unsigned int largestFailure; // Size of the biggest allocation that failed since the last Reset()
+
+        /* Copying would make two allocators own the same block. */
+        LinearAllocator(const LinearAllocator& allocator);
+        LinearAllocator& operator=(const LinearAllocator& allocator);
+
+
+    public:
+
+        /* Allocates the block of memory, which will be 'initialCapacity' bytes long (or
+         * 64, if that's smaller). */
+        LinearAllocator(unsigned int initialCapacity);
+        ~LinearAllocator();
+
+        /* Returns a pointer to 'size' bytes of memory, or NULL if the block is full. */
+        void* Allocate(unsigned int size);
+
+        /* Makes all the memory available again. Any pointers handed out before
+         * are invalidated. If the allocator has overflowed, the block is grown. */
+        void Reset();
+
+        /* Getters. */
+        char* GetCurrentPosition() const { return (memory + offset); }
+        unsigned int GetUsedMemory() const { return offset; }
+        unsigned int GetCapacity() const { return capacity; }
+        bool HasOverflowed() const { return overflowed; }
+
+        /* Rounds the given size up to the allocator's alignment. */
+        static unsigned int AlignSize(unsigned int size) { return ((size + alignment - 1) & ~(alignment - 1)); }
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,33 @@
+/*
+ * File:   LuaException.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 5:15 AM
+ */
+
+#ifndef LUAEXCEPTION_H
+#define LUAEXCEPTION_H
+
+#include <string>
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace lua
+{
+
+    /* Exception thrown whenever something goes wrong on the lua side. Kept apart from
+     * LuaManager so LuaStackGuard can throw it, and LuaManager can use LuaStackGuard. */
+    class LuaException : public debug::Exception
+    {
+    public:
+        LuaException(const std::string& errorMessage) : Exception(errorMessage) {}
+
+    };
+
+}
+
+}
+
+#endif
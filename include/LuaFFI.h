@@ -0,0 +1,61 @@
+/*
+ * File:   LuaFFI.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 3:30 AM
+ */
+
+#ifndef LUAFFI_H
+#define LUAFFI_H
+
+#include <lua.hpp>
+#include "Vertex.h"
+#include "Colour.h"
+#include "Primitives.h"
+
+namespace parcel
+{
+
+namespace lua
+{
+
+    /* Makes the engine's plain types and a few fast functions available to scripts through
+     * LuaJIT's FFI. After this, require("parcel.ffi") returns a table with:
+     *
+     *     vector2f, vector3f, colourf, Vertex, Triangle - FFI types with the same layout as
+     *         the C++ ones (parcel_vector3f and so on in ffi.cdef), so arrays of them can be
+     *         shared with C++ without copying. vector3f has +, -, * by a number and the
+     *         methods Length(), Dot() and Cross().
+     *     ArrayFrom(pointer, typeName) - casts a pointer C++ set as light userdata (see
+     *         LuaManager::SetPointerToVariable()) to an array of the type, e.g. "parcel_Vertex".
+     *     TransformPoints, TransformVertices, CalculateNormals, LerpColours - the functions
+     *         below, which the JIT calls directly rather than through the Lua stack.
+     *
+     * Values in shared arrays are read and written in place, and the arrays must outlive
+     * the script's use of them. Returns false (without doing anything) if Parcel isn't built
+     * against LuaJIT (PARCEL_LUAJIT isn't defined). Throws a LuaException if the module
+     * can't be loaded. */
+    bool RegisterFFIModule(lua_State* vm);
+
+
+    /* Functions the FFI module exposes. They only take plain types, so LuaJIT can call
+     * them without going through the Lua stack, and they work on whole arrays so a script
+     * makes one call for many values. Matrices are 16 floats in column-major form. */
+
+    /* Moves points by a matrix, including its translation. */
+    void TransformPoints(maths::vector3f* points, unsigned int count, const float* matrix);
+    /* Moves vertices' positions by a matrix and rotates their normals (using the top-left
+     * 3x3, so the matrix mustn't be scaled unevenly). */
+    void TransformVertices(graphics::Vertex* vertices, unsigned int count, const float* matrix);
+    /* Sets every vertex's normal to the average of the normals of the triangles using it,
+     * weighted by their area. */
+    void CalculateNormals(graphics::Vertex* vertices, unsigned int vertexCount,
+        const graphics::Triangle* triangles, unsigned int triangleCount);
+    /* Moves each colour 't' of the way towards the matching target colour. */
+    void LerpColours(graphics::colourf* colours, const graphics::colourf* targets, unsigned int count, float t);
+
+}
+
+}
+
+#endif
@@ -1,170 +1,230 @@
-/*
- * File:   LuaManager.h
- * Author: Donald "Datriot" Whyte
- *
- * Created on October 11, 2008, 7:08 PM
- * Imported into Parcel engine and modified on
- * June 3, 11:13 AM
- */
-
-#ifndef LUAMANAGER_H
-#define LUAMANAGER_H
-
-#include <string>
-#include <lua.hpp>
-#include "Exceptions.h"
-
-namespace parcel
-{
-
-namespace lua
-{
-
-    /* Exception thrown whenever something goes wrong on the lua side. */
-    class LuaException : public debug::Exception
-    {
-    public:
-        LuaException(const std::string& errorMessage) : Exception(errorMessage) {}
-
-    };
-
-    /* Loads and executes Lua scripts and stores the state of the virtual machine.
-     * This class also bridges the gap between C++ and Lua, allowing C++ to get/set
-     * variables from Lua and register C++ functions to be used in Lua. */
-    class LuaManager
-    {
-
-
-    private:
-
-        lua_State* vm;  // The Lua virtual machine
-
-
-        /* This method pushes the global variable "varName" to the top of the stack.
-         * Throws an exception if the global doesn't exitst. */
-        void GetGlobal(const std::string& varName);
-        /* Gets a field. This method assumes that a table has already been pushed
-         * to the top of the stack. Throws an exception if the table/field doesn't exist. */
-        void GetField(const std::string& field);
-        /* Instead of assuming there's a table at the top of the stack lke the above
-         * method, this one pushes the tabnle requested onto the stack for us. */
-        void GetField(const std::string& varName, const std::string& field);
-        /* Sets the value of a global variable and a field of a table respectively. It
-         * does this by setting the variable with the value that at's the top of the
-         * stack, so you have to push values before calling these. (you can do this by
-         * calling functions like lua_ pushnumber) */
-        void SetGlobal(const std::string& varName);
-        void SetField(const std::string& field);
-
-
-    public:
-
-        /* Constructor, starts virtual machine and opens default libraries for use in Lua. */
-        LuaManager();
-        /* Destructor, closes and destroys the lua state. */
-        ~LuaManager();
-
-        /* Loads and executes a script. */
-        void LoadAndExecuteScript(const std::string& filename);
-
-        /* Registers a C function inside the Lua interpreter. */
-        void RegisterFunction(luaL_reg function);
-        /* Registers a collection of functions in a table called libraryName. Lua
-         * supports dynamic loader libraries, but this would cause Lua to be
-         * unsafe, as it can breach the confines of the engine then. */
-        void RegisterStaticLibrary(const std::string& libraryName, const luaL_reg* functions);
-
-        /* These methods attempt to acquire a value of a certain type from a variable
-         * called 'varName'. If the variable in Lua is nil or isn't the type the methods
-         * is looking for, they throw an exception. */
-        int GetIntFromVariable(const std::string& varName);
-        float GetFloatFromVariable(const std::string& varName);
-        double GetDoubleFromVariable(const std::string& varName);
-        bool GetBoolFromVariable(const std::string& varName);
-        std::string GetStringFromVariable(const std::string& varName);
-        /* Methods same as above but they get a specific field in a table. */
-        int GetIntFromTable(const std::string& varName, const std::string& field);
-        float GetFloatFromTable(const std::string& varName, const std::string& field);
-        double GetDoubleFromTable(const std::string& varName, const std::string& field);
-        bool GetBoolFromTable(const std::string& varName, const std::string& field);
-        std::string GetStringFromTable(const std::string& varName, const std::string& field);
-
-        /* Same as above, but sets/creates a variable instead of getting its value. */
-        void SetIntToVariable(const std::string& varName, int value);
-        void SetFloatToVariable(const std::string& varName, float value);
-        void SetDoubleToVariable(const std::string& varName, double value);
-        void SetBoolToVariable(const std::string& varName, bool value);
-        void SetStringToVariable(const std::string& varName, const std::string& value);
-        /* Table field setters. */
-        void SetIntToTable(const std::string& varName, const std::string& field,
-            int value);
-        void SetFloatToTable(const std::string& varName, const std::string& field,
-            float value);
-        void SetDoubleToTable(const std::string& varName, const std::string& field,
-            double value);
-        void SetBoolToTable(const std::string& varName, const std::string& field,
-            bool value);
-        void SetStringToTable(const std::string& varName, const std::string& field,
-            const std::string& value);
-
-        /* TODO. */
-//        /* Getters/setters for USERDATA type variables in Lua. Have to be implemented
-//         * here, in the header, since they receive template parameters. */
-//        template<typename T> T GetUserDataFromVariable(const std::string& varName)
-//        {
-//            // Pushes required variable to the top of the stack
-//            GetGlobal(varName);
-//            /* If the variable IS userdata, convert it to the required C++ datatype
-//             * and return it. If it ISN'T, throw an exception. */
-//            if (lua_isuserdata(vm, -1))
-//            {
-//                return *(reinterpret_cast<T*>(lua_touserdata(vm, -1)));
-//            }
-//            else
-//            {
-//                throw LuaException("LuaManager::GetUserDataFromVariable - '" +
-//                    varName + "' is not user data!");
-//            }
-//        }
-//
-//        template<typename T> T GetUserDataFromTable(const std::string& varName,
-//            const std::string& field)
-//        {
-//            GetField(varName, field); // Pushes requested field on to the top of the stack
-//            if (lua_isuserdata(vm, -1))
-//            {
-//                return static_cast<T>(lua_touserdata(vm, -1));
-//            }
-//            else
-//            {
-//                throw LuaException("LuaManager::GetUserDataFromVariable - '" +
-//                    varName + "' is not user data!");
-//            }
-//        }
-//
-//        template<typename T> T* SetUserDataToVariable(const std::string& varName, T* value)
-//        {
-//            // Allocates enough memory for the full user data
-//            void* userdata = lua_newuserdata(vm, sizeof(T));
-//            // Assigns the new user data the given values
-//            T* convert = (T*)userdata;
-//            convert = value;
-//            // Passes suerdata to the required variable
-//            SetGlobal(varName);
-//        }
-//        template<typename T> void SetUserDataToTable(const std::string& varName,
-//            const std::string& field, T value)
-//        {
-////            GetGlobal(varName);
-////            lua_pushuserdata(vm, reinterpret_cast<void*>(T));
-////            SetField(field);
-//        }
-
-
-    };
-
-}
-
-}
-
-#endif
+/*
+ * File:   LuaManager.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 11, 2008, 7:08 PM
+ * Imported into Parcel engine and modified on
+ * June 3, 11:13 AM
+ * Added references and stack guards on October 19, 2026, 2:50 AM
+ * Added maths userdata on October 19, 2026, 3:10 AM
+ * Added LuaJIT support on October 19, 2026, 3:30 AM
+ * Moved LuaException into LuaException.h and changed the userdata templates to use stack guards on October 19, 2026, 5:15 AM
+ */
+
+#ifndef LUAMANAGER_H
+#define LUAMANAGER_H
+
+#include <string>
+#include <vector>
+#include <lua.hpp>
+#include "LuaException.h"
+#include "LuaRef.h"
+#include "LuaMaths.h"
+#include "LuaStackGuard.h"
+
+namespace parcel
+{
+
+namespace lua
+{
+
+    /* Loads and executes Lua scripts and stores the state of the virtual machine.
+     * This class also bridges the gap between C++ and Lua, allowing C++ to get/set
+     * variables from Lua and register C++ functions to be used in Lua.
+     *
+     * The getters and setters look the variable up by name every call. For values read
+     * every frame, get a reference once with the Get*Ref() methods and read that instead.
+     * Every method leaves the Lua stack the way it found it, even when it throws.
+     *
+     * Parcel can be built against stock Lua 5.1 or LuaJIT, which has the same API. To use
+     * LuaJIT, put its headers on the include path, link with its library and define
+     * PARCEL_LUAJIT. Scripts can then use its FFI with the engine's types (see LuaFFI.h). */
+    class LuaManager
+    {
+
+
+    private:
+
+        lua_State* vm;  // The Lua virtual machine
+
+
+        /* This method pushes the global variable "varName" to the top of the stack.
+         * Throws an exception if the global doesn't exitst. */
+        void GetGlobal(const std::string& varName);
+        /* Gets a field. This method assumes that a table has already been pushed
+         * to the top of the stack. Throws an exception if the table/field doesn't exist. */
+        void GetField(const std::string& field);
+        /* Instead of assuming there's a table at the top of the stack lke the above
+         * method, this one pushes the tabnle requested onto the stack for us. */
+        void GetField(const std::string& varName, const std::string& field);
+        /* Sets the value of a global variable and a field of a table respectively. It
+         * does this by setting the variable with the value that at's the top of the
+         * stack, so you have to push values before calling these. (you can do this by
+         * calling functions like lua_ pushnumber) */
+        void SetGlobal(const std::string& varName);
+        void SetField(const std::string& field);
+
+
+    public:
+
+        /* Constructor, starts virtual machine and opens default libraries for use in Lua. */
+        LuaManager();
+        /* Destructor, closes and destroys the lua state. */
+        ~LuaManager();
+
+        /* Loads and executes a script. */
+        void LoadAndExecuteScript(const std::string& filename);
+
+        /* Registers a C function inside the Lua interpreter. */
+        void RegisterFunction(luaL_Reg function);
+        /* Registers a collection of functions in a table called libraryName. Lua
+         * supports dynamic loader libraries, but this would cause Lua to be
+         * unsafe, as it can breach the confines of the engine then. */
+        void RegisterStaticLibrary(const std::string& libraryName, const luaL_Reg* functions);
+        /* Registers the vector, quaternion and matrix userdata types and the "maths" table
+         * that creates them. See LuaMaths.h. */
+        void RegisterMathsLibrary();
+        /* Makes the engine's types and fast functions available to scripts through
+         * LuaJIT's FFI, as require("parcel.ffi"). Returns false (and does nothing) when
+         * Parcel isn't built against LuaJIT. See LuaFFI.h. */
+        bool RegisterFFIModule();
+
+        /* Returns the name and version of the Lua being used, like "Lua 5.1.5" or
+         * "LuaJIT 2.1.0". */
+        std::string GetBackendName() const;
+
+        /* These methods attempt to acquire a value of a certain type from a variable
+         * called 'varName'. If the variable in Lua is nil or isn't the type the methods
+         * is looking for, they throw an exception. */
+        int GetIntFromVariable(const std::string& varName);
+        float GetFloatFromVariable(const std::string& varName);
+        double GetDoubleFromVariable(const std::string& varName);
+        bool GetBoolFromVariable(const std::string& varName);
+        std::string GetStringFromVariable(const std::string& varName);
+        /* Methods same as above but they get a specific field in a table. */
+        int GetIntFromTable(const std::string& varName, const std::string& field);
+        float GetFloatFromTable(const std::string& varName, const std::string& field);
+        double GetDoubleFromTable(const std::string& varName, const std::string& field);
+        bool GetBoolFromTable(const std::string& varName, const std::string& field);
+        std::string GetStringFromTable(const std::string& varName, const std::string& field);
+
+        /* Same as above, but sets/creates a variable instead of getting its value. */
+        void SetIntToVariable(const std::string& varName, int value);
+        void SetFloatToVariable(const std::string& varName, float value);
+        void SetDoubleToVariable(const std::string& varName, double value);
+        void SetBoolToVariable(const std::string& varName, bool value);
+        void SetStringToVariable(const std::string& varName, const std::string& value);
+        /* Sets a variable to a pointer (as light userdata), for scripts to use C++ arrays in
+         * place through LuaJIT's FFI. Lua doesn't own or free it. */
+        void SetPointerToVariable(const std::string& varName, void* pointer);
+        /* Table field setters. */
+        void SetIntToTable(const std::string& varName, const std::string& field,
+            int value);
+        void SetFloatToTable(const std::string& varName, const std::string& field,
+            float value);
+        void SetDoubleToTable(const std::string& varName, const std::string& field,
+            double value);
+        void SetBoolToTable(const std::string& varName, const std::string& field,
+            bool value);
+        void SetStringToTable(const std::string& varName, const std::string& field,
+            const std::string& value);
+
+        /* Return references to a variable, a field of a table, a table or a function, which
+         * are looked up once here and can then be used without looking them up again (see
+         * LuaRef.h). The variable doesn't have to exist yet, but the table or function does:
+         * these throw a LuaException if it isn't one. References must be destroyed before
+         * the manager. */
+        LuaRef GetVariableRef(const std::string& varName);
+        LuaRef GetFieldRef(const std::string& varName, const std::string& field);
+        LuaTableRef GetTableRef(const std::string& varName);
+        LuaFunctionRef GetFunctionRef(const std::string& varName);
+
+        /* Returns the virtual machine, for calling the Lua API directly. */
+        lua_State* GetState() { return vm; }
+
+        /* Getters/setters for userdata variables: vectors, quaternions and matrices (see
+         * LuaMaths.h). Implemented here, in the header, since they receive template
+         * parameters. The getters throw a LuaException if the variable is nil or isn't
+         * that type, and the table ones if the table doesn't exist. */
+        template<typename T> T GetUserdataFromVariable(const std::string& varName)
+        {
+            T value;
+            LuaStackGuard guard(vm);
+            lua_getglobal(vm, varName.c_str());
+            if (!ToUserdata(vm, -1, value))
+            {
+                throw LuaException("LuaManager::GetUserdataFromVariable - '" + varName + "' is not the right type of userdata!");
+            }
+            return value;
+        }
+
+        template<typename T> T GetUserdataFromTable(const std::string& varName, const std::string& field)
+        {
+            T value;
+            LuaStackGuard guard(vm);
+            lua_getglobal(vm, varName.c_str());
+            bool converted = false;
+            if (lua_istable(vm, -1))
+            {
+                lua_getfield(vm, -1, field.c_str());
+                converted = ToUserdata(vm, -1, value);
+            }
+            if (!converted)
+            {
+                throw LuaException("LuaManager::GetUserdataFromTable - '" + varName + "." + field + "' is not the right type of userdata!");
+            }
+            return value;
+        }
+
+        template<typename T> void SetUserdataToVariable(const std::string& varName, const T& value)
+        {
+            LuaStackGuard guard(vm);
+            PushUserdata(vm, value);
+            lua_setglobal(vm, varName.c_str());
+            guard.CheckBalanced("LuaManager::SetUserdataToVariable");
+        }
+
+        template<typename T> void SetUserdataToTable(const std::string& varName, const std::string& field,
+            const T& value)
+        {
+            LuaStackGuard guard(vm);
+            lua_getglobal(vm, varName.c_str());
+            if (!lua_istable(vm, -1))
+            {
+                throw LuaException("LuaManager::SetUserdataToTable - '" + varName + "' is not a table!");
+            }
+            PushUserdata(vm, value);
+            lua_setfield(vm, -2, field.c_str());
+            lua_pop(vm, 1);
+            guard.CheckBalanced("LuaManager::SetUserdataToTable");
+        }
+
+        /* Read or write a whole array of userdata at once, rather than a field at a time.
+         * The getter throws a LuaException if the variable isn't an array of T. */
+        template<typename T> void GetUserdataArrayFromVariable(const std::string& varName, std::vector<T>& values)
+        {
+            LuaStackGuard guard(vm);
+            lua_getglobal(vm, varName.c_str());
+            if (!ToUserdataArray(vm, -1, values))
+            {
+                throw LuaException("LuaManager::GetUserdataArrayFromVariable - '" + varName + "' is not an array of the right type of userdata!");
+            }
+        }
+
+        template<typename T> void SetUserdataArrayToVariable(const std::string& varName, const T* values,
+            unsigned int count)
+        {
+            LuaStackGuard guard(vm);
+            PushUserdataArray(vm, values, count);
+            lua_setglobal(vm, varName.c_str());
+            guard.CheckBalanced("LuaManager::SetUserdataArrayToVariable");
+        }
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ * File:   LuaMaths.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 3:10 AM
+ * Changed ToMatrix() to copy element by element on October 19, 2026, 5:25 AM
+ */
+
+#ifndef LUAMATHS_H
+#define LUAMATHS_H
+
+#include <vector>
+#include <lua.hpp>
+#include "Vector.h"
+#include "Quaternion.h"
+
+namespace parcel
+{
+
+namespace lua
+{
+
+    /* A 4x4 matrix of floats in column-major form, like the arrays given to GL. Matrix
+     * keeps its elements in vectors on the heap, so this is what's stored in Lua instead,
+     * and converted when it's pushed or read. */
+    struct LuaMatrix
+    {
+        float values[16];
+
+        /* Creates an identity matrix. */
+        LuaMatrix();
+        /* Copies 16 floats in column-major form. */
+        explicit LuaMatrix(const float* data);
+        /* Copies the top-left 4x4 of a matrix. Smaller matrices have the rest of the
+         * identity matrix around them. */
+        explicit LuaMatrix(const maths::Matrix<float>& matrix);
+
+        /* Returns a 4x4 Matrix with the same elements. */
+        maths::Matrix<float> ToMatrix() const;
+        /* Element at (row, column), starting from 0. */
+        float& operator()(int row, int column) { return values[column * 4 + row]; }
+        const float& operator()(int row, int column) const { return values[column * 4 + row]; }
+    };
+
+
+    /* Registers the vector, quaternion and matrix types in Lua, and a table called
+     * "maths" with their constructors:
+     *
+     *     maths.Vector2(x, y), maths.Vector3(x, y, z), maths.Vector4(x, y, z, w)
+     *     maths.Quaternion() (identity), maths.Quaternion(x, y, z, w),
+     *         maths.Quaternion(degrees, axis)
+     *     maths.Matrix() (identity), maths.Matrix(16 numbers, column-major)
+     *
+     * Values are full userdata with the C++ type stored in them, so making one is a single
+     * allocation in Lua's heap and nothing else. Components are read and written as v.x or
+     * v[1], and the types support +, -, *, / (vectors by a number), unary -, == and
+     * tostring(), plus methods (v:Length(), q:Slerp(b, t), m:Inverse() and so on). */
+    void RegisterMathsLibrary(lua_State* vm);
+
+    /* Push a copy of a value onto the stack as userdata. RegisterMathsLibrary() must have
+     * been called. */
+    void PushUserdata(lua_State* vm, const maths::vector2f& value);
+    void PushUserdata(lua_State* vm, const maths::vector3f& value);
+    void PushUserdata(lua_State* vm, const maths::vector4f& value);
+    void PushUserdata(lua_State* vm, const maths::quaternionf& value);
+    void PushUserdata(lua_State* vm, const LuaMatrix& value);
+    void PushUserdata(lua_State* vm, const maths::Matrix<float>& value);
+
+    /* Copy the userdata at 'index' into 'value', returning false (and leaving 'value'
+     * alone) if it isn't that type. */
+    bool ToUserdata(lua_State* vm, int index, maths::vector2f& value);
+    bool ToUserdata(lua_State* vm, int index, maths::vector3f& value);
+    bool ToUserdata(lua_State* vm, int index, maths::vector4f& value);
+    bool ToUserdata(lua_State* vm, int index, maths::quaternionf& value);
+    bool ToUserdata(lua_State* vm, int index, LuaMatrix& value);
+    bool ToUserdata(lua_State* vm, int index, maths::Matrix<float>& value);
+
+    /* Return the userdata at 'index' itself, for C functions called from Lua, raising a Lua
+     * error if the argument is the wrong type. Changing the value changes it in Lua. */
+    maths::vector2f* CheckVector2(lua_State* vm, int index);
+    maths::vector3f* CheckVector3(lua_State* vm, int index);
+    maths::vector4f* CheckVector4(lua_State* vm, int index);
+    maths::quaternionf* CheckQuaternion(lua_State* vm, int index);
+    LuaMatrix* CheckMatrix(lua_State* vm, int index);
+
+
+    /* Pushes an array of values as a Lua array (a table with keys from 1 to 'count'),
+     * which is made big enough for all of them up front. */
+    template<typename T> void PushUserdataArray(lua_State* vm, const T* values, unsigned int count)
+    {
+        lua_createtable(vm, count, 0);
+        for (unsigned int i = 0; (i < count); i++)
+        {
+            PushUserdata(vm, values[i]);
+            lua_rawseti(vm, -2, i + 1);
+        }
+    }
+
+    /* Reads the Lua array at 'index' into 'values', which is resized to fit. Returns false
+     * if it isn't a table or any of its values are the wrong type (leaving 'values' with
+     * the ones before it). The stack is left as it was. */
+    template<typename T> bool ToUserdataArray(lua_State* vm, int index, std::vector<T>& values)
+    {
+        if (!lua_istable(vm, index)) return false;
+        // Pushing values moves indices relative to the top, so this works out the absolute one
+        if (index < 0 && index > LUA_REGISTRYINDEX) index = lua_gettop(vm) + index + 1;
+
+        unsigned int count = lua_objlen(vm, index);
+        values.resize(count);
+        for (unsigned int i = 0; (i < count); i++)
+        {
+            lua_rawgeti(vm, index, i + 1);
+            bool converted = ToUserdata(vm, -1, values[i]);
+            lua_pop(vm, 1);
+            if (!converted)
+            {
+                values.resize(i);
+                return false;
+            }
+        }
+        return true;
+    }
+
+}
+
+}
+
+#endif
@@ -0,0 +1,180 @@
+/*
+ * File:   LuaRef.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 2:50 AM
+ */
+
+#ifndef LUAREF_H
+#define LUAREF_H
+
+#include <string>
+#include <lua.hpp>
+
+namespace parcel
+{
+
+namespace lua
+{
+
+    /* A value kept in the Lua registry with luaL_ref(), so it can be pushed again without
+     * looking it up by name. Copies make their own reference to the same value, and each
+     * is released when it's destroyed. References must be destroyed before the LuaManager
+     * they came from. */
+    class LuaRegistryRef
+    {
+
+
+    protected:
+
+        lua_State* vm; // NULL if the reference is empty
+        int reference; // Key in the registry
+
+
+    public:
+
+        /* Creates an empty reference. */
+        LuaRegistryRef();
+        /* Pops the value at the top of the stack and keeps a reference to it. */
+        explicit LuaRegistryRef(lua_State* state);
+        LuaRegistryRef(const LuaRegistryRef& other);
+        LuaRegistryRef& operator=(const LuaRegistryRef& other);
+        ~LuaRegistryRef();
+
+        /* Pushes the value onto the top of the stack (nil if the reference is empty). */
+        void Push() const;
+        bool IsEmpty() const { return (vm == NULL); }
+        lua_State* GetState() const { return vm; }
+
+
+    };
+
+
+    /* A variable, or a field of a table, found once and then read or written without its
+     * name being looked up again: the table and the name (an interned Lua string, whose hash
+     * is already worked out) are both kept in the registry. The variable doesn't have to
+     * exist until it's read, and is read again every time, so it always has its latest
+     * value. The getters throw a LuaException if it's nil or the wrong type, like the ones
+     * in LuaManager. */
+    class LuaRef
+    {
+
+
+    private:
+
+        LuaRegistryRef table; // Globals table, for variables
+        LuaRegistryRef key; // Name of the variable or field
+        std::string name; // For error messages
+
+
+        /* Returns the Lua state, throwing a LuaException if the reference is empty. */
+        lua_State* GetVM() const;
+        /* Pushes the value, throwing a LuaException if it's nil. */
+        void PushValue() const;
+        /* Sets the value to the one on the top of the stack, which is popped. */
+        void SetValue();
+
+
+    public:
+
+        /* Creates an empty reference, which throws if it's used. */
+        LuaRef() {}
+        /* Refers to the field 'fieldName' of a table, which is popped off the top of the
+         * stack. 'fullName' is used in error messages. */
+        LuaRef(lua_State* state, const std::string& fieldName, const std::string& fullName);
+
+        int GetInt() const;
+        float GetFloat() const;
+        double GetDouble() const;
+        bool GetBool() const;
+        std::string GetString() const;
+        /* Returns true if the value isn't nil. */
+        bool Exists() const;
+
+        void SetInt(int value);
+        void SetFloat(float value);
+        void SetDouble(double value);
+        void SetBool(bool value);
+        void SetString(const std::string& value);
+
+        const std::string& GetName() const { return name; }
+
+
+    };
+
+
+    /* A table, found once and kept in the registry, whose fields can be read by name or
+     * referred to with a LuaRef. */
+    class LuaTableRef : public LuaRegistryRef
+    {
+
+
+    private:
+
+        std::string name; // For error messages
+
+
+        /* Pushes one of the table's fields, throwing a LuaException if it's nil. */
+        void PushField(const std::string& field) const;
+
+
+    public:
+
+        LuaTableRef() {}
+        /* Refers to the table on the top of the stack, which is popped. Throws a
+         * LuaException (after popping it) if it isn't a table. */
+        LuaTableRef(lua_State* state, const std::string& tableName);
+
+        /* Returns a reference to one of the table's fields, for fields that are read often. */
+        LuaRef GetFieldRef(const std::string& field) const;
+
+        /* Read a field by name, which skips looking the table up. These throw a LuaException
+         * if the field is nil or the wrong type. */
+        int GetInt(const std::string& field) const;
+        float GetFloat(const std::string& field) const;
+        double GetDouble(const std::string& field) const;
+        bool GetBool(const std::string& field) const;
+        std::string GetString(const std::string& field) const;
+
+
+    };
+
+
+    /* A function, found once and kept in the registry, to be called without looking it up.
+     * Errors raised by the function are thrown as a LuaException. */
+    class LuaFunctionRef : public LuaRegistryRef
+    {
+
+
+    private:
+
+        std::string name; // For error messages
+
+
+        /* Calls the function with the arguments on the stack above it. */
+        void Invoke(int amountOfArguments, int amountOfResults) const;
+
+
+    public:
+
+        LuaFunctionRef() {}
+        /* Refers to the function on the top of the stack, which is popped. Throws a
+         * LuaException (after popping it) if it isn't a function. */
+        LuaFunctionRef(lua_State* state, const std::string& functionName);
+
+        /* Calls the function with no arguments, or one number (like the time since the last
+         * frame), ignoring what it returns. */
+        void Call() const;
+        void Call(double argument) const;
+        /* Calls the function with one number and returns the number it returns. Throws a
+         * LuaException if it doesn't return a number. */
+        double CallForNumber(double argument) const;
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,64 @@
+/*
+ * File:   LuaStackGuard.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 2:50 AM
+ * Changed to include LuaException.h instead of LuaManager.h on October 19, 2026, 5:15 AM
+ */
+
+#ifndef LUASTACKGUARD_H
+#define LUASTACKGUARD_H
+
+#include <string>
+#include <lua.hpp>
+#include "LuaException.h"
+#include "Util.h"
+
+namespace parcel
+{
+
+namespace lua
+{
+
+    /* Remembers how many values are on a Lua stack when it's created, and puts the stack
+     * back to that when it goes out of scope. Creating one at the start of anything that
+     * pushes values means they're always popped again, even when it returns early or
+     * throws.
+     *
+     * CheckBalanced() is for code that's meant to clean up after itself (like a C function
+     * called from Lua), to check that it did. */
+    class LuaStackGuard
+    {
+
+
+    private:
+
+        lua_State* vm;
+        int top; // Height of the stack when the guard was created
+
+
+    public:
+
+        LuaStackGuard(lua_State* state) : vm(state), top(lua_gettop(state)) {}
+        ~LuaStackGuard() { lua_settop(vm, top); }
+
+        /* Returns how many values are on the stack above where it was (negative if values
+         * below it have been popped). */
+        int GetPushed() const { return lua_gettop(vm) - top; }
+        /* Throws a LuaException naming 'where' if the stack isn't the height it was. */
+        void CheckBalanced(const std::string& where) const
+        {
+            if (GetPushed() != 0)
+            {
+                throw LuaException(where + " - Left " + general::ToString(GetPushed()) + " values on the Lua stack.");
+            }
+        }
+
+
+    };
+
+}
+
+}
+
+#endif
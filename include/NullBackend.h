@@ -0,0 +1,275 @@
+/*
+ * File:   NullBackend.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 2:30 PM
+ * Added SetDepthWrite() on October 19, 2026, 4:55 AM
+ */
+
+#ifndef NULLBACKEND_H
+#define NULLBACKEND_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "RenderBackend.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Counters kept by the NullBackend. */
+    struct BackendStatistics
+    {
+        unsigned int drawCalls; // DrawArrays()/DrawElements() calls, including ones made by display lists
+        unsigned int verticesDrawn; // Vertices (or indices) sent by those draw calls
+        unsigned int stateChanges; // Calls that change any state apart from the matrix stacks
+        unsigned int matrixOperations; // Calls that change the matrix stacks
+        unsigned int bufferBytesUploaded; // Bytes sent to buffers through BufferData() and MapBuffer()
+        unsigned int textureBytesUploaded; // Bytes of pixel data sent through UploadTexture()
+        unsigned int validationErrors; // Calls that were invalid
+
+        BackendStatistics() :
+            drawCalls(0), verticesDrawn(0), stateChanges(0), matrixOperations(0),
+            bufferBytesUploaded(0), textureBytesUploaded(0), validationErrors(0)
+        {
+        }
+    };
+
+
+    /* Render backend that doesn't draw anything, so it can be used without a graphics
+     * context (on a headless machine, for instance) to measure how much work the CPU side
+     * of the renderer does.
+     *
+     * It keeps track of the state OpenGL would have and checks every call against it.
+     * Invalid calls (drawing from a buffer that's too small, binding a buffer that was
+     * never created, popping an empty matrix stack and so on) increase the validation
+     * error counter and then throw an exception, so mistakes are caught where they happen.
+     * Every valid call is counted in the statistics.
+     *
+     * Buffers are given real memory on the heap, so MapBuffer() returns memory the caller
+     * can write to. Calls made while a display list is being built are not counted, but
+     * the draw calls in it are counted every time the list is called. */
+    class NullBackend : public IRenderBackend
+    {
+
+
+    private:
+
+        /* Constants for the amount of each type of state tracked. */
+        static const unsigned int amountOfCapabilities = 7;
+        static const unsigned int amountOfClientArrays = 4;
+        static const unsigned int amountOfBufferTargets = 3;
+        // The smallest maximum stack depths the OpenGL specification allows
+        static const unsigned int maxModelviewDepth = 32;
+        static const unsigned int maxProjectionDepth = 2;
+        // Fixed function OpenGL always supports at least eight lights
+        static const unsigned int maxLights = 8;
+
+        /* Memory for a buffer object. */
+        struct Buffer
+        {
+            std::vector<char> data;
+            bool mapped;
+        };
+        typedef std::map<unsigned int, Buffer> BufferTable;
+
+        /* The draw calls stored in a display list. */
+        struct DisplayList
+        {
+            unsigned int drawCalls;
+            unsigned int verticesDrawn;
+        };
+        typedef std::map<unsigned int, DisplayList> ListTable;
+
+        /* Where a vertex array reads its data from. */
+        struct ArrayPointer
+        {
+            unsigned int buffer; // Buffer bound when the pointer was set, 0 for client memory
+            unsigned int offset; // Offset into the buffer, in bytes
+            unsigned int stride;
+            unsigned int size; // Size of one element, in bytes
+        };
+
+        BackendStatistics statistics;
+
+        bool capabilities[amountOfCapabilities];
+        bool clientArrays[amountOfClientArrays];
+        bool lights[maxLights];
+        MatrixStack matrixMode;
+        unsigned int modelviewDepth, projectionDepth;
+
+        BufferTable buffers;
+        unsigned int nextBufferID;
+        unsigned int boundBuffers[amountOfBufferTargets];
+        ArrayPointer vertexPointer;
+
+        std::map<unsigned int, unsigned int> textures; // Maps texture IDs to the amount of bytes they use
+        unsigned int nextTextureID;
+        unsigned int boundTexture;
+        std::map<unsigned int, unsigned int> arrayLayers; // Maps array texture IDs to their amount of layers
+        unsigned int boundArrayTexture; // Array texture bound to unit 0
+
+        std::map<unsigned int, bool> framebuffers; // Maps framebuffer IDs to whether they can be drawn into
+        unsigned int nextFramebufferID;
+        unsigned int boundFramebuffer;
+        std::map<unsigned int, unsigned int> renderbuffers; // Maps renderbuffer IDs to the amount of bytes they use
+        unsigned int nextRenderbufferID;
+
+        std::map<unsigned int, bool> queries; // Maps query IDs to whether they have a result
+        unsigned int nextQueryID;
+        unsigned int runningQuery; // Query between BeginTimerQuery() and EndTimerQuery(), 0 if none
+
+        ListTable lists;
+        unsigned int nextListID;
+        unsigned int listBase;
+        unsigned int compilingList; // List between BeginList() and EndList(), 0 if none
+
+        unsigned int currentProgram;
+
+
+        /* Increases the validation error counter and throws an exception with the message. */
+        void ValidationError(const std::string& message);
+        /* Counts a state change, unless a display list is being built. */
+        void StateChange();
+        /* Counts a matrix operation, unless a display list is being built. */
+        void MatrixOperation();
+        /* Counts a draw call, either in the statistics or in the list being built. */
+        void CountDraw(unsigned int amount);
+
+        /* Returns the buffer bound to the given target. Throws if nothing is bound. */
+        Buffer& GetBound(BufferTarget target, const char* method);
+        /* Returns a reference to the depth of the current matrix stack. */
+        unsigned int& GetMatrixDepth();
+
+
+    public:
+
+        NullBackend();
+
+        /* Returns the counters for every call made since creation or ResetStatistics(). */
+        const BackendStatistics& GetStatistics() const { return statistics; }
+        void ResetStatistics() { statistics = BackendStatistics(); }
+
+
+        void Enable(RenderCapability capability);
+        void Disable(RenderCapability capability);
+        bool IsEnabled(RenderCapability capability);
+        void SetBlendMode(BlendMode mode);
+        void SetDepthWrite(bool enabled);
+
+        void SetClearColour(const colourf& colour);
+        void Clear(unsigned int flags);
+        void SetViewport(int x, int y, int width, int height);
+
+        void SetColour(const colourf& colour);
+        void SetMaterialColour(MaterialColour property, const colourf& colour);
+        void SetMaterialShininess(float shininess);
+
+        unsigned int GetMaxLights();
+        void EnableLight(unsigned int light);
+        void DisableLight(unsigned int light);
+        void SetLightVector(unsigned int light, LightParameter parameter, const float* values);
+        void SetLightValue(unsigned int light, LightParameter parameter, float value);
+        void SetLightModel(const colourf& globalAmbient, bool localViewer, bool twoSided);
+
+        void SetMatrixMode(MatrixStack stack);
+        void LoadMatrix(const float* matrix);
+        void MultiplyMatrix(const float* matrix);
+        void PushMatrix();
+        void PopMatrix();
+        void Translate(float x, float y, float z);
+        void Rotate(float angle, float x, float y, float z);
+
+        void GenerateBuffers(unsigned int amount, unsigned int* ids);
+        void DeleteBuffers(unsigned int amount, const unsigned int* ids);
+        void BindBuffer(BufferTarget target, unsigned int id);
+        unsigned int GetBoundBuffer(BufferTarget target);
+        void BufferData(BufferTarget target, unsigned int size, const void* data);
+        void* MapBuffer(BufferTarget target);
+        bool UnmapBuffer(BufferTarget target);
+
+        void EnableClientArray(ClientArray clientArray);
+        void DisableClientArray(ClientArray clientArray);
+        bool IsClientArrayEnabled(ClientArray clientArray);
+        void SetVertexPointer(unsigned int components, unsigned int stride, const void* pointer);
+        void SetTexCoordPointer(unsigned int components, unsigned int stride, const void* pointer);
+        void SetNormalPointer(unsigned int stride, const void* pointer);
+        void SetColourPointer(unsigned int components, unsigned int stride, const void* pointer);
+        void EnableAttributeArray(unsigned int location);
+        void DisableAttributeArray(unsigned int location);
+        void SetAttributePointer(unsigned int location, unsigned int components,
+            unsigned int stride, const void* pointer);
+
+        void DrawArrays(PrimitiveType type, unsigned int start, unsigned int amount);
+        void DrawElements(PrimitiveType type, unsigned int start, unsigned int amount);
+
+        void GenerateTextures(unsigned int amount, unsigned int* ids);
+        void DeleteTextures(unsigned int amount, const unsigned int* ids);
+        bool IsTexture(unsigned int id);
+        void BindTexture(unsigned int id);
+        void SetTextureFilter(TextureFilter filter, bool magnification);
+        void SetTextureWrapping(TextureWrapping wrapping, unsigned int coordinate);
+        void UploadTexture(unsigned int level, unsigned int width, unsigned int height,
+            PixelFormat format, const void* pixels);
+
+        unsigned int GenerateLists(unsigned int amount);
+        void DeleteLists(unsigned int first, unsigned int amount);
+        void BeginList(unsigned int id);
+        void EndList();
+        void SetListBase(unsigned int base);
+        void CallLists(unsigned int amount, const unsigned char* lists);
+
+        void UseProgram(unsigned int handle);
+
+        bool SupportsTextureBuffers();
+        void BindTextureBuffer(unsigned int unit, unsigned int texture, unsigned int buffer);
+
+        bool SupportsArrayTextures();
+        void BindArrayTexture(unsigned int unit, unsigned int texture);
+        void AllocateArrayTexture(unsigned int width, unsigned int height, unsigned int layers,
+            const TextureParameters& params);
+        void UploadArrayTextureLayer(unsigned int layer, unsigned int width, unsigned int height,
+            PixelFormat format, const void* pixels);
+
+        void BindUnitTexture(unsigned int unit, unsigned int texture);
+        void SetUnitTexCoordPointer(unsigned int unit, unsigned int components, unsigned int stride,
+            const void* pointer);
+        void DisableUnitTexCoordArray(unsigned int unit);
+
+        bool SupportsRenderTargets();
+        void GenerateFramebuffers(unsigned int amount, unsigned int* ids);
+        void DeleteFramebuffers(unsigned int amount, const unsigned int* ids);
+        void BindFramebuffer(unsigned int id);
+        void GenerateRenderbuffers(unsigned int amount, unsigned int* ids);
+        void DeleteRenderbuffers(unsigned int amount, const unsigned int* ids);
+        void AllocateDepthRenderbuffer(unsigned int id, unsigned int width, unsigned int height);
+        bool AttachToFramebuffer(unsigned int colourTexture, unsigned int depthRenderbuffer);
+        void BlitFramebuffer(unsigned int source, unsigned int sourceWidth, unsigned int sourceHeight,
+            unsigned int destination, unsigned int destinationWidth, unsigned int destinationHeight);
+
+        bool SupportsTimerQueries();
+        void GenerateQueries(unsigned int amount, unsigned int* ids);
+        void DeleteQueries(unsigned int amount, const unsigned int* ids);
+        void BeginTimerQuery(unsigned int id);
+        void EndTimerQuery();
+        bool GetTimerQueryResult(unsigned int id, float& milliseconds);
+
+        bool SupportsShadowMaps();
+        void AllocateDepthTexture(unsigned int width, unsigned int height);
+        bool AttachDepthTextureToFramebuffer(unsigned int depthTexture);
+        void BlitFramebufferDepth(unsigned int source, unsigned int destination, unsigned int width,
+            unsigned int height);
+        void BindDepthTexture(unsigned int unit, unsigned int texture);
+        void SetPolygonOffset(float factor, float units);
+
+
+    };
+
+}
+
+}
+
+#endif
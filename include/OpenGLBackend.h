@@ -0,0 +1,144 @@
+/*
+ * File:   OpenGLBackend.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 2:05 PM
+ * Added SetDepthWrite() on October 19, 2026, 4:55 AM
+ */
+
+#ifndef OPENGLBACKEND_H
+#define OPENGLBACKEND_H
+
+#include "RenderBackend.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Render backend that passes every call straight on to OpenGL. An OpenGL context
+     * must be current on the calling thread. */
+    class OpenGLBackend : public IRenderBackend
+    {
+
+    public:
+
+        void Enable(RenderCapability capability);
+        void Disable(RenderCapability capability);
+        bool IsEnabled(RenderCapability capability);
+        void SetBlendMode(BlendMode mode);
+        void SetDepthWrite(bool enabled);
+
+        void SetClearColour(const colourf& colour);
+        void Clear(unsigned int flags);
+        void SetViewport(int x, int y, int width, int height);
+
+        void SetColour(const colourf& colour);
+        void SetMaterialColour(MaterialColour property, const colourf& colour);
+        void SetMaterialShininess(float shininess);
+
+        unsigned int GetMaxLights();
+        void EnableLight(unsigned int light);
+        void DisableLight(unsigned int light);
+        void SetLightVector(unsigned int light, LightParameter parameter, const float* values);
+        void SetLightValue(unsigned int light, LightParameter parameter, float value);
+        void SetLightModel(const colourf& globalAmbient, bool localViewer, bool twoSided);
+
+        void SetMatrixMode(MatrixStack stack);
+        void LoadMatrix(const float* matrix);
+        void MultiplyMatrix(const float* matrix);
+        void PushMatrix();
+        void PopMatrix();
+        void Translate(float x, float y, float z);
+        void Rotate(float angle, float x, float y, float z);
+
+        void GenerateBuffers(unsigned int amount, unsigned int* ids);
+        void DeleteBuffers(unsigned int amount, const unsigned int* ids);
+        void BindBuffer(BufferTarget target, unsigned int id);
+        unsigned int GetBoundBuffer(BufferTarget target);
+        void BufferData(BufferTarget target, unsigned int size, const void* data);
+        void* MapBuffer(BufferTarget target);
+        bool UnmapBuffer(BufferTarget target);
+
+        void EnableClientArray(ClientArray clientArray);
+        void DisableClientArray(ClientArray clientArray);
+        bool IsClientArrayEnabled(ClientArray clientArray);
+        void SetVertexPointer(unsigned int components, unsigned int stride, const void* pointer);
+        void SetTexCoordPointer(unsigned int components, unsigned int stride, const void* pointer);
+        void SetNormalPointer(unsigned int stride, const void* pointer);
+        void SetColourPointer(unsigned int components, unsigned int stride, const void* pointer);
+        void EnableAttributeArray(unsigned int location);
+        void DisableAttributeArray(unsigned int location);
+        void SetAttributePointer(unsigned int location, unsigned int components,
+            unsigned int stride, const void* pointer);
+
+        void DrawArrays(PrimitiveType type, unsigned int start, unsigned int amount);
+        void DrawElements(PrimitiveType type, unsigned int start, unsigned int amount);
+
+        void GenerateTextures(unsigned int amount, unsigned int* ids);
+        void DeleteTextures(unsigned int amount, const unsigned int* ids);
+        bool IsTexture(unsigned int id);
+        void BindTexture(unsigned int id);
+        void SetTextureFilter(TextureFilter filter, bool magnification);
+        void SetTextureWrapping(TextureWrapping wrapping, unsigned int coordinate);
+        void UploadTexture(unsigned int level, unsigned int width, unsigned int height,
+            PixelFormat format, const void* pixels);
+
+        unsigned int GenerateLists(unsigned int amount);
+        void DeleteLists(unsigned int first, unsigned int amount);
+        void BeginList(unsigned int id);
+        void EndList();
+        void SetListBase(unsigned int base);
+        void CallLists(unsigned int amount, const unsigned char* lists);
+
+        void UseProgram(unsigned int handle);
+
+        bool SupportsTextureBuffers();
+        void BindTextureBuffer(unsigned int unit, unsigned int texture, unsigned int buffer);
+
+        bool SupportsArrayTextures();
+        void BindArrayTexture(unsigned int unit, unsigned int texture);
+        void AllocateArrayTexture(unsigned int width, unsigned int height, unsigned int layers,
+            const TextureParameters& params);
+        void UploadArrayTextureLayer(unsigned int layer, unsigned int width, unsigned int height,
+            PixelFormat format, const void* pixels);
+
+        void BindUnitTexture(unsigned int unit, unsigned int texture);
+        void SetUnitTexCoordPointer(unsigned int unit, unsigned int components, unsigned int stride,
+            const void* pointer);
+        void DisableUnitTexCoordArray(unsigned int unit);
+
+        bool SupportsRenderTargets();
+        void GenerateFramebuffers(unsigned int amount, unsigned int* ids);
+        void DeleteFramebuffers(unsigned int amount, const unsigned int* ids);
+        void BindFramebuffer(unsigned int id);
+        void GenerateRenderbuffers(unsigned int amount, unsigned int* ids);
+        void DeleteRenderbuffers(unsigned int amount, const unsigned int* ids);
+        void AllocateDepthRenderbuffer(unsigned int id, unsigned int width, unsigned int height);
+        bool AttachToFramebuffer(unsigned int colourTexture, unsigned int depthRenderbuffer);
+        void BlitFramebuffer(unsigned int source, unsigned int sourceWidth, unsigned int sourceHeight,
+            unsigned int destination, unsigned int destinationWidth, unsigned int destinationHeight);
+
+        bool SupportsTimerQueries();
+        void GenerateQueries(unsigned int amount, unsigned int* ids);
+        void DeleteQueries(unsigned int amount, const unsigned int* ids);
+        void BeginTimerQuery(unsigned int id);
+        void EndTimerQuery();
+        bool GetTimerQueryResult(unsigned int id, float& milliseconds);
+
+        bool SupportsShadowMaps();
+        void AllocateDepthTexture(unsigned int width, unsigned int height);
+        bool AttachDepthTextureToFramebuffer(unsigned int depthTexture);
+        void BlitFramebufferDepth(unsigned int source, unsigned int destination, unsigned int width,
+            unsigned int height);
+        void BindDepthTexture(unsigned int unit, unsigned int texture);
+        void SetPolygonOffset(float factor, float units);
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,230 @@
+/*
+ * File:   ParticleSystem.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 11:10 PM
+ * Changed to draw particles without writing depth on October 19, 2026, 4:55 AM
+ */
+
+#ifndef PARTICLESYSTEM_H
+#define PARTICLESYSTEM_H
+
+#include <vector>
+#include "RenderDevice.h"
+#include "ThreadPool.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Describes how a ParticleEmitter creates and moves its particles. Random values are
+     * picked evenly between the base value minus and plus the variation. */
+    struct ParticleEmitterSettings
+    {
+        unsigned int maxParticles; // Particles that can be alive at once, new ones aren't emitted past this
+        float emissionRate; // Particles emitted every second, can be 0 for emitters only used with Emit()
+        float minLifetime, maxLifetime; // Seconds each particle lives for
+
+        maths::vector3f position; // Centre of the box particles are emitted in
+        maths::vector3f positionVariation; // Half the size of that box
+        maths::vector3f velocity, velocityVariation; // Velocity particles are emitted with
+        maths::vector3f acceleration; // Added to every particle's velocity every second (gravity, wind)
+        float drag; // Fraction of a particle's velocity lost every second
+
+        /* A particle's colour and size go from the start to the end values over its life. */
+        colourf startColour, endColour;
+        float startSize, endSize;
+
+        SkinHandle skin; // Skin every particle is drawn with, invalidHandle for none
+        BlendMode blendMode; // BLENDMODE_ADDITIVE suits fire and sparks, BLENDMODE_ALPHA suits smoke
+
+        /* Defaults to a thousand white particles a second going upwards for a second. */
+        ParticleEmitterSettings() :
+            maxParticles(1000), emissionRate(1000.0f), minLifetime(1.0f), maxLifetime(1.0f),
+            position(0.0f, 0.0f, 0.0f), positionVariation(0.0f, 0.0f, 0.0f),
+            velocity(0.0f, 1.0f, 0.0f), velocityVariation(0.0f, 0.0f, 0.0f),
+            acceleration(0.0f, 0.0f, 0.0f), drag(0.0f),
+            startColour(1.0f, 1.0f, 1.0f, 1.0f), endColour(1.0f, 1.0f, 1.0f, 0.0f),
+            startSize(1.0f), endSize(1.0f),
+            skin(invalidHandle), blendMode(BLENDMODE_ALPHA)
+        {
+        }
+    };
+
+
+    /* Creates, moves and kills a group of particles that all share the same settings.
+     *
+     * Particles are stored as a structure of arrays: every property (position x, position y,
+     * age and so on) has its own array, so the update can work on four particles at a time
+     * with SSE instructions and only reads the memory it needs. The alive particles are
+     * always at the start of the arrays; dead ones are removed by moving the alive ones
+     * after them down (stream compaction), so the arrays never have gaps in them.
+     *
+     * Every emitter has its own random number generator and touches nothing but its own
+     * memory, so different emitters can be updated by different threads at once. */
+    class ParticleEmitter
+    {
+
+
+    private:
+
+        // Every array a particle has a value in
+        enum Lane
+        {
+            LANE_POSITIONX, LANE_POSITIONY, LANE_POSITIONZ,
+            LANE_VELOCITYX, LANE_VELOCITYY, LANE_VELOCITYZ,
+            LANE_AGE, LANE_INVERSELIFETIME,
+            LANE_RED, LANE_GREEN, LANE_BLUE, LANE_ALPHA,
+            LANE_SIZE,
+            AMOUNT_OF_LANES
+        };
+
+        ParticleEmitterSettings settings;
+
+        /* All the arrays are in one block of memory, each one starting on a 16 byte boundary
+         * and holding a multiple of four particles, so SSE can always load four at a time. */
+        char* memory;
+        float* lanes[AMOUNT_OF_LANES];
+        unsigned int laneCapacity; // maxParticles rounded up to a multiple of four
+        unsigned int amountOfParticles; // Particles alive, which are the first ones in each array
+
+        float emissionRemainder; // Fraction of a particle left over from the last update's emission
+        bool emitting; // If false, Update() doesn't emit anything
+        unsigned int randomState;
+
+        /* Copying would make two emitters share their particle memory. */
+        ParticleEmitter(const ParticleEmitter& emitter);
+        ParticleEmitter& operator=(const ParticleEmitter& emitter);
+
+        /* Allocates the arrays for the current maxParticles, keeping as many particles as fit. */
+        void AllocateLanes();
+        /* Returns a random number from 0 up to (but not including) 1. */
+        float Random();
+        /* Returns a random number between 'value' - 'variation' and 'value' + 'variation'. */
+        float Vary(float value, float variation) { return value + (variation * ((Random() * 2.0f) - 1.0f)); }
+
+        /* Moves the particles and works out their colours and sizes. */
+        void Integrate(float deltaTime);
+        /* Removes the particles that have lived out their lifetimes. */
+        void KillDeadParticles();
+
+
+    public:
+
+        /* Throws an InvalidArgumentException if the settings don't make sense. The seed
+         * changes the random numbers used, so emitters with the same settings look different. */
+        ParticleEmitter(const ParticleEmitterSettings& emitterSettings, unsigned int randomSeed);
+        ~ParticleEmitter();
+
+        /* Moves every particle forward by 'deltaTime' seconds, kills the ones that have died
+         * and emits new ones. */
+        void Update(float deltaTime);
+        /* Emits the given amount of particles straight away, or as many as there's room for. */
+        void Emit(unsigned int amount);
+        /* Kills every particle. */
+        void Clear() { amountOfParticles = 0; }
+
+        /* Writes a quad facing the camera for every particle, four vertices each made up of
+         * a position, texture coordinates and colour (nine floats). 'right' and 'up' are the
+         * camera's right and up directions in world space. Returns the amount of particles
+         * written. */
+        unsigned int WriteQuads(float* vertices, const float* right, const float* up) const;
+
+        /* Changing the maximum amount of particles reallocates the arrays, killing any
+         * particles that don't fit anymore. */
+        void SetSettings(const ParticleEmitterSettings& newSettings);
+        const ParticleEmitterSettings& GetSettings() const { return settings; }
+        void SetPosition(const maths::vector3f& position) { settings.position = position; }
+        void SetEmitting(bool emit) { emitting = emit; }
+        bool IsEmitting() const { return emitting; }
+        unsigned int GetAmountOfParticles() const { return amountOfParticles; }
+
+
+    };
+
+
+    /* Holds a set of emitters, updating them and drawing all of their particles.
+     *
+     * Particles are drawn as quads facing the camera, written straight into a vertex buffer
+     * that is thrown away and refilled every frame, then drawn with one call per emitter.
+     * Given a thread pool, emitters are updated (and their quads written) in parallel, one
+     * emitter per task, so effects made of several emitters scale across cores. Particles
+     * are lit by nothing and drawn with the blend mode of their emitter, without writing to
+     * the depth buffer, so they should be drawn after everything opaque.
+     *
+     * Particles are in world space, so Render() must be called in 3D mode with the device's
+     * view matrix loaded (which is how the device leaves it). */
+    class ParticleSystem : public general::ITask
+    {
+
+
+    private:
+
+        // Floats for each vertex (position, texture coordinates, colour) and each particle's quad
+        static const unsigned int floatsPerVertex = 9;
+        static const unsigned int floatsPerParticle = floatsPerVertex * 4;
+
+        // Which of the jobs the system splits across threads is being dispatched
+        enum Job
+        {
+            JOB_UPDATE,
+            JOB_WRITEQUADS
+        };
+
+        std::vector<ParticleEmitter*> emitters; // Owned by the system
+        unsigned int nextSeed; // Seed given to the next emitter added
+
+        RenderDevice* renderDevice; // Used for setting the skins and getting the camera
+        IRenderBackend* backend; // The render device's backend
+        general::ThreadPool* threadPool; // Pool updates are split across, NULL to do everything on this thread
+        unsigned int vboID; // Buffer the quads are streamed into
+
+        /* State of the job being dispatched, read by Execute(). */
+        Job currentJob;
+        float jobDeltaTime;
+        float* jobVertices; // Mapped vertex buffer
+        std::vector<unsigned int> particleOffsets; // Index of the first particle of each emitter in the buffer
+        float cameraRight[3], cameraUp[3];
+
+        /* Runs the current job for every emitter, in parallel if there's a thread pool. */
+        void RunJob(Job job);
+
+
+    public:
+
+        /* 'pool' can be NULL, in which case everything is done on the calling thread. Neither
+         * is owned by the system. */
+        ParticleSystem(RenderDevice* device, general::ThreadPool* pool);
+        /* Deletes every emitter and the vertex buffer. */
+        ~ParticleSystem();
+
+        /* Creates an emitter that is owned by the system. Throws an exception if the settings
+         * don't make sense. */
+        ParticleEmitter* AddEmitter(const ParticleEmitterSettings& settings);
+        /* Deletes the given emitter. Does nothing if it isn't one of this system's. */
+        void RemoveEmitter(ParticleEmitter* emitter);
+
+        /* Updates every emitter by 'deltaTime' seconds. */
+        void Update(float deltaTime);
+        /* Draws every particle. */
+        void Render();
+
+        /* Called by the thread pool, runs the current job for the emitter at 'index'. */
+        void Execute(unsigned int index, unsigned int threadIndex);
+
+        void SetThreadPool(general::ThreadPool* pool) { threadPool = pool; }
+        unsigned int GetAmountOfEmitters() const { return emitters.size(); }
+        ParticleEmitter* GetEmitter(unsigned int index) { return emitters[index]; }
+        // Total amount of particles alive in every emitter
+        unsigned int GetAmountOfParticles() const;
+
+
+    };
+
+}
+
+}
+
+#endif
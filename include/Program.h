@@ -1,168 +1,354 @@
-/*
- * File:   Program.h
- * Author: Donald "Datriot" Whyte
- *
- * Created on April 10, 2009, 7:12 PM
- */
-
-#ifndef PROGRAM_H
-#define PROGRAM_H
-
-#include <vector>
-#include <map>
-#include <string>
-#include "Shader.h"
-#include "Matrix.h"
-
-namespace parcel
-{
-
-namespace graphics
-{
-
-    /* Encapsulates shader program creation, management and deletion. */
-    class Program
-    {
-
-
-    private:
-
-        std::map<std::string, Shader*> shaders; // Holds every shader with an ID as a lookup key
-
-        bool linked; // True if the program was successfully linked
-        bool enabled; // True if the program is currently being used by the pipeline
-
-        GLint glHandle; // OpenGL handle to the program
-
-
-        /* Returns the location of a uniform/attribute variable inside this program.
-         * When isUniform is true, it looks for a uniform variable with the given
-         * name. Similarly. when isUniform is false, it looks for an attribute variable
-         * with the given name. Throws an exception if it fails to find the variable. */
-        GLint GetVariableLocation(const std::string& varName, bool isUniform) const;
-
-
-    public:
-
-        /* Constructor and destructor. Creates and deletes the program respectively. */
-        Program();
-        ~Program();
-
-        /* Links the program. Returns true when it's a success When it fails to link,
-         * it prints out an info log to explain why it failed. */
-        bool Link();
-
-        /* Enables and disables the program respectively. Does nothing if the program
-         * hasn't been linked beforehand. */
-        void Enable();
-        void Disable();
-
-        /* Adds a shader to the map. If 'attach' is true, then the method automatically
-         * attaches the shader to the program, providing that the program is not linked.
-         * If the ID given has already been taken, then it returns false. If the ID has not
-         * been taken, it adds it to the map and returns true.
-         * NOTE: If ID is already used, it will not add the given shader AND it will
-         * delete the shader object given, invalidating the pointer passed through the
-         * parameters. Make sure to pass new objects through this method by using
-         * 'new Shader(...)' instead of passing a pointer, sicne it may become invalidated. */
-        bool AddShader(Shader* shader, const std::string& id, bool attach);
-        /* Removes the shader with the given shader, before getting rid of it, it
-         * makes sure the shader is detached from the program. Returns true
-         * if it successfully found and deleted the shader. */
-        bool RemoveShader(const std::string& id);
-
-        /* Getters */
-        Shader* GetShader(const std::string& id); // returns NULL if it couldn't find the shader
-        const bool& IsEnabled() { return enabled; }
-
-        /* The following methods are for retrieving or altering the values of the uniform
-         * and attribute variables inside the shader program held in this class.
-         * This is key to communicating between the host OpenGL application (this)
-         * and the shaders (in this class). There are getter and setter methods for both
-         * integers, floats, vectors and matrices. Simply use the integer methods when
-         * getting/setting boolean variables.
-         *
-         * NOTE1: GetUniformFloat/Int/ ONLY return the first element in an array if the full
-         * array was specified. Basically, passing myArray will be the same as passing
-         * myArray[0], so only the first element is returned.
-         *
-         * NOTE2: Matrices passed to SetUniformMatrixFloat/Int must be a size from 2x2
-         * to 4x4, otherwise an exception is thrown.
-         *
-         * NOTE3: Make sure the amount of rows and columns given as arguments in
-         * GetUniformFloat/Int are the VALID size of the matrix in the shader. The wrong
-         * size may cause undefined behaviour. Additionally, if rows or columns given is
-         * higher than 4 or lower than 2, an exception is thown.
-         *
-         * NOTE4: Also, unlike SetUniform, SetUniformMatrix cannot only assign one
-         * matrix at a time, which means if there is an array of matrices in the shader,
-         * each element has to be assigned with a new call to SetUniformMatrix.
-         *
-         * NOTE5: Because there are arrays that are dynamically allocated in the
-         * Get/SetUniformMatrixInt/Float methods, they may run slower than usual.
-         * I may come up with a way of not using this in the future.
-         *
-         * NOTE6: There is no integer equivilent for the Get/SetUniformMatrix methods
-         * because GLSL only supports matrices with contain floats. So the integers
-         * passed to SetUniformMatrix are converted to floats and the floats gotten
-         * from GetUniformMatrix are converted to integers. */
-
-        /* Getting float uniforms. */
-        std::vector<float> GetUniformFloat(const std::string& varName, unsigned int amount) const;
-        maths::matrixf GetUniformMatrixFloat(const std::string& varName, unsigned int rows,
-            unsigned int columns) const;
-        /* Setting float uniforms. */
-        void SetUniform(const std::string& varName, const std::vector<float>& values);
-        void SetUniform(const std::string& varName, const std::vector<maths::vector2f>& values);
-        void SetUniform(const std::string& varName, const std::vector<maths::vector3f>& values);
-        void SetUniform(const std::string& varName, const std::vector<maths::vector4f>& values);
-        void SetUniformMatrix(const std::string& varName, const maths::matrixf& mat);
-
-        /* Getting integer uniforms. */
-        std::vector<int> GetUniformInt(const std::string& varName, unsigned int amount) const;
-        maths::matrixi GetUniformMatrixInt(const std::string& varName, unsigned int rows,
-            unsigned int columns) const;
-        /* Setting integer uniforms. */
-        void SetUniform(const std::string& varName, const std::vector<int>& values);
-        void SetUniform(const std::string& varName, const std::vector<maths::vector2i>& values);
-        void SetUniform(const std::string& varName, const std::vector<maths::vector3i>& values);
-        void SetUniform(const std::string& varName, const std::vector<maths::vector4i>& values);
-        void SetUniformMatrix(const std::string& varName, const maths::matrixi& mat);
-
-        /* Enables and disables an attribute array (much like EnableClientState()) respectively. */
-        void EnableAttributeArray(const std::string& varName);
-        void DisableAttributeArray(const std::string& varName);
-
-        /* Fills in an attribute array using the given properties. Enabling/disabling the
-         * array is the job of the two methods above; this method just fills an attribute
-         * array's values via a call to glVertexAttribPointer(). */
-        // TODO: Test the vertex attribute functions!!!
-
-        /* Float attribute arrays. */
-        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-            const std::vector<float>& elements);
-        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-            const std::vector<maths::vector2f>& elements);
-        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-            const std::vector<maths::vector3f>& elements);
-        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-            const std::vector<maths::vector4f>& elements);
-
-        /* Integer attribute arrays. */
-        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-            const std::vector<int>& elements);
-        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-            const std::vector<maths::vector2i>& elements);
-        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-            const std::vector<maths::vector3i>& elements);
-        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-            const std::vector<maths::vector4i>& elements);
-
-
-    };
-
-}
-
-}
-
-#endif
+/*
+ * File:   Program.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on April 10, 2009, 7:12 PM
+ * Added enabling through a render backend on October 18, 2026, 6:20 PM
+ * Added location getters on October 18, 2026, 8:15 PM
+ * Added cached locations and location setters on October 19, 2026, 1:20 AM
+ * Added shadowed uniform values on October 19, 2026, 1:35 AM
+ * Added linking through a program cache on October 19, 2026, 1:50 AM
+ * Added starting a link without waiting for it on October 19, 2026, 2:30 AM
+ */
+
+#ifndef PROGRAM_H
+#define PROGRAM_H
+
+#include <vector>
+#include <map>
+#include <string>
+#include <windows.h>
+#include "Shader.h"
+#include "Matrix.h"
+#include "RenderBackend.h"
+#include "ProgramCache.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Locations of a uniform or attribute variable in a linked program, found once with
+     * Program::Find() or Program::FindAttribute() and then used to set the variable without
+     * looking its name up again. -1 means the variable isn't in the program (or the compiler
+     * optimised it out), and setting it does nothing. */
+    typedef GLint UniformLocation;
+    typedef GLint AttributeLocation;
+
+
+    /* Encapsulates shader program creation, management and deletion.
+     *
+     * When the program links, every active uniform and attribute is read from OpenGL into a
+     * table of names and locations, so nothing asks OpenGL for a location again. The methods
+     * that take a variable's name look it up in the table. For variables set every time
+     * something is drawn, find the location once with Find() and use the Set() methods, which
+     * only make the one OpenGL call that sets the value.
+     *
+     * The program also keeps a copy of every uniform's value (a shadow copy), and every setter
+     * compares the new value with it first. Setting a uniform to exactly the value it already
+     * has doesn't call OpenGL at all. This assumes the program's uniforms are only ever set
+     * through this class, while it's enabled. */
+    class Program
+    {
+
+
+    private:
+
+        /* What OpenGL says about an active uniform or attribute. */
+        struct VariableInfo
+        {
+            GLint location;
+            GLenum type; // GL_FLOAT_VEC3, GL_SAMPLER_2D and so on
+            GLint size; // Amount of elements, for arrays
+        };
+
+        typedef std::map<std::string, VariableInfo> VariableTable;
+
+        /* Where the shadow copy of the uniform at a location is kept. Array elements each have
+         * a location, and the shadow copies of an array's elements are next to each other. */
+        struct UniformShadow
+        {
+            unsigned int offset; // Byte in 'shadowValues' the element's value starts at
+            unsigned int bytes; // Bytes from there to the end of the array
+            unsigned int element; // Index of the element in 'shadowWritten'
+            unsigned int elementBytes; // Size of one element, 0 if the location isn't shadowed
+        };
+
+        // Locations above this aren't shadowed, so a driver with sparse locations can't make the table huge
+        static const GLint maxShadowedLocation = 4096;
+        // Uniform updates since the last call to ResetUniformCounters(), for every program
+        static unsigned int uniformUpdatesIssued;
+        static unsigned int uniformUpdatesSkipped;
+
+        std::map<std::string, Shader*> shaders; // Holds every shader with an ID as a lookup key
+
+        bool linked; // True if the program was successfully linked
+        bool linking; // True if StartLink() started linking, but the status hasn't been read
+        bool enabled; // True if the program is currently being used by the pipeline
+
+        GLint glHandle; // OpenGL handle to the program
+
+        VariableTable uniforms; // Every active uniform, filled in when the program links
+        VariableTable attributes; // Same for attributes
+
+        // Link started by StartLink(), which is finished by FinishLink()
+        ProgramCache* linkCache; // Cache the program's stored in once it's linked, NULL for none
+        std::string linkKey; // Key it's stored under
+        LARGE_INTEGER linkStartTime; // Performance counter when the link started
+
+        std::vector<UniformShadow> uniformShadows; // Indexed by location
+        std::vector<unsigned char> shadowValues; // Last value of every uniform element set
+        std::vector<unsigned char> shadowWritten; // 1 for every element that's been set, 0 if not
+
+
+        /* Returns the location of a uniform/attribute variable inside this program.
+         * When isUniform is true, it looks for a uniform variable with the given
+         * name. Similarly. when isUniform is false, it looks for an attribute variable
+         * with the given name. Throws an exception if it fails to find the variable. */
+        GLint GetVariableLocation(const std::string& varName, bool isUniform) const;
+        /* Reads every active uniform and attribute into the tables. Elements of arrays are
+         * added under their own names ("lights[2]") as well as the array's name. */
+        void ReadVariables();
+        /* Compares a value about to be set at a location with its shadow copy, and if it's
+         * different, replaces the copy. Returns true if the value has to be sent to OpenGL
+         * (which it always does for locations that aren't shadowed). */
+        bool UniformChanged(UniformLocation location, const void* values, unsigned int bytes);
+        /* Returns the text a program cache stores this program's binary under: the type and
+         * source of every shader, in order of their IDs. */
+        std::string GetCacheKey() const;
+        /* Tells the link cache how long it's been since the link started. */
+        void RecordLinkTime(bool fromCache);
+
+
+    public:
+
+        /* Constructor and destructor. Creates and deletes the program respectively. */
+        Program();
+        ~Program();
+
+        /* Links the program. Returns true when it's a success When it fails to link,
+         * it prints out an info log to explain why it failed. */
+        bool Link();
+        /* Same as above, but loads the program from the cache if it has it. Otherwise, compiles
+         * any shaders that haven't been compiled, attaches any that aren't attached, links the
+         * program and stores it in the cache. To save the most time, add the shaders without
+         * compiling them and let this compile them only if it has to. Returns false if a
+         * shader didn't compile or the program didn't link. With a NULL cache, the shaders are
+         * compiled, attached and linked without one. */
+        bool Link(ProgramCache* cache);
+        /* The same as Link(cache), split in two so the link doesn't have to be waited for.
+         * StartLink() loads the program from the cache, or starts compiling its shaders and
+         * linking it without reading their status. With GL_KHR_parallel_shader_compile, the
+         * driver does that on its own threads, and IsLinkComplete() returns true once it's
+         * done (it always returns true without the extension). FinishLink() reads the status,
+         * waiting for the link if it isn't complete, and returns what Link() would have. */
+        void StartLink(ProgramCache* cache);
+        bool IsLinkComplete() const;
+        bool FinishLink();
+
+        /* Enables and disables the program respectively. Does nothing if the program
+         * hasn't been linked beforehand. */
+        void Enable();
+        void Disable();
+        /* Same as above, but makes the program current through the given backend, so
+         * the backend can keep track of (and skip) program changes. Use the backend
+         * from RenderDevice::GetBackend() when drawing with a render device. */
+        void Enable(IRenderBackend* backend);
+        void Disable(IRenderBackend* backend);
+
+        /* Adds a shader to the map. If 'attach' is true, then the method automatically
+         * attaches the shader to the program, providing that the program is not linked.
+         * If the ID given has already been taken, then it returns false. If the ID has not
+         * been taken, it adds it to the map and returns true.
+         * NOTE: If ID is already used, it will not add the given shader AND it will
+         * delete the shader object given, invalidating the pointer passed through the
+         * parameters. Make sure to pass new objects through this method by using
+         * 'new Shader(...)' instead of passing a pointer, sicne it may become invalidated. */
+        bool AddShader(Shader* shader, const std::string& id, bool attach);
+        /* Removes the shader with the given shader, before getting rid of it, it
+         * makes sure the shader is detached from the program. Returns true
+         * if it successfully found and deleted the shader. */
+        bool RemoveShader(const std::string& id);
+
+        /* Getters */
+        Shader* GetShader(const std::string& id); // returns NULL if it couldn't find the shader
+        const bool& IsEnabled() { return enabled; }
+        const bool& IsLinked() { return linked; }
+        /* Return the location of the uniform/attribute variable with the given name, which is
+         * what the render backend needs to feed it. Throws an exception if it can't be found. */
+        GLint GetUniformLocation(const std::string& varName) const { return GetVariableLocation(varName, true); }
+        GLint GetAttributeLocation(const std::string& varName) const { return GetVariableLocation(varName, false); }
+        /* Same as above, but return -1 instead of throwing if the variable isn't in the program,
+         * for variables a shader might not use. */
+        UniformLocation Find(const std::string& varName) const;
+        AttributeLocation FindAttribute(const std::string& varName) const;
+        /* Amount of active uniforms and attributes in the linked program. */
+        unsigned int GetAmountOfUniforms() const { return uniforms.size(); }
+        unsigned int GetAmountOfAttributes() const { return attributes.size(); }
+
+        /* Set uniforms at locations from Find(). The program must be enabled. The array
+         * versions set 'amount' elements starting at the location, and SetMatrix() sets a 4x4
+         * matrix of 16 floats in column-major order. None of them allocate, and none of them
+         * call OpenGL if the value is the same as the uniform's shadow copy. */
+        void Set(UniformLocation location, float value)
+        {
+            if (UniformChanged(location, &value, sizeof(float))) glUniform1f(location, value);
+        }
+        void Set(UniformLocation location, int value)
+        {
+            if (UniformChanged(location, &value, sizeof(int))) glUniform1i(location, value);
+        }
+        void Set(UniformLocation location, const maths::vector2f& value)
+        {
+            if (UniformChanged(location, &value.x, sizeof(float) * 2)) glUniform2f(location, value.x, value.y);
+        }
+        void Set(UniformLocation location, const maths::vector3f& value)
+        {
+            if (UniformChanged(location, &value.x, sizeof(float) * 3)) glUniform3f(location, value.x, value.y, value.z);
+        }
+        void Set(UniformLocation location, const maths::vector4f& value)
+        {
+            if (UniformChanged(location, &value.x, sizeof(float) * 4))
+                glUniform4f(location, value.x, value.y, value.z, value.w);
+        }
+        void Set(UniformLocation location, const float* values, unsigned int amount)
+        {
+            if (UniformChanged(location, values, sizeof(float) * amount)) glUniform1fv(location, amount, values);
+        }
+        void Set(UniformLocation location, const int* values, unsigned int amount)
+        {
+            if (UniformChanged(location, values, sizeof(int) * amount)) glUniform1iv(location, amount, values);
+        }
+        void Set(UniformLocation location, const maths::vector2f* values, unsigned int amount)
+        {
+            if (UniformChanged(location, &values[0].x, sizeof(float) * 2 * amount)) glUniform2fv(location, amount, &values[0].x);
+        }
+        void Set(UniformLocation location, const maths::vector3f* values, unsigned int amount)
+        {
+            if (UniformChanged(location, &values[0].x, sizeof(float) * 3 * amount)) glUniform3fv(location, amount, &values[0].x);
+        }
+        void Set(UniformLocation location, const maths::vector4f* values, unsigned int amount)
+        {
+            if (UniformChanged(location, &values[0].x, sizeof(float) * 4 * amount)) glUniform4fv(location, amount, &values[0].x);
+        }
+        void SetMatrix(UniformLocation location, const float* matrix)
+        {
+            if (UniformChanged(location, matrix, sizeof(float) * 16)) glUniformMatrix4fv(location, 1, false, matrix);
+        }
+
+        /* Same as above, but look the uniform up by name first (throwing an exception if the
+         * program doesn't have it). These don't allocate either. */
+        void SetUniform(const std::string& varName, float value) { Set(GetUniformLocation(varName), value); }
+        void SetUniform(const std::string& varName, int value) { Set(GetUniformLocation(varName), value); }
+        void SetUniform(const std::string& varName, const maths::vector2f& value) { Set(GetUniformLocation(varName), value); }
+        void SetUniform(const std::string& varName, const maths::vector3f& value) { Set(GetUniformLocation(varName), value); }
+        void SetUniform(const std::string& varName, const maths::vector4f& value) { Set(GetUniformLocation(varName), value); }
+        void SetUniform(const std::string& varName, const float* values, unsigned int amount)
+        {
+            Set(GetUniformLocation(varName), values, amount);
+        }
+        void SetUniform(const std::string& varName, const int* values, unsigned int amount)
+        {
+            Set(GetUniformLocation(varName), values, amount);
+        }
+        void SetUniformMatrix(const std::string& varName, const float* matrix) { SetMatrix(GetUniformLocation(varName), matrix); }
+
+        /* Amount of uniform updates sent to OpenGL, and skipped because they were the same as
+         * the shadow copy, by every program since the last call to ResetUniformCounters().
+         * RenderDevice::StartRendering() resets them, so they count a frame. */
+        static unsigned int GetUniformUpdatesIssued() { return uniformUpdatesIssued; }
+        static unsigned int GetUniformUpdatesSkipped() { return uniformUpdatesSkipped; }
+        static void ResetUniformCounters() { uniformUpdatesIssued = 0; uniformUpdatesSkipped = 0; }
+
+        /* The following methods are for retrieving or altering the values of the uniform
+         * and attribute variables inside the shader program held in this class.
+         * This is key to communicating between the host OpenGL application (this)
+         * and the shaders (in this class). There are getter and setter methods for both
+         * integers, floats, vectors and matrices. Simply use the integer methods when
+         * getting/setting boolean variables.
+         *
+         * NOTE1: GetUniformFloat/Int/ ONLY return the first element in an array if the full
+         * array was specified. Basically, passing myArray will be the same as passing
+         * myArray[0], so only the first element is returned.
+         *
+         * NOTE2: Matrices passed to SetUniformMatrixFloat/Int must be a size from 2x2
+         * to 4x4, otherwise an exception is thrown.
+         *
+         * NOTE3: Make sure the amount of rows and columns given as arguments in
+         * GetUniformFloat/Int are the VALID size of the matrix in the shader. The wrong
+         * size may cause undefined behaviour. Additionally, if rows or columns given is
+         * higher than 4 or lower than 2, an exception is thown.
+         *
+         * NOTE4: Also, unlike SetUniform, SetUniformMatrix cannot only assign one
+         * matrix at a time, which means if there is an array of matrices in the shader,
+         * each element has to be assigned with a new call to SetUniformMatrix.
+         *
+         * NOTE5: Because there are arrays that are dynamically allocated in the
+         * Get/SetUniformMatrixInt/Float methods, they may run slower than usual.
+         * I may come up with a way of not using this in the future.
+         *
+         * NOTE6: There is no integer equivilent for the Get/SetUniformMatrix methods
+         * because GLSL only supports matrices with contain floats. So the integers
+         * passed to SetUniformMatrix are converted to floats and the floats gotten
+         * from GetUniformMatrix are converted to integers. */
+
+        /* Getting float uniforms. */
+        std::vector<float> GetUniformFloat(const std::string& varName, unsigned int amount) const;
+        maths::matrixf GetUniformMatrixFloat(const std::string& varName, unsigned int rows,
+            unsigned int columns) const;
+        /* Setting float uniforms. */
+        void SetUniform(const std::string& varName, const std::vector<float>& values);
+        void SetUniform(const std::string& varName, const std::vector<maths::vector2f>& values);
+        void SetUniform(const std::string& varName, const std::vector<maths::vector3f>& values);
+        void SetUniform(const std::string& varName, const std::vector<maths::vector4f>& values);
+        void SetUniformMatrix(const std::string& varName, const maths::matrixf& mat);
+
+        /* Getting integer uniforms. */
+        std::vector<int> GetUniformInt(const std::string& varName, unsigned int amount) const;
+        maths::matrixi GetUniformMatrixInt(const std::string& varName, unsigned int rows,
+            unsigned int columns) const;
+        /* Setting integer uniforms. */
+        void SetUniform(const std::string& varName, const std::vector<int>& values);
+        void SetUniform(const std::string& varName, const std::vector<maths::vector2i>& values);
+        void SetUniform(const std::string& varName, const std::vector<maths::vector3i>& values);
+        void SetUniform(const std::string& varName, const std::vector<maths::vector4i>& values);
+        void SetUniformMatrix(const std::string& varName, const maths::matrixi& mat);
+
+        /* Enables and disables an attribute array (much like EnableClientState()) respectively. */
+        void EnableAttributeArray(const std::string& varName);
+        void DisableAttributeArray(const std::string& varName);
+
+        /* Fills in an attribute array using the given properties. Enabling/disabling the
+         * array is the job of the two methods above; this method just fills an attribute
+         * array's values via a call to glVertexAttribPointer(). */
+        // TODO: Test the vertex attribute functions!!!
+
+        /* Float attribute arrays. */
+        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+            const std::vector<float>& elements);
+        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+            const std::vector<maths::vector2f>& elements);
+        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+            const std::vector<maths::vector3f>& elements);
+        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+            const std::vector<maths::vector4f>& elements);
+
+        /* Integer attribute arrays. */
+        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+            const std::vector<int>& elements);
+        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+            const std::vector<maths::vector2i>& elements);
+        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+            const std::vector<maths::vector3i>& elements);
+        void FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+            const std::vector<maths::vector4i>& elements);
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,105 @@
+/*
+ * File:   ProgramCache.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 1:50 AM
+ * Added locking on October 19, 2026, 4:20 AM
+ */
+
+#ifndef PROGRAMCACHE_H
+#define PROGRAMCACHE_H
+
+#include <string>
+#include <windows.h>
+#include <GLee.h>
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* A cache of linked programs on disk, so programs only have to be compiled the first time
+     * the game runs (or after the shaders or the graphics driver change).
+     *
+     * When a program is linked with Program::Link(ProgramCache*), the cache is asked for a
+     * binary of it first, which is loaded with glProgramBinary() instead of compiling its
+     * shaders. If there isn't one, or the driver won't take it, the program's shaders are
+     * compiled and linked like normal, and the binary the driver gives back is stored for the
+     * next run.
+     *
+     * Binaries are stored under a key made from everything that goes into a program: the
+     * source of every shader (which includes any defines added to it), and the driver's
+     * vendor, renderer and version strings, since a binary from one driver can't be used by
+     * another. Each key is a file in the cache's directory, which must already exist. Files
+     * that can't be read or written are treated as missing, so the cache never stops a
+     * program from linking.
+     *
+     * The cache keeps count of how long programs took to link with and without it, which is
+     * the startup time it saves. Needs GL_ARB_get_program_binary; without it, every program
+     * is compiled and nothing is stored.
+     *
+     * Every function locks the cache, so it can be used by more than one thread at once (like
+     * the render thread and an AsyncProgramCompiler's worker), as long as each has a context
+     * that shares objects with the others. */
+    class ProgramCache
+    {
+
+
+    private:
+
+        CRITICAL_SECTION lock; // Guards everything below, and the cache's files
+        std::string directory; // Where the binaries are stored, ending with a separator
+        std::string driver; // Vendor, renderer and version, read the first time they're needed
+
+        // Counters since the cache was created
+        unsigned int hits, misses;
+        double loadSeconds, compileSeconds;
+
+
+        /* Copying would make two caches share a lock. */
+        ProgramCache(const ProgramCache& cache);
+        ProgramCache& operator=(const ProgramCache& cache);
+
+        /* Returns the driver's strings, which needs a context. */
+        const std::string& GetDriver();
+        /* Returns the file a key's binary is stored in. */
+        std::string GetFilename(const std::string& key);
+
+
+    public:
+
+        /* Creates a cache of the binaries in the given directory. Nothing's read until a
+         * program is linked. */
+        ProgramCache(const std::string& cacheDirectory);
+        ~ProgramCache();
+
+        /* Returns true if the driver can give and take program binaries. */
+        bool IsSupported() const;
+
+        /* Loads the binary stored under the key into a program, returning true if it linked.
+         * Returns false if there isn't one, it's from another driver or the driver rejected
+         * it, in which case the program has to be compiled and linked from its shaders. */
+        bool Load(GLuint program, const std::string& key);
+        /* Stores the binary of a linked program under the key, replacing any stored before.
+         * The program should have been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set. */
+        void Store(GLuint program, const std::string& key);
+
+        /* Counts a program linked from the cache (a hit) or compiled (a miss), and the time
+         * it took. Called by Program::Link(ProgramCache*). */
+        void RecordLink(bool fromCache, double seconds);
+
+        unsigned int GetHits();
+        unsigned int GetMisses();
+        /* Total time spent linking programs from the cache, and compiling the others. */
+        double GetLoadSeconds();
+        double GetCompileSeconds();
+
+
+    };
+
+}
+
+}
+
+#endif
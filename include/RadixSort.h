@@ -0,0 +1,52 @@
+/*
+ * File:   RadixSort.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 9:45 PM
+ */
+
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+#include <vector>
+
+namespace parcel
+{
+
+namespace general
+{
+
+    /* Sorts floats with a radix sort, which takes O(n) time instead of the O(n log n)
+     * a comparison sort needs. It's used for sorting things like draw depths every frame,
+     * so it keeps its memory between sorts and only allocates when given more values
+     * than it has ever had before.
+     *
+     * The floats aren't moved; Sort() returns the order of their indices instead, so the
+     * caller can use it to go through whatever the floats belong to. The sort is stable,
+     * so equal floats stay in the order they were given in. */
+    class FloatRadixSorter
+    {
+
+
+    private:
+
+        std::vector<unsigned int> keys; // The floats' bits, changed so they sort like the floats do
+        std::vector<unsigned int> order; // Indices of the floats, sorted after each pass
+        std::vector<unsigned int> scratch; // Where each pass writes the indices to
+
+
+    public:
+
+        /* Sorts the given amount of floats from smallest to largest, returning the indices
+         * of the floats in sorted order. The returned vector is only valid until the next
+         * call. */
+        const std::vector<unsigned int>& Sort(const float* values, unsigned int amount);
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,337 @@
+/*
+ * File:   RenderBackend.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 1:40 PM
+ * Added UseProgram() on October 18, 2026, 5:30 PM
+ * Added texture buffers and vertex attributes on October 18, 2026, 8:00 PM
+ * Added array textures on October 18, 2026, 9:10 PM
+ * Added render targets and timer queries on October 18, 2026, 10:10 PM
+ * Added colour arrays on October 18, 2026, 11:10 PM
+ * Added multitexturing on October 19, 2026, 12:20 AM
+ * Added shadow maps on October 19, 2026, 12:50 AM
+ * Added SetDepthWrite() on October 19, 2026, 4:55 AM
+ */
+
+#ifndef RENDERBACKEND_H
+#define RENDERBACKEND_H
+
+#include "Primitives.h"
+#include "Texture.h"
+#include "Colour.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Enumerators used by the render backend instead of the graphics API's own constants,
+     * so nothing above the backend has to include the API's headers. */
+
+    // States that can be enabled and disabled with IRenderBackend::Enable()/Disable()
+    enum RenderCapability
+    {
+        CAPABILITY_BLEND,
+        CAPABILITY_TEXTURE2D,
+        CAPABILITY_DEPTHTEST,
+        CAPABILITY_LIGHTING,
+        CAPABILITY_CULLFACE,
+        CAPABILITY_NORMALIZE,
+        CAPABILITY_POLYGONOFFSET // Pushes filled polygons back by what's given to SetPolygonOffset()
+    };
+
+    // Arrays of vertex data that can be read when drawing
+    enum ClientArray
+    {
+        CLIENTARRAY_VERTEX,
+        CLIENTARRAY_TEXCOORD,
+        CLIENTARRAY_NORMAL,
+        CLIENTARRAY_COLOUR
+    };
+
+    // Points a buffer can be bound to
+    enum BufferTarget
+    {
+        BUFFERTARGET_ARRAY, // Vertex data
+        BUFFERTARGET_ELEMENTARRAY, // Indices to vertex data
+        BUFFERTARGET_TEXTURE // Data read by shaders through a texture buffer
+    };
+
+    enum MatrixStack
+    {
+        MATRIXSTACK_PROJECTION,
+        MATRIXSTACK_MODELVIEW
+    };
+
+    // Colours of a material that can be set with IRenderBackend::SetMaterialColour()
+    enum MaterialColour
+    {
+        MATERIALCOLOUR_AMBIENT,
+        MATERIALCOLOUR_DIFFUSE,
+        MATERIALCOLOUR_SPECULAR,
+        MATERIALCOLOUR_EMISSION
+    };
+
+    /* Properties of a fixed function light. The first five are set with
+     * IRenderBackend::SetLightVector() (four floats, apart from SPOTDIRECTION which
+     * takes three), the rest with IRenderBackend::SetLightValue(). */
+    enum LightParameter
+    {
+        LIGHTPARAMETER_AMBIENT,
+        LIGHTPARAMETER_DIFFUSE,
+        LIGHTPARAMETER_SPECULAR,
+        LIGHTPARAMETER_POSITION, // Fourth float is 0 for directional lights, 1 otherwise
+        LIGHTPARAMETER_SPOTDIRECTION,
+        LIGHTPARAMETER_CONSTANTATTENUATION,
+        LIGHTPARAMETER_LINEARATTENUATION,
+        LIGHTPARAMETER_QUADRATICATTENUATION,
+        LIGHTPARAMETER_SPOTCUTOFF,
+        LIGHTPARAMETER_SPOTEXPONENT
+    };
+
+    // How the source and destination colours are combined when blending is enabled
+    enum BlendMode
+    {
+        BLENDMODE_ALPHA, // Source alpha, one minus source alpha
+        BLENDMODE_ADDITIVE // Source alpha, one
+    };
+
+    // Format of the pixel data given to IRenderBackend::UploadTexture()
+    enum PixelFormat
+    {
+        PIXELFORMAT_RGBA, // Four bytes per pixel
+        PIXELFORMAT_LUMINANCEALPHA // Two bytes per pixel
+    };
+
+    // Buffers that can be cleared, can be OR'd together
+    enum ClearFlags
+    {
+        CLEAR_COLOUR = 1,
+        CLEAR_DEPTH = 2
+    };
+
+
+    /* Interface that sits between the engine's rendering classes (RenderDevice, the renderers,
+     * SkinManager and FontRenderer) and the graphics API. Everything those classes need
+     * from the API goes through here, so they can run without a graphics context by using
+     * a different backend.
+     *
+     * The calls map very closely to fixed function OpenGL, since that's what the engine
+     * was written against. Buffers, textures and display lists are referred to by unsigned
+     * integer IDs created by the backend, where 0 always means "no object". Vertex pointers
+     * are byte offsets into the currently bound array buffer if there is one, or pointers
+     * to client memory if there isn't, just like in OpenGL. Vertex data is always floats
+     * and index data is always unsigned ints.
+     *
+     * Implementations: OpenGLBackend (the real thing), NullBackend (validates and counts
+     * calls without drawing anything) and RecordingBackend (writes every call out to a
+     * stream before passing it on to another backend). */
+    class IRenderBackend
+    {
+
+    public:
+
+        virtual ~IRenderBackend() {}
+
+
+        /* State. */
+        virtual void Enable(RenderCapability capability) = 0;
+        virtual void Disable(RenderCapability capability) = 0;
+        virtual bool IsEnabled(RenderCapability capability) = 0;
+        virtual void SetBlendMode(BlendMode mode) = 0;
+        virtual void SetDepthWrite(bool enabled) = 0; // Whether drawing writes to the depth buffer, on by default
+
+        virtual void SetClearColour(const colourf& colour) = 0;
+        virtual void Clear(unsigned int flags) = 0; // Takes ClearFlags OR'd together
+        virtual void SetViewport(int x, int y, int width, int height) = 0;
+
+        /* Current colour, which vertices are drawn with, and the material lighting uses. */
+        virtual void SetColour(const colourf& colour) = 0;
+        virtual void SetMaterialColour(MaterialColour property, const colourf& colour) = 0;
+        virtual void SetMaterialShininess(float shininess) = 0;
+
+
+        /* Fixed function lights, which are numbered from 0 to GetMaxLights() - 1. */
+        virtual unsigned int GetMaxLights() = 0;
+        virtual void EnableLight(unsigned int light) = 0;
+        virtual void DisableLight(unsigned int light) = 0;
+        virtual void SetLightVector(unsigned int light, LightParameter parameter, const float* values) = 0;
+        virtual void SetLightValue(unsigned int light, LightParameter parameter, float value) = 0;
+        virtual void SetLightModel(const colourf& globalAmbient, bool localViewer, bool twoSided) = 0;
+
+
+        /* Matrix stacks. Matrices are 16 floats in column-major order. */
+        virtual void SetMatrixMode(MatrixStack stack) = 0;
+        virtual void LoadMatrix(const float* matrix) = 0;
+        virtual void MultiplyMatrix(const float* matrix) = 0;
+        virtual void PushMatrix() = 0;
+        virtual void PopMatrix() = 0;
+        virtual void Translate(float x, float y, float z) = 0;
+        virtual void Rotate(float angle, float x, float y, float z) = 0;
+
+
+        /* Buffer objects. BufferData() (re)allocates the buffer bound to the given target
+         * for dynamic drawing, copying 'data' into it if it isn't NULL. MapBuffer() returns
+         * write-only memory for the bound buffer, which is sent off by UnmapBuffer(). If
+         * UnmapBuffer() returns false, the buffer's contents were lost. */
+        virtual void GenerateBuffers(unsigned int amount, unsigned int* ids) = 0;
+        virtual void DeleteBuffers(unsigned int amount, const unsigned int* ids) = 0;
+        virtual void BindBuffer(BufferTarget target, unsigned int id) = 0;
+        virtual unsigned int GetBoundBuffer(BufferTarget target) = 0;
+        virtual void BufferData(BufferTarget target, unsigned int size, const void* data) = 0;
+        virtual void* MapBuffer(BufferTarget target) = 0;
+        virtual bool UnmapBuffer(BufferTarget target) = 0;
+
+
+        /* Vertex arrays. The attribute arrays feed the generic vertex attributes of shader
+         * programs, using the locations given by Program::GetAttributeLocation(). */
+        virtual void EnableClientArray(ClientArray clientArray) = 0;
+        virtual void DisableClientArray(ClientArray clientArray) = 0;
+        virtual bool IsClientArrayEnabled(ClientArray clientArray) = 0;
+        virtual void SetVertexPointer(unsigned int components, unsigned int stride, const void* pointer) = 0;
+        virtual void SetTexCoordPointer(unsigned int components, unsigned int stride, const void* pointer) = 0;
+        virtual void SetNormalPointer(unsigned int stride, const void* pointer) = 0;
+        /* Colours are floats. Drawing with the colour array enabled leaves the current colour
+         * undefined, so it has to be set again afterwards. */
+        virtual void SetColourPointer(unsigned int components, unsigned int stride, const void* pointer) = 0;
+        virtual void EnableAttributeArray(unsigned int location) = 0;
+        virtual void DisableAttributeArray(unsigned int location) = 0;
+        virtual void SetAttributePointer(unsigned int location, unsigned int components,
+            unsigned int stride, const void* pointer) = 0;
+
+
+        /* Drawing. DrawArrays() draws 'amount' vertices starting at vertex 'start'.
+         * DrawElements() draws 'amount' indices from the bound element array buffer,
+         * starting at index 'start'. */
+        virtual void DrawArrays(PrimitiveType type, unsigned int start, unsigned int amount) = 0;
+        virtual void DrawElements(PrimitiveType type, unsigned int start, unsigned int amount) = 0;
+
+
+        /* Textures. Everything after BindTexture() applies to the bound 2D texture.
+         * UploadTexture() gives the bound texture's mipmap 'level' new pixel data,
+         * which is always stored as RGBA. 'coordinate' for SetTextureWrapping() is 0
+         * for S, 1 for T and 2 for R. */
+        virtual void GenerateTextures(unsigned int amount, unsigned int* ids) = 0;
+        virtual void DeleteTextures(unsigned int amount, const unsigned int* ids) = 0;
+        virtual bool IsTexture(unsigned int id) = 0;
+        virtual void BindTexture(unsigned int id) = 0;
+        virtual void SetTextureFilter(TextureFilter filter, bool magnification) = 0;
+        virtual void SetTextureWrapping(TextureWrapping wrapping, unsigned int coordinate) = 0;
+        virtual void UploadTexture(unsigned int level, unsigned int width, unsigned int height,
+            PixelFormat format, const void* pixels) = 0;
+
+
+        /* Display lists. GenerateLists() returns the first of 'amount' consecutive lists.
+         * Every call made between BeginList() and EndList() is stored in the list instead
+         * of being executed. CallLists() calls the list at (list base + lists[i]) for every
+         * one of the 'amount' bytes in 'lists'. */
+        virtual unsigned int GenerateLists(unsigned int amount) = 0;
+        virtual void DeleteLists(unsigned int first, unsigned int amount) = 0;
+        virtual void BeginList(unsigned int id) = 0;
+        virtual void EndList() = 0;
+        virtual void SetListBase(unsigned int base) = 0;
+        virtual void CallLists(unsigned int amount, const unsigned char* lists) = 0;
+
+
+        /* Shader programs. Makes the program with the given handle current, 0 returns
+         * to fixed functionality. */
+        virtual void UseProgram(unsigned int handle) = 0;
+
+
+        /* Texture buffers, which let shaders read a buffer object as a big array of RGBA
+         * floats. BindTextureBuffer() binds 'texture' (created with GenerateTextures()) to
+         * texture unit 'unit' as a buffer texture whose contents are 'buffer'. Giving it a
+         * texture of 0 unbinds the unit's buffer texture. Texture unit 0 is always the
+         * active unit again afterwards, so BindTexture() is unaffected. */
+        virtual bool SupportsTextureBuffers() = 0;
+        virtual void BindTextureBuffer(unsigned int unit, unsigned int texture, unsigned int buffer) = 0;
+
+
+        /* Array textures, which hold layers of images with the same size in one texture so
+         * shaders can pick a layer per object. BindArrayTexture() binds 'texture' (created
+         * with GenerateTextures()) to texture unit 'unit' as an array texture, 0 unbinds it.
+         * Like BindTextureBuffer(), unit 0 is always the active unit again afterwards.
+         * AllocateArrayTexture() gives the array texture bound to unit 0 room for 'layers'
+         * RGBA layers (just one mipmap level) and sets its filtering and wrapping from
+         * 'params'. UploadArrayTextureLayer() replaces one of its layers' pixels. */
+        virtual bool SupportsArrayTextures() = 0;
+        virtual void BindArrayTexture(unsigned int unit, unsigned int texture) = 0;
+        virtual void AllocateArrayTexture(unsigned int width, unsigned int height, unsigned int layers,
+            const TextureParameters& params) = 0;
+        virtual void UploadArrayTextureLayer(unsigned int layer, unsigned int width, unsigned int height,
+            PixelFormat format, const void* pixels) = 0;
+
+
+        /* Multitexturing with the fixed function pipeline, for drawing with a second texture
+         * (like a lightmap) on top of the one bound with BindTexture(). Units above 0 are only
+         * changed through these calls, and unit 0 is always the active unit again afterwards.
+         * BindUnitTexture() binds a 2D texture to 'unit' and enables texturing on it, multiplying
+         * it with the result of the units before it (GL_MODULATE); a texture of 0 disables the
+         * unit again. SetUnitTexCoordPointer() gives the unit its own texture coordinate array
+         * and enables it, and DisableUnitTexCoordArray() disables it. */
+        virtual void BindUnitTexture(unsigned int unit, unsigned int texture) = 0;
+        virtual void SetUnitTexCoordPointer(unsigned int unit, unsigned int components, unsigned int stride,
+            const void* pointer) = 0;
+        virtual void DisableUnitTexCoordArray(unsigned int unit) = 0;
+
+
+        /* Render targets (framebuffer objects), which everything is drawn into instead of the
+         * window while one is bound. Framebuffer 0 is the window. AttachToFramebuffer()
+         * attaches a 2D texture as the colour buffer and a renderbuffer as the depth buffer of
+         * the bound framebuffer, returning false if the result can't be drawn into.
+         * BlitFramebuffer() copies the colour of the rectangle from (0, 0) to (sourceWidth,
+         * sourceHeight) in 'source' into the rectangle from (0, 0) to (destinationWidth,
+         * destinationHeight) in 'destination', filtering linearly if the sizes differ, and
+         * leaves 'destination' bound. */
+        virtual bool SupportsRenderTargets() = 0;
+        virtual void GenerateFramebuffers(unsigned int amount, unsigned int* ids) = 0;
+        virtual void DeleteFramebuffers(unsigned int amount, const unsigned int* ids) = 0;
+        virtual void BindFramebuffer(unsigned int id) = 0;
+        virtual void GenerateRenderbuffers(unsigned int amount, unsigned int* ids) = 0;
+        virtual void DeleteRenderbuffers(unsigned int amount, const unsigned int* ids) = 0;
+        virtual void AllocateDepthRenderbuffer(unsigned int id, unsigned int width, unsigned int height) = 0;
+        virtual bool AttachToFramebuffer(unsigned int colourTexture, unsigned int depthRenderbuffer) = 0;
+        virtual void BlitFramebuffer(unsigned int source, unsigned int sourceWidth, unsigned int sourceHeight,
+            unsigned int destination, unsigned int destinationWidth, unsigned int destinationHeight) = 0;
+
+
+        /* Timer queries, which measure how long the GPU takes to carry out the calls made
+         * between BeginTimerQuery() and EndTimerQuery(). Only one can be running at a time.
+         * The result takes a while to arrive; GetTimerQueryResult() returns false until it
+         * has, and never waits for it. */
+        virtual bool SupportsTimerQueries() = 0;
+        virtual void GenerateQueries(unsigned int amount, unsigned int* ids) = 0;
+        virtual void DeleteQueries(unsigned int amount, const unsigned int* ids) = 0;
+        virtual void BeginTimerQuery(unsigned int id) = 0;
+        virtual void EndTimerQuery() = 0;
+        virtual bool GetTimerQueryResult(unsigned int id, float& milliseconds) = 0;
+
+
+        /* Shadow maps, which are depth textures drawn into from a light's point of view.
+         * AllocateDepthTexture() gives the texture bound to unit 0 room for a depth image of
+         * the given size, filtered linearly, clamped to its edges and set up to be compared
+         * against (so shaders read it with a sampler2DShadow). AttachDepthTextureToFramebuffer()
+         * attaches one as the only buffer of the bound framebuffer, with no colour at all,
+         * returning false if the result can't be drawn into. BlitFramebufferDepth() copies
+         * the whole depth of one framebuffer into another of the same size, leaving the
+         * destination bound. BindDepthTexture() binds a depth texture to a unit above 0 for
+         * shaders to read, without enabling fixed function texturing on it, and leaves unit 0
+         * the active unit; 0 unbinds it. SetPolygonOffset() sets how far polygons are pushed
+         * back while CAPABILITY_POLYGONOFFSET is enabled, which stops surfaces shadowing
+         * themselves. */
+        virtual bool SupportsShadowMaps() = 0;
+        virtual void AllocateDepthTexture(unsigned int width, unsigned int height) = 0;
+        virtual bool AttachDepthTextureToFramebuffer(unsigned int depthTexture) = 0;
+        virtual void BlitFramebufferDepth(unsigned int source, unsigned int destination, unsigned int width,
+            unsigned int height) = 0;
+        virtual void BindDepthTexture(unsigned int unit, unsigned int texture) = 0;
+        virtual void SetPolygonOffset(float factor, float units) = 0;
+
+    };
+
+}
+
+}
+
+#endif
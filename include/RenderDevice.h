@@ -1,185 +1,277 @@
-/*
- * File:   RenderDevice.h
- * Author: Donald "Datriot" Whyte
- *
- * Created on January 2, 2009, 3:15 PM
- */
-
-#ifndef RENDERDEVICE_H
-#define RENDERDEVICE_H
-
-#include "Matrix.h"
-#include "Vector.h"
-
-#include "SkinManager.h"
-#include "ALighting.h"
-
-#include "GLWindow.h"
-#include "RenderMode.h"
-
-/* TODO: Create a class that is held by the RenderDevice which handles activating textures,
- * multitextures, texture blending, combining, interpolating and so on. This class will NOT
- * load textures. That is the SkinManager's job. SkinManager may also be renamed to something
- * more generic in the future. */
-
-namespace parcel
-{
-
-namespace graphics
-{
-
-
-    /* This class provides the many of the engine's rendering capabilities and usually holds
-     * most of the other managers, such as material and texture management, 3D meshes,
-     * lighting and so on. It encapsulates many OpenGL functions. */
-    class RenderDevice
-    {
-
-
-    private:
-
-        // The two matrices used with the modelview matrix stack
-        maths::matrixf worldMatrix; // Matrix for world space
-        maths::matrixf viewMatrix; // View (camera) matrix
-        maths::matrixf projectionMatrix2D; // Projection matrix for 2D portion of scene
-        maths::matrixf projectionMatrix3D; // Projection matrix for 3D portion of scene
-
-        maths::vector2i viewportSize; // Size of the viewport
-
-        SkinManager skinManager; // Manages all skins, textures, materials and all that other stuff
-        ALighting* lighting; // Holds a pointer to the manager that handles the scene's lighting
-
-        debug::Logger* logger; // Used to log render device's state
-        unsigned int logID; // The ID of the log that was created for this class
-
-
-        /* State variables. */
-
-        RenderMode mode; // The current mode of the render device, set to 3D upon creation
-        bool renderStarted; // Determines if rendering has started yet and is allowed
-
-        /* Constants that determine the ID currentSkin/TextureID contain if NO texture or
-         * skin is active. Implementing in .cpp file. */
-        static const std::string noSkin;
-        static const std::string noTexture;
-        std::string currentSkinID; // ID of currently active skin. "NOSKIN!" = NoSkin
-        std::string currentTextureID; // ID of currently active texture. "NOTEXTURE!" = NoTexture
-
-
-
-        /* Private Methods. */
-
-
-        /* Since it uses a double buffered mode, this function swaps buffers,
-         * presenting rendered content to screen. */
-        void SwapDeviceBuffers();
-
-        /* This function resets the modelview and projection matrices to switch to 3D/2D.
-         * This can be done in the middle of a rendering pass, so you can start with 3D,
-         * render the scene, then swap to 2D to render the HUD.
-         * It is good practice for this to be called before rendering in 3D/2D, while it is not
-         * always neccesery, it makes sure that the state has been reset correctly. */
-        void Reset();
-
-        /* Builds the viewport with dimensions stored in 'viewportSize'. */
-        void BuildViewport();
-
-        /* This method sets the transparency by using a texture's transparency value.
-         * Simply returns if it fails to find the texture. */
-        void SetTextureTransparency(const std::string& textureID);
-        /* Applies transparency AND the RGB values of the given colour. */
-        void SetTextureTransparencyWithColourMask(const std::string& textureID, const colourf& colour);
-
-
-    public:
-
-        /* Constructor and Destructor. */
-        RenderDevice(debug::Logger* log); // Initialises RenderDevice's state
-        ~RenderDevice(); // Releases any resources that may have been used for the device
-
-        void DeleteAll(); // Deletes everything created by managers and such
-
-
-
-        /* State related methods. */
-
-
-        /* Initialises the viewport, clear colour and state. Is made public because it can
-         * be called at any time everything needs to be cleared. */
-        void Initialise();
-
-        /* Changes the render mode to the one specified. It calls Reset() and loads up
-         * the matrices and apprporiate projection of the render mode.
-         * NOTE: If you set the mode to 3D when it is already 3D, it will reset the state
-         * again with fresh new matrices and such. */
-        void SetRenderMode(RenderMode renderMode);
-
-        /* These two methods start and end the device's rendering pass respectively. */
-        void StartRendering();
-        void EndRendering();
-
-
-
-        /* Model, view and projection matrix/vector operations. */
-
-
-        /* Creates a look-at view matrix that will be used with the device. */
-        void SetViewMatrix(const maths::matrixf& mat);
-        /* Used to set the given mode's (renderMode) projection's properties */
-        void SetProjectionMatrix(RenderMode renderMode, const maths::matrixf& newProjMatrix);
-        /* Sets viewport size. */
-        void SetViewportSize(const maths::vector2i& newSize);
-        /* Getting view and projection matrices. */
-        const maths::matrixf& GetViewMatrix() { return viewMatrix; }
-        const maths::matrixf& GetProjectionMatrix(RenderMode renderMode);
-        const maths::vector2i& GetViewportSize() { return viewportSize; }
-
-
-
-        /* Skin management and rendering. */
-
-
-        /* Sets active mateirals and textures to the ones used by the skin with the ID given.
-         * If it cannot find the skin/texture/material, then it throws an exception.*/
-        void SetActiveSkin(const std::string& skinID);
-
-        /* Sets the currently active texture to the current texture unit. Keeps the set materials
-         * as they are. If you need to set a texture and material, use SetActiveSkin(). */
-        void SetActiveTexture(const std::string& textureID);
-        /* Sets the active texture, but with the specified colour mask. */
-        void SetActiveTextureWithColourMask(const std::string& textureID, const colourf& colour);
-
-        /* Clears the texture and material state. */
-        void ClearSkinAndTexture();
-
-
-
-        /* Accessor methods. */
-
-
-        /* Checks if the current render mode is the one specified. */
-        bool IsRenderMode(const RenderMode& rMode);
-
-        SkinManager* GetSkinManager() { return &skinManager; }
-        ALighting* GetLighting() { return lighting; }
-
-        const std::string& GetCurrentSkinID() { return currentSkinID; }
-        const std::string& GetCurrentTextureID() { return currentTextureID; }
-
-
-    };
-
-
-    /* Exception thrown if a certain extension is not availible. */
-    class GLExtensionUnavailableException : public debug::Exception
-    {
-    public:
-        GLExtensionUnavailableException(const char* errorMessage) : Exception(errorMessage) {}
-
-    };
-
-}
-
-}
-
-#endif
+/*
+ * File:   RenderDevice.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on January 2, 2009, 3:15 PM
+ * Changed to draw through an IRenderBackend on October 18, 2026, 4:10 PM
+ * Added state cache on October 18, 2026, 6:10 PM
+ * Changed to track active skins and textures by handle on October 18, 2026, 7:20 PM
+ * Added dynamic resolution for the 3D scene on October 18, 2026, 10:35 PM
+ * Added SetLighting() on October 18, 2026, 11:40 PM
+ * Changed to tell the lighting when the modelview matrix changes on October 18, 2026, 11:50 PM
+ * Changed to record the scale each timed frame was drawn at on October 19, 2026, 4:50 AM
+ */
+
+#ifndef RENDERDEVICE_H
+#define RENDERDEVICE_H
+
+#include "Matrix.h"
+#include "Vector.h"
+
+#include "RenderBackend.h"
+#include "StateCacheBackend.h"
+#include "SkinManager.h"
+#include "ALighting.h"
+#include "RenderTarget.h"
+#include "DynamicResolution.h"
+
+#include "GLWindow.h"
+#include "RenderMode.h"
+
+/* TODO: Create a class that is held by the RenderDevice which handles activating textures,
+ * multitextures, texture blending, combining, interpolating and so on. This class will NOT
+ * load textures. That is the SkinManager's job. SkinManager may also be renamed to something
+ * more generic in the future. */
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+
+    /* This class provides the many of the engine's rendering capabilities and usually holds
+     * most of the other managers, such as material and texture management, 3D meshes,
+     * lighting and so on. It encapsulates many OpenGL functions. */
+    class RenderDevice
+    {
+
+
+    private:
+
+        // The two matrices used with the modelview matrix stack
+        maths::matrixf worldMatrix; // Matrix for world space
+        maths::matrixf viewMatrix; // View (camera) matrix
+        maths::matrixf projectionMatrix2D; // Projection matrix for 2D portion of scene
+        maths::matrixf projectionMatrix3D; // Projection matrix for 3D portion of scene
+
+        maths::vector2i viewportSize; // Size of the viewport
+
+        IRenderBackend* targetBackend; // Backend that talks to the graphics API
+        bool ownsBackend; // If true, the target backend is deleted with the device
+        /* Every graphics API call the device (and the renderers using it) makes goes through
+         * this, which skips calls that wouldn't change anything before passing them on to
+         * the target backend. Declared before skinManager, since the skin manager is given
+         * it on creation. */
+        StateCacheBackend stateCache;
+
+        SkinManager skinManager; // Manages all skins, textures, materials and all that other stuff
+        ALighting* lighting; // Holds a pointer to the manager that handles the scene's lighting
+        /* World and view matrices last loaded into the modelview stack, which the lights are
+         * transformed by. The lighting is told when these change. */
+        float loadedModelview[32];
+        bool loadedModelviewKnown;
+
+        debug::Logger* logger; // Used to log render device's state
+        unsigned int logID; // The ID of the log that was created for this class
+
+
+        /* State variables. */
+
+        RenderMode mode; // The current mode of the render device, set to 3D upon creation
+        bool renderStarted; // Determines if rendering has started yet and is allowed
+
+        /* Constants that determine the ID GetCurrentSkin/TextureID() return if NO texture or
+         * skin is active. Implementing in .cpp file. */
+        static const std::string noSkin;
+        static const std::string noTexture;
+        SkinHandle currentSkin; // Handle of currently active skin. invalidHandle = NoSkin
+        TextureHandle currentTexture; // Handle of currently active texture. invalidHandle = NoTexture
+
+
+        /* Dynamic resolution. When it's on, the 3D part of the scene is drawn into sceneTarget
+         * at the scale the controller picks, then copied up to the window before the 2D part
+         * (or at the end of the pass). */
+
+        // Amount of timer queries cycled through, so results are read a couple of frames late without waiting
+        static const unsigned int amountOfFrameQueries = 3;
+
+        DynamicResolution resolutionController; // Picks the scale from the frame times
+        RenderTarget* sceneTarget; // Target the 3D scene is drawn into, NULL if dynamic resolution is off
+        bool sceneTargetBound; // True from the start of the pass until the scene has been copied to the window
+        maths::vector2i sceneSize; // Size the scene is being drawn at this pass
+
+        bool timingGPU; // True if the backend supports timer queries
+        unsigned int frameQueries[amountOfFrameQueries]; // Timer queries, one per frame in turn
+        bool queryRunning; // True if a query was started this pass and hasn't been ended yet
+        unsigned int queriesStarted; // Total amount of queries that have been started
+        unsigned int queriesRead; // Total amount of queries that have had their results read
+        float frameQueryScales[amountOfFrameQueries]; // Scale the scene was drawn at while each query ran
+        float lastGPUTime; // Time in milliseconds of the latest finished query, negative if there isn't one
+        float lastGPUScale; // Scale the frame that query timed was drawn at
+        LARGE_INTEGER passStartTime; // Performance counter when the pass started, for the CPU time
+
+
+
+        /* Private Methods. */
+
+
+        /* Starts the log and sets up the default state. Called by both constructors. */
+        void Create();
+
+        /* Since it uses a double buffered mode, this function swaps buffers,
+         * presenting rendered content to screen. */
+        void SwapDeviceBuffers();
+
+        /* This function resets the modelview and projection matrices to switch to 3D/2D.
+         * This can be done in the middle of a rendering pass, so you can start with 3D,
+         * render the scene, then swap to 2D to render the HUD.
+         * It is good practice for this to be called before rendering in 3D/2D, while it is not
+         * always neccesery, it makes sure that the state has been reset correctly. */
+        void Reset();
+
+        /* Builds the viewport with dimensions stored in 'viewportSize'. */
+        void BuildViewport();
+
+        /* Stops timing the GPU for this pass, copies the scene from the scene target onto the
+         * window (scaling it up) and goes back to drawing into the window at full size. */
+        void ResolveScene();
+        /* Reads the results of any timer queries that have finished, without waiting. */
+        void ReadFrameQueries();
+
+        /* This method sets the transparency by using a texture's transparency value. */
+        void SetTextureTransparency(const Texture* texture);
+        /* Applies transparency AND the RGB values of the given colour. */
+        void SetTextureTransparencyWithColourMask(const Texture* texture, const colourf& colour);
+
+
+    public:
+
+        /* Constructor and Destructor. The first constructor draws using OpenGL, the second
+         * draws using the given backend, which is NOT deleted by the device. */
+        RenderDevice(debug::Logger* log); // Initialises RenderDevice's state
+        RenderDevice(debug::Logger* log, IRenderBackend* renderBackend);
+        ~RenderDevice(); // Releases any resources that may have been used for the device
+
+        void DeleteAll(); // Deletes everything created by managers and such
+
+
+
+        /* State related methods. */
+
+
+        /* Initialises the viewport, clear colour and state. Is made public because it can
+         * be called at any time everything needs to be cleared. */
+        void Initialise();
+
+        /* Changes the render mode to the one specified. It calls Reset() and loads up
+         * the matrices and apprporiate projection of the render mode.
+         * NOTE: If you set the mode to 3D when it is already 3D, it will reset the state
+         * again with fresh new matrices and such. */
+        void SetRenderMode(RenderMode renderMode);
+
+        /* These two methods start and end the device's rendering pass respectively. */
+        void StartRendering();
+        void EndRendering();
+
+        /* Draws the 3D scene at a resolution that changes to keep the frame time under the
+         * target in the settings. While it's on, everything drawn in 3D mode goes into an
+         * offscreen target, which is copied (scaled up) onto the window when the render mode
+         * is switched to 2D, so the HUD is always drawn at full resolution. Anything still
+         * in the target at EndRendering() is copied then.
+         * Returns false (leaving it off) if the backend doesn't support render targets. */
+        bool EnableDynamicResolution(const DynamicResolutionSettings& settings);
+        void DisableDynamicResolution();
+        bool UsingDynamicResolution() const { return (sceneTarget != NULL); }
+        /* Fraction of the viewport size along each axis the 3D scene is drawn at. Always 1 if
+         * dynamic resolution is off. */
+        float GetResolutionScale() const;
+        // The controller, for reading the frame times it's been given
+        const DynamicResolution& GetDynamicResolution() const { return resolutionController; }
+
+
+
+        /* Model, view and projection matrix/vector operations. */
+
+
+        /* Creates a look-at view matrix that will be used with the device. */
+        void SetViewMatrix(const maths::matrixf& mat);
+        /* Used to set the given mode's (renderMode) projection's properties */
+        void SetProjectionMatrix(RenderMode renderMode, const maths::matrixf& newProjMatrix);
+        /* Sets viewport size. */
+        void SetViewportSize(const maths::vector2i& newSize);
+        /* Getting view and projection matrices. */
+        const maths::matrixf& GetViewMatrix() { return viewMatrix; }
+        const maths::matrixf& GetProjectionMatrix(RenderMode renderMode);
+        const maths::vector2i& GetViewportSize() { return viewportSize; }
+
+
+
+        /* Skin management and rendering. */
+
+
+        /* Sets active mateirals and textures to the ones used by the skin with the handle given.
+         * If it cannot find the skin/texture/material, then it throws an exception. The
+         * overload taking an ID looks up the handle first, so it's slower. */
+        void SetActiveSkin(SkinHandle skin);
+        void SetActiveSkin(const std::string& skinID);
+
+        /* Sets the currently active texture to the current texture unit. Keeps the set materials
+         * as they are. If you need to set a texture and material, use SetActiveSkin(). */
+        void SetActiveTexture(TextureHandle texture);
+        void SetActiveTexture(const std::string& textureID);
+        /* Sets the active texture, but with the specified colour mask. */
+        void SetActiveTextureWithColourMask(TextureHandle texture, const colourf& colour);
+        void SetActiveTextureWithColourMask(const std::string& textureID, const colourf& colour);
+
+        /* Clears the texture and material state. */
+        void ClearSkinAndTexture();
+
+
+
+        /* Accessor methods. */
+
+
+        /* Checks if the current render mode is the one specified. */
+        bool IsRenderMode(const RenderMode& rMode);
+
+        /* Returns the backend everything drawing with this device should use. */
+        IRenderBackend* GetBackend() { return &stateCache; }
+        /* Returns the amount of graphics API calls skipped by the state cache, because they
+         * would have set state to what it already was. */
+        unsigned int GetRedundantCallsAvoided() const { return stateCache.GetRedundantCallsAvoided(); }
+        /* Makes the state cache forget everything it knows. Must be called if anything changes
+         * the graphics API's state without going through GetBackend(), such as a FontRenderer
+         * that was created with its own backend. */
+        void InvalidateStateCache() { stateCache.Invalidate(); }
+        SkinManager* GetSkinManager() { return &skinManager; }
+        ALighting* GetLighting() { return lighting; }
+        /* Replaces the lighting manager (a FixedFunctionLighting by default) with 'newLighting',
+         * which the device then owns. The old one is disabled and deleted. */
+        void SetLighting(ALighting* newLighting);
+
+        /* Handles of the active skin and texture, which is what should be compared when
+         * rendering. invalidHandle if there isn't one. */
+        SkinHandle GetCurrentSkin() const { return currentSkin; }
+        TextureHandle GetCurrentTexture() const { return currentTexture; }
+        /* IDs of the active skin and texture, for tools and debugging. */
+        const std::string& GetCurrentSkinID();
+        const std::string& GetCurrentTextureID();
+
+
+    };
+
+
+    /* Exception thrown if a certain extension is not availible. */
+    class GLExtensionUnavailableException : public debug::Exception
+    {
+    public:
+        GLExtensionUnavailableException(const char* errorMessage) : Exception(errorMessage) {}
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ * File:   RenderTarget.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 10:20 PM
+ */
+
+#ifndef RENDERTARGET_H
+#define RENDERTARGET_H
+
+#include "RenderBackend.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* An offscreen surface that can be drawn into instead of the window. It's made up of a
+     * framebuffer object with an RGBA texture for its colour and a renderbuffer for its
+     * depth, so it can be used for anything the window's back buffer can.
+     *
+     * Only part of the target has to be drawn into; BlitToWindow() copies (and scales)
+     * the part that was used onto the window. This is how RenderDevice renders the 3D
+     * scene at a lower resolution without recreating the target every time it changes. */
+    class RenderTarget
+    {
+
+
+    private:
+
+        IRenderBackend* backend; // Used to create, bind and delete the target's objects
+
+        unsigned int framebufferID;
+        unsigned int colourTextureID;
+        unsigned int depthBufferID;
+        unsigned int width, height;
+
+
+        /* Creates the framebuffer's attachments with the current size and attaches them.
+         * Throws an exception if the framebuffer can't be drawn into. */
+        void CreateAttachments();
+        /* Deletes the attachments, but not the framebuffer. */
+        void DeleteAttachments();
+
+
+    public:
+
+        /* Creates a target of the given size. Throws a GLExtensionUnavailableException if
+         * the backend doesn't support render targets. The window is bound afterwards, and
+         * so is texture 0. */
+        RenderTarget(IRenderBackend* renderBackend, unsigned int targetWidth, unsigned int targetHeight);
+        ~RenderTarget();
+
+        /* Changes the size of the target, losing its contents. Does nothing if the size
+         * is the same. Like the constructor, leaves the window and texture 0 bound. */
+        void Resize(unsigned int newWidth, unsigned int newHeight);
+
+        /* Makes everything draw into the target. Call IRenderBackend::BindFramebuffer(0) to
+         * go back to drawing into the window. The viewport isn't changed. */
+        void Bind();
+        /* Copies the rectangle from (0, 0) to (usedWidth, usedHeight) of the target onto
+         * the whole window, which has the given size. The window is bound afterwards. */
+        void BlitToWindow(unsigned int usedWidth, unsigned int usedHeight,
+            unsigned int windowWidth, unsigned int windowHeight);
+
+        unsigned int GetWidth() const { return width; }
+        unsigned int GetHeight() const { return height; }
+        // ID of the texture holding the target's colour, which can be bound to draw with it
+        unsigned int GetTextureID() const { return colourTextureID; }
+
+
+    };
+
+}
+
+}
+
+#endif
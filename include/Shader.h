@@ -1,81 +1,105 @@
-/*
- * File:   Shader.h
- * Author: Donald "Datriot" Whyte
- *
- * Created on April 10, 2009, 7:04 PM
- */
-
-#ifndef SHADER_H
-#define SHADER_H
-
-#include <string>
-#include <GLee.h>
-
-namespace parcel
-{
-
-namespace graphics
-{
-
-    /* Contains every shader type. */
-    enum ShaderType
-    {
-        SHADERTYPE_VERTEX,
-        SHADERTYPE_FRAGMENT,
-        SHADERTYPE_GEOMETRY
-    };
-
-    /* This calls creates and cleans up a shader. It loads the shader source
-     * file in the constructor and passes it to the OpenGL shader. */
-    class Shader
-    {
-
-
-    private:
-
-        std::string source; // Source code of the shader
-        ShaderType type; // Type of shader
-
-        bool compiled; // Shader compile status
-        bool attachedToProgram; // Is it attached to a program or not?
-
-        GLint glHandle; // OpenGL ID for this shader
-        GLint programHandle; // OpenGL ID for its program
-
-
-        /* Loads a shaer file's source code and returns it. */
-        std::string LoadShaderFile(const std::string& filename);
-
-
-    public:
-
-        /* The constructor creates the shader object then loads the source
-         * code from the given file into the shader object. If the file is not
-         * found, throw an exception. The destructor simply deletes the
-         * shader object. */
-        Shader(ShaderType shaderType, const std::string& filename);
-        ~Shader();
-
-        /* Compiles the shader. If compilation failed, then print the error
-         * and infolog. */
-        bool Compile();
-
-        /* Attaches and detaches the shader from the program its holding
-         * respectively. */
-        void Attach();
-        void Detach();
-
-        /* Getters/setters. */
-        const bool& IsCompiled() { return compiled; }
-        const bool& IsAttached() { return attachedToProgram; }
-        void SetProgramHandle(GLint progHandle) { programHandle = progHandle; }
-
-
-
-    };
-
-}
-
-}
-
-#endif
+/*
+ * File:   Shader.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on April 10, 2009, 7:04 PM
+ * Added source and type getters on October 19, 2026, 1:50 AM
+ * Added creating shaders from source with defines on October 19, 2026, 2:10 AM
+ * Added starting a compile without waiting for it on October 19, 2026, 2:30 AM
+ */
+
+#ifndef SHADER_H
+#define SHADER_H
+
+#include <string>
+#include <vector>
+#include <GLee.h>
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Contains every shader type. */
+    enum ShaderType
+    {
+        SHADERTYPE_VERTEX,
+        SHADERTYPE_FRAGMENT,
+        SHADERTYPE_GEOMETRY
+    };
+
+    /* This calls creates and cleans up a shader. It loads the shader source
+     * file in the constructor and passes it to the OpenGL shader. */
+    class Shader
+    {
+
+
+    private:
+
+        std::string source; // Source code of the shader
+        ShaderType type; // Type of shader
+
+        bool compiled; // Shader compile status
+        bool compiling; // True if the compile has been started, but its status hasn't been read
+        bool attachedToProgram; // Is it attached to a program or not?
+
+        GLint glHandle; // OpenGL ID for this shader
+        GLint programHandle; // OpenGL ID for its program
+
+
+        /* Creates the OpenGL shader object and gives it the source code. */
+        void Create(const std::string& shaderSource);
+
+
+    public:
+
+        /* The constructor creates the shader object then loads the source
+         * code from the given file into the shader object. If the file is not
+         * found, throw an exception. The destructor simply deletes the
+         * shader object. */
+        Shader(ShaderType shaderType, const std::string& filename);
+        /* Creates the shader from source code that's already been loaded, with a #define line
+         * added for each of 'defines' (after the #version line, if the source has one). Used
+         * to compile variants of the same source with different features. */
+        Shader(ShaderType shaderType, const std::string& shaderSource, const std::vector<std::string>& defines);
+        ~Shader();
+
+        /* Loads a shader file's source code and returns it. Throws an exception if the file
+         * can't be opened. */
+        static std::string LoadShaderFile(const std::string& filename);
+        /* Returns the source with a #define line for each of 'defines', placed after the
+         * #version line if there is one (which has to come first). */
+        static std::string AddDefines(const std::string& shaderSource, const std::vector<std::string>& defines);
+
+        /* Compiles the shader. If compilation failed, then print the error
+         * and infolog. If StartCompile() was called first, this only waits for that
+         * compile to finish and reads its status. */
+        bool Compile();
+        /* Starts compiling the shader without waiting for it to finish (with
+         * GL_KHR_parallel_shader_compile, the driver does it on its own threads). The shader
+         * can be attached straight away, and the program linked; Compile() reads how it went. */
+        void StartCompile();
+
+        /* Attaches and detaches the shader from the program its holding
+         * respectively. Shaders that haven't been compiled (or started compiling) aren't. */
+        void Attach();
+        void Detach();
+
+        /* Getters/setters. */
+        const bool& IsCompiled() { return compiled; }
+        const bool& IsCompiling() { return compiling; }
+        const bool& IsAttached() { return attachedToProgram; }
+        const std::string& GetSource() const { return source; }
+        ShaderType GetType() const { return type; }
+        void SetProgramHandle(GLint progHandle) { programHandle = progHandle; }
+
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,121 @@
+/*
+ * File:   ShaderPermutations.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 2:10 AM
+ */
+
+#ifndef SHADERPERMUTATIONS_H
+#define SHADERPERMUTATIONS_H
+
+#include <vector>
+#include <map>
+#include <string>
+#include "Shader.h"
+#include "Program.h"
+#include "ProgramCache.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Set of features of a shader variant, one bit for each feature. */
+    typedef unsigned int FeatureMask;
+
+
+    /* Every variant of one set of shader sources, where each variant turns on a different
+     * combination of features (skinned, lit, fog, alpha test...).
+     *
+     * The sources are written once, with #ifdef blocks around the code of each feature.
+     * Each feature is the name of a define, and gets a bit of a FeatureMask when it's added;
+     * a variant is compiled with a #define for every feature whose bit is set in its mask.
+     * Renderers ask for programs by their mask, so there's no file to maintain for each
+     * combination of features.
+     *
+     * Variants are only compiled the first time they're asked for, so combinations that are
+     * never used are never compiled. To stop the game from hitching the first time a variant
+     * is used, a manifest of the variants a previous run used can be compiled up front with
+     * Prewarm() (SaveManifest() writes one). Compiled variants are kept until the permutations
+     * are deleted, and if there's a ProgramCache, each one is linked through it, so variants
+     * compiled in a previous run are loaded from their binaries.
+     *
+     * Manifests are text files with a variant on each line, written as the names of its
+     * features separated by spaces ("-" for the variant without any features). Lines
+     * starting with '#' are comments. */
+    class ShaderPermutations
+    {
+
+
+    public:
+
+        static const unsigned int maxFeatures = 32;
+
+
+    private:
+
+        /* One shader of every variant, with its source loaded once. */
+        struct Stage
+        {
+            ShaderType type;
+            std::string source;
+        };
+
+        std::vector<Stage> stages;
+        std::vector<std::string> features; // Define of each bit of a mask, from bit 0
+        std::map<FeatureMask, Program*> programs; // Every variant compiled so far
+
+        ProgramCache* cache; // Not owned, can be NULL
+
+
+        /* Returns the names of a variant's features, as written in manifests. */
+        std::string GetFeatureNames(FeatureMask mask) const;
+
+
+    public:
+
+        /* Creates an empty set of permutations. Variants are linked through 'programCache'
+         * if it isn't NULL, which isn't owned. */
+        ShaderPermutations(ProgramCache* programCache);
+        /* Deletes every variant's program. */
+        ~ShaderPermutations();
+
+        /* Loads a shader that's part of every variant. Throws an Exception if the file can't
+         * be loaded, or if variants have already been compiled (they'd be missing it). */
+        void AddShader(ShaderType type, const std::string& filename);
+        /* Adds a feature that's turned on by defining 'define', returning its bit. Throws an
+         * InvalidArgumentException if it's already been added or there are already
+         * maxFeatures features. */
+        FeatureMask AddFeature(const std::string& define);
+        /* Returns the bit of a feature. Throws an InvalidArgumentException if it hasn't been
+         * added. */
+        FeatureMask GetFeature(const std::string& define) const;
+
+        /* Returns the program of a variant, compiling it if this is the first time it's been
+         * asked for. Throws an InvalidArgumentException if the mask has bits no feature was
+         * added for, and an Exception if the variant doesn't compile or link. */
+        Program* GetProgram(FeatureMask mask);
+        /* Returns true if a variant has been compiled already. */
+        bool HasProgram(FeatureMask mask) const;
+
+        /* Compiles every variant in a manifest that hasn't been compiled, returning how many
+         * were. Variants with features that haven't been added are skipped, as the manifest
+         * might be from older shaders. Returns 0 if the file can't be opened, and throws like
+         * GetProgram() if a variant doesn't compile. */
+        unsigned int Prewarm(const std::string& manifestFilename);
+        /* Writes a manifest of every variant compiled so far. Returns false if the file
+         * can't be written. */
+        bool SaveManifest(const std::string& manifestFilename) const;
+
+        unsigned int GetAmountOfFeatures() const { return features.size(); }
+        unsigned int GetAmountOfPrograms() const { return programs.size(); }
+
+
+    };
+
+}
+
+}
+
+#endif
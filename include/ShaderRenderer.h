@@ -0,0 +1,152 @@
+/*
+ * File:   ShaderRenderer.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 8:30 PM
+ * Added clustered lighting on October 18, 2026, 11:40 PM
+ */
+
+#ifndef SHADERRENDERER_H
+#define SHADERRENDERER_H
+
+#include "ARenderer.h"
+#include "RenderDevice.h"
+#include "Program.h"
+#include "Util.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    class ClusteredLighting;
+
+    /* Renderer that draws everything with a shader program instead of the fixed function
+     * pipeline, without touching the matrix stack or the material for each object.
+     *
+     * All the per-object data (world matrix, material, whether it's textured) and the camera
+     * matrices are written into one big float array every frame, which is sent to a buffer
+     * object in a single upload and read by the shaders through a texture buffer. Every
+     * vertex in the VBO also stores the index of the object it belongs to, so the vertex
+     * shader can look up its object's data itself. Because of that, objects only need to be
+     * drawn separately when their texture or primitive type changes; everything in between
+     * is drawn with one call. If the SkinManager put an object's texture in an array texture,
+     * the object's data holds its layer and the batch only changes with the array, so objects
+     * that only differ in their texture are drawn together too.
+     *
+     * The program given must have been linked and use the same interface as the shaders in
+     * shaders/ShaderRenderer.vert and shaders/ShaderRenderer.frag: a float attribute called
+     * "objectIndex", a samplerBuffer called "objectData", a sampler2D called
+     * "diffuseTexture" and, if array textures are supported, a sampler2DArray called
+     * "diffuseArray". The layout of the object data is described at the top of those
+     * shaders. Lighting is not done by this renderer, unless it's given a ClusteredLighting
+     * with SetLighting() and a program built from shaders/ClusteredLighting.vert and
+     * shaders/ClusteredLighting.frag (which also need a samplerBuffer called "lightData").
+     *
+     * Needs texture buffer support (GL_ARB_texture_buffer_object), an exception is
+     * thrown on construction if it isn't available. */
+    class ShaderRenderer : public ARenderer
+    {
+
+
+    private:
+
+        // Floats per vertex in the VBO: position (3), texture coordinates (2), normal (3) and object index (1)
+        static const unsigned int floatsPerVertex = 9;
+        /* Sizes of the different parts of the object data, in texels (four floats each). The header
+         * is the texel with the start of the materials and objects, then the view and projection matrices. */
+        static const unsigned int headerTexels = 9;
+        static const unsigned int texelsPerMaterial = 5;
+        static const unsigned int texelsPerObject = 5;
+        // Texture units the object data and array textures are bound to, the diffuse texture uses unit 0
+        static const unsigned int objectDataUnit = 1;
+        static const unsigned int textureArrayUnit = 2;
+        static const unsigned int lightDataUnit = 3;
+
+        /* A range of objects that are drawn with one call, because they're next to each other
+         * in the VBO and use the same texture (or array texture) and primitive type. */
+        struct DrawBatch
+        {
+            PrimitiveType type;
+            TextureHandle texture; // skinNoTexture if the objects don't use a 2D texture
+            unsigned int textureArray; // ID of the array texture the objects use, 0 if none
+            unsigned int start, amount;
+        };
+
+        unsigned int vboID; // ID for the renderer's Vertex Buffer Object (VBO)
+        float* vboData; // Used to store a pointer the VBO's data
+        unsigned int objectBufferID; // Buffer the object data is uploaded to
+        unsigned int objectTextureID; // Buffer texture the shaders read the object data through
+
+        // Start and amount of vertices in the VBO of every object with geometry, indexed by object index
+        std::vector<general::ArrayIndices> arrayIndices;
+
+        /* Rebuilt every frame. objectData is the CPU copy of the object data, materialSlots has
+         * the material slot in objectData for every material handle (or invalidHandle if it
+         * isn't used this frame) and usedMaterials has the handles that have been given slots. */
+        std::vector<float> objectData;
+        std::vector<unsigned int> materialSlots;
+        std::vector<MaterialHandle> usedMaterials;
+        std::vector<DrawBatch> batches;
+
+        Program* program; // Program everything is drawn with
+        unsigned int objectIndexLocation; // Location of the program's "objectIndex" attribute
+        bool useTextureArrays; // True if textures in array textures are drawn from their arrays
+        ClusteredLighting* lighting; // Lights the program reads, NULL if the program is unlit
+
+        RenderDevice* renderDevice; // Used for binding textures and getting the camera matrices
+        IRenderBackend* backend; // The render device's backend, used for all the buffer and draw calls
+
+
+        /* Processes one renderable, adding its data to the VBO.
+         * It takes in the current VBO index and the number of vertices already processed. */
+        void ProcessRenderable(IRenderable* renderable, unsigned int& vboIndex, unsigned int& vertexNumber);
+        /* Writes the data of one renderable (and all of its children) into objectData and adds
+         * it to the draw batches. 'parentMatrix' is the world matrix of the renderable's parent
+         * and 'skin' is the skin it inherits from its parent. */
+        void GatherObject(IRenderable* renderable, const float* parentMatrix, SkinHandle skin,
+            unsigned int& objectIndex);
+        /* Returns the slot in objectData of the given material, writing it in if it
+         * doesn't have one yet. Slot 0 is the default material. */
+        unsigned int GetMaterialSlot(MaterialHandle material);
+        /* Writes four floats at the given texel of objectData. */
+        void WriteTexel(unsigned int texel, float x, float y, float z, float w);
+        // Writes the colour as a texel at the end of objectData
+        void AppendColour(const colourf& colour);
+
+
+    public:
+
+        /* Creates the VBO and the object data buffer. 'shaderProgram' must already be linked, and
+         * is not deleted by the renderer. Throws a GLExtensionUnavailableException if texture
+         * buffers aren't supported, and an exception if the program is missing any variables. */
+        ShaderRenderer(RenderDevice* renderDevice, Program* shaderProgram, debug::Logger* log,
+            const bool& willDeleteAll);
+        /* Deletes the VBO, object data buffer and buffer texture. Like every renderer, the
+         * superclass' (ARenderer) destructor takes care of deleting the renderables. */
+        ~ShaderRenderer();
+
+        /* Clears the VBO and refills it with the renderable's vertices, giving every object with
+         * geometry an object index. */
+        void Update();
+        /* Writes and uploads the object data, then draws every batch with the program.
+         * DO NOT add/delete any renderables between the calls to Update() and Render(). */
+        void Render();
+
+        /* Gives the program the light data of 'clusteredLighting' while drawing, which isn't
+         * owned by the renderer. The program must have a "lightData" sampler. Passing NULL
+         * stops the renderer binding any lights. */
+        void SetLighting(ClusteredLighting* clusteredLighting);
+
+        // Returns the amount of draw calls the last call to Render() made
+        unsigned int GetAmountOfBatches() const { return batches.size(); }
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,229 @@
+/*
+ * File:   ShadowMaps.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:50 AM
+ * Changed to cache uniform locations and fit cascades to dynamic casters on October 19, 2026, 5:05 AM
+ */
+
+#ifndef SHADOWMAPS_H
+#define SHADOWMAPS_H
+
+#include <map>
+#include <vector>
+#include "ALight.h"
+#include "BoundingVolumeHierarchy.h"
+#include "RenderDevice.h"
+#include "Program.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Settings for ShadowMaps. */
+    struct ShadowSettings
+    {
+        unsigned int resolution; // Width and height of every shadow map
+        unsigned int amountOfCascades; // Shadow maps the sun's shadows are split between, from 1 to 4
+        float shadowDistance; // How far from the camera the sun's shadows reach
+        float splitWeight; // From 0 (cascades split evenly) to 1 (split logarithmically, more detail up close)
+        float cacheMargin; // How much bigger than needed each cascade is, as a fraction of what's needed
+        float depthMargin; // Extra depth kept in front of and behind the static casters, for dynamic ones
+        float spotlightNear; // Near plane of spotlights' shadow maps
+        float spotlightFar; // Far plane of spotlights whose attenuation never drops off
+        float slopeBias, depthBias; // Polygon offset factor and units used when drawing casters
+
+        ShadowSettings() : resolution(1024), amountOfCascades(4), shadowDistance(100.0f), splitWeight(0.75f),
+            cacheMargin(0.25f), depthMargin(20.0f), spotlightNear(0.1f), spotlightFar(100.0f),
+            slopeBias(2.0f), depthBias(4.0f) {}
+    };
+
+
+    /* Shadow maps for the sun (a directional light) and any amount of spotlights, for shaders
+     * to shadow the scene with.
+     *
+     * The sun's shadows are split into cascades: the part of the camera's view up to the
+     * shadow distance is cut into slices, near ones thinner than far ones, and each slice gets
+     * a shadow map of its own covering a sphere around it. The sphere's size only depends on
+     * the camera's projection, so turning the camera doesn't change it, and every cascade is
+     * made 'cacheMargin' bigger than its sphere and only moved in steps of that margin (lined
+     * up with its texels). Most frames, no cascade moves at all.
+     *
+     * That's what lets casters be split in two. Static casters (the level) are drawn into a
+     * cached shadow map for each cascade and spotlight, which is only drawn again when the
+     * light's matrices change (the cascade moves, or the light moves or turns) or a static
+     * caster overlapping it is added or removed. Each frame, the cached depth is copied into
+     * the shadow map that's used and the dynamic casters (characters and so on) are drawn on
+     * top, so only they cost anything. Shadow maps with no dynamic casters in them skip even
+     * the copy, and use the cached map directly.
+     *
+     * Casters are kept in two BoundingVolumeHierarchys, which every cascade and spotlight's
+     * frustum is checked against, so each only draws the casters inside it. The depth range of
+     * the sun's cascades covers every caster, static and dynamic (rounded out to the depth
+     * margin, so adding or moving casters doesn't move it often), and the depth margin beyond
+     * them. A dynamic caster that moves the range invalidates the cached static maps, so
+     * casters that wander far outside the level cost a redraw of them.
+     *
+     * Casters are drawn with only their vertex positions, from vertex arrays, with their
+     * matrices relative to their parents' like the renderers. Update() draws into framebuffers,
+     * so it must be called before RenderDevice::StartRendering() (which binds the device's own
+     * render target if it has one) and after the camera has been set up for the frame.
+     * Shaders read the maps with the functions in shaders/ShadowMaps.frag, which SetUniforms()
+     * sets up. Needs framebuffers, depth textures and GL_ARB_shadow. */
+    class ShadowMaps
+    {
+
+
+    public:
+
+        static const unsigned int maxCascades = 4;
+
+
+    private:
+
+        /* A shadow map drawn from one point of view, with the cached map of the static casters
+         * it starts from. */
+        struct ShadowView
+        {
+            unsigned int staticTexture, staticFramebuffer; // Static casters only
+            unsigned int texture, framebuffer; // Static and dynamic casters
+            float view[16], projection[16]; // The light's matrices
+            float matrix[16]; // Projection multiplied by view
+            float textureMatrix[16]; // 'matrix' scaled and moved so x, y and z go from 0 to 1, for reading the map
+            float cachedMatrix[16]; // Matrix the static map was drawn with
+            bool staticValid; // False if the static map has to be drawn again
+            bool hasDynamic; // True if dynamic casters were drawn into 'texture' this frame
+            bool active; // False if the light is disabled or missing, so nothing's drawn
+            maths::Frustum frustum;
+        };
+
+        /* Locations of the uniforms SetUniforms() sets in a program, -1 for the ones it doesn't use. */
+        struct ProgramUniforms
+        {
+            UniformLocation cascades[maxCascades]; // shadowCascade0 onwards
+            UniformLocation matrices[maxCascades]; // shadowMatrices[0] onwards
+            UniformLocation cascadeEnds;
+            UniformLocation amountOfCascades;
+        };
+
+        typedef std::map<const Program*, ProgramUniforms> ProgramUniformTable;
+
+        RenderDevice* renderDevice; // Gives the camera
+        IRenderBackend* backend; // Used to create and draw into the shadow maps
+        ShadowSettings settings;
+
+        BoundingVolumeHierarchy staticCasters, dynamicCasters;
+        maths::AABB staticBounds; // Box around every static caster added, which never shrinks
+
+        ALight* sun;
+        ShadowView cascades[maxCascades];
+        float cascadeEnds[maxCascades]; // Distance from the camera each cascade ends at
+
+        std::vector<ALight*> spotlights;
+        std::vector<ShadowView> spotlightViews; // One for each spotlight
+
+        // Reused so they don't have to allocate
+        std::vector<IRenderable*> casters;
+        std::vector<maths::vector3f> expandedPositions; // Triangles of indexed geometry, one vertex after another
+
+        // Counters from the last call to Update()
+        unsigned int staticMapsDrawn;
+        unsigned int castersDrawn;
+
+        // Uniform locations of every program given to SetUniforms(), found the first time it's given
+        ProgramUniformTable programUniforms;
+
+
+        /* Creates the textures and framebuffers of a view. Throws an Exception if they can't
+         * be drawn into. */
+        void CreateView(ShadowView& view);
+        void DeleteView(ShadowView& view);
+        /* Works out the matrices of the sun's cascades from the camera. */
+        void UpdateCascades();
+        /* Works out a spotlight's matrices, returning false if it's disabled. */
+        bool UpdateSpotlight(ALight* light, ShadowView& view);
+        /* Finishes off a view once its matrices are set, working out its frustum and whether
+         * its static map is still valid. */
+        void SetViewMatrices(ShadowView& view);
+        /* Draws the static map if it's invalid, then the dynamic casters on top. */
+        void DrawView(ShadowView& view);
+        /* Draws every caster in 'casters' with the view's matrices. */
+        void DrawCasters(const ShadowView& view);
+        /* Draws a renderable and its children, whose matrices are relative to 'parentMatrix'. */
+        void DrawCaster(IRenderable* renderable, const float* view, const float* parentMatrix);
+        /* Makes every cached map the box is in be drawn again. */
+        void InvalidateStatic(const maths::AABB& bounds);
+        /* Returns the uniform locations of the program, finding them if it hasn't been seen before. */
+        const ProgramUniforms& GetProgramUniforms(const Program* program);
+
+
+    public:
+
+        /* Creates the shadow maps of the sun's cascades. Throws a NullPointerException if the
+         * device is NULL, an InvalidArgumentException if the settings are out of range and a
+         * GLExtensionUnavailableException if shadow maps aren't supported. */
+        ShadowMaps(RenderDevice* device, const ShadowSettings& shadowSettings);
+        ~ShadowMaps();
+
+        /* Sets the directional light that casts the cascaded shadows, NULL for none. The light
+         * isn't owned, and is read every update. */
+        void SetSun(ALight* light);
+        ALight* GetSun() { return sun; }
+        /* Adds a spotlight to draw a shadow map for, returning its index. Its cutoff and
+         * attenuation decide the map's angle and range. Throws a NullPointerException if the
+         * light is NULL. */
+        unsigned int AddSpotlight(ALight* light);
+        /* Removes a spotlight. The ones after it move down an index. */
+        void RemoveSpotlight(ALight* light);
+
+        /* Adds a caster that never moves or changes (like the level), returning the ID it's
+         * removed with. Only the cached maps it's in are drawn again. */
+        BoundingVolumeHierarchy::ProxyID AddStaticCaster(IRenderable* renderable);
+        void RemoveStaticCaster(BoundingVolumeHierarchy::ProxyID proxy);
+        /* Draws every cached map again at the next update, for when static casters have been
+         * changed anyway. */
+        void InvalidateStaticCasters();
+        /* Adds a caster that can move or change every frame. Its box is worked out again
+         * every update. */
+        BoundingVolumeHierarchy::ProxyID AddDynamicCaster(IRenderable* renderable);
+        void RemoveDynamicCaster(BoundingVolumeHierarchy::ProxyID proxy);
+
+        /* Draws the shadow maps for this frame, with the device's current view and projection.
+         * Leaves the window bound, with the viewport set to the device's viewport size. */
+        void Update();
+
+        /* Binds the sun's cascades to texture units 'firstUnit' onwards (which must be above 0)
+         * and sets the uniforms shaders/ShadowMaps.frag reads in 'program', which must be enabled.
+         * The matrices are given in view space, so they're only right for the current frame.
+         * Uniforms the program doesn't use are skipped. Their locations are looked up the first
+         * time a program is given and kept, so ForgetProgram() must be called before a program
+         * given here is relinked or deleted. */
+        void SetUniforms(Program* program, unsigned int firstUnit);
+        void ForgetProgram(const Program* program);
+
+        unsigned int GetAmountOfCascades() const { return settings.amountOfCascades; }
+        /* The shadow map of a cascade or spotlight to read this frame, and the matrix that takes
+         * world space positions into it (x and y are the texture coordinates, z is the depth to
+         * compare with). Throw an InvalidArgumentException if the index is out of range. */
+        unsigned int GetCascadeTexture(unsigned int cascade) const;
+        const float* GetCascadeMatrix(unsigned int cascade) const;
+        float GetCascadeEnd(unsigned int cascade) const;
+        unsigned int GetAmountOfSpotlights() const { return spotlights.size(); }
+        unsigned int GetSpotlightTexture(unsigned int spotlight) const;
+        const float* GetSpotlightMatrix(unsigned int spotlight) const;
+
+        /* Amount of cached maps drawn again by the last update. */
+        unsigned int GetStaticMapsDrawn() const { return staticMapsDrawn; }
+        /* Amount of casters drawn by the last update, static and dynamic. */
+        unsigned int GetCastersDrawn() const { return castersDrawn; }
+
+
+    };
+
+}
+
+}
+
+#endif
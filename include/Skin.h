@@ -1,42 +1,52 @@
-/*
- * File:   Skin.h
- * Author: Donald
- *
- * Created on December 22, 2008, 8:44 PM
- */
-
-#ifndef SKIN_H
-#define SKIN_H
-
-#include <string>
-
-namespace parcel
-{
-
-namespace graphics
-{
-
-    // The maximum amount of textures a single skin can hold
-    const unsigned int skinMaxTextures = 4;
-    // Flag that determines whether a skin's textur slot is free
-    const std::string skinNoTexture = "!";
-
-    /* This struct holds the ID numbers of all all textures and the material is uses.
-     * It also holds a boolean value that determines of the skin uses alpha values.
-     * This can be used for optimisation; if it is false, then no processing time is
-     * wasted on calculating alpha values for it. The static, constant variable
-     * determines how many textures a single skin can use. noTexture is a
-     * unique string that signifies that a slot in the skin does NOT have a texture.*/
-    struct Skin
-    {
-        bool usesAlpha;
-        std::string material;
-        std::string textures[skinMaxTextures];
-
-    };
-
-}
-
-}
-
-#endif
+/*
+ * File:   Skin.h
+ * Author: Donald
+ *
+ * Created on December 22, 2008, 8:44 PM
+ * Changed to store handles instead of string IDs on October 18, 2026, 6:50 PM
+ */
+
+#ifndef SKIN_H
+#define SKIN_H
+
+#include <string>
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Handles to the skins, textures and materials stored in the SkinManager. Every
+     * string ID is given a handle when it's first added, which can be used instead of
+     * the ID to find the resource without any string comparisons. */
+    typedef unsigned int SkinHandle;
+    typedef unsigned int TextureHandle;
+    typedef unsigned int MaterialHandle;
+    // A handle that never refers to anything
+    const unsigned int invalidHandle = 0xFFFFFFFF;
+
+    // The maximum amount of textures a single skin can hold
+    const unsigned int skinMaxTextures = 4;
+    // Flag that determines whether a skin's textur slot is free
+    const TextureHandle skinNoTexture = invalidHandle;
+
+    /* This struct holds the handles of all all textures and the material is uses.
+     * It also holds a boolean value that determines of the skin uses alpha values.
+     * This can be used for optimisation; if it is false, then no processing time is
+     * wasted on calculating alpha values for it. The static, constant variable
+     * determines how many textures a single skin can use. noTexture is a
+     * unique handle that signifies that a slot in the skin does NOT have a texture.*/
+    struct Skin
+    {
+        bool usesAlpha;
+        MaterialHandle material;
+        TextureHandle textures[skinMaxTextures];
+
+    };
+
+}
+
+}
+
+#endif
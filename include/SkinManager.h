@@ -1,130 +1,232 @@
-/*
- * File:   SkinManager.h
- * Author: Donald "Datriot" Whyte
- *
- * Created on December 23, 2008, 7:05 PM
- * Modified to support new, string ID based storage of textures,
- * skins and materials on May 23, 2009, 10:16 AM
- */
-
-#ifndef SKINMANAGER_H
-#define SKINMANAGER_H
-
-#include <map>
-#include <string>
-#include "Material.h"
-#include "Texture.h"
-#include "Skin.h"
-#include "Logger.h"
-
-namespace parcel
-{
-
-namespace graphics
-{
-
-    /* Creates, manages and deletes all skins, materials and textures used in the game. */
-    class SkinManager
-    {
-
-
-    private:
-
-        // These constants define the maximum amount this manager can hold
-        static const unsigned int maxTextures = 20;
-        // Maps are typedef'd for shorter code
-        typedef std::map<std::string, Texture> TextureTable;
-        typedef std::map<std::string, Skin> SkinTable;
-        typedef std::map<std::string, Material> MaterialTable;
-
-        /* These tables hold every texture, skin and material along with their respective
-         * string ID. */
-        TextureTable textures;
-        SkinTable skins;
-        MaterialTable materials;
-
-        debug::Logger* logger; // Pointer to the logger being used in the game
-        unsigned int logID; // ID of the log created for the skin manager
-
-
-        /* Sets the filtering parameters for a single texture. Called in AddTexture(). */
-        void SetTextureFiltering(TextureFilter filter, bool magnification);
-        /* Sets the wrapping parameters for a coordinate of a single texture. Like
-         * SetTextureFiltering(), this is called in AddTexture(). */
-        void SetTextureWrapping(TextureWrapping wrapping, unsigned int textureCoordinate);
-
-
-    public:
-
-        SkinManager(debug::Logger* log);
-        virtual ~SkinManager(); // Destructor
-
-        void DeleteAll(); // Deletes all skins/materials/textures currently loaded
-
-        Skin* GetSkin(const std::string& id); // Returns a pointer to the skin with the given ID
-        Material* GetMaterial(const std::string& id); // Same as above, but for materials
-        Texture* GetTexture(const std::string& id); // Same as above, but for textures
-        // Returns the filename of the texture with the given ID
-        const std::string& GetTextureName(const std::string& id) const;
-
-        /* Adds a skin and use the material given as the new skin's material. The string
-         * given will be the skin's new ID, unless that ID already exists, which it will
-         * return false and NOT create the skin. If the given material is equal to another
-         * material already loaded, it will use the material already loaded and ignore the
-         * given material to save memory. */
-        bool AddSkin(const std::string& id, const Material& mat);
-        /* Overload so we don't have to create a new material structure. */
-        bool AddSkin(const std::string& id, const colourf& ambient,
-            const colourf& diffuse, const colourf& specular, const colourf& emmisive,
-            const float& specularPower);
-
-
-        /* Adds a texture but does not add it to a skin, simply creates one and stores it. */
-        bool AddTexture(const std::string& textureID, const Texture& texture,
-            const TextureParameters& params);
-        /* This overload turns parameters into a Texture struct and calls the above method. */
-        bool AddTexture(const std::string& textureID, const std::string& textureName,
-            const float& textureTransparency, const TextureParameters& params);
-
-        /* Adds a texture to a skin (by using skinID to find the needed skin).
-         * This also checks if the given texture has already been created; if it has,
-         * then simply use the texture that is already created for the skin's texture. */
-        bool AddTextureToSkin(const std::string& skinID, const std::string& textureID,
-            const Texture& texture, const bool& usesAlpha, const TextureParameters& params);
-        // Overload, translates texture data into a struct for you and then calls the above. */
-        bool AddTextureToSkin(const std::string& skinID, const std::string& textureID,
-            const std::string& textureName, const float& textureTransparency, const bool& usesAlpha,
-            const TextureParameters& params);
-
-        /* Overloads of the four methods above that don't need to be give a
-         * TextureParameters struct, a default one is created automatically.
-         * This means I don't have to create an extra TextureParameters()
-         * structure myself when I don't need to, shortening code. */
-        bool AddTexture(const std::string& textureID, const Texture& texture);
-        bool AddTexture(const std::string& textureID, const std::string& textureName,
-            const float& textureTransparency);
-
-        bool AddTextureToSkin(const std::string& skinID, const std::string& textureID,
-            const Texture& texture, const bool& usesAlpha);
-        bool AddTextureToSkin(const std::string& skinID, const std::string& textureID,
-            const std::string& textureName, const float& textureTransparency, const bool& usesAlpha);
-
-        /* Finds skin using the given ID and deletes it. The second overload, with
-         * the two boolean parameters determines if the texture and material used
-         * by the skin are delete too. Be very careful when setting these to true. */
-        bool DeleteSkin(const std::string& id);
-        bool DeleteSkin(const std::string& id, bool deleteTextures, bool deleteMaterial);
-        /* These both find the texture/material using the given ID and deletes it.
-         * If a skin currently uses the texture or material in question, that skin
-         * will also be delete, so BEWARE! */
-        bool DeleteTexture(const std::string& id);
-        bool DeleteMaterial(const std::string& id);
-
-
-    };
-
-}
-
-}
-
-#endif
+/*
+ * File:   SkinManager.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on December 23, 2008, 7:05 PM
+ * Modified to support new, string ID based storage of textures,
+ * skins and materials on May 23, 2009, 10:16 AM
+ * Changed to load textures through an IRenderBackend on October 18, 2026, 4:45 PM
+ * Changed to store resources in arrays indexed by handles on October 18, 2026, 7:00 PM
+ * Added grouping textures into array textures on October 18, 2026, 9:20 PM
+ * Added transparency classification of skins on October 18, 2026, 9:50 PM
+ */
+
+#ifndef SKINMANAGER_H
+#define SKINMANAGER_H
+
+#include <string>
+#include <vector>
+#include "Material.h"
+#include "Texture.h"
+#include "Skin.h"
+#include "Logger.h"
+#include "RenderBackend.h"
+#include "StringTable.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Creates, manages and deletes all skins, materials and textures used in the game.
+     *
+     * Every resource is added with a string ID, which is interned to give the resource
+     * a handle. Resources are stored in arrays indexed by their handles, so looking one
+     * up by handle is just an array access. The string IDs are meant for loading and
+     * tools; anything done every frame should use the handles instead. An ID keeps the
+     * same handle even if its resource is deleted and added again, and getting a
+     * resource using the handle of a deleted one throws an exception.
+     *
+     * Optionally, textures can also be grouped into array textures. Every texture added
+     * while this is enabled is copied into a layer of an array texture holding other
+     * textures with the same size and parameters, and the texture's arrayID and arrayLayer
+     * say where. Shaders can then pick the layer per object, so objects that only differ
+     * in their texture can be drawn together (see ShaderRenderer). Every texture is still
+     * created as a normal 2D texture too, which is what the fixed function renderers use
+     * and what everything falls back on when array textures aren't supported. */
+    class SkinManager
+    {
+
+
+    private:
+
+        // These constants define the maximum amount this manager can hold
+        static const unsigned int maxTextures = 20;
+        static const unsigned int textureArrayLayers = 16; // Layers in every array texture
+
+        /* Stores all resources of one type, indexed by their handle. */
+        template<typename T>
+        struct ResourceTable
+        {
+            general::StringTable ids; // Interns the IDs, giving the handles
+            std::vector<T> resources;
+            std::vector<bool> loaded; // False for handles whose resource was deleted (or never added)
+
+            bool IsLoaded(unsigned int handle) const { return (handle < loaded.size() && loaded[handle]); }
+            /* Returns the handle of the resource with the given ID, or invalidHandle if it isn't loaded. */
+            unsigned int Find(const std::string& id) const
+            {
+                unsigned int handle = ids.Find(id);
+                return (IsLoaded(handle)) ? handle : invalidHandle;
+            }
+            /* Stores the resource and returns its new handle. */
+            unsigned int Add(const std::string& id, const T& resource)
+            {
+                unsigned int handle = ids.Intern(id);
+                if (handle >= resources.size())
+                {
+                    resources.resize(handle + 1);
+                    loaded.resize(handle + 1, false);
+                }
+                resources[handle] = resource;
+                loaded[handle] = true;
+                return handle;
+            }
+            void Remove(unsigned int handle) { loaded[handle] = false; }
+            /* Removes every resource. The IDs keep their handles. */
+            void Clear()
+            {
+                resources.clear();
+                loaded.clear();
+            }
+        };
+
+        /* These tables hold every texture, skin and material along with their respective
+         * string ID. */
+        ResourceTable<Texture> textures;
+        ResourceTable<Skin> skins;
+        ResourceTable<Material> materials;
+
+        /* An array texture holding textures with the same size and parameters. Arrays that
+         * have been emptied have a glID of 0, and are reused for the next new array. */
+        struct TextureArray
+        {
+            unsigned int glID;
+            int width, height;
+            TextureParameters params;
+            std::vector<bool> usedLayers;
+            unsigned int layersUsed;
+        };
+        std::vector<TextureArray> textureArrays;
+        bool useTextureArrays; // True if new textures are put into array textures
+
+        IRenderBackend* backend; // Used to create, set up and delete textures
+
+        debug::Logger* logger; // Pointer to the logger being used in the game
+        unsigned int logID; // ID of the log created for the skin manager
+
+
+        /* Deletes the texture with the given handle, which must be loaded. */
+        void DeleteTexture(TextureHandle handle);
+        /* Copies the texture's pixels into a free layer of an array texture with the same size
+         * and parameters (creating one if there isn't one with room), filling in the texture's
+         * arrayID and arrayLayer. Textures using mipmaps are left out of arrays. */
+        void AddToTextureArray(Texture& texture, const TextureParameters& params);
+        /* Frees the layer the texture used, deleting its array texture if it's now empty. */
+        void RemoveFromTextureArray(const Texture& texture);
+
+
+
+    public:
+
+        SkinManager(IRenderBackend* renderBackend, debug::Logger* log);
+        virtual ~SkinManager(); // Destructor
+
+        void DeleteAll(); // Deletes all skins/materials/textures currently loaded
+
+        /* Turns grouping textures added from now on into array textures on or off. Returns
+         * false (and stays off) if the render backend doesn't support array textures.
+         * Textures already in arrays stay in them when this is turned off. */
+        bool SetTextureArraysEnabled(bool enabled);
+        bool UsingTextureArrays() const { return useTextureArrays; }
+        // Returns the amount of array textures currently created
+        unsigned int GetAmountOfTextureArrays() const;
+
+        /* Return a pointer to the skin/material/texture with the given handle. These are
+         * what should be used while rendering. Throw an exception if it isn't loaded. */
+        Skin* GetSkin(SkinHandle handle);
+        Material* GetMaterial(MaterialHandle handle);
+        Texture* GetTexture(TextureHandle handle);
+        /* Returns true if things drawn with the skin need blending, which is when the skin
+         * uses alpha or its primary texture isn't fully opaque. Throws an exception if the
+         * skin isn't loaded. */
+        bool IsSkinTranslucent(SkinHandle handle);
+
+        Skin* GetSkin(const std::string& id); // Returns a pointer to the skin with the given ID
+        Material* GetMaterial(const std::string& id); // Same as above, but for materials
+        Texture* GetTexture(const std::string& id); // Same as above, but for textures
+        // Returns the filename of the texture with the given ID
+        const std::string& GetTextureName(const std::string& id) const;
+
+        /* Return the handle of the skin/material/texture with the given ID. Throw an
+         * exception if it isn't loaded. */
+        SkinHandle GetSkinHandle(const std::string& id) const;
+        MaterialHandle GetMaterialHandle(const std::string& id) const;
+        TextureHandle GetTextureHandle(const std::string& id) const;
+        /* Return the ID the handle was given for. */
+        const std::string& GetSkinID(SkinHandle handle) const { return skins.ids.GetString(handle); }
+        const std::string& GetMaterialID(MaterialHandle handle) const { return materials.ids.GetString(handle); }
+        const std::string& GetTextureID(TextureHandle handle) const { return textures.ids.GetString(handle); }
+
+        /* Adds a skin and use the material given as the new skin's material. The string
+         * given will be the skin's new ID, unless that ID already exists, which it will
+         * return false and NOT create the skin. If the given material is equal to another
+         * material already loaded, it will use the material already loaded and ignore the
+         * given material to save memory. */
+        bool AddSkin(const std::string& id, const Material& mat);
+        /* Overload so we don't have to create a new material structure. */
+        bool AddSkin(const std::string& id, const colourf& ambient,
+            const colourf& diffuse, const colourf& specular, const colourf& emmisive,
+            const float& specularPower);
+
+
+        /* Adds a texture but does not add it to a skin, simply creates one and stores it. */
+        bool AddTexture(const std::string& textureID, const Texture& texture,
+            const TextureParameters& params);
+        /* This overload turns parameters into a Texture struct and calls the above method. */
+        bool AddTexture(const std::string& textureID, const std::string& textureName,
+            const float& textureTransparency, const TextureParameters& params);
+
+        /* Adds a texture to a skin (by using skinID to find the needed skin).
+         * This also checks if the given texture has already been created; if it has,
+         * then simply use the texture that is already created for the skin's texture. */
+        bool AddTextureToSkin(const std::string& skinID, const std::string& textureID,
+            const Texture& texture, const bool& usesAlpha, const TextureParameters& params);
+        // Overload, translates texture data into a struct for you and then calls the above. */
+        bool AddTextureToSkin(const std::string& skinID, const std::string& textureID,
+            const std::string& textureName, const float& textureTransparency, const bool& usesAlpha,
+            const TextureParameters& params);
+
+        /* Overloads of the four methods above that don't need to be give a
+         * TextureParameters struct, a default one is created automatically.
+         * This means I don't have to create an extra TextureParameters()
+         * structure myself when I don't need to, shortening code. */
+        bool AddTexture(const std::string& textureID, const Texture& texture);
+        bool AddTexture(const std::string& textureID, const std::string& textureName,
+            const float& textureTransparency);
+
+        bool AddTextureToSkin(const std::string& skinID, const std::string& textureID,
+            const Texture& texture, const bool& usesAlpha);
+        bool AddTextureToSkin(const std::string& skinID, const std::string& textureID,
+            const std::string& textureName, const float& textureTransparency, const bool& usesAlpha);
+
+        /* Finds skin using the given ID and deletes it. The second overload, with
+         * the two boolean parameters determines if the texture and material used
+         * by the skin are delete too. Be very careful when setting these to true. */
+        bool DeleteSkin(const std::string& id);
+        bool DeleteSkin(const std::string& id, bool deleteTextures, bool deleteMaterial);
+        /* These both find the texture/material using the given ID and deletes it.
+         * If a skin currently uses the texture or material in question, that skin
+         * will also be delete, so BEWARE! */
+        bool DeleteTexture(const std::string& id);
+        bool DeleteMaterial(const std::string& id);
+
+
+    };
+
+}
+
+}
+
+#endif
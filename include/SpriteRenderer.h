@@ -1,61 +1,73 @@
-/*
- * File:   SpriteRenderer.h
- * Author: Donald "Datriot" Whyte
- *
- * Created on June 29, 2009, 6:45 PM
- */
-
-#ifndef SPRITERENDERER_H
-#define SPRITERENDERER_H
-
-#include <GLee.h>
-#include "ARenderer.h"
-#include "RenderDevice.h"
-#include "Util.h"
-
-namespace parcel
-{
-
-namespace graphics
-{
-
-    /* This acts the same as VBORenderer, except renderables that draw
-     * geometry do not use normals and 3D vertices, they use 2D vertices
-     * instead. This means four floats (16 bytes) is saved for every vertex. */
-    class SpriteRenderer : public ARenderer
-    {
-
-
-    private:
-
-        GLuint vboID;
-        float* vboData;
-        std::vector<general::ArrayIndices> arrayIndices;
-        /* Used to make sure geometry data exists before calling glDrawArrays
-         * in the RenderObject() method. */
-        int vboMemorySize;
-
-        RenderDevice* renderDevice;
-
-
-        void ProcessRenderable(IRenderable* renderable, unsigned int& vboIndex, unsigned int& vertexNumber);
-        void RenderObject(IRenderable* renderable, unsigned int& index);
-
-
-    public:
-
-        SpriteRenderer(RenderDevice* renderDevice, debug::Logger* log, const bool& willDeleteAll);
-        ~SpriteRenderer();
-
-        void Update();
-        void Render();
-
-
-    };
-
-
-}
-
-}
-
-#endif
+/*
+ * File:   SpriteRenderer.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on June 29, 2009, 6:45 PM
+ * Changed to only blend translucent sprites on October 19, 2026, 4:40 AM
+ */
+
+#ifndef SPRITERENDERER_H
+#define SPRITERENDERER_H
+
+#include "ARenderer.h"
+#include "RenderDevice.h"
+#include "Util.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* This acts the same as VBORenderer, except renderables that draw
+     * geometry do not use normals and 3D vertices, they use 2D vertices
+     * instead. This means four floats (16 bytes) is saved for every vertex.
+     *
+     * Unlike VBORenderer, sprites aren't reordered into opaque and translucent passes, since
+     * the order they're stored in is the order they're layered in. Blending is still only
+     * turned on while sprites with translucent skins are drawn. */
+    class SpriteRenderer : public ARenderer
+    {
+
+
+    private:
+
+        unsigned int vboID;
+        float* vboData;
+        std::vector<general::ArrayIndices> arrayIndices;
+        // Index in arrayIndices of every renderable, used when recording a range of renderables
+        std::vector<unsigned int> renderableIndices;
+        /* Used to make sure geometry data exists before calling glDrawArrays
+         * in the RenderObject() method. */
+        int vboMemorySize;
+        bool blending; // If blending is on while sprites are drawn
+
+        RenderDevice* renderDevice;
+        IRenderBackend* backend;
+
+
+        void ProcessRenderable(IRenderable* renderable, unsigned int& vboIndex, unsigned int& vertexNumber);
+        /* Turns blending on if the skin is translucent and off if it isn't, when it's not already. */
+        void SetBlending(SkinHandle skin);
+        void RenderObject(IRenderable* renderable, unsigned int& index);
+        void RecordObject(IRenderable* renderable, CommandBuffer& buffer, unsigned int& index);
+
+
+    public:
+
+        SpriteRenderer(RenderDevice* renderDevice, debug::Logger* log, const bool& willDeleteAll);
+        ~SpriteRenderer();
+
+        void Update();
+        void Render();
+        void RecordCommands(CommandBuffer& buffer, unsigned int first, unsigned int last);
+
+
+    };
+
+
+}
+
+}
+
+#endif
@@ -0,0 +1,238 @@
+/*
+ * File:   StateCacheBackend.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 5:35 PM
+ * Added SetDepthWrite() on October 19, 2026, 4:55 AM
+ */
+
+#ifndef STATECACHEBACKEND_H
+#define STATECACHEBACKEND_H
+
+#include "RenderBackend.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Render backend that keeps a copy of the graphics API's state on the CPU and passes
+     * calls on to another backend only when they actually change something. Binding the
+     * texture that's already bound, enabling a capability that's already enabled and so
+     * on are skipped, and queries like IsEnabled() and GetBoundBuffer() are answered from
+     * the copy, so the API never has to be asked (which can stall the pipeline).
+     *
+     * Shadowed state: capabilities, blend mode, clear colour, viewport, current colour,
+     * lights being on or off, matrix mode, bound buffers, client arrays, bound texture,
+     * current program, bound framebuffer and the maximum amount of lights.
+     *
+     * Everything starts off unknown, so the first call that sets each piece of state is
+     * always passed on, and the first query of each is asked of the target backend.
+     * If anything changes the state without going through this backend (another backend
+     * using the same context, for instance), call Invalidate() afterwards.
+     *
+     * Display lists are handled like OpenGL handles them: calls made while a list is
+     * being built are stored in the list rather than executed, so they are always passed
+     * on and don't change the copy (apart from the buffer, client array and framebuffer
+     * calls, which are never stored in lists). Calling lists can change anything, so CallLists()
+     * forgets the state lists are able to change. */
+    class StateCacheBackend : public IRenderBackend
+    {
+
+
+    private:
+
+        /* Constants for the amount of each type of state shadowed. */
+        static const unsigned int amountOfCapabilities = 7;
+        static const unsigned int amountOfClientArrays = 4;
+        static const unsigned int amountOfBufferTargets = 3;
+        static const unsigned int amountOfLights = 8; // Lights above this are not shadowed
+
+        // Switches are stored as one of these
+        enum SwitchState
+        {
+            SWITCH_UNKNOWN,
+            SWITCH_OFF,
+            SWITCH_ON
+        };
+
+        IRenderBackend* target; // Backend the calls are passed on to
+        unsigned int redundantCallsAvoided; // Calls not passed on, since they wouldn't have changed anything
+        bool compilingList; // True between BeginList() and EndList()
+
+        /* The shadowed state. Every value that isn't a switch has a flag saying if it's known. */
+        SwitchState capabilities[amountOfCapabilities];
+        SwitchState clientArrays[amountOfClientArrays];
+        SwitchState lights[amountOfLights];
+
+        BlendMode blendMode;
+        bool blendModeKnown;
+        bool depthWrite;
+        bool depthWriteKnown;
+        colourf clearColour;
+        bool clearColourKnown;
+        int viewport[4];
+        bool viewportKnown;
+        colourf colour;
+        bool colourKnown;
+        MatrixStack matrixMode;
+        bool matrixModeKnown;
+
+        unsigned int boundBuffers[amountOfBufferTargets];
+        bool boundBuffersKnown[amountOfBufferTargets];
+        unsigned int boundTexture;
+        bool boundTextureKnown;
+        unsigned int currentProgram;
+        bool currentProgramKnown;
+        unsigned int boundFramebuffer;
+        bool boundFramebufferKnown;
+
+        unsigned int maxLights; // Never changes, so it's only asked for once
+        bool maxLightsKnown;
+
+
+        /* Returns true if a call that sets state to what it already is can be skipped,
+         * counting it if so. 'unchanged' says if the call would leave the state as it is. */
+        bool SkipCall(bool unchanged);
+        /* Same as above, but for the calls stored in display lists, which can never be
+         * skipped while a list is being built. */
+        bool SkipListableCall(bool unchanged);
+
+        /* Forgets all of the state that can be stored in a display list. */
+        void InvalidateListableState();
+
+
+    public:
+
+        /* Calls are passed on to 'targetBackend', which is not owned by the cache. */
+        StateCacheBackend(IRenderBackend* targetBackend);
+
+        /* Forgets everything the cache knows, so every piece of state will be set or asked
+         * for again. Call this after something changes the state behind the cache's back. */
+        void Invalidate();
+
+        unsigned int GetRedundantCallsAvoided() const { return redundantCallsAvoided; }
+        void ResetRedundantCallsAvoided() { redundantCallsAvoided = 0; }
+        IRenderBackend* GetTarget() { return target; }
+
+
+        void Enable(RenderCapability capability);
+        void Disable(RenderCapability capability);
+        bool IsEnabled(RenderCapability capability);
+        void SetBlendMode(BlendMode mode);
+        void SetDepthWrite(bool enabled);
+
+        void SetClearColour(const colourf& newColour);
+        void Clear(unsigned int flags);
+        void SetViewport(int x, int y, int width, int height);
+
+        void SetColour(const colourf& newColour);
+        void SetMaterialColour(MaterialColour property, const colourf& newColour);
+        void SetMaterialShininess(float shininess);
+
+        unsigned int GetMaxLights();
+        void EnableLight(unsigned int light);
+        void DisableLight(unsigned int light);
+        void SetLightVector(unsigned int light, LightParameter parameter, const float* values);
+        void SetLightValue(unsigned int light, LightParameter parameter, float value);
+        void SetLightModel(const colourf& globalAmbient, bool localViewer, bool twoSided);
+
+        void SetMatrixMode(MatrixStack stack);
+        void LoadMatrix(const float* matrix);
+        void MultiplyMatrix(const float* matrix);
+        void PushMatrix();
+        void PopMatrix();
+        void Translate(float x, float y, float z);
+        void Rotate(float angle, float x, float y, float z);
+
+        void GenerateBuffers(unsigned int amount, unsigned int* ids);
+        void DeleteBuffers(unsigned int amount, const unsigned int* ids);
+        void BindBuffer(BufferTarget bufferTarget, unsigned int id);
+        unsigned int GetBoundBuffer(BufferTarget bufferTarget);
+        void BufferData(BufferTarget bufferTarget, unsigned int size, const void* data);
+        void* MapBuffer(BufferTarget bufferTarget);
+        bool UnmapBuffer(BufferTarget bufferTarget);
+
+        void EnableClientArray(ClientArray clientArray);
+        void DisableClientArray(ClientArray clientArray);
+        bool IsClientArrayEnabled(ClientArray clientArray);
+        void SetVertexPointer(unsigned int components, unsigned int stride, const void* pointer);
+        void SetTexCoordPointer(unsigned int components, unsigned int stride, const void* pointer);
+        void SetNormalPointer(unsigned int stride, const void* pointer);
+        void SetColourPointer(unsigned int components, unsigned int stride, const void* pointer);
+        void EnableAttributeArray(unsigned int location);
+        void DisableAttributeArray(unsigned int location);
+        void SetAttributePointer(unsigned int location, unsigned int components,
+            unsigned int stride, const void* pointer);
+
+        void DrawArrays(PrimitiveType type, unsigned int start, unsigned int amount);
+        void DrawElements(PrimitiveType type, unsigned int start, unsigned int amount);
+
+        void GenerateTextures(unsigned int amount, unsigned int* ids);
+        void DeleteTextures(unsigned int amount, const unsigned int* ids);
+        bool IsTexture(unsigned int id);
+        void BindTexture(unsigned int id);
+        void SetTextureFilter(TextureFilter filter, bool magnification);
+        void SetTextureWrapping(TextureWrapping wrapping, unsigned int coordinate);
+        void UploadTexture(unsigned int level, unsigned int width, unsigned int height,
+            PixelFormat format, const void* pixels);
+
+        unsigned int GenerateLists(unsigned int amount);
+        void DeleteLists(unsigned int first, unsigned int amount);
+        void BeginList(unsigned int id);
+        void EndList();
+        void SetListBase(unsigned int base);
+        void CallLists(unsigned int amount, const unsigned char* lists);
+
+        void UseProgram(unsigned int handle);
+
+        bool SupportsTextureBuffers();
+        void BindTextureBuffer(unsigned int unit, unsigned int texture, unsigned int buffer);
+
+        bool SupportsArrayTextures();
+        void BindArrayTexture(unsigned int unit, unsigned int texture);
+        void AllocateArrayTexture(unsigned int width, unsigned int height, unsigned int layers,
+            const TextureParameters& params);
+        void UploadArrayTextureLayer(unsigned int layer, unsigned int width, unsigned int height,
+            PixelFormat format, const void* pixels);
+
+        void BindUnitTexture(unsigned int unit, unsigned int texture);
+        void SetUnitTexCoordPointer(unsigned int unit, unsigned int components, unsigned int stride,
+            const void* pointer);
+        void DisableUnitTexCoordArray(unsigned int unit);
+
+        bool SupportsRenderTargets();
+        void GenerateFramebuffers(unsigned int amount, unsigned int* ids);
+        void DeleteFramebuffers(unsigned int amount, const unsigned int* ids);
+        void BindFramebuffer(unsigned int id);
+        void GenerateRenderbuffers(unsigned int amount, unsigned int* ids);
+        void DeleteRenderbuffers(unsigned int amount, const unsigned int* ids);
+        void AllocateDepthRenderbuffer(unsigned int id, unsigned int width, unsigned int height);
+        bool AttachToFramebuffer(unsigned int colourTexture, unsigned int depthRenderbuffer);
+        void BlitFramebuffer(unsigned int source, unsigned int sourceWidth, unsigned int sourceHeight,
+            unsigned int destination, unsigned int destinationWidth, unsigned int destinationHeight);
+
+        bool SupportsTimerQueries();
+        void GenerateQueries(unsigned int amount, unsigned int* ids);
+        void DeleteQueries(unsigned int amount, const unsigned int* ids);
+        void BeginTimerQuery(unsigned int id);
+        void EndTimerQuery();
+        bool GetTimerQueryResult(unsigned int id, float& milliseconds);
+
+        bool SupportsShadowMaps();
+        void AllocateDepthTexture(unsigned int width, unsigned int height);
+        bool AttachDepthTextureToFramebuffer(unsigned int depthTexture);
+        void BlitFramebufferDepth(unsigned int source, unsigned int destination, unsigned int width,
+            unsigned int height);
+        void BindDepthTexture(unsigned int unit, unsigned int texture);
+        void SetPolygonOffset(float factor, float units);
+
+
+    };
+
+}
+
+}
+
+#endif
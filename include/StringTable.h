@@ -0,0 +1,61 @@
+/*
+ * File:   StringTable.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 6:40 PM
+ */
+
+#ifndef STRINGTABLE_H
+#define STRINGTABLE_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace parcel
+{
+
+namespace general
+{
+
+    /* Interns strings, giving every different string a unique integer. The integers
+     * start at 0 and go up by one for every new string, so they can be used to index
+     * arrays. A string keeps its integer for as long as the table exists, so comparing
+     * two interned strings is just comparing two integers.
+     *
+     * Strings are never removed from the table, so it only grows as big as the amount
+     * of different strings given to it. */
+    class StringTable
+    {
+
+
+    private:
+
+        typedef std::map<std::string, unsigned int> IndexTable;
+
+        IndexTable indices; // Maps every string to its integer
+        std::vector<const std::string*> strings; // Maps every integer back to its string (the key in 'indices')
+
+
+    public:
+
+        static const unsigned int notFound = 0xFFFFFFFF; // Returned by Find() if the string isn't interned
+
+        /* Returns the integer for the given string, adding it to the table if needed. */
+        unsigned int Intern(const std::string& str);
+        /* Returns the integer for the given string, or 'notFound' if it has never been interned. */
+        unsigned int Find(const std::string& str) const;
+
+        /* Returns the string with the given integer. Throws an exception if there isn't one. */
+        const std::string& GetString(unsigned int index) const;
+        /* Returns the amount of strings interned, which is one more than the highest integer. */
+        unsigned int GetSize() const { return strings.size(); }
+
+
+    };
+
+}
+
+}
+
+#endif
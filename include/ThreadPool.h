@@ -0,0 +1,109 @@
+/*
+ * File:   ThreadPool.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 10:05 AM
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <string>
+#include <windows.h>
+
+namespace parcel
+{
+
+namespace general
+{
+
+    /* Interface for a piece of work that can be split across the threads of a
+     * ThreadPool.
+     *
+     * Execute() is called once for every index from 0 to the amount given to
+     * ThreadPool::Dispatch(), possibly from many threads at once. threadIndex
+     * is unique to the thread making the call (0 is always the thread that called
+     * Dispatch()), so it can be used to access per-thread storage without locking. */
+    class ITask
+    {
+
+    public:
+
+        virtual void Execute(unsigned int index, unsigned int threadIndex) = 0;
+
+    };
+
+
+    /* A fixed set of worker threads that are created once and then reused for
+     * every task dispatched to the pool. The thread that calls Dispatch() also
+     * does work, so a pool with no workers simply runs every task in order. */
+    class ThreadPool
+    {
+
+
+    private:
+
+        /* Every worker has its own start and finish event, so the dispatching thread
+         * can wake them all up and then wait for all of them to be done. */
+        struct Worker
+        {
+            ThreadPool* pool; // Pool the worker belongs to
+            unsigned int threadIndex; // Index given to ITask::Execute()
+            HANDLE thread; // Win32 handle to the worker's thread
+            HANDLE startEvent; // Signalled when there is work to do
+            HANDLE finishEvent; // Signalled by the worker when it has run out of work
+        };
+
+        std::vector<Worker> workers; // Holds every worker thread
+        std::vector<HANDLE> finishEvents; // Copy of every worker's finish event for WaitForMultipleObjects
+
+        /* State of the task currently being dispatched. nextIndex is incremented
+         * atomically by every thread to grab the next piece of work. */
+        ITask* currentTask;
+        LONG taskAmount;
+        volatile LONG nextIndex;
+        volatile LONG failed; // Set to 1 by the first Execute() that throws
+        std::string failMessage; // Message of the exception it threw
+        volatile LONG quit; // Set to 1 when the workers have to exit
+
+
+        /* Entry point of every worker thread. */
+        static DWORD WINAPI WorkerMain(void* parameter);
+        /* Keeps executing indices of the current task until there are none left. */
+        void ExecuteTask(unsigned int threadIndex);
+        /* Records an exception thrown by the current task and skips its remaining indices. */
+        void Fail(const std::string& message);
+
+
+    public:
+
+        /* Creates the given amount of worker threads. If 'numWorkers' is 0, then
+         * one worker is created for every processor apart from the one the
+         * dispatching thread runs on. */
+        ThreadPool(unsigned int numWorkers);
+        /* Tells every worker to exit and waits for them to do so. */
+        ~ThreadPool();
+
+        /* Calls task->Execute() for every index from 0 to 'amount' using all the
+         * threads in the pool and blocks until every index has been executed.
+         * Dispatch() must only be called from one thread at a time.
+         *
+         * If Execute() throws, the indices no thread has started are skipped, and once
+         * every thread has stopped, the first exception's message is thrown from here as a
+         * debug::Exception. */
+        void Dispatch(ITask* task, unsigned int amount);
+
+        /* Returns the amount of threads that execute tasks, including the
+         * dispatching thread. threadIndex given to ITask::Execute() is always
+         * less than this. */
+        unsigned int GetThreadCount() const { return workers.size() + 1; }
+
+
+    };
+
+}
+
+}
+
+#endif
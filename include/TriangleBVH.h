@@ -0,0 +1,125 @@
+/*
+ * File:   TriangleBVH.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:20 AM
+ */
+
+#ifndef TRIANGLEBVH_H
+#define TRIANGLEBVH_H
+
+#include <vector>
+#include "Bounds.h"
+#include "Primitives.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Bounding volume hierarchy over individual triangles, for tracing rays through static
+     * geometry (like the lightmap baker does). Unlike BoundingVolumeHierarchy, which holds
+     * whole objects and can change every frame, this is built once from a fixed set of
+     * triangles and only answers ray queries, as quickly as it can.
+     *
+     * The tree is built top down with the surface area heuristic and stored depth first, so
+     * a node's first child is right after it in the array. Every leaf holds up to four
+     * triangles, stored as a packet with each coordinate of the four triangles next to each
+     * other, so a ray is tested against all four at once with SSE instructions. */
+    class TriangleBVH
+    {
+
+
+    public:
+
+        /* Where a ray hit a triangle. 'distance' is in multiples of the ray direction's length,
+         * and 'u' and 'v' are the barycentric coordinates of the hit, so the point is
+         * (1 - u - v) * v1 + u * v2 + v * v3. */
+        struct Hit
+        {
+            unsigned int triangle; // Index of the triangle in the array the tree was built from
+            float distance;
+            float u, v;
+        };
+
+
+    private:
+
+        static const unsigned int trianglesPerLeaf = 4;
+        static const unsigned int amountOfBins = 12; // Amount of places split along each axis when building
+        static const unsigned int maxDepth = 60; // Ranges this deep are split down the middle instead
+        static const unsigned int noTriangle = 0xFFFFFFFF; // Given to the unused slots of packets
+
+        /* A node in the tree. Inner nodes have their first child right after them and the
+         * second at 'child'; leaves use 'child' as the index of their packet. */
+        struct Node
+        {
+            maths::AABB bounds;
+            unsigned int child;
+            bool leaf;
+        };
+
+        /* Up to four triangles, stored as one of their vertices and the two edges from it,
+         * each split into x, y and z arrays for loading straight into SSE registers. */
+        struct Packet
+        {
+            float origin[3][4];
+            float edge1[3][4];
+            float edge2[3][4];
+            unsigned int triangles[4];
+        };
+
+        // A triangle in a range being built, along with its box and the box's centre
+        struct BuildItem
+        {
+            maths::AABB bounds;
+            maths::vector3f centre;
+            unsigned int triangle;
+        };
+
+        std::vector<Node> nodes;
+        std::vector<Packet> packets;
+        std::vector<BuildItem> buildItems; // Only used while building
+
+
+        /* Builds a subtree out of buildItems[first] to buildItems[last - 1], returning its root. */
+        unsigned int BuildRange(unsigned int first, unsigned int last, unsigned int depth,
+            const std::vector<maths::vector3f>& positions, const std::vector<Triangle>& triangles);
+        /* Tests the ray against the four triangles of a packet, updating 'hit' if one of them is
+         * closer than hit.distance. If 'anyHit' is true, it returns as soon as it finds one. */
+        static bool IntersectPacket(const Packet& packet, const maths::Ray& ray, bool anyHit, Hit& hit);
+        /* Shared by Intersect() and IsOccluded(). */
+        bool Trace(const maths::Ray& ray, float maxDistance, bool anyHit, Hit& hit) const;
+
+
+    public:
+
+        TriangleBVH();
+
+        /* Builds the tree over the triangles, whose vertices index into 'positions'. Anything
+         * built before is thrown away. Throws an InvalidArgumentException if a triangle uses a
+         * vertex that doesn't exist. */
+        void Build(const std::vector<maths::vector3f>& positions, const std::vector<Triangle>& triangles);
+        /* Removes every triangle. */
+        void Clear();
+
+        /* Finds the first triangle the ray hits between 0 and 'maxDistance' along it, returning
+         * false if it doesn't hit any. Both sides of the triangles are hit. */
+        bool Intersect(const maths::Ray& ray, float maxDistance, Hit& hit) const;
+        /* Returns true if the ray hits any triangle between 0 and 'maxDistance' along it. This
+         * is quicker than Intersect(), since it can stop at the first hit it finds. */
+        bool IsOccluded(const maths::Ray& ray, float maxDistance) const;
+
+        bool IsEmpty() const { return nodes.empty(); }
+        unsigned int GetAmountOfNodes() const { return nodes.size(); }
+        const maths::AABB& GetBounds() const;
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -1,70 +1,135 @@
-/*
- * File:   VBORenderer.h
- * Author: Donald "Datriot" Whyte
- *
- * Created on February 17, 2009, 10:16 AM
- */
-
-#ifndef VBORENDERER_H
-#define VBORENDERER_H
-
-#include <GLee.h>
-#include "ARenderer.h"
-#include "RenderDevice.h"
-#include "Util.h"
-
-namespace parcel
-{
-
-namespace graphics
-{
-
-    /* Provides storing and batch rendering functionality using Vertex Buffer Objects (VBOs)
-     * within OpenGL. */
-    class VBORenderer : public ARenderer
-    {
-
-
-    private:
-
-        GLuint vboID; // ID for the renderer's Vertex Buffer Object (VBO)
-        float* vboData; // Used to store a pointer the VBO's data
-
-        // Used to store every renderable's start and end indices in the VBO
-        std::vector<general::ArrayIndices> arrayIndices;
-
-        RenderDevice* renderDevice; // Used for activating a renderable's skin and texture
-
-
-        /* Processes one renderable, adding its data to the VBO.
-         * It takes in the current VBO index and the number of vertices already processed. */
-        void ProcessRenderable(IRenderable* renderable, unsigned int& vboIndex, unsigned int& vertexNumber);
-        /* Renders a single object by calling glDrawArrays, activating the skin and
-         * transforming objects by their matrix. */
-        void RenderObject(IRenderable* renderable, unsigned int& index);
-
-
-    public:
-
-        /* The constructor initialises the properties and creates a blank VBO. */
-        VBORenderer(RenderDevice* renderDevice, debug::Logger* log, const bool& willDeleteAll);
-        /* The destructor destroys the VBO and releases any memory stored in vboData.
-         * There is no need to delete every renderable, the superclass' (ARenderer) destructor
-         * does that for us.*/
-        ~VBORenderer();
-
-        /* The update method clears the VBO and refills it with the renderable's values. Also
-         * clears the arrayIndices std::vector and refills it with elements. */
-        void Update();
-        /* The render method renders every object by calling RenderObject() for each one.
-         * DO NOT add/delete any renderables between the calls to Update() and Render(). */
-        void Render();
-
-
-    };
-
-}
-
-}
-
-#endif
+/*
+ * File:   VBORenderer.h
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on February 17, 2009, 10:16 AM
+ * Changed to draw opaque objects first and sort translucent ones on October 18, 2026, 9:50 PM
+ * Added per-object light selection on October 19, 2026, 12:05 AM
+ * Added lightmaps on October 19, 2026, 12:20 AM
+ */
+
+#ifndef VBORENDERER_H
+#define VBORENDERER_H
+
+#include "ARenderer.h"
+#include "RenderDevice.h"
+#include "Util.h"
+#include "RadixSort.h"
+#include "Bounds.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Provides storing and batch rendering functionality using Vertex Buffer Objects (VBOs)
+     * within OpenGL.
+     *
+     * Render() draws in two passes. Objects whose skin is opaque are drawn first, in the
+     * order they're stored, with blending turned off. Objects whose skin is translucent
+     * (see SkinManager::IsSkinTranslucent()) are drawn afterwards with blending, sorted
+     * from back to front so they blend with everything behind them. Blending is left on
+     * afterwards, since that's what the render device starts with.
+     *
+     * If the device's lighting picks lights for each object (see
+     * ALighting::SelectsLightsPerObject()), each object's lights are bound before it's drawn,
+     * using the box around its vertices in world space.
+     *
+     * Renderables with baked lighting (ILightmapped) are drawn with lighting turned off and
+     * their lightmap multiplied in on texture unit 1. Their lightmap coordinates are kept in a
+     * second VBO, next to the vertices in the first, and that VBO is only made once a
+     * renderable has them. Lightmaps are only drawn by Render(), not by recorded commands. */
+    class VBORenderer : public ARenderer
+    {
+
+
+    private:
+
+        static const unsigned int lightmapUnit = 1; // Texture unit lightmaps are bound to
+
+        unsigned int vboID; // ID for the renderer's Vertex Buffer Object (VBO)
+        float* vboData; // Used to store a pointer the VBO's data
+        unsigned int lightmapVboID; // VBO with two floats of lightmap coordinates for every vertex, 0 until it's needed
+        std::vector<float> lightmapCoords; // Filled in by Update() and uploaded to the lightmap VBO
+        bool hasLightmaps; // True if any renderable was lightmapped at the last Update()
+
+        // Used to store every renderable's start and end indices in the VBO
+        std::vector<general::ArrayIndices> arrayIndices;
+        /* Stores the index in arrayIndices of every renderable in the renderables vector
+         * (group renderables take up more than one element), so a range of renderables
+         * can be recorded without going through the ones before it. */
+        std::vector<unsigned int> renderableIndices;
+        // Box around the vertices of every renderable, in its own space, indexed like arrayIndices
+        std::vector<maths::AABB> localBounds;
+
+        /* Everything needed to draw one object with geometry. Render() gathers these before
+         * drawing anything, so objects can be drawn in a different order than they're stored. */
+        struct DrawItem
+        {
+            float matrix[16]; // World matrix, the object's own combined with its parents'
+            bool transformed; // False if neither it nor its parents have a matrix, so 'matrix' is unused
+            SkinHandle skin; // Skin it inherits or has, invalidHandle to use whatever skin is active
+            PrimitiveType type;
+            unsigned int start, amount;
+            IRenderable* renderable; // Identifies the object to the lighting
+            maths::AABB bounds; // World space box, only worked out when the lighting needs it
+            maths::vector3f centre; // World space centre of its vertices, only worked out if it's translucent
+            unsigned int lightmap; // Texture ID of its lightmap, 0 if it doesn't have one
+        };
+        std::vector<DrawItem> opaqueItems, translucentItems;
+        std::vector<float> depths; // View space depth of every translucent item, used for sorting
+        general::FloatRadixSorter depthSorter;
+        bool selectLights; // True if the lighting picks lights for each object this frame
+        unsigned int boundLightmap; // Lightmap bound to lightmapUnit while drawing, 0 if none
+        bool lightingWasEnabled; // If lighting was on before the first lightmapped object turned it off
+
+        RenderDevice* renderDevice; // Used for activating a renderable's skin and texture
+        IRenderBackend* backend; // The render device's backend, used for all the buffer and draw calls
+
+
+        /* Processes one renderable, adding its data to the VBO.
+         * It takes in the current VBO index and the number of vertices already processed. */
+        void ProcessRenderable(IRenderable* renderable, unsigned int& vboIndex, unsigned int& vertexNumber);
+        /* Gathers a draw item for the renderable (if it has geometry) and all of its children,
+         * putting each one in the opaque or translucent items depending on its skin. Takes in
+         * the parent's world matrix and skin. */
+        void GatherObject(IRenderable* renderable, const float* parentMatrix, bool transformed,
+            SkinHandle skin, unsigned int& index);
+        /* Draws a single item by calling glDrawArrays, activating its skin and transforming
+         * it by its matrix. */
+        void DrawObject(const DrawItem& item);
+        /* Binds the lightmap (0 for none) to lightmapUnit, turning lighting off while one is
+         * bound and back on (if it was on) when it's unbound. */
+        void SetLightmap(unsigned int lightmap);
+        /* Same as RenderObject(), but records the commands into a command buffer. */
+        void RecordObject(IRenderable* renderable, CommandBuffer& buffer, unsigned int& index);
+
+
+    public:
+
+        /* The constructor initialises the properties and creates a blank VBO. */
+        VBORenderer(RenderDevice* renderDevice, debug::Logger* log, const bool& willDeleteAll);
+        /* The destructor destroys the VBO and releases any memory stored in vboData.
+         * There is no need to delete every renderable, the superclass' (ARenderer) destructor
+         * does that for us.*/
+        ~VBORenderer();
+
+        /* The update method clears the VBO and refills it with the renderable's values. Also
+         * clears the arrayIndices std::vector and refills it with elements. */
+        void Update();
+        /* The render method gathers every object, then draws the opaque ones followed by the
+         * translucent ones, sorted by depth.
+         * DO NOT add/delete any renderables between the calls to Update() and Render(). */
+        void Render();
+        /* Records the commands for rendering a range of renderables. Can be called from any thread. */
+        void RecordCommands(CommandBuffer& buffer, unsigned int first, unsigned int last);
+
+
+    };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,157 @@
+/*
+ * File:   ClusteredLighting.frag
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 11:30 PM
+ */
+
+/* Fragment shader that lights a ShaderRenderer's objects with the lights ClusteredLighting
+ * uploads. The lighting follows the fixed function model (per light ambient, diffuse and
+ * Blinn-Phong specular, with the same attenuation and spotlight terms), just done for every
+ * pixel. 'lightData' is a buffer of RGBA float texels laid out like this:
+ *
+ *   texel 0    (tiles across, tiles down, depth slices, lighting enabled)
+ *   texel 1    (slice scale, slice bias, tile width in pixels, tile height in pixels)
+ *   texel 2    (amount of global lights, start of lights, start of clusters, start of indices)
+ *   texel 3    global ambient colour
+ *   lights     6 texels each, global lights first:
+ *                (view space position, or direction for directional lights, type)
+ *                (ambient, range)
+ *                (diffuse, spotlight exponent)
+ *                (specular, 0)
+ *                (constant, linear and quadratic attenuation, 0)
+ *                (view space spotlight direction, cosine of spotlight cutoff)
+ *              type is 0 for directional lights, 1 for point lights and 2 for spotlights
+ *              and range is negative if the light never stops reaching anything.
+ *   clusters   (offset, count) into the indices of each cluster, two clusters to a texel
+ *   indices    indices of the clustered lights, four to a texel, index 0 being the first
+ *              light after the global ones
+ *
+ * A pixel's cluster is found from its position on screen and the logarithm of its depth. */
+
+#version 120
+#extension GL_EXT_gpu_shader4 : require
+#extension GL_EXT_texture_array : enable
+
+uniform sampler2D diffuseTexture;
+#ifdef GL_EXT_texture_array
+uniform sampler2DArray diffuseArray;
+#endif
+uniform samplerBuffer lightData;
+
+varying vec2 texCoord;
+varying vec4 diffuseColour;
+varying vec4 emissionColour;
+varying float textured;
+varying float layer;
+
+varying vec3 viewPosition;
+varying vec3 viewNormal;
+varying vec3 ambientColour;
+varying vec3 specularColour;
+varying float shininess;
+
+const int texelsPerLight = 6;
+
+/* Adds the light starting at the given texel to the three sums. */
+void AddLight(int texel, vec3 normal, vec3 eye, inout vec3 ambient, inout vec3 diffuse, inout vec3 specular)
+{
+    vec4 vector = texelFetchBuffer(lightData, texel);
+    vec4 lightAmbient = texelFetchBuffer(lightData, texel + 1);
+    vec4 lightDiffuse = texelFetchBuffer(lightData, texel + 2);
+
+    vec3 toLight;
+    float attenuation = 1.0;
+    if (vector.w < 0.5)
+    {
+        toLight = normalize(vector.xyz);
+    }
+    else
+    {
+        toLight = vector.xyz - viewPosition;
+        float distance = length(toLight);
+        // Past its range the light is too weak to matter, and wasn't binned into clusters there
+        if (lightAmbient.w >= 0.0 && distance > lightAmbient.w) return;
+        toLight /= distance;
+
+        vec4 factors = texelFetchBuffer(lightData, texel + 4);
+        attenuation = 1.0 / (factors.x + (factors.y * distance) + (factors.z * distance * distance));
+
+        if (vector.w > 1.5)
+        {
+            vec4 spot = texelFetchBuffer(lightData, texel + 5);
+            float spotEffect = dot(-toLight, normalize(spot.xyz));
+            if (spotEffect < spot.w) return;
+            attenuation *= pow(spotEffect, lightDiffuse.w);
+        }
+    }
+
+    ambient += lightAmbient.rgb * attenuation;
+    float diffuseFactor = dot(normal, toLight);
+    if (diffuseFactor > 0.0)
+    {
+        diffuse += lightDiffuse.rgb * (diffuseFactor * attenuation);
+        float specularFactor = max(dot(normal, normalize(toLight + eye)), 0.0);
+        specular += texelFetchBuffer(lightData, texel + 3).rgb * (pow(specularFactor, shininess) * attenuation);
+    }
+}
+
+void main()
+{
+    vec4 colour = diffuseColour;
+    if (textured > 1.5)
+    {
+#ifdef GL_EXT_texture_array
+        colour *= texture2DArray(diffuseArray, vec3(texCoord, layer));
+#endif
+    }
+    else if (textured > 0.5)
+    {
+        colour *= texture2D(diffuseTexture, texCoord);
+    }
+
+    vec4 grid = texelFetchBuffer(lightData, 0);
+    if (grid.w < 0.5)
+    {
+        gl_FragColor = vec4(colour.rgb + emissionColour.rgb, colour.a);
+        return;
+    }
+    vec4 slicing = texelFetchBuffer(lightData, 1);
+    vec4 starts = texelFetchBuffer(lightData, 2);
+    int amountOfGlobalLights = int(starts.x + 0.5);
+    int lightsStart = int(starts.y + 0.5);
+
+    vec3 normal = normalize(viewNormal);
+    vec3 eye = normalize(-viewPosition);
+    vec3 ambient = texelFetchBuffer(lightData, 3).rgb;
+    vec3 diffuse = vec3(0.0);
+    vec3 specular = vec3(0.0);
+
+    for (int i = 0; i < amountOfGlobalLights; i++)
+    {
+        AddLight(lightsStart + (i * texelsPerLight), normal, eye, ambient, diffuse, specular);
+    }
+
+    // Find the pixel's cluster, then go through the lights binned into it
+    ivec3 tiles = ivec3(grid.xyz + 0.5);
+    ivec2 tile = clamp(ivec2(gl_FragCoord.xy / slicing.zw), ivec2(0), tiles.xy - 1);
+    int slice = clamp(int(log(max(-viewPosition.z, 1e-6)) * slicing.x + slicing.y), 0, tiles.z - 1);
+    int cluster = tile.x + (tiles.x * (tile.y + (tiles.y * slice)));
+
+    vec4 ranges = texelFetchBuffer(lightData, int(starts.z + 0.5) + (cluster / 2));
+    vec2 range = ((cluster - ((cluster / 2) * 2)) == 0) ? ranges.xy : ranges.zw;
+    int offset = int(range.x + 0.5);
+    int count = int(range.y + 0.5);
+    int indicesStart = int(starts.w + 0.5);
+    int clusteredStart = lightsStart + (amountOfGlobalLights * texelsPerLight);
+
+    for (int i = offset; i < offset + count; i++)
+    {
+        vec4 indices = texelFetchBuffer(lightData, indicesStart + (i / 4));
+        int light = int(indices[i - ((i / 4) * 4)] + 0.5);
+        AddLight(clusteredStart + (light * texelsPerLight), normal, eye, ambient, diffuse, specular);
+    }
+
+    vec3 lit = (ambient * ambientColour) + (diffuse * colour.rgb) + (specular * specularColour);
+    gl_FragColor = vec4(lit + emissionColour.rgb, colour.a);
+}
@@ -0,0 +1,67 @@
+/*
+ * File:   ClusteredLighting.vert
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 11:30 PM
+ */
+
+/* Vertex shader for drawing a ShaderRenderer's objects lit by ClusteredLighting. It reads
+ * 'objectData' exactly like shaders/ShaderRenderer.vert (which describes its layout), and
+ * also passes the view space position and normal and the rest of the material on to the
+ * fragment shader, which does the lighting. Normals are transformed by the world and view
+ * matrices directly, so objects are expected to be scaled the same along every axis. */
+
+#version 120
+#extension GL_EXT_gpu_shader4 : require
+
+uniform samplerBuffer objectData;
+
+attribute float objectIndex;
+
+varying vec2 texCoord;
+varying vec4 diffuseColour;
+varying vec4 emissionColour;
+varying float textured;
+varying float layer;
+
+varying vec3 viewPosition;
+varying vec3 viewNormal;
+varying vec3 ambientColour;
+varying vec3 specularColour;
+varying float shininess;
+
+mat4 FetchMatrix(int texel)
+{
+    return mat4(texelFetchBuffer(objectData, texel),
+        texelFetchBuffer(objectData, texel + 1),
+        texelFetchBuffer(objectData, texel + 2),
+        texelFetchBuffer(objectData, texel + 3));
+}
+
+void main()
+{
+    vec4 header = texelFetchBuffer(objectData, 0);
+    int object = int(header.y) + (int(objectIndex + 0.5) * 5);
+
+    mat4 view = FetchMatrix(1);
+    mat4 projection = FetchMatrix(5);
+    mat4 world = FetchMatrix(object);
+    vec4 properties = texelFetchBuffer(objectData, object + 4);
+
+    int material = int(header.x) + (int(properties.x + 0.5) * 5);
+    ambientColour = texelFetchBuffer(objectData, material).rgb;
+    diffuseColour = texelFetchBuffer(objectData, material + 1) * gl_Color;
+    specularColour = texelFetchBuffer(objectData, material + 2).rgb;
+    emissionColour = texelFetchBuffer(objectData, material + 3);
+    shininess = texelFetchBuffer(objectData, material + 4).x;
+    textured = properties.y;
+    layer = properties.z;
+
+    mat4 worldView = view * world;
+    vec4 position = worldView * vec4(gl_Vertex.xyz, 1.0);
+    viewPosition = position.xyz;
+    viewNormal = mat3(worldView) * gl_Normal;
+
+    texCoord = gl_MultiTexCoord0.xy;
+    gl_Position = projection * position;
+}
@@ -0,0 +1,41 @@
+/*
+ * File:   ShaderRenderer.frag
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 8:30 PM
+ */
+
+/* Fragment shader used by ShaderRenderer. The object data is read by the vertex shader,
+ * this just combines the material's colours with the diffuse texture. Array textures are
+ * only used when the driver supports them, otherwise ShaderRenderer never asks for them. */
+
+#version 120
+#extension GL_EXT_texture_array : enable
+
+uniform sampler2D diffuseTexture;
+#ifdef GL_EXT_texture_array
+uniform sampler2DArray diffuseArray;
+#endif
+
+varying vec2 texCoord;
+varying vec4 diffuseColour;
+varying vec4 emissionColour;
+varying float textured;
+varying float layer;
+
+void main()
+{
+    vec4 colour = diffuseColour;
+    if (textured > 1.5)
+    {
+#ifdef GL_EXT_texture_array
+        colour *= texture2DArray(diffuseArray, vec3(texCoord, layer));
+#endif
+    }
+    else if (textured > 0.5)
+    {
+        colour *= texture2D(diffuseTexture, texCoord);
+    }
+
+    gl_FragColor = vec4(colour.rgb + emissionColour.rgb, colour.a);
+}
@@ -0,0 +1,59 @@
+/*
+ * File:   ShaderRenderer.vert
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 8:30 PM
+ */
+
+/* Vertex shader used by ShaderRenderer. Everything about the object a vertex belongs to
+ * is read from 'objectData', which is a buffer of RGBA float texels laid out like this:
+ *
+ *   texel 0       (start of materials, start of objects, 0, 0)
+ *   texels 1-4    view matrix columns
+ *   texels 5-8    projection matrix columns
+ *   objects       5 texels each: world matrix columns, then (material slot, textured, layer, 0)
+ *   materials     5 texels each: ambient, diffuse, specular, emission, (shininess, 0, 0, 0)
+ *
+ * Material slot 0 is always the default material. 'textured' is 0 for untextured objects,
+ * 1 for objects using diffuseTexture and 2 for objects using 'layer' of diffuseArray. */
+
+#version 120
+#extension GL_EXT_gpu_shader4 : require
+
+uniform samplerBuffer objectData;
+
+attribute float objectIndex;
+
+varying vec2 texCoord;
+varying vec4 diffuseColour;
+varying vec4 emissionColour;
+varying float textured;
+varying float layer;
+
+mat4 FetchMatrix(int texel)
+{
+    return mat4(texelFetchBuffer(objectData, texel),
+        texelFetchBuffer(objectData, texel + 1),
+        texelFetchBuffer(objectData, texel + 2),
+        texelFetchBuffer(objectData, texel + 3));
+}
+
+void main()
+{
+    vec4 header = texelFetchBuffer(objectData, 0);
+    int object = int(header.y) + (int(objectIndex + 0.5) * 5);
+
+    mat4 view = FetchMatrix(1);
+    mat4 projection = FetchMatrix(5);
+    mat4 world = FetchMatrix(object);
+    vec4 properties = texelFetchBuffer(objectData, object + 4);
+
+    int material = int(header.x) + (int(properties.x + 0.5) * 5);
+    diffuseColour = texelFetchBuffer(objectData, material + 1) * gl_Color;
+    emissionColour = texelFetchBuffer(objectData, material + 3);
+    textured = properties.y;
+    layer = properties.z;
+
+    texCoord = gl_MultiTexCoord0.xy;
+    gl_Position = projection * view * world * vec4(gl_Vertex.xyz, 1.0);
+}
@@ -0,0 +1,53 @@
+/*
+ * File:   ShadowMaps.frag
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:50 AM
+ */
+
+/* Functions for reading the shadow maps drawn by ShadowMaps. This has no main(); it's
+ * compiled as a second fragment shader and attached to a program next to the one that uses
+ * it, which declares the functions it calls:
+ *
+ *   float CascadeShadow(vec3 viewPosition);
+ *   float SampleShadow(sampler2DShadow shadowMap, vec4 shadowPosition);
+ *
+ * Both return 1.0 where a pixel is lit and 0.0 where it's in shadow, with the edges of shadows
+ * softened by the hardware's comparison filtering. ShadowMaps::SetUniforms() sets every uniform
+ * here. Spotlights' maps are read with SampleShadow(), with the position multiplied by the matrix
+ * from ShadowMaps::GetSpotlightMatrix() (times the inverse of the camera's view matrix, for a
+ * view space position). */
+
+#version 120
+
+uniform sampler2DShadow shadowCascade0;
+uniform sampler2DShadow shadowCascade1;
+uniform sampler2DShadow shadowCascade2;
+uniform sampler2DShadow shadowCascade3;
+uniform mat4 shadowMatrices[4]; // Take view space positions into each cascade's map
+uniform vec4 shadowCascadeEnds; // Distance from the camera each cascade ends at
+uniform int amountOfShadowCascades; // 0 if the sun casts no shadows
+
+/* Compares a position already multiplied by a shadow matrix with the map. */
+float SampleShadow(sampler2DShadow shadowMap, vec4 shadowPosition)
+{
+    return shadow2DProj(shadowMap, shadowPosition).r;
+}
+
+/* Shadow of the sun on a view space position, from whichever cascade it's in. Positions past
+ * the last cascade aren't shadowed. */
+float CascadeShadow(vec3 viewPosition)
+{
+    float distance = -viewPosition.z;
+    vec4 position = vec4(viewPosition, 1.0);
+
+    if (amountOfShadowCascades > 0 && distance <= shadowCascadeEnds.x)
+        return SampleShadow(shadowCascade0, shadowMatrices[0] * position);
+    if (amountOfShadowCascades > 1 && distance <= shadowCascadeEnds.y)
+        return SampleShadow(shadowCascade1, shadowMatrices[1] * position);
+    if (amountOfShadowCascades > 2 && distance <= shadowCascadeEnds.z)
+        return SampleShadow(shadowCascade2, shadowMatrices[2] * position);
+    if (amountOfShadowCascades > 3 && distance <= shadowCascadeEnds.w)
+        return SampleShadow(shadowCascade3, shadowMatrices[3] * position);
+    return 1.0;
+}
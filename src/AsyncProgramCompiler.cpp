@@ -0,0 +1,205 @@
+/*
+ * File:   AsyncProgramCompiler.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 2:30 AM
+ */
+
+#include "AsyncProgramCompiler.h"
+#include "GLExtensions.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    AsyncProgramCompiler::AsyncProgramCompiler(ProgramCache* programCache, bool allowWorker)
+        : mode(COMPILEMODE_BLOCKING), cache(programCache), workerThread(NULL), workEvent(NULL),
+        deviceContext(NULL), workerContext(NULL), quit(0)
+    {
+        InitializeCriticalSection(&queueLock);
+
+        // Looks the extensions up here, so the worker never does it at the same time as this thread
+        const GLExtensions& extensions = GetGLExtensions();
+        if (extensions.parallelShaderCompile)
+        {
+            // Lets the driver use as many threads as it wants
+            extensions.maxShaderCompilerThreads(0xFFFFFFFF);
+            mode = COMPILEMODE_PARALLEL;
+        }
+        else if (allowWorker && StartWorker())
+        {
+            mode = COMPILEMODE_WORKER;
+        }
+    }
+
+    AsyncProgramCompiler::~AsyncProgramCompiler()
+    {
+        if (workerThread)
+        {
+            InterlockedExchange(&quit, 1);
+            SetEvent(workEvent);
+            WaitForSingleObject(workerThread, INFINITE);
+            CloseHandle(workerThread);
+            CloseHandle(workEvent);
+            wglDeleteContext(workerContext);
+        }
+        DeleteCriticalSection(&queueLock);
+
+        for (unsigned int i = 0; (i < requests.size()); i++) delete requests[i];
+    }
+
+
+    bool AsyncProgramCompiler::StartWorker()
+    {
+        // The worker's context has to share objects with the current one, so programs it links can be used here
+        HGLRC renderContext = wglGetCurrentContext();
+        deviceContext = wglGetCurrentDC();
+        if (!renderContext || !deviceContext) return false;
+
+        workerContext = wglCreateContext(deviceContext);
+        if (!workerContext) return false;
+        if (!wglShareLists(renderContext, workerContext))
+        {
+            wglDeleteContext(workerContext);
+            workerContext = NULL;
+            return false;
+        }
+
+        workEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+        workerThread = CreateThread(NULL, 0, WorkerMain, this, 0, NULL);
+        if (!workerThread)
+        {
+            CloseHandle(workEvent);
+            wglDeleteContext(workerContext);
+            workEvent = NULL;
+            workerContext = NULL;
+            return false;
+        }
+        return true;
+    }
+
+    DWORD WINAPI AsyncProgramCompiler::WorkerMain(void* parameter)
+    {
+        AsyncProgramCompiler* compiler = static_cast<AsyncProgramCompiler*>(parameter);
+        wglMakeCurrent(compiler->deviceContext, compiler->workerContext);
+
+        while (true)
+        {
+            WaitForSingleObject(compiler->workEvent, INFINITE);
+            if (compiler->quit) break;
+
+            // Links every request in the queue, one at a time
+            while (!compiler->quit)
+            {
+                EnterCriticalSection(&compiler->queueLock);
+                Request* request = NULL;
+                if (!compiler->queue.empty())
+                {
+                    request = compiler->queue.front();
+                    compiler->queue.pop_front();
+                }
+                LeaveCriticalSection(&compiler->queueLock);
+                if (!request) break;
+
+                bool linked = request->program->Link(compiler->cache);
+                // The render thread can only use the program once the driver's finished with it here
+                glFinish();
+                InterlockedExchange(&request->state, (linked) ? COMPILESTATE_READY : COMPILESTATE_FAILED);
+            }
+        }
+
+        wglMakeCurrent(NULL, NULL);
+        return 0;
+    }
+
+
+    CompileHandle AsyncProgramCompiler::Compile(Program* program, Program* fallback)
+    {
+        if (!program) throw debug::NullPointerException("AsyncProgramCompiler::Compile - Cannot compile a NULL program!");
+
+        Request* request = new Request();
+        request->program = program;
+        request->fallback = fallback;
+        request->state = COMPILESTATE_PENDING;
+        requests.push_back(request);
+
+        switch (mode)
+        {
+            case COMPILEMODE_PARALLEL:
+                // Programs the cache has are linked straight away
+                program->StartLink(cache);
+                if (program->IsLinked()) request->state = COMPILESTATE_READY;
+                else linking.push_back(request);
+                break;
+
+            case COMPILEMODE_WORKER:
+                EnterCriticalSection(&queueLock);
+                queue.push_back(request);
+                LeaveCriticalSection(&queueLock);
+                SetEvent(workEvent);
+                break;
+
+            default:
+                request->state = (program->Link(cache)) ? COMPILESTATE_READY : COMPILESTATE_FAILED;
+                break;
+        }
+
+        return requests.size();
+    }
+
+    void AsyncProgramCompiler::Update()
+    {
+        // Only programs the driver says are done are finished, so this never waits
+        unsigned int remaining = 0;
+        for (unsigned int i = 0; (i < linking.size()); i++)
+        {
+            Request* request = linking[i];
+            if (request->program->IsLinkComplete())
+            {
+                request->state = (request->program->FinishLink()) ? COMPILESTATE_READY : COMPILESTATE_FAILED;
+            }
+            else
+            {
+                linking[remaining++] = request;
+            }
+        }
+        linking.resize(remaining);
+    }
+
+
+    const AsyncProgramCompiler::Request* AsyncProgramCompiler::GetRequest(CompileHandle handle) const
+    {
+        if (handle == 0 || handle > requests.size())
+        {
+            throw debug::InvalidArgumentException("AsyncProgramCompiler - Compile handle is invalid!");
+        }
+        return requests[handle - 1];
+    }
+
+    CompileState AsyncProgramCompiler::GetState(CompileHandle handle) const
+    {
+        return static_cast<CompileState>(GetRequest(handle)->state);
+    }
+
+    Program* AsyncProgramCompiler::GetProgram(CompileHandle handle) const
+    {
+        const Request* request = GetRequest(handle);
+        return (request->state == COMPILESTATE_READY) ? request->program : request->fallback;
+    }
+
+    unsigned int AsyncProgramCompiler::GetAmountPending() const
+    {
+        unsigned int pending = 0;
+        for (unsigned int i = 0; (i < requests.size()); i++)
+        {
+            if (requests[i]->state == COMPILESTATE_PENDING) ++pending;
+        }
+        return pending;
+    }
+
+}
+
+}
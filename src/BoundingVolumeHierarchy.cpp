@@ -0,0 +1,756 @@
+/*
+ * File:   BoundingVolumeHierarchy.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 10:50 PM
+ * Added GetTotalBounds() on October 19, 2026, 5:05 AM
+ */
+
+#include <algorithm>
+#include <queue>
+#include <functional>
+#include "BoundingVolumeHierarchy.h"
+#include "Exceptions.h"
+#include "Util.h"
+
+namespace parcel
+{
+
+using namespace maths;
+
+namespace graphics
+{
+
+    namespace
+    {
+
+        // Orders build items along one axis of their box centres
+        struct CentreLess
+        {
+            unsigned int axis;
+            explicit CentreLess(unsigned int centreAxis) : axis(centreAxis) {}
+
+            template<typename T>
+            bool operator()(const T& a, const T& b) const
+            {
+                return a.centre.values[axis] < b.centre.values[axis];
+            }
+        };
+
+        // Says if a build item's centre falls in a bin at or before the split
+        struct InLeftBins
+        {
+            unsigned int axis, split;
+            float minimum, binsPerUnit;
+
+            template<typename T>
+            bool operator()(const T& item) const
+            {
+                return GetBin(item.centre.values[axis]) <= split;
+            }
+
+            unsigned int GetBin(float value) const
+            {
+                int bin = static_cast<int>((value - minimum) * binsPerUnit);
+                if (bin < 0) return 0;
+                return static_cast<unsigned int>(bin);
+            }
+        };
+
+    }
+
+
+    BoundingVolumeHierarchy::BoundingVolumeHierarchy() :
+        root(nullNode), freeNodes(nullNode), amountOfObjects(0), layoutChanged(false), boundsChanged(false)
+    {
+    }
+
+
+    int BoundingVolumeHierarchy::AllocateNode()
+    {
+        int node;
+        if (freeNodes != nullNode)
+        {
+            node = freeNodes;
+            freeNodes = nodes[node].parent;
+        }
+        else
+        {
+            node = static_cast<int>(nodes.size());
+            nodes.push_back(Node());
+        }
+
+        nodes[node].bounds = AABB();
+        nodes[node].parent = nodes[node].left = nodes[node].right = nullNode;
+        nodes[node].object = NULL;
+        nodes[node].boundsFromRenderable = false;
+        return node;
+    }
+
+    void BoundingVolumeHierarchy::FreeNode(int node)
+    {
+        // Clearing the object marks it as not being a leaf, so its proxy stops being valid
+        nodes[node].object = NULL;
+        nodes[node].left = nodes[node].right = nullNode;
+        nodes[node].parent = freeNodes;
+        freeNodes = node;
+    }
+
+
+    BoundingVolumeHierarchy::ProxyID BoundingVolumeHierarchy::Insert(IRenderable* object, const AABB& bounds)
+    {
+        if (!object)
+        {
+            throw debug::NullPointerException("BoundingVolumeHierarchy::Insert - Object cannot be NULL.");
+        }
+        if (bounds.IsEmpty())
+        {
+            throw debug::InvalidArgumentException("BoundingVolumeHierarchy::Insert - Bounds cannot be empty.");
+        }
+
+        // Boxes have to be up to date for the best place for the leaf to be found
+        if (boundsChanged) Flatten();
+
+        int leaf = AllocateNode();
+        nodes[leaf].bounds = bounds;
+        nodes[leaf].object = object;
+        InsertLeaf(leaf);
+
+        amountOfObjects++;
+        layoutChanged = true;
+        return static_cast<ProxyID>(leaf);
+    }
+
+    BoundingVolumeHierarchy::ProxyID BoundingVolumeHierarchy::InsertRenderable(IRenderable* renderable)
+    {
+        if (!renderable)
+        {
+            throw debug::NullPointerException("BoundingVolumeHierarchy::InsertRenderable - Renderable cannot be NULL.");
+        }
+
+        AABB bounds;
+        if (!ComputeWorldBounds(renderable, bounds))
+        {
+            throw debug::InvalidArgumentException(
+                "BoundingVolumeHierarchy::InsertRenderable - Renderable has no vertices to bound.");
+        }
+
+        ProxyID proxy = Insert(renderable, bounds);
+        nodes[proxy].boundsFromRenderable = true;
+        return proxy;
+    }
+
+    void BoundingVolumeHierarchy::Remove(ProxyID proxy)
+    {
+        CheckProxy(proxy, "BoundingVolumeHierarchy::Remove - ");
+
+        RemoveLeaf(static_cast<int>(proxy));
+        FreeNode(static_cast<int>(proxy));
+
+        amountOfObjects--;
+        layoutChanged = true;
+    }
+
+    void BoundingVolumeHierarchy::Clear()
+    {
+        nodes.clear();
+        flatNodes.clear();
+        root = freeNodes = nullNode;
+        amountOfObjects = 0;
+        layoutChanged = boundsChanged = false;
+    }
+
+
+    void BoundingVolumeHierarchy::InsertLeaf(int leaf)
+    {
+        if (root == nullNode)
+        {
+            root = leaf;
+            nodes[leaf].parent = nullNode;
+            return;
+        }
+
+        /* Goes down the tree, at each node choosing between making the leaf its sibling or
+         * going down into one of its children, whichever adds the least surface area.
+         * Every node above wherever the leaf ends up grows too, so that's added to the cost
+         * of going further down (the "inherited" cost). */
+        const AABB& leafBounds = nodes[leaf].bounds;
+        int sibling = root;
+        while (nodes[sibling].left != nullNode)
+        {
+            const Node& node = nodes[sibling];
+            float area = node.bounds.GetSurfaceArea();
+            float combinedArea = AABB::Union(node.bounds, leafBounds).GetSurfaceArea();
+
+            float cost = 2.0f * combinedArea; // Making a new parent for this node and the leaf
+            float inheritedCost = 2.0f * (combinedArea - area);
+
+            float childCosts[2];
+            int children[2] = { node.left, node.right };
+            for (unsigned int i = 0; (i < 2); i++)
+            {
+                const Node& child = nodes[children[i]];
+                float childCombined = AABB::Union(child.bounds, leafBounds).GetSurfaceArea();
+                // Going into a leaf means pairing with it, going into a node only grows it
+                if (child.left == nullNode) childCosts[i] = childCombined + inheritedCost;
+                else childCosts[i] = (childCombined - child.bounds.GetSurfaceArea()) + inheritedCost;
+            }
+
+            if (cost < childCosts[0] && cost < childCosts[1]) break;
+            sibling = (childCosts[0] <= childCosts[1]) ? children[0] : children[1];
+        }
+
+        // Replaces the sibling with a new node holding it and the leaf
+        int oldParent = nodes[sibling].parent;
+        int newParent = AllocateNode();
+        nodes[newParent].parent = oldParent;
+        nodes[newParent].left = sibling;
+        nodes[newParent].right = leaf;
+        nodes[sibling].parent = newParent;
+        nodes[leaf].parent = newParent;
+
+        if (oldParent == nullNode)
+        {
+            root = newParent;
+        }
+        else
+        {
+            if (nodes[oldParent].left == sibling) nodes[oldParent].left = newParent;
+            else nodes[oldParent].right = newParent;
+        }
+
+        RefitAncestors(newParent);
+    }
+
+    void BoundingVolumeHierarchy::RemoveLeaf(int leaf)
+    {
+        if (leaf == root)
+        {
+            root = nullNode;
+            return;
+        }
+
+        // The leaf's sibling takes its parent's place
+        int parent = nodes[leaf].parent;
+        int grandparent = nodes[parent].parent;
+        int sibling = (nodes[parent].left == leaf) ? nodes[parent].right : nodes[parent].left;
+
+        if (grandparent == nullNode)
+        {
+            root = sibling;
+            nodes[sibling].parent = nullNode;
+        }
+        else
+        {
+            if (nodes[grandparent].left == parent) nodes[grandparent].left = sibling;
+            else nodes[grandparent].right = sibling;
+            nodes[sibling].parent = grandparent;
+            RefitAncestors(grandparent);
+        }
+
+        FreeNode(parent);
+        nodes[leaf].parent = nullNode;
+    }
+
+    void BoundingVolumeHierarchy::RefitAncestors(int node)
+    {
+        while (node != nullNode)
+        {
+            nodes[node].bounds = AABB::Union(nodes[nodes[node].left].bounds, nodes[nodes[node].right].bounds);
+            node = nodes[node].parent;
+        }
+    }
+
+
+    void BoundingVolumeHierarchy::Update(ProxyID proxy, const AABB& bounds)
+    {
+        CheckProxy(proxy, "BoundingVolumeHierarchy::Update - ");
+        if (bounds.IsEmpty())
+        {
+            throw debug::InvalidArgumentException("BoundingVolumeHierarchy::Update - Bounds cannot be empty.");
+        }
+
+        nodes[proxy].bounds = bounds;
+        boundsChanged = true;
+    }
+
+    void BoundingVolumeHierarchy::UpdateRenderables()
+    {
+        for (unsigned int i = 0; (i < nodes.size()); i++)
+        {
+            if (nodes[i].object && nodes[i].boundsFromRenderable)
+            {
+                // A renderable that has lost all its vertices keeps its old box
+                AABB bounds;
+                if (ComputeWorldBounds(nodes[i].object, bounds)) nodes[i].bounds = bounds;
+            }
+        }
+        boundsChanged = true;
+    }
+
+    void BoundingVolumeHierarchy::Refit()
+    {
+        Flatten();
+    }
+
+
+    void BoundingVolumeHierarchy::Rebuild()
+    {
+        if (root == nullNode) return;
+
+        // Gathers the leaves and frees every other node
+        buildItems.clear();
+        for (unsigned int i = 0; (i < nodes.size()); i++)
+        {
+            if (nodes[i].object)
+            {
+                BuildItem item;
+                item.leaf = static_cast<int>(i);
+                item.centre = nodes[i].bounds.GetCentre();
+                buildItems.push_back(item);
+            }
+        }
+        freeNodes = nullNode;
+        for (int i = static_cast<int>(nodes.size()) - 1; (i >= 0); i--)
+        {
+            if (!nodes[i].object) FreeNode(i);
+        }
+
+        root = BuildRange(0, buildItems.size());
+        nodes[root].parent = nullNode;
+        layoutChanged = true;
+    }
+
+    int BoundingVolumeHierarchy::BuildRange(unsigned int first, unsigned int last)
+    {
+        unsigned int count = last - first;
+        if (count == 1) return buildItems[first].leaf;
+
+        // Splits along the axis the centres are most spread out on
+        AABB centreBounds;
+        for (unsigned int i = first; (i < last); i++) centreBounds.Expand(buildItems[i].centre);
+        unsigned int axis = 0;
+        float extent = centreBounds.maximum.x - centreBounds.minimum.x;
+        for (unsigned int i = 1; (i < 3); i++)
+        {
+            float axisExtent = centreBounds.maximum.values[i] - centreBounds.minimum.values[i];
+            if (axisExtent > extent) { extent = axisExtent; axis = i; }
+        }
+
+        unsigned int middle = first;
+        if (extent > 0.0f)
+        {
+            /* Puts the objects into bins along the axis, then tries splitting between each
+             * pair of bins. The cost of a split is the area of each side's box times how many
+             * objects are in it, since that's how likely and how expensive it is to search. */
+            InLeftBins binning;
+            binning.axis = axis;
+            binning.minimum = centreBounds.minimum.values[axis];
+            // Slightly under amountOfBins, so the largest centre still lands in the last bin
+            binning.binsPerUnit = (static_cast<float>(amountOfBins) * 0.9999f) / extent;
+
+            AABB binBounds[amountOfBins];
+            unsigned int binCounts[amountOfBins] = { 0 };
+            for (unsigned int i = first; (i < last); i++)
+            {
+                unsigned int bin = binning.GetBin(buildItems[i].centre.values[axis]);
+                if (bin >= amountOfBins) bin = amountOfBins - 1;
+                binCounts[bin]++;
+                binBounds[bin].Expand(nodes[buildItems[i].leaf].bounds);
+            }
+
+            // Areas and counts of everything to the right of each split
+            float rightAreas[amountOfBins];
+            unsigned int rightCounts[amountOfBins];
+            AABB right;
+            unsigned int rightCount = 0;
+            for (unsigned int i = amountOfBins - 1; (i > 0); i--)
+            {
+                right.Expand(binBounds[i]);
+                rightCount += binCounts[i];
+                rightAreas[i - 1] = right.GetSurfaceArea();
+                rightCounts[i - 1] = rightCount;
+            }
+
+            float bestCost = 0.0f;
+            unsigned int bestSplit = amountOfBins;
+            AABB left;
+            unsigned int leftCount = 0;
+            for (unsigned int i = 0; (i < amountOfBins - 1); i++)
+            {
+                left.Expand(binBounds[i]);
+                leftCount += binCounts[i];
+                if (leftCount == 0 || rightCounts[i] == 0) continue;
+
+                float cost = (left.GetSurfaceArea() * leftCount) + (rightAreas[i] * rightCounts[i]);
+                if (bestSplit == amountOfBins || cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestSplit = i;
+                }
+            }
+
+            if (bestSplit != amountOfBins)
+            {
+                binning.split = bestSplit;
+                middle = static_cast<unsigned int>(std::partition(buildItems.begin() + first,
+                    buildItems.begin() + last, binning) - buildItems.begin());
+            }
+        }
+
+        // If every centre is in the same place (or bin), the objects are just split in half
+        if (middle == first || middle == last)
+        {
+            middle = first + (count / 2);
+            std::nth_element(buildItems.begin() + first, buildItems.begin() + middle,
+                buildItems.begin() + last, CentreLess(axis));
+        }
+
+        int node = AllocateNode();
+        int leftChild = BuildRange(first, middle);
+        int rightChild = BuildRange(middle, last);
+        nodes[node].left = leftChild;
+        nodes[node].right = rightChild;
+        nodes[leftChild].parent = node;
+        nodes[rightChild].parent = node;
+        nodes[node].bounds = AABB::Union(nodes[leftChild].bounds, nodes[rightChild].bounds);
+        return node;
+    }
+
+
+    void BoundingVolumeHierarchy::Flatten()
+    {
+        flatNodes.clear();
+        layoutChanged = boundsChanged = false;
+        if (root == nullNode) return;
+
+        /* Goes through the tree depth first, left child first, so each node's first child
+         * ends up right after it. The right child's index isn't known until the whole left
+         * side has been added, so it's filled in when the right child is reached; nodes on
+         * the stack are paired with the index of their parent in flatNodes. */
+        flatNodes.reserve(amountOfObjects * 2);
+        nodeStack.clear();
+        nodeStack.push_back(root);
+        nodeStack.push_back(-1);
+        while (!nodeStack.empty())
+        {
+            int flatParent = nodeStack.back(); nodeStack.pop_back();
+            int node = nodeStack.back(); nodeStack.pop_back();
+
+            unsigned int index = flatNodes.size();
+            if (flatParent >= 0 && static_cast<unsigned int>(flatParent) + 1 != index)
+            {
+                flatNodes[flatParent].rightChild = index;
+            }
+
+            FlatNode flat;
+            flat.bounds = nodes[node].bounds;
+            flat.rightChild = 0;
+            flat.skip = 0;
+            flat.object = nodes[node].object;
+            flat.proxy = static_cast<ProxyID>(node);
+            flatNodes.push_back(flat);
+
+            if (nodes[node].left != nullNode)
+            {
+                nodeStack.push_back(nodes[node].right);
+                nodeStack.push_back(static_cast<int>(index));
+                nodeStack.push_back(nodes[node].left);
+                nodeStack.push_back(static_cast<int>(index));
+            }
+        }
+
+        /* Children come after their parents, so going backwards every node's children are
+         * done before it is. This works out each node's box and where its children end. */
+        for (unsigned int i = flatNodes.size(); (i > 0); i--)
+        {
+            FlatNode& flat = flatNodes[i - 1];
+            if (flat.object)
+            {
+                flat.skip = i;
+            }
+            else
+            {
+                const FlatNode& right = flatNodes[flat.rightChild];
+                flat.bounds = AABB::Union(flatNodes[i].bounds, right.bounds);
+                flat.skip = right.skip;
+                nodes[flat.proxy].bounds = flat.bounds;
+            }
+        }
+    }
+
+
+    void BoundingVolumeHierarchy::QueryFrustum(const Frustum& frustum, std::vector<IRenderable*>& results)
+    {
+        results.clear();
+        PrepareForQuery();
+
+        unsigned int i = 0;
+        while (i < flatNodes.size())
+        {
+            const FlatNode& node = flatNodes[i];
+            Containment containment = frustum.Classify(node.bounds);
+
+            if (containment == CONTAINMENT_OUTSIDE)
+            {
+                i = node.skip;
+            }
+            else if (containment == CONTAINMENT_INSIDE)
+            {
+                // Everything under a node that's completely inside is too, so none of it needs testing
+                for (unsigned int j = i; (j < node.skip); j++)
+                {
+                    if (flatNodes[j].object) results.push_back(flatNodes[j].object);
+                }
+                i = node.skip;
+            }
+            else
+            {
+                if (node.object) results.push_back(node.object);
+                i++;
+            }
+        }
+    }
+
+    void BoundingVolumeHierarchy::QueryAABB(const AABB& bounds, std::vector<IRenderable*>& results)
+    {
+        results.clear();
+        PrepareForQuery();
+
+        unsigned int i = 0;
+        while (i < flatNodes.size())
+        {
+            const FlatNode& node = flatNodes[i];
+            if (node.bounds.Overlaps(bounds))
+            {
+                if (node.object) results.push_back(node.object);
+                i++;
+            }
+            else
+            {
+                i = node.skip;
+            }
+        }
+    }
+
+    void BoundingVolumeHierarchy::QuerySphere(const vector3f& centre, float radius,
+        std::vector<IRenderable*>& results)
+    {
+        results.clear();
+        PrepareForQuery();
+
+        float sqrRadius = radius * radius;
+        unsigned int i = 0;
+        while (i < flatNodes.size())
+        {
+            const FlatNode& node = flatNodes[i];
+            if (node.bounds.GetSqrDistanceTo(centre) <= sqrRadius)
+            {
+                if (node.object) results.push_back(node.object);
+                i++;
+            }
+            else
+            {
+                i = node.skip;
+            }
+        }
+    }
+
+    void BoundingVolumeHierarchy::QueryNearest(const vector3f& point, unsigned int amount,
+        std::vector<IRenderable*>& results)
+    {
+        results.clear();
+        PrepareForQuery();
+        if (flatNodes.empty() || amount == 0) return;
+
+        /* Always looks at whichever node found so far is closest. A node's box is never further
+         * away than anything inside it, so when a leaf comes out first, nothing left can be
+         * closer than it. */
+        typedef std::pair<float, unsigned int> QueueEntry;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry> > queue;
+        queue.push(QueueEntry(flatNodes[0].bounds.GetSqrDistanceTo(point), 0));
+
+        while (!queue.empty())
+        {
+            unsigned int index = queue.top().second;
+            queue.pop();
+
+            const FlatNode& node = flatNodes[index];
+            if (node.object)
+            {
+                results.push_back(node.object);
+                if (results.size() == amount) return;
+            }
+            else
+            {
+                queue.push(QueueEntry(flatNodes[index + 1].bounds.GetSqrDistanceTo(point), index + 1));
+                queue.push(QueueEntry(flatNodes[node.rightChild].bounds.GetSqrDistanceTo(point), node.rightChild));
+            }
+        }
+    }
+
+    bool BoundingVolumeHierarchy::RayCast(const Ray& ray, float maxDistance, RayHit& hit)
+    {
+        PrepareForQuery();
+        if (flatNodes.empty()) return false;
+
+        vector3f inverseDirection(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+        float closest = maxDistance;
+        bool found = false;
+
+        float distance;
+        if (!ray.Intersects(flatNodes[0].bounds, inverseDirection, closest, distance)) return false;
+
+        /* Each node on the stack is stored with the distance the ray enters it at, so nodes
+         * further away than the closest hit found since it was pushed can be skipped. The
+         * nearer child is pushed last so it's looked at first, which finds close hits sooner. */
+        std::vector<std::pair<unsigned int, float> > stack;
+        stack.push_back(std::make_pair(0u, distance));
+        while (!stack.empty())
+        {
+            unsigned int index = stack.back().first;
+            float entry = stack.back().second;
+            stack.pop_back();
+            if (entry > closest) continue;
+
+            const FlatNode& node = flatNodes[index];
+            if (node.object)
+            {
+                closest = entry;
+                hit.object = node.object;
+                hit.proxy = node.proxy;
+                hit.distance = entry;
+                found = true;
+                continue;
+            }
+
+            float leftDistance, rightDistance;
+            bool hitLeft = ray.Intersects(flatNodes[index + 1].bounds, inverseDirection, closest, leftDistance);
+            bool hitRight = ray.Intersects(flatNodes[node.rightChild].bounds, inverseDirection, closest, rightDistance);
+
+            if (hitLeft && hitRight)
+            {
+                if (leftDistance <= rightDistance)
+                {
+                    stack.push_back(std::make_pair(node.rightChild, rightDistance));
+                    stack.push_back(std::make_pair(index + 1, leftDistance));
+                }
+                else
+                {
+                    stack.push_back(std::make_pair(index + 1, leftDistance));
+                    stack.push_back(std::make_pair(node.rightChild, rightDistance));
+                }
+            }
+            else if (hitLeft)
+            {
+                stack.push_back(std::make_pair(index + 1, leftDistance));
+            }
+            else if (hitRight)
+            {
+                stack.push_back(std::make_pair(node.rightChild, rightDistance));
+            }
+        }
+
+        return found;
+    }
+
+
+    void BoundingVolumeHierarchy::CheckProxy(ProxyID proxy, const char* method) const
+    {
+        if (proxy >= nodes.size() || !nodes[proxy].object)
+        {
+            throw debug::InvalidArgumentException(std::string(method) + "Proxy is not in the hierarchy.");
+        }
+    }
+
+    IRenderable* BoundingVolumeHierarchy::GetObject(ProxyID proxy) const
+    {
+        CheckProxy(proxy, "BoundingVolumeHierarchy::GetObject - ");
+        return nodes[proxy].object;
+    }
+
+    const AABB& BoundingVolumeHierarchy::GetBounds(ProxyID proxy) const
+    {
+        CheckProxy(proxy, "BoundingVolumeHierarchy::GetBounds - ");
+        return nodes[proxy].bounds;
+    }
+
+    AABB BoundingVolumeHierarchy::GetTotalBounds()
+    {
+        PrepareForQuery();
+        return flatNodes.empty() ? AABB() : flatNodes[0].bounds;
+    }
+
+    float BoundingVolumeHierarchy::GetCost()
+    {
+        PrepareForQuery();
+        if (flatNodes.empty()) return 0.0f;
+
+        float rootArea = flatNodes[0].bounds.GetSurfaceArea();
+        if (rootArea <= 0.0f) return 0.0f;
+
+        float total = 0.0f;
+        for (unsigned int i = 1; (i < flatNodes.size()); i++) total += flatNodes[i].bounds.GetSurfaceArea();
+        return total / rootArea;
+    }
+
+
+    bool BoundingVolumeHierarchy::ComputeWorldBounds(IRenderable* renderable, AABB& bounds)
+    {
+        static const float identity[16] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+
+        bounds = AABB();
+        AddRenderableBounds(renderable, identity, bounds);
+        return !bounds.IsEmpty();
+    }
+
+    void BoundingVolumeHierarchy::AddRenderableBounds(IRenderable* renderable, const float* parentMatrix,
+        AABB& bounds)
+    {
+        // Like the renderers, a renderable's matrix is relative to its parent's
+        const float* m = parentMatrix;
+        float combined[16];
+        IMatrix* mat = dynamic_cast<IMatrix*>(renderable);
+        if (mat)
+        {
+            float a[16];
+            mat->GetMatrixAsArray(a);
+            general::MultiplyMatrixArrays(parentMatrix, a, combined);
+            m = combined;
+        }
+
+        const std::vector<Vertex>* vertices = NULL;
+        IGeometry* geometry = dynamic_cast<IGeometry*>(renderable);
+        IIndexedGeometry* indexedGeometry = dynamic_cast<IIndexedGeometry*>(renderable);
+        if (geometry) vertices = &geometry->GetVertices();
+        else if (indexedGeometry) vertices = &indexedGeometry->GetVertices();
+
+        if (vertices)
+        {
+            for (unsigned int i = 0; (i < vertices->size()); i++)
+            {
+                const vector3f& p = (*vertices)[i].position;
+                bounds.Expand(vector3f(
+                    (m[0] * p.x) + (m[4] * p.y) + (m[8] * p.z) + m[12],
+                    (m[1] * p.x) + (m[5] * p.y) + (m[9] * p.z) + m[13],
+                    (m[2] * p.x) + (m[6] * p.y) + (m[10] * p.z) + m[14]));
+            }
+        }
+
+        IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
+        if (group)
+        {
+            for (unsigned int i = 0; (i < group->GetAmountOfRenderables()); i++)
+            {
+                if (group->GetRenderable(i) != NULL)
+                {
+                    AddRenderableBounds(group->GetRenderable(i), m, bounds);
+                }
+            }
+        }
+    }
+
+}
+
+}
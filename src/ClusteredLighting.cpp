@@ -0,0 +1,263 @@
+/*
+ * File:   ClusteredLighting.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 11:30 PM
+ */
+
+#include <cmath>
+#include "ClusteredLighting.h"
+#include "MCommon.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    ClusteredLighting::ClusteredLighting(RenderDevice* device, general::ThreadPool* pool, debug::Logger* log,
+        const ClusterGridSettings& gridSettings, const bool& willDeleteAll) :
+        // Call the superclass, ALighting
+        ALighting(log, willDeleteAll),
+        renderDevice(device), backend(NULL), threadPool(pool), grid(gridSettings), clustered(false),
+        bufferID(0), textureID(0), enabled(true),
+        globalAmbient(colourf(0.2f, 0.2f, 0.2f, 1.0f)), attenuationThreshold(1.0f / 256.0f)
+    {
+        if (!renderDevice)
+        {
+            throw debug::NullPointerException("ClusteredLighting - Given a null render device!");
+        }
+        backend = renderDevice->GetBackend();
+        if (!backend->SupportsTextureBuffers())
+        {
+            throw GLExtensionUnavailableException("ClusteredLighting - Texture buffers are not supported!");
+        }
+
+        // Nothing has been set up yet, so the first Update() always sets up the grid
+        for (unsigned int i = 0; (i < 16); i++) projection[i] = 0.0f;
+
+        unsigned int texBuffer = backend->GetBoundBuffer(BUFFERTARGET_TEXTURE);
+        backend->GenerateBuffers(1, &bufferID);
+        backend->BindBuffer(BUFFERTARGET_TEXTURE, bufferID);
+        backend->BufferData(BUFFERTARGET_TEXTURE, 0, NULL);
+        backend->BindBuffer(BUFFERTARGET_TEXTURE, texBuffer);
+        backend->GenerateTextures(1, &textureID);
+
+        logger->WriteTextAndNewLine(logID, "ClusteredLighting created.");
+    }
+
+    ClusteredLighting::~ClusteredLighting()
+    {
+        backend->DeleteTextures(1, &textureID);
+        backend->DeleteBuffers(1, &bufferID);
+
+        logger->WriteTextAndNewLine(logID, "ClusteredLighting destroyed.");
+    }
+
+
+    float ClusteredLighting::GetLightRange(float constant, float linear, float quadratic, float threshold)
+    {
+        // Solves constant + (linear * d) + (quadratic * d^2) = 1 / threshold for d
+        float target = 1.0f / threshold;
+        if (constant >= target) return 0.0f;
+
+        if (quadratic > 0.0f)
+        {
+            float discriminant = (linear * linear) - (4.0f * quadratic * (constant - target));
+            return (-linear + std::sqrt(discriminant)) / (2.0f * quadratic);
+        }
+        else if (linear > 0.0f)
+        {
+            return (target - constant) / linear;
+        }
+        return -1.0f;
+    }
+
+
+    void ClusteredLighting::UpdateProjection()
+    {
+        float m[16];
+        renderDevice->GetProjectionMatrix(RENDERMODE_3D).ToArray(m);
+
+        bool changed = false;
+        for (unsigned int i = 0; (i < 16); i++)
+        {
+            if (m[i] != projection[i]) changed = true;
+            projection[i] = m[i];
+        }
+        if (!changed) return;
+
+        try
+        {
+            grid.SetProjection(m);
+            clustered = true;
+        }
+        catch (debug::InvalidArgumentException&)
+        {
+            logger->WriteTextAndNewLine(logID,
+                "ClusteredLighting - 3D projection is not a perspective one, so lights will not be clustered.");
+            clustered = false;
+        }
+    }
+
+
+    void ClusteredLighting::Update()
+    {
+        UpdateProjection();
+
+        float view[16];
+        renderDevice->GetViewMatrix().ToArray(view);
+
+        globalLights.clear();
+        localLights.clear();
+        clusterLights.clear();
+
+        // Reads any ALights that have changed into the pool, then goes through its arrays
+        lightPool.SyncAdapters();
+        const std::vector<unsigned char>& lightEnabled = lightPool.GetEnabled();
+        const std::vector<LightType>& types = lightPool.GetTypes();
+        const std::vector<maths::vector3f>& positions = lightPool.GetPositions();
+        const std::vector<maths::vector3f>& directions = lightPool.GetDirections();
+        const std::vector<maths::vector3f>& attenuations = lightPool.GetAttenuations();
+
+        for (unsigned int i = 0; (i < lightPool.GetAmountOfLights()); i++)
+        {
+            if (!lightEnabled[i]) continue;
+
+            LightType type = types[i];
+            float position[3] = { 0.0f, 0.0f, 0.0f };
+            float direction[3] = { 0.0f, 0.0f, 0.0f };
+            float range = -1.0f;
+
+            // Directions are transformed without the view matrix's translation
+            if (type == LIGHTTYPE_DIRECTION || type == LIGHTTYPE_SPOTLIGHT)
+            {
+                const maths::vector3f& d = directions[i];
+                for (unsigned int j = 0; (j < 3); j++)
+                {
+                    direction[j] = (view[j] * d.x) + (view[4 + j] * d.y) + (view[8 + j] * d.z);
+                }
+            }
+            if (type == LIGHTTYPE_POSITION || type == LIGHTTYPE_SPOTLIGHT)
+            {
+                const maths::vector3f& p = positions[i];
+                for (unsigned int j = 0; (j < 3); j++)
+                {
+                    position[j] = (view[j] * p.x) + (view[4 + j] * p.y) + (view[8 + j] * p.z) + view[12 + j];
+                }
+                range = GetLightRange(attenuations[i].x, attenuations[i].y, attenuations[i].z, attenuationThreshold);
+            }
+
+            if (range < 0.0f || !clustered)
+            {
+                PackLight(globalLights, i, position, direction, range);
+            }
+            else
+            {
+                PackLight(localLights, i, position, direction, range);
+                ClusterLight sphere = { position[0], position[1], position[2], range };
+                clusterLights.push_back(sphere);
+            }
+        }
+
+        if (clustered) grid.Bin(clusterLights, threadPool);
+
+
+        /* Lays out the light data: the header, then the global and clustered lights, then the
+         * (offset, count) of every cluster (two clusters to a texel), then the light indices
+         * (four to a texel). */
+        const ClusterGridSettings& settings = grid.GetSettings();
+        unsigned int amountOfClusters = grid.GetAmountOfClusters();
+        unsigned int amountOfIndices = (clustered) ? grid.GetLightIndices().size() : 0;
+
+        unsigned int lightsStart = headerTexels;
+        unsigned int clustersStart = lightsStart + ((globalLights.size() + localLights.size()) / 4);
+        unsigned int indicesStart = clustersStart + ((amountOfClusters + 1) / 2);
+        unsigned int totalTexels = indicesStart + ((amountOfIndices + 3) / 4);
+        lightData.assign(totalTexels * 4, 0.0f);
+
+        // Clusters are worked out from the size the scene is actually drawn at
+        const maths::vector2i& viewport = renderDevice->GetViewportSize();
+        float scale = renderDevice->GetResolutionScale();
+
+        float* header = &lightData[0];
+        header[0] = static_cast<float>(settings.tilesX);
+        header[1] = static_cast<float>(settings.tilesY);
+        header[2] = static_cast<float>(settings.slices);
+        header[3] = (enabled) ? 1.0f : 0.0f;
+        header[4] = grid.GetSliceScale();
+        header[5] = grid.GetSliceBias();
+        header[6] = (viewport.x * scale) / settings.tilesX;
+        header[7] = (viewport.y * scale) / settings.tilesY;
+        header[8] = static_cast<float>(GetAmountOfGlobalLights());
+        header[9] = static_cast<float>(lightsStart);
+        header[10] = static_cast<float>(clustersStart);
+        header[11] = static_cast<float>(indicesStart);
+        for (unsigned int i = 0; (i < 4); i++) header[12 + i] = globalAmbient.values[i];
+
+        float* data = &lightData[lightsStart * 4];
+        for (unsigned int i = 0; (i < globalLights.size()); i++) *data++ = globalLights[i];
+        for (unsigned int i = 0; (i < localLights.size()); i++) *data++ = localLights[i];
+
+        // Clusters are left with no lights if the lights weren't binned
+        if (clustered)
+        {
+            const std::vector<unsigned int>& ranges = grid.GetClusterRanges();
+            const std::vector<unsigned int>& indices = grid.GetLightIndices();
+            data = &lightData[clustersStart * 4];
+            for (unsigned int i = 0; (i < ranges.size()); i++) data[i] = static_cast<float>(ranges[i]);
+            data = &lightData[indicesStart * 4];
+            for (unsigned int i = 0; (i < indices.size()); i++) data[i] = static_cast<float>(indices[i]);
+        }
+
+        backend->BindBuffer(BUFFERTARGET_TEXTURE, bufferID);
+        backend->BufferData(BUFFERTARGET_TEXTURE, lightData.size() * sizeof(float), &lightData[0]);
+        backend->BindBuffer(BUFFERTARGET_TEXTURE, 0);
+    }
+
+    void ClusteredLighting::PackLight(std::vector<float>& packed, unsigned int index, const float* position,
+        const float* direction, float range)
+    {
+        LightType type = lightPool.GetTypes()[index];
+        const colourf& ambient = lightPool.GetAmbientColours()[index];
+        const colourf& diffuse = lightPool.GetDiffuseColours()[index];
+        const colourf& specular = lightPool.GetSpecularColours()[index];
+
+        float attenuation[3] = { 1.0f, 0.0f, 0.0f };
+        float cosCutoff = -1.0f, exponent = 0.0f;
+        if (type != LIGHTTYPE_DIRECTION)
+        {
+            const maths::vector3f& a = lightPool.GetAttenuations()[index];
+            attenuation[0] = a.x;
+            attenuation[1] = a.y;
+            attenuation[2] = a.z;
+        }
+        if (type == LIGHTTYPE_SPOTLIGHT)
+        {
+            cosCutoff = static_cast<float>(std::cos(maths::DegreesToRadians(lightPool.GetSpotCutoffs()[index])));
+            exponent = lightPool.GetSpotExponents()[index];
+        }
+
+        // Directional lights store the direction towards them where the others store their position
+        const float* vector = (type == LIGHTTYPE_DIRECTION) ? direction : position;
+        float typeValue = (type == LIGHTTYPE_DIRECTION) ? 0.0f : ((type == LIGHTTYPE_POSITION) ? 1.0f : 2.0f);
+
+        float values[texelsPerLight * 4] = {
+            vector[0], vector[1], vector[2], typeValue,
+            ambient.r, ambient.g, ambient.b, range,
+            diffuse.r, diffuse.g, diffuse.b, exponent,
+            specular.r, specular.g, specular.b, 0.0f,
+            attenuation[0], attenuation[1], attenuation[2], 0.0f,
+            direction[0], direction[1], direction[2], cosCutoff };
+        packed.insert(packed.end(), values, values + (texelsPerLight * 4));
+    }
+
+
+    void ClusteredLighting::Bind(unsigned int unit)
+    {
+        backend->BindTextureBuffer(unit, textureID, bufferID);
+    }
+
+}
+
+}
@@ -0,0 +1,334 @@
+/*
+ * File:   CommandBuffer.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 11:30 AM
+ */
+
+#include <vector>
+#include "CommandBuffer.h"
+#include "RenderDevice.h"
+#include "Program.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* The different commands that can be stored in a command buffer. Every command
+     * starts with a CommandHeader, followed by its own data. The size stored in the
+     * header includes the header itself and any padding, so the next command always
+     * starts 'size' bytes after the current one. */
+    namespace
+    {
+
+        enum RenderCommandType
+        {
+            RENDERCOMMAND_BINDGEOMETRY,
+            RENDERCOMMAND_SETSKIN,
+            RENDERCOMMAND_PUSHMATRIX,
+            RENDERCOMMAND_POPMATRIX,
+            RENDERCOMMAND_DRAWARRAYS,
+            RENDERCOMMAND_DRAWELEMENTS,
+            RENDERCOMMAND_SETUNIFORM
+        };
+
+        struct CommandHeader
+        {
+            unsigned int type;
+            unsigned int size;
+        };
+
+        struct BindGeometryCommand
+        {
+            CommandHeader header;
+            unsigned int dataBuffer, indexBuffer;
+            VertexLayout layout;
+        };
+
+        struct SetSkinCommand
+        {
+            CommandHeader header;
+            SkinHandle skin;
+        };
+
+        struct PushMatrixCommand
+        {
+            CommandHeader header;
+            float matrix[16];
+        };
+
+        struct DrawCommand
+        {
+            CommandHeader header;
+            PrimitiveType type;
+            unsigned int start, amount;
+        };
+
+        /* The uniform's values are stored straight after this struct. */
+        struct SetUniformCommand
+        {
+            CommandHeader header;
+            Program* program;
+            UniformLocation location;
+            unsigned int amount;
+        };
+
+    }
+
+
+    CommandBuffer::CommandBuffer() :
+        allocator(NULL), start(NULL), size(0), commandCount(0),
+        recording(false), overflowed(false), lastSkin(invalidHandle)
+    {
+    }
+
+
+    void CommandBuffer::Begin(general::LinearAllocator* commandAllocator)
+    {
+        if (commandAllocator == NULL)
+        {
+            throw debug::NullPointerException("CommandBuffer::Begin - Given a null allocator!");
+        }
+
+        // Commands will be written from the allocator's current position onwards
+        allocator = commandAllocator;
+        start = allocator->GetCurrentPosition();
+        size = 0;
+        commandCount = 0;
+        recording = true;
+        overflowed = false;
+        lastSkin = invalidHandle;
+    }
+
+    void CommandBuffer::End()
+    {
+        recording = false;
+    }
+
+
+    void* CommandBuffer::AllocateCommand(unsigned int commandSize, unsigned int type)
+    {
+        // Once the buffer has overflowed, it stays incomplete, so don't record anything else
+        if (!recording || overflowed) return NULL;
+
+        commandSize = general::LinearAllocator::AlignSize(commandSize);
+        void* memory = allocator->Allocate(commandSize);
+        if (memory == NULL)
+        {
+            overflowed = true;
+            return NULL;
+        }
+
+        // Fills in the header, the caller fills in the rest
+        CommandHeader* header = static_cast<CommandHeader*>(memory);
+        header->type = type;
+        header->size = commandSize;
+
+        size += commandSize;
+        commandCount++;
+        return memory;
+    }
+
+
+    bool CommandBuffer::BindGeometry(unsigned int dataBuffer, unsigned int indexBuffer, VertexLayout layout)
+    {
+        BindGeometryCommand* command = static_cast<BindGeometryCommand*>(
+            AllocateCommand(sizeof(BindGeometryCommand), RENDERCOMMAND_BINDGEOMETRY));
+        if (!command) return false;
+
+        command->dataBuffer = dataBuffer;
+        command->indexBuffer = indexBuffer;
+        command->layout = layout;
+        return true;
+    }
+
+    bool CommandBuffer::SetSkin(SkinHandle skin)
+    {
+        // No need to record anything if the skin is already going to be active
+        if (lastSkin != invalidHandle && lastSkin == skin) return true;
+
+        SetSkinCommand* command = static_cast<SetSkinCommand*>(
+            AllocateCommand(sizeof(SetSkinCommand), RENDERCOMMAND_SETSKIN));
+        if (!command) return false;
+
+        command->skin = skin;
+        lastSkin = skin;
+        return true;
+    }
+
+    bool CommandBuffer::PushMatrix(const float* matrix)
+    {
+        PushMatrixCommand* command = static_cast<PushMatrixCommand*>(
+            AllocateCommand(sizeof(PushMatrixCommand), RENDERCOMMAND_PUSHMATRIX));
+        if (!command) return false;
+
+        for (unsigned int i = 0; (i < 16); i++) command->matrix[i] = matrix[i];
+        return true;
+    }
+
+    bool CommandBuffer::PopMatrix()
+    {
+        return (AllocateCommand(sizeof(CommandHeader), RENDERCOMMAND_POPMATRIX) != NULL);
+    }
+
+    bool CommandBuffer::DrawArrays(PrimitiveType type, unsigned int start, unsigned int amount)
+    {
+        DrawCommand* command = static_cast<DrawCommand*>(
+            AllocateCommand(sizeof(DrawCommand), RENDERCOMMAND_DRAWARRAYS));
+        if (!command) return false;
+
+        command->type = type;
+        command->start = start;
+        command->amount = amount;
+        return true;
+    }
+
+    bool CommandBuffer::DrawElements(unsigned int start, unsigned int amount)
+    {
+        DrawCommand* command = static_cast<DrawCommand*>(
+            AllocateCommand(sizeof(DrawCommand), RENDERCOMMAND_DRAWELEMENTS));
+        if (!command) return false;
+
+        // All indexed geometry is made up of triangles
+        command->type = PRIMITIVETYPE_TRIANGLE;
+        command->start = start;
+        command->amount = amount;
+        return true;
+    }
+
+    bool CommandBuffer::SetUniform(Program* program, const std::string& varName,
+        const float* values, unsigned int amount)
+    {
+        return SetUniform(program, program->GetUniformLocation(varName), values, amount);
+    }
+
+    bool CommandBuffer::SetUniform(Program* program, UniformLocation location,
+        const float* values, unsigned int amount)
+    {
+        if (amount == 0)
+        {
+            throw debug::InvalidArgumentException(
+                "CommandBuffer::SetUniform - Cannot pass zero amount of values!");
+        }
+
+        // The values are stored straight after the command itself
+        SetUniformCommand* command = static_cast<SetUniformCommand*>(AllocateCommand(
+            sizeof(SetUniformCommand) + (sizeof(float) * amount), RENDERCOMMAND_SETUNIFORM));
+        if (!command) return false;
+
+        command->program = program;
+        command->location = location;
+        command->amount = amount;
+        float* commandValues = reinterpret_cast<float*>(command + 1);
+        for (unsigned int i = 0; (i < amount); i++) commandValues[i] = values[i];
+        return true;
+    }
+
+
+    void CommandBuffer::Submit(RenderDevice* renderDevice) const
+    {
+        if (recording)
+        {
+            throw debug::UnsupportedOperationException(
+                "CommandBuffer::Submit - Cannot submit a buffer that is still recording.");
+        }
+
+        IRenderBackend* backend = renderDevice->GetBackend();
+        const char* current = start;
+        const char* end = (start + size);
+
+        // Goes through every command in the order they were recorded
+        while (current < end)
+        {
+            const CommandHeader* header = reinterpret_cast<const CommandHeader*>(current);
+
+            switch (header->type)
+            {
+                case RENDERCOMMAND_BINDGEOMETRY:
+                {
+                    const BindGeometryCommand* command = reinterpret_cast<const BindGeometryCommand*>(header);
+                    backend->BindBuffer(BUFFERTARGET_ARRAY, command->dataBuffer);
+                    backend->BindBuffer(BUFFERTARGET_ELEMENTARRAY, command->indexBuffer);
+
+                    // Points the vertex arrays at the buffer depending on the vertex struct stored
+                    if (command->layout == VERTEXLAYOUT_VERTEX)
+                    {
+                        unsigned int vertexOffset = 0,
+                            texCoordOffset = sizeof(maths::vector3f),
+                            normalOffset = sizeof(maths::vector3f) + sizeof(maths::vector2f);
+                        backend->SetVertexPointer(3, sizeof(Vertex), (void*)vertexOffset);
+                        backend->SetTexCoordPointer(2, sizeof(Vertex), (void*)texCoordOffset);
+                        backend->SetNormalPointer(sizeof(Vertex), (void*)normalOffset);
+                        backend->EnableClientArray(CLIENTARRAY_NORMAL);
+                    }
+                    else
+                    {
+                        unsigned int vertexOffset = 0, texCoordOffset = sizeof(maths::vector2f);
+                        backend->SetVertexPointer(2, sizeof(SpriteVertex), (void*)vertexOffset);
+                        backend->SetTexCoordPointer(2, sizeof(SpriteVertex), (void*)texCoordOffset);
+                        // Sprites have no normals
+                        backend->DisableClientArray(CLIENTARRAY_NORMAL);
+                    }
+                    backend->EnableClientArray(CLIENTARRAY_VERTEX);
+                    backend->EnableClientArray(CLIENTARRAY_TEXCOORD);
+                    break;
+                }
+                case RENDERCOMMAND_SETSKIN:
+                {
+                    const SetSkinCommand* command = reinterpret_cast<const SetSkinCommand*>(header);
+                    // Makes sure current skin isn't already active
+                    if (renderDevice->GetCurrentSkin() != command->skin)
+                    {
+                        renderDevice->SetActiveSkin(command->skin);
+                    }
+                    break;
+                }
+                case RENDERCOMMAND_PUSHMATRIX:
+                {
+                    const PushMatrixCommand* command = reinterpret_cast<const PushMatrixCommand*>(header);
+                    backend->PushMatrix();
+                    backend->MultiplyMatrix(command->matrix);
+                    break;
+                }
+                case RENDERCOMMAND_POPMATRIX:
+                {
+                    backend->PopMatrix();
+                    break;
+                }
+                case RENDERCOMMAND_DRAWARRAYS:
+                {
+                    const DrawCommand* command = reinterpret_cast<const DrawCommand*>(header);
+                    backend->DrawArrays(command->type, command->start, command->amount);
+                    break;
+                }
+                case RENDERCOMMAND_DRAWELEMENTS:
+                {
+                    const DrawCommand* command = reinterpret_cast<const DrawCommand*>(header);
+                    backend->DrawElements(command->type, command->start, command->amount);
+                    break;
+                }
+                case RENDERCOMMAND_SETUNIFORM:
+                {
+                    const SetUniformCommand* command = reinterpret_cast<const SetUniformCommand*>(header);
+                    const float* values = reinterpret_cast<const float*>(command + 1);
+                    command->program->Set(command->location, values, command->amount);
+                    break;
+                }
+
+                default: throw debug::Exception("CommandBuffer::Submit - Cannot recognize command in buffer.");
+            }
+
+            current += header->size;
+        }
+
+        // Unbinds the buffers, like the renderers do after rendering
+        backend->BindBuffer(BUFFERTARGET_ARRAY, 0);
+        backend->BindBuffer(BUFFERTARGET_ELEMENTARRAY, 0);
+    }
+
+}
+
+}
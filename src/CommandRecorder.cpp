@@ -0,0 +1,133 @@
+/*
+ * File:   CommandRecorder.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 12:25 PM
+ */
+
+#include "CommandRecorder.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    CommandRecorder::CommandRecorder(general::ThreadPool* pool, unsigned int renderablesPerChunk,
+        unsigned int allocatorSize) : threadPool(pool), chunkSize(renderablesPerChunk), fallbackAllocator(NULL)
+    {
+        if (!threadPool)
+        {
+            throw debug::NullPointerException("CommandRecorder - Given a null thread pool!");
+        }
+        if (chunkSize == 0)
+        {
+            throw debug::InvalidArgumentException("CommandRecorder - Chunk size must be greater than zero!");
+        }
+
+        // Every thread gets its own allocator, so recording never has to lock
+        for (unsigned int i = 0; (i < threadPool->GetThreadCount()); i++)
+        {
+            allocators.push_back(new general::LinearAllocator(allocatorSize));
+        }
+        fallbackAllocator = new general::LinearAllocator(allocatorSize);
+    }
+
+    CommandRecorder::~CommandRecorder()
+    {
+        for (unsigned int i = 0; (i < allocators.size()); i++)
+        {
+            delete allocators[i];
+        }
+        allocators.clear();
+
+        delete fallbackAllocator;
+    }
+
+
+    void CommandRecorder::Record(const std::vector<ARenderer*>& renderers)
+    {
+        // Throws away the commands from the previous frame (growing allocators that overflowed)
+        for (unsigned int i = 0; (i < allocators.size()); i++)
+        {
+            allocators[i]->Reset();
+        }
+        fallbackAllocator->Reset();
+
+        // Splits every renderer's renderables into jobs
+        jobs.clear();
+        for (unsigned int i = 0; (i < renderers.size()); i++)
+        {
+            if (!renderers[i]) continue;
+
+            unsigned int amount = renderers[i]->GetAmountOfRenderables();
+            for (unsigned int first = 0; (first < amount); first += chunkSize)
+            {
+                Job job;
+                job.renderer = renderers[i];
+                job.first = first;
+                job.last = (first + chunkSize < amount) ? (first + chunkSize) : amount;
+                jobs.push_back(job);
+            }
+        }
+
+        threadPool->Dispatch(this, jobs.size());
+
+        // Finds the jobs that didn't fit in their thread's allocator
+        std::vector<unsigned int> overflowedJobs;
+        for (unsigned int i = 0; (i < jobs.size()); i++)
+        {
+            if (jobs[i].buffer.HasOverflowed()) overflowedJobs.push_back(i);
+        }
+
+        /* They are recorded again here, into the fallback allocator. If that runs out
+         * of space too, it is grown and all of them are recorded again. This only happens
+         * until the allocators have grown to fit the amount of commands being recorded. */
+        bool retry = !overflowedJobs.empty();
+        while (retry)
+        {
+            retry = false;
+            for (unsigned int i = 0; (i < overflowedJobs.size()); i++)
+            {
+                Job& job = jobs[overflowedJobs[i]];
+                job.buffer.Begin(fallbackAllocator);
+                job.renderer->RecordCommands(job.buffer, job.first, job.last);
+                job.buffer.End();
+
+                if (job.buffer.HasOverflowed())
+                {
+                    retry = true;
+                    break;
+                }
+            }
+
+            if (retry) fallbackAllocator->Reset();
+        }
+    }
+
+    void CommandRecorder::Submit(RenderDevice* renderDevice)
+    {
+        if (!renderDevice)
+        {
+            throw debug::NullPointerException("CommandRecorder::Submit - Given a null render device!");
+        }
+
+        for (unsigned int i = 0; (i < jobs.size()); i++)
+        {
+            jobs[i].buffer.Submit(renderDevice);
+        }
+    }
+
+
+    void CommandRecorder::Execute(unsigned int index, unsigned int threadIndex)
+    {
+        Job& job = jobs[index];
+        job.buffer.Begin(allocators[threadIndex]);
+        job.renderer->RecordCommands(job.buffer, job.first, job.last);
+        job.buffer.End();
+    }
+
+}
+
+}
@@ -0,0 +1,94 @@
+/*
+ * File:   DynamicResolution.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 10:30 PM
+ * Changed to average the cost per pixel of frames drawn at any scale on October 19, 2026, 4:50 AM
+ */
+
+#include <cmath>
+#include "DynamicResolution.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    DynamicResolution::DynamicResolution(const DynamicResolutionSettings& initialSettings) :
+        scale(1.0f), averageCost(0.0f)
+    {
+        SetSettings(initialSettings);
+    }
+
+
+    void DynamicResolution::SetSettings(const DynamicResolutionSettings& newSettings)
+    {
+        if (newSettings.minScale <= 0.0f || newSettings.minScale > newSettings.maxScale || newSettings.maxScale > 1.0f)
+        {
+            throw debug::InvalidArgumentException(
+                "DynamicResolution::SetSettings - Scales must be between 0 and 1, and the minimum can't be above the maximum.");
+        }
+        if (newSettings.targetFrameTime <= 0.0f)
+        {
+            throw debug::InvalidArgumentException("DynamicResolution::SetSettings - Target frame time must be above zero.");
+        }
+        if (newSettings.smoothing <= 0.0f || newSettings.smoothing > 1.0f)
+        {
+            throw debug::InvalidArgumentException("DynamicResolution::SetSettings - Smoothing must be between 0 and 1.");
+        }
+
+        settings = newSettings;
+        Reset();
+    }
+
+    void DynamicResolution::Reset()
+    {
+        scale = settings.maxScale;
+        averageCost = 0.0f;
+    }
+
+
+    void DynamicResolution::AddFrameTime(float cpuTime, float gpuTime, float gpuScale)
+    {
+        /* Frame time is assumed to go up with the amount of pixels, which goes up with the
+         * square of the scale. Dividing each time by the square of the scale it was measured
+         * at gives what the frame would have cost at full resolution, so times measured at
+         * different scales can be averaged together. Whichever of the two is slower is what
+         * holds the frame up. */
+        float cost = (cpuTime > 0.0f) ? cpuTime / (scale * scale) : 0.0f;
+        if (gpuTime > 0.0f && gpuScale > 0.0f)
+        {
+            float gpuCost = gpuTime / (gpuScale * gpuScale);
+            if (gpuCost > cost) cost = gpuCost;
+        }
+        if (cost <= 0.0f) return;
+
+        // The first frame starts the average off, after that it's a moving average
+        if (averageCost == 0.0f) averageCost = cost;
+        else averageCost += settings.smoothing * (cost - averageCost);
+
+        // What frames take at the current scale, and the scale that would hit the target exactly
+        float averageFrameTime = GetAverageFrameTime();
+        float idealScale = std::sqrt(settings.targetFrameTime / averageCost);
+
+        if (averageFrameTime > settings.targetFrameTime)
+        {
+            // Too slow, so drops straight down to the ideal scale
+            scale = idealScale;
+        }
+        else if (averageFrameTime < settings.targetFrameTime * (1.0f - settings.headroom))
+        {
+            // Fast enough to spare, so creeps back up towards the ideal scale
+            float maxScale = scale * (1.0f + settings.maxIncrease);
+            scale = (idealScale < maxScale) ? idealScale : maxScale;
+        }
+
+        if (scale < settings.minScale) scale = settings.minScale;
+        if (scale > settings.maxScale) scale = settings.maxScale;
+    }
+
+}
+
+}
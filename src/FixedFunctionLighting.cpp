@@ -1,241 +1,450 @@
- /*
- * File:   FixedFunctionLighting.cpp
- * Author: Donald "Datriot" Whyte
- *
- * Created on February 24, 2009, 10:10 AM
- */
-
-#include <GLee.h>
-#include "FixedFunctionLighting.h"
-#include "Util.h"
-
-namespace parcel
-{
-
-namespace graphics
-{
-
-    FixedFunctionLighting::FixedFunctionLighting(debug::Logger* log, const bool& enabled, const bool& willDeleteAll) :
-        // Call the superclass, ALighting
-        ALighting(log, willDeleteAll),
-        // Gives other members default values
-        globalAmbient(colourf(1.0f, 1.0f, 1.0f, 1.0f)),
-        twoSidedLighting(false), useLocalViewer(false), generateNormals(false)
-    {
-        // Starts a log for this class
-        logger->WriteTextAndNewLine(logID, "FixedFunctionLighting created.");
-
-        // Depending on the value given, enable/disable lighting initially
-        if (enabled)
-        {
-            EnableLighting();
-        }
-        else
-        {
-            DisableLighting();
-        }
-
-
-    }
-
-    FixedFunctionLighting::~FixedFunctionLighting()
-    {
-        // Disables lighting before being destroyed
-        DisableLighting();
-
-        logger->WriteTextAndNewLine(logID,  "FixedFunctionLighting destroyed.");
-    }
-
-
-    void FixedFunctionLighting::EnableLighting()
-    {
-        // Enables lighting if it is not enabled already
-        if (!glIsEnabled(GL_LIGHTING))
-        {
-            glEnable(GL_LIGHTING);
-
-            // Logs event
-            logger->WriteTextAndNewLine(logID,  "FixedFunctionLighting enabled!");
-        }
-    }
-
-    void FixedFunctionLighting::DisableLighting()
-    {
-        // Same as EnableLighting(), but reversed
-        if (glIsEnabled(GL_LIGHTING))
-        {
-            glDisable(GL_LIGHTING);
-
-            // Logs event
-            logger->WriteTextAndNewLine(logID,  "FixedFunctionLighting disabled!");
-        }
-    }
-
-
-    void FixedFunctionLighting::DisableAllGLLights()
-    {
-        // Disables eight lights in OpenGL's fixed function lighting
-        glDisable(GL_LIGHT0);
-        glDisable(GL_LIGHT1);
-        glDisable(GL_LIGHT2);
-        glDisable(GL_LIGHT3);
-        glDisable(GL_LIGHT4);
-        glDisable(GL_LIGHT5);
-        glDisable(GL_LIGHT6);
-        glDisable(GL_LIGHT7);
-    }
-
-
-    void FixedFunctionLighting::Update()
-    {
-        // Enable normal generation if generateNormals is true and it hasn't already been enabled
-        if (generateNormals && !glIsEnabled(GL_NORMALIZE)) glEnable(GL_NORMALIZE);
-
-        // Sets the lighting model parameters
-        glLightModelfv(GL_LIGHT_MODEL_AMBIENT, globalAmbient.values);
-        glLightModeli(GL_LIGHT_MODEL_LOCAL_VIEWER, useLocalViewer);
-        glLightModeli(GL_LIGHT_MODEL_TWO_SIDE, twoSidedLighting);
-
-        // Gets the maximum OpenGL lights possible for future use
-        GLint maxGLLights;
-        glGetIntegerv(GL_MAX_LIGHTS, &maxGLLights);
-
-        // Disables all the lights in OpenGL before updating the ones stored in the manager
-        DisableAllGLLights();
-
-        // Iterates through every light
-        for (unsigned int i = 0; (i < lights.size()); i++)
-        {
-            try
-            {
-                /* Before doing anything, make sure that we haven't exceeded the maximun amount
-                 * of lights in this implementation of OpenGL. Break the loop if it has. */
-                if (i >= (unsigned int)maxGLLights) break;
-
-                int light; // Stores the enumerator for the OpenGL lights, such as GL_LIGHT0
-
-                /* Because of OpenGL's awkward light enumerators, we have to go through a switch
-                 * statement to get the enumerator and alter the correct light. */
-                switch (i)
-                {
-                    case 0: light = GL_LIGHT0; break;
-                    case 1: light = GL_LIGHT1; break;
-                    case 2: light = GL_LIGHT2; break;
-                    case 3: light = GL_LIGHT3; break;
-                    case 4: light = GL_LIGHT4; break;
-                    case 5: light = GL_LIGHT5; break;
-                    case 6: light = GL_LIGHT6; break;
-                    case 7: light = GL_LIGHT7; break;
-
-                    // Throws an exception if the case could not be handled
-                    default: throw debug::Exception("FixedFunctionLighting::Update() - No corresponding enumerator for light.");
-                }
-
-                // If the light exists and it is enabled
-                if (lights[i] != NULL && lights[i]->IsEnabled())
-                {
-                    // Sets the light's colour
-                    glLightfv(light, GL_AMBIENT, lights[i]->GetAmbientColour().values);
-                    glLightfv(light, GL_DIFFUSE, lights[i]->GetDiffuseColour().values);
-                    glLightfv(light, GL_SPECULAR, lights[i]->GetSpecularColour().values);
-
-                    // Checks which type of light it is and acts appropriately
-                    switch (lights[i]->GetType())
-                    {
-                        // If it's a positional light
-                        case LIGHTTYPE_POSITION:
-                        {
-                            /* Gets the light's position.
-                             * The fourth float is set to 1.0 to tell OpenGL that it's a positional light */
-                            maths::vector3f position = lights[i]->GetPosition();
-                            float values[4] = { position.x, position.y, position.z, 1.0f };
-
-                            // Passes the type and values of the light to OpenGL
-                            glLightfv(light, GL_POSITION, values);
-
-                            // Sets the attenuation properties of the light
-                            glLightf(light, GL_CONSTANT_ATTENUATION, lights[i]->GetConstantAttenuation());
-                            glLightf(light, GL_LINEAR_ATTENUATION, lights[i]->GetLinearAttenuation());
-                            glLightf(light, GL_QUADRATIC_ATTENUATION, lights[i]->GetQuadraticAttenuation());
-
-                            break;
-                        }
-                        case LIGHTTYPE_DIRECTION:
-                        {
-                            /* Gets the light's direction.
-                             * The fourth float is set to 0.0 to tell OpenGL that it's a directional light */
-                            maths::vector3f direction = lights[i]->GetDirection();
-                            float values[4] = { direction.x, direction.y, direction.z, 0.0f };
-
-                            glLightfv(light, GL_POSITION, values);
-
-                            break;
-                        }
-                        case LIGHTTYPE_SPOTLIGHT:
-                        {
-                            /* Gets the light's position.
-                             * The fourth float is set to 1.0 to tell OpenGL that it's a positional light */
-                            maths::vector3f position = lights[i]->GetPosition();
-                            float values[4] = { position.x, position.y, position.z, 1.0f };
-
-                            // Sets up a position light as normal
-                            glLightfv(light, GL_POSITION, values);
-
-                            // Sets the attenuation properties of the light
-                            glLightf(light, GL_CONSTANT_ATTENUATION, lights[i]->GetConstantAttenuation());
-                            glLightf(light, GL_LINEAR_ATTENUATION, lights[i]->GetLinearAttenuation());
-                            glLightf(light, GL_QUADRATIC_ATTENUATION, lights[i]->GetQuadraticAttenuation());
-
-                            /* Sets spotlight specific parameters, which are the direction, size (cutoff)
-                             * and focus (exponent) of the spotlight. */
-                            glLightfv(light, GL_SPOT_DIRECTION, lights[i]->GetDirection().values);
-                            glLightf(light, GL_SPOT_CUTOFF, lights[i]->GetSpotlightCutoff());
-                            glLightf(light, GL_SPOT_EXPONENT, lights[i]->GetSpotlightFocus());
-
-                            break;
-                        }
-
-                        default: throw debug::Exception("FixedFunctionLighting::Update() - Cannot recognize this light's type.");
-                    }
-
-                    // Enable the light
-                    glEnable(light);
-                }
-            }
-            // Catch exceptions and log the message
-            catch (debug::Exception& ex)
-            {
-                logger->WriteTextAndNewLine(logID, ex.Message());
-            }
-            // Catches anything and logs generic error message
-            catch (...)
-            {
-                logger->WriteTextAndNewLine(logID, "FixedFunctionLighting::Update() - Failed for unknown reason!");
-            }
-        }
-    }
-
-
-    void FixedFunctionLighting::SetGlobalAmbientColour(const colourf& colour)
-    {
-        globalAmbient = colour;
-    }
-
-    void FixedFunctionLighting::SetTwoSidedLighting(const bool& twoSided)
-    {
-        twoSidedLighting = twoSided;
-    }
-
-    void FixedFunctionLighting::SetUseLocalViewer(const bool& localViewer)
-    {
-        useLocalViewer = localViewer;
-    }
-
-    void FixedFunctionLighting::SetGenerateNormals(const bool& genNorms)
-    {
-        generateNormals = genNorms;
-    }
-
-}
-
-}
+ /*
+ * File:   FixedFunctionLighting.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on February 24, 2009, 10:10 AM
+ * Changed to only upload lights that have changed on October 18, 2026, 11:50 PM
+ * Added per-object light selection on October 19, 2026, 12:05 AM
+ * Added ambient light from light probes on October 19, 2026, 12:35 AM
+ * Changed to read the lights from a LightPool on October 19, 2026, 1:05 AM
+ */
+
+#include <algorithm>
+#include "FixedFunctionLighting.h"
+#include "Util.h"
+
+namespace
+{
+
+    // Returns true if the first 'amount' floats of both arrays are the same
+    bool SameValues(const float* a, const float* b, unsigned int amount)
+    {
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            if (a[i] != b[i]) return false;
+        }
+        return true;
+    }
+
+    void CopyValues(float* destination, const float* source, unsigned int amount)
+    {
+        for (unsigned int i = 0; (i < amount); i++) destination[i] = source[i];
+    }
+
+}
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    FixedFunctionLighting::FixedFunctionLighting(IRenderBackend* renderBackend, debug::Logger* log,
+        const bool& enabled, const bool& willDeleteAll) :
+        // Call the superclass, ALighting
+        ALighting(log, willDeleteAll),
+        backend(renderBackend),
+        // Gives other members default values
+        globalAmbient(colourf(1.0f, 1.0f, 1.0f, 1.0f)),
+        twoSidedLighting(false), useLocalViewer(false), generateNormals(false),
+        modelDirty(true), modelVersion(1), slotsCreated(false), selector(NULL),
+        probeSampler(NULL), appliedAmbient(colourf(1.0f, 1.0f, 1.0f, 1.0f)), lightCalls(0), lightsUploaded(0)
+    {
+        if (!backend)
+        {
+            throw debug::NullPointerException("FixedFunctionLighting - Given a null render backend!");
+        }
+
+        // Starts a log for this class
+        logger->WriteTextAndNewLine(logID, "FixedFunctionLighting created.");
+
+        // Depending on the value given, enable/disable lighting initially
+        if (enabled)
+        {
+            EnableLighting();
+        }
+        else
+        {
+            DisableLighting();
+        }
+
+
+    }
+
+    FixedFunctionLighting::~FixedFunctionLighting()
+    {
+        // Disables lighting before being destroyed
+        DisableLighting();
+
+        logger->WriteTextAndNewLine(logID,  "FixedFunctionLighting destroyed.");
+    }
+
+
+    void FixedFunctionLighting::EnableLighting()
+    {
+        // Enables lighting if it is not enabled already
+        if (!backend->IsEnabled(CAPABILITY_LIGHTING))
+        {
+            backend->Enable(CAPABILITY_LIGHTING);
+
+            // Logs event
+            logger->WriteTextAndNewLine(logID,  "FixedFunctionLighting enabled!");
+        }
+    }
+
+    void FixedFunctionLighting::DisableLighting()
+    {
+        // Same as EnableLighting(), but reversed
+        if (backend->IsEnabled(CAPABILITY_LIGHTING))
+        {
+            backend->Disable(CAPABILITY_LIGHTING);
+
+            // Logs event
+            logger->WriteTextAndNewLine(logID,  "FixedFunctionLighting disabled!");
+        }
+    }
+
+
+    void FixedFunctionLighting::Update()
+    {
+        lightCalls = 0;
+        lightsUploaded = 0;
+
+        // The global model is only set again when it has changed
+        if (modelDirty)
+        {
+            // Enable normal generation if generateNormals is true and it hasn't already been enabled
+            if (generateNormals && !backend->IsEnabled(CAPABILITY_NORMALIZE)) backend->Enable(CAPABILITY_NORMALIZE);
+
+            backend->SetLightModel(globalAmbient, useLocalViewer, twoSidedLighting);
+            ++lightCalls;
+            appliedAmbient = globalAmbient;
+            modelDirty = false;
+        }
+        // Anything drawn before the first object's lights are bound gets the global ambient colour
+        else
+        {
+            ApplyAmbient(globalAmbient);
+        }
+
+        // Asks for the maximum amount of lights once, then keeps a slot for each of them
+        if (!slotsCreated)
+        {
+            LightSlot empty;
+            empty.light = 0;
+            empty.version = 0;
+            empty.dirty = true;
+            empty.enabled = false;
+            empty.enabledKnown = false;
+            empty.stateKnown = false;
+            empty.transformsKnown = false;
+            slots.assign(backend->GetMaxLights(), empty);
+            slotsCreated = true;
+        }
+
+        // Reads any ALights that have changed into the pool
+        lightPool.SyncAdapters();
+
+        // With a selector, the lights are bound for each object as it's drawn
+        if (selector)
+        {
+            selector->Update(lightPool);
+            return;
+        }
+
+        /* The light's number in the graphics API is the same as its index. Lights past the
+         * maximum amount of lights in this implementation of OpenGL are ignored, and slots
+         * without a light are disabled. */
+        for (unsigned int i = 0; (i < slots.size()); i++)
+        {
+            SetSlotLight(i, (i < lightPool.GetAmountOfLights()) ? static_cast<int>(i) : -1);
+        }
+    }
+
+
+    void FixedFunctionLighting::SetSlotLight(unsigned int index, int lightIndex)
+    {
+        LightSlot& slot = slots[index];
+        if (lightIndex < 0)
+        {
+            slot.light = 0;
+            SetLightEnabled(index, false);
+            return;
+        }
+
+        // Skips lights that haven't changed since they were uploaded
+        LightHandle light = lightPool.GetHandles()[lightIndex];
+        unsigned int version = lightPool.GetVersions()[lightIndex];
+        if (light == slot.light && !slot.dirty && version == slot.version) return;
+
+        ++lightsUploaded;
+        if (lightPool.GetEnabled()[lightIndex])
+        {
+            LightState state;
+            ReadLight(lightIndex, slot.state, slot.stateKnown, state);
+            UploadLight(index, state);
+            SetLightEnabled(index, true);
+        }
+        else
+        {
+            SetLightEnabled(index, false);
+        }
+
+        slot.light = light;
+        slot.version = version;
+        slot.dirty = false;
+    }
+
+
+    void FixedFunctionLighting::SetLightSelector(LightSelector* lightSelector)
+    {
+        selector = lightSelector;
+        if (selector) selector->Clear();
+        // The slots are filled in differently now, so they're all checked again
+        for (unsigned int i = 0; (i < slots.size()); i++) slots[i].dirty = true;
+    }
+
+    void FixedFunctionLighting::SetProbeSampler(LightProbeSampler* sampler)
+    {
+        probeSampler = sampler;
+    }
+
+    void FixedFunctionLighting::BindLightsFor(const void* object, const maths::AABB& bounds)
+    {
+        if (probeSampler)
+        {
+            ApplyAmbient(probeSampler->HasLighting(object) ? probeSampler->GetAmbientColour(object) : globalAmbient);
+        }
+        if (!selector || !slotsCreated) return;
+
+        const std::vector<unsigned int>& picked = selector->Select(object, bounds);
+        const std::vector<LightHandle>& handles = lightPool.GetHandles();
+        unsigned int amount = (picked.size() < slots.size()) ? picked.size() : slots.size();
+
+        // Lights that are already in a slot stay there...
+        slotLights.assign(slots.size(), -1);
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            for (unsigned int j = 0; (j < slots.size()); j++)
+            {
+                if (slots[j].light == handles[picked[i]])
+                {
+                    slotLights[j] = picked[i];
+                    break;
+                }
+            }
+        }
+        // ...and the rest go into the slots that are left
+        unsigned int freeSlot = 0;
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            int light = static_cast<int>(picked[i]);
+            if (std::find(slotLights.begin(), slotLights.end(), light) != slotLights.end()) continue;
+            while (slotLights[freeSlot] >= 0) ++freeSlot;
+            slotLights[freeSlot] = light;
+        }
+
+        for (unsigned int i = 0; (i < slots.size()); i++) SetSlotLight(i, slotLights[i]);
+    }
+
+
+    void FixedFunctionLighting::ReadLight(unsigned int index, const LightState& previous, bool previousKnown,
+        LightState& state)
+    {
+        /* Parameters the light's type doesn't use are left as they were in the slot, so
+         * they're not sent again. Spotlights are the only lights with a cutoff, though,
+         * so a slot that held a spotlight doesn't turn the next light into one. */
+        if (previousKnown) state = previous;
+        else
+        {
+            const float defaultAttenuation[3] = { 1.0f, 0.0f, 0.0f };
+            const float defaultSpotDirection[3] = { 0.0f, 0.0f, -1.0f };
+            CopyValues(state.attenuation, defaultAttenuation, 3);
+            CopyValues(state.spotDirection, defaultSpotDirection, 3);
+            state.spotExponent = 0.0f;
+        }
+        state.spotCutoff = 180.0f;
+
+        state.type = lightPool.GetTypes()[index];
+        CopyValues(state.ambient, lightPool.GetAmbientColours()[index].values, 4);
+        CopyValues(state.diffuse, lightPool.GetDiffuseColours()[index].values, 4);
+        CopyValues(state.specular, lightPool.GetSpecularColours()[index].values, 4);
+
+        // Checks which type of light it is and acts appropriately
+        if (state.type == LIGHTTYPE_DIRECTION)
+        {
+            // The fourth float is 0.0 to tell OpenGL that it's a directional light
+            CopyValues(state.position, lightPool.GetDirections()[index].values, 3);
+            state.position[3] = 0.0f;
+        }
+        else
+        {
+            // The fourth float is 1.0 to tell OpenGL that it's a positional light
+            CopyValues(state.position, lightPool.GetPositions()[index].values, 3);
+            state.position[3] = 1.0f;
+            CopyValues(state.attenuation, lightPool.GetAttenuations()[index].values, 3);
+
+            /* Spotlights also have a direction, size (cutoff) and focus (exponent). */
+            if (state.type == LIGHTTYPE_SPOTLIGHT)
+            {
+                CopyValues(state.spotDirection, lightPool.GetDirections()[index].values, 3);
+                state.spotCutoff = lightPool.GetSpotCutoffs()[index];
+                state.spotExponent = lightPool.GetSpotExponents()[index];
+            }
+        }
+    }
+
+
+    void FixedFunctionLighting::UploadLight(unsigned int index, const LightState& state)
+    {
+        LightSlot& slot = slots[index];
+        LightState& uploaded = slot.state;
+        // Everything is sent if the slot isn't known, so afterwards it always is
+        bool known = slot.stateKnown;
+        bool transformed = slot.stateKnown && slot.transformsKnown;
+
+        if (!known || !SameValues(uploaded.ambient, state.ambient, 4))
+        {
+            backend->SetLightVector(index, LIGHTPARAMETER_AMBIENT, state.ambient);
+            ++lightCalls;
+        }
+        if (!known || !SameValues(uploaded.diffuse, state.diffuse, 4))
+        {
+            backend->SetLightVector(index, LIGHTPARAMETER_DIFFUSE, state.diffuse);
+            ++lightCalls;
+        }
+        if (!known || !SameValues(uploaded.specular, state.specular, 4))
+        {
+            backend->SetLightVector(index, LIGHTPARAMETER_SPECULAR, state.specular);
+            ++lightCalls;
+        }
+        if (!transformed || !SameValues(uploaded.position, state.position, 4))
+        {
+            backend->SetLightVector(index, LIGHTPARAMETER_POSITION, state.position);
+            ++lightCalls;
+        }
+        if (!known || uploaded.attenuation[0] != state.attenuation[0])
+        {
+            backend->SetLightValue(index, LIGHTPARAMETER_CONSTANTATTENUATION, state.attenuation[0]);
+            ++lightCalls;
+        }
+        if (!known || uploaded.attenuation[1] != state.attenuation[1])
+        {
+            backend->SetLightValue(index, LIGHTPARAMETER_LINEARATTENUATION, state.attenuation[1]);
+            ++lightCalls;
+        }
+        if (!known || uploaded.attenuation[2] != state.attenuation[2])
+        {
+            backend->SetLightValue(index, LIGHTPARAMETER_QUADRATICATTENUATION, state.attenuation[2]);
+            ++lightCalls;
+        }
+        if (!transformed || !SameValues(uploaded.spotDirection, state.spotDirection, 3))
+        {
+            backend->SetLightVector(index, LIGHTPARAMETER_SPOTDIRECTION, state.spotDirection);
+            ++lightCalls;
+        }
+        if (!known || uploaded.spotCutoff != state.spotCutoff)
+        {
+            backend->SetLightValue(index, LIGHTPARAMETER_SPOTCUTOFF, state.spotCutoff);
+            ++lightCalls;
+        }
+        if (!known || uploaded.spotExponent != state.spotExponent)
+        {
+            backend->SetLightValue(index, LIGHTPARAMETER_SPOTEXPONENT, state.spotExponent);
+            ++lightCalls;
+        }
+
+        uploaded = state;
+        slot.stateKnown = true;
+        slot.transformsKnown = true;
+    }
+
+
+    void FixedFunctionLighting::SetLightEnabled(unsigned int index, bool enabled)
+    {
+        LightSlot& slot = slots[index];
+        if (slot.enabledKnown && slot.enabled == enabled) return;
+
+        if (enabled) backend->EnableLight(index);
+        else backend->DisableLight(index);
+        ++lightCalls;
+
+        slot.enabled = enabled;
+        slot.enabledKnown = true;
+    }
+
+
+    void FixedFunctionLighting::RemoveLight(const unsigned int& lightID)
+    {
+        ALighting::RemoveLight(lightID);
+
+        for (unsigned int i = 0; (i < slots.size()); i++) slots[i].dirty = true;
+    }
+
+    void FixedFunctionLighting::InvalidateTransforms()
+    {
+        for (unsigned int i = 0; (i < slots.size()); i++)
+        {
+            slots[i].dirty = true;
+            slots[i].transformsKnown = false;
+        }
+    }
+
+    void FixedFunctionLighting::InvalidateLights()
+    {
+        modelDirty = true;
+        for (unsigned int i = 0; (i < slots.size()); i++)
+        {
+            slots[i].dirty = true;
+            slots[i].enabledKnown = false;
+            slots[i].stateKnown = false;
+        }
+    }
+
+
+    void FixedFunctionLighting::ModelChanged()
+    {
+        modelDirty = true;
+        ++modelVersion;
+    }
+
+
+    void FixedFunctionLighting::ApplyAmbient(const colourf& ambient)
+    {
+        if (appliedAmbient == ambient) return;
+        backend->SetLightModel(ambient, useLocalViewer, twoSidedLighting);
+        ++lightCalls;
+        appliedAmbient = ambient;
+    }
+
+    void FixedFunctionLighting::SetGlobalAmbientColour(const colourf& colour)
+    {
+        if (globalAmbient == colour) return;
+        globalAmbient = colour;
+        ModelChanged();
+    }
+
+    void FixedFunctionLighting::SetTwoSidedLighting(const bool& twoSided)
+    {
+        if (twoSidedLighting == twoSided) return;
+        twoSidedLighting = twoSided;
+        ModelChanged();
+    }
+
+    void FixedFunctionLighting::SetUseLocalViewer(const bool& localViewer)
+    {
+        if (useLocalViewer == localViewer) return;
+        useLocalViewer = localViewer;
+        ModelChanged();
+    }
+
+    void FixedFunctionLighting::SetGenerateNormals(const bool& genNorms)
+    {
+        if (generateNormals == genNorms) return;
+        generateNormals = genNorms;
+        ModelChanged();
+    }
+
+}
+
+}
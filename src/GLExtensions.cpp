@@ -0,0 +1,96 @@
+/*
+ * File:   GLExtensions.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 3:50 AM
+ * Added program binaries on October 19, 2026, 4:05 AM
+ * Added parallel shader compiling on October 19, 2026, 4:20 AM
+ */
+
+#include <cstring>
+#include "GLExtensions.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    bool IsExtensionSupported(const char* name)
+    {
+        const char* extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+        if (!extensions || !name || !name[0]) return false;
+
+        // Only counts whole names, since one can be the start of another (e.g. "GL_EXT_texture")
+        size_t length = strlen(name);
+        const char* found = extensions;
+        while ((found = strstr(found, name)) != NULL)
+        {
+            bool startsName = (found == extensions || found[-1] == ' ');
+            bool endsName = (found[length] == ' ' || found[length] == '\0');
+            if (startsName && endsName) return true;
+            found += length;
+        }
+        return false;
+    }
+
+    void* GetExtensionFunction(const char* name)
+    {
+        void* function = reinterpret_cast<void*>(wglGetProcAddress(name));
+        // Some drivers return small numbers instead of NULL when they don't have the function
+        ptrdiff_t value = reinterpret_cast<ptrdiff_t>(function);
+        if (value >= -1 && value <= 3) return NULL;
+        return function;
+    }
+
+    const GLExtensions& GetGLExtensions()
+    {
+        static GLExtensions extensions;
+        static bool loaded = false;
+        if (loaded) return extensions;
+
+        extensions.timerQuery = false;
+        extensions.getQueryObjectui64v = NULL;
+        if (IsExtensionSupported("GL_ARB_timer_query"))
+        {
+            extensions.getQueryObjectui64v = reinterpret_cast<GetQueryObjectui64vFunction>(
+                GetExtensionFunction("glGetQueryObjectui64v"));
+            extensions.timerQuery = (extensions.getQueryObjectui64v != NULL);
+        }
+
+        extensions.programBinaries = false;
+        extensions.getProgramBinary = NULL;
+        extensions.programBinary = NULL;
+        extensions.programParameteri = NULL;
+        if (IsExtensionSupported("GL_ARB_get_program_binary"))
+        {
+            extensions.getProgramBinary = reinterpret_cast<GetProgramBinaryFunction>(
+                GetExtensionFunction("glGetProgramBinary"));
+            extensions.programBinary = reinterpret_cast<ProgramBinaryFunction>(
+                GetExtensionFunction("glProgramBinary"));
+            extensions.programParameteri = reinterpret_cast<ProgramParameteriFunction>(
+                GetExtensionFunction("glProgramParameteri"));
+            extensions.programBinaries = (extensions.getProgramBinary && extensions.programBinary
+                && extensions.programParameteri);
+        }
+
+        extensions.maxShaderCompilerThreads = NULL;
+        if (IsExtensionSupported("GL_KHR_parallel_shader_compile"))
+        {
+            extensions.maxShaderCompilerThreads = reinterpret_cast<MaxShaderCompilerThreadsFunction>(
+                GetExtensionFunction("glMaxShaderCompilerThreadsKHR"));
+        }
+        else if (IsExtensionSupported("GL_ARB_parallel_shader_compile"))
+        {
+            extensions.maxShaderCompilerThreads = reinterpret_cast<MaxShaderCompilerThreadsFunction>(
+                GetExtensionFunction("glMaxShaderCompilerThreadsARB"));
+        }
+        extensions.parallelShaderCompile = (extensions.maxShaderCompilerThreads != NULL);
+
+        loaded = true;
+        return extensions;
+    }
+
+}
+
+}
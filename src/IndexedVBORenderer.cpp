@@ -1,343 +1,499 @@
-/*
- * File:   IndexedVBORenderer.cpp
- * Author: Donald "Datriot" Whyte
- *
- * Created on March 28, 2009, 10:12 AM
- */
-
-#include "IndexedVBORenderer.h"
-
-namespace parcel
-{
-
-    using namespace maths;
-
-    namespace graphics
-    {
-
-        IndexedVBORenderer::IndexedVBORenderer(RenderDevice* renderDevice, debug::Logger* log,
-            const bool& willDeleteAll) :
-            // Initialiser list
-            ARenderer(log, "IndexedVBORenderer", willDeleteAll), // Superclass constructor
-            dataVBO(0), indexVBO(0),
-            vboData(NULL), indexVBOData(NULL),
-            renderDevice(renderDevice)
-        {
-            // Stores the currently bound buffers (or 0 for no buffer)
-            int arrBuffer, elemBuffer;
-            glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &arrBuffer);
-            glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &elemBuffer);
-
-            // Creates the data and index (element) VBOs and stores IDs in appropriate variables
-            glGenBuffers(2, &dataVBO);
-            // Data VBO
-            glBindBuffer(GL_ARRAY_BUFFER, dataVBO);
-            glBufferData(GL_ARRAY_BUFFER, 0, NULL, GL_DYNAMIC_DRAW);
-            // Index VBO
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexVBO);
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER, 0, NULL, GL_DYNAMIC_DRAW);
-
-            /* Makes sure to re-bind the buffers that were active BEFORE creating the buffers
-             * for this renderer. */
-            glBindBuffer(GL_ARRAY_BUFFER, arrBuffer);
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elemBuffer);
-
-            logger->WriteTextAndNewLine(logID, "IndexedVBORenderer created.");
-        }
-
-
-        IndexedVBORenderer::~IndexedVBORenderer()
-        {
-            // Deletes both VBOs
-            glDeleteBuffers(2, &dataVBO);
-
-            logger->WriteTextAndNewLine(logID, "IndexedVBORenderer destroyed.");
-        }
-
-
-        void IndexedVBORenderer::ProcessRenderable(IRenderable* renderable,
-            unsigned int& dataVBOIndex, unsigned int& elementVBOIndex,
-            unsigned int& triangleNumber)
-        {
-            /* Stores start and end of this renderable's triangles in the INDEX
-             * (element) VBO array. */
-            general::ArrayIndices indices;
-            // Sets the start of the triangles
-            indices.start = elementVBOIndex;
-
-            unsigned int i; // Iterator for the loops
-            unsigned int amount = 0; // The amount of triangles this renderable has to draw
-
-
-            // If renderable holds geometry and triangle face data
-            IIndexedGeometry* geometry = dynamic_cast<IIndexedGeometry*>(renderable);
-            if (geometry)
-            {
-                // Gets the vertices from the renderable and fills the VBO with them
-                const std::vector<Vertex>& vertexData = geometry->GetVertices();
-
-                // Fills data VBO with the vertices
-                for (i = 0; (i < vertexData.size()); i++)
-                {
-                    // Stores vertex position
-                    vboData[dataVBOIndex++] = vertexData[i].position.x;
-                    vboData[dataVBOIndex++] = vertexData[i].position.y;
-                    vboData[dataVBOIndex++] = vertexData[i].position.z;
-                    // Stores texture coordinates
-                    vboData[dataVBOIndex++] = vertexData[i].texCoord.x;
-                    vboData[dataVBOIndex++] = vertexData[i].texCoord.y;
-                    // Stores normals
-                    vboData[dataVBOIndex++] = vertexData[i].normal.x;
-                    vboData[dataVBOIndex++] = vertexData[i].normal.y;
-                    vboData[dataVBOIndex++] = vertexData[i].normal.z;
-                }
-
-
-                // Gets the triangles from the renderable
-                const std::vector<Triangle>& triangleData = geometry->GetFaces();
-
-                // Now fills the index VBO with the indices from the triangles
-                for (i = 0; (i < triangleData.size()); i++)
-                {
-                    // Stores vertex indices
-                    indexVBOData[elementVBOIndex++] = triangleData[i].v1;
-                    indexVBOData[elementVBOIndex++] = triangleData[i].v2;
-                    indexVBOData[elementVBOIndex++] = triangleData[i].v3;
-
-                    // Increases the amount of indices, so it draws all three of the triangle's points
-                    amount += 3;
-                    // Also increases the total triangle number
-                    triangleNumber++;
-                }
-            }
-
-            // Processes all the group's renderables too
-            IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
-            if (group)
-            {
-                for (i = 0; (i < group->GetAmountOfRenderables()); i++)
-                {
-                    if (group->GetRenderable(i) != NULL)
-                    {
-                        ProcessRenderable(group->GetRenderable(i), dataVBOIndex, elementVBOIndex, triangleNumber);
-                    }
-                }
-            }
-
-            // Sets the amount of elements this object will draw to the amount of indices from this object
-            indices.amount = amount;
-            arrayIndices.push_back(indices);
-        }
-
-
-        void IndexedVBORenderer::Update()
-        {
-            // Gets the size the updated buffers will need to be
-            int dataVBOMemorySize = 0;
-            int indexVBOMemorySize = 0;
-
-            /* Iterates through all renderables, adding their memory size (for vertex
-             * data) to the total. */
-            for (unsigned int i = 0; (i < renderables.size()); i++)
-            {
-                dataVBOMemorySize += renderables[i]->GetMemorySize();
-
-                /* Checks if renderable contains indexed geometry. If it does, then it
-                 * adds the memory size of all the renderable's triangles to total of
-                 * the index VBO. */
-                IIndexedGeometry* geometry  = dynamic_cast<IIndexedGeometry*>(renderables[i]);
-                if (geometry)
-                {
-                    indexVBOMemorySize += geometry->GetTriangleMemorySize();
-                }
-            }
-
-
-            // Binds the renderer's data and index buffers to make them active
-            glBindBuffer(GL_ARRAY_BUFFER, dataVBO);
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexVBO);
-            // Clears VBOs and specifies how the data in the arrays will be packed
-            glBufferData(GL_ARRAY_BUFFER, dataVBOMemorySize, NULL, GL_DYNAMIC_DRAW);
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexVBOMemorySize, NULL, GL_DYNAMIC_DRAW);
-
-            /* If memory sizes of either data or indices is 0, just return since
-             * there is nothing to update. */
-            if (dataVBOMemorySize == 0 || indexVBOMemorySize == 0) return;
-
-            // Gets pointers to data and index VBOs to put our values into
-            vboData = (float*)glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
-            indexVBOData = (int*)glMapBuffer(GL_ELEMENT_ARRAY_BUFFER, GL_WRITE_ONLY);
-
-
-            // Used for accessing data and index VBOs array's elements
-            unsigned int dataVBOIndex = 0;
-            unsigned int elementVBOIndex = 0;
-            // Used for getting the start index for each renderable's ArrayIndices struct
-            unsigned int triangleNumber = 0;
-
-            // Clears the std::vector of its array indices and reserves needed amount of memory
-            arrayIndices.clear();
-            arrayIndices.reserve(renderables.size());
-
-            /* Processes all the renderables, adding data to the VBO and putting indices to that
-             * data into arrayIndices. */
-            for (unsigned int i = 0; (i < renderables.size()); i++)
-            {
-                if (renderables[i] != NULL)
-                {
-                    ProcessRenderable(renderables[i], dataVBOIndex, elementVBOIndex, triangleNumber);
-                }
-            }
-
-            /* Unmap buffer to send new data to the graphics card. If it returns false, the VBO data
-             * must have got corruped, so throw an exception that is to be caught higher up the chain. */
-            if (!glUnmapBuffer(GL_ARRAY_BUFFER))
-            {
-                throw debug::Exception(
-                    "IndexedVBORenderer::Update - VBO data got corrupted when changing data.");
-            }
-            if (!glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER))
-            {
-                throw debug::Exception(
-                    "IndexedVBORenderer::Update - VBO indices (elements) got corrupted when changing data.");
-            }
-
-            logger->WriteTextAndNewLine(logID, "IndexedVBORenderer successfully updated.");
-        }
-
-
-
-        void IndexedVBORenderer::RenderObject(IRenderable* renderable, unsigned int& index)
-        {
-            try
-            {
-                // If renderable has its own matrix, use it
-                IMatrix* mat = dynamic_cast<IMatrix*>(renderable);
-                if (mat)
-                {
-                    glPushMatrix(); // Stores current matrix
-
-                    // Stores the matrix in the array format that OpenGL requires
-                    float a[16];
-                    mat->GetMatrixAsArray(a);
-
-                    glMultMatrixf(a); // Multiplies matrix by the current one
-                }
-
-
-                // If it is textured, make sure that its texture is bound
-                ISkinned* skinned = dynamic_cast<ISkinned*>(renderable);
-                if (skinned)
-                {
-                    const std::string& skinID = skinned->GetSkinID(); // Gets skin ID from renderable
-
-                    // Makes sure current skin isn't already active
-                    if (renderDevice->GetCurrentSkinID() != skinID)
-                    {
-                        // Then makes the skin active
-                        renderDevice->SetActiveSkin(skinID);
-                    }
-                }
-
-
-                // If the renderable has INDEXED geometry, draw the arrays with the correct indexes!
-                IIndexedGeometry* geometry = dynamic_cast<IIndexedGeometry*>(renderable);
-                if (geometry)
-                {
-                    /* NOTE: Getting primitive type of the renderable is not needed here because
-                     * all indexed geometry are assumed to be triangles. */
-
-                    general::ArrayIndices indices = arrayIndices[index]; // Gets indices for this renderable
-
-                    // Draws the vertices using the indices of the renderable's triangles
-                    glDrawRangeElements(
-                        GL_TRIANGLES, indices.start, (indices.start + indices.amount) - 1,
-                        indices.amount, GL_UNSIGNED_INT, 0);
-
-                }
-
-
-                // If it's a group renderable, render all of its child objects
-                IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
-                if (group)
-                {
-                    for (unsigned int i = 0; (i < group->GetAmountOfRenderables()); i++)
-                    {
-                        if (group->GetRenderable(i) != NULL)
-                        {
-                            RenderObject(group->GetRenderable(i), index);
-                        }
-                    }
-                }
-
-
-                // After rendering, restore previous matrix if needed
-                if (mat)
-                {
-                    glPopMatrix();
-                }
-            }
-            catch (debug::Exception& ex)
-            {
-                ex.PrintMessage();
-            }
-            catch (std::exception& ex)
-            {
-                std::cout << ex.what() << std::endl;
-            }
-            catch (...)
-            {
-                std::cout
-                    << "IndexedVBORenderer - Renderable# " << (index + 1) << " failed to render for unknown reasons!"
-                    << std::endl;
-            }
-
-            // Increases the index of the arrayIndices
-            index++;
-        }
-
-
-        void IndexedVBORenderer::Render()
-        {
-            // Bind the data and index VBOs
-            glBindBuffer(GL_ARRAY_BUFFER, dataVBO);
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexVBO);
-
-
-            // Calculates offsets for array
-            unsigned int vertexOffset = 0,
-                texCoordOffset = sizeof(vector3f),
-                normalOffset = sizeof(vector3f) + sizeof(vector2f);
-            // Points to the vertex arrays in the VBO
-            glVertexPointer(3, GL_FLOAT, sizeof(Vertex), (GLvoid*)vertexOffset);
-            glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), (GLvoid*)texCoordOffset);
-            glNormalPointer(GL_FLOAT, sizeof(Vertex), (GLvoid*)normalOffset);
-
-
-            // Makes sure vertex arrays are enabled
-            if (!glIsEnabled(GL_VERTEX_ARRAY)) glEnableClientState(GL_VERTEX_ARRAY);
-            if (!glIsEnabled(GL_TEXTURE_COORD_ARRAY)) glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-            if (!glIsEnabled(GL_NORMAL_ARRAY)) glEnableClientState(GL_NORMAL_ARRAY);
-
-            // Used for accessing arrayIndices
-            unsigned int index = 0;
-            // Renders every object
-            for (unsigned int i = 0; (i < renderables.size()); i++)
-            {
-                if (renderables[i] != NULL)
-                {
-                    RenderObject(renderables[i], index);
-                }
-            }
-
-
-            // Unbinds the buffers and returns to client mode
-            glBindBuffer(GL_ARRAY_BUFFER, 0);
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-
-            logger->WriteTextAndNewLine(logID, "IndexedVBORenderer draws objects stored.");
-        }
-
-    }
-
-}
+/*
+ * File:   IndexedVBORenderer.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on March 28, 2009, 10:12 AM
+ * Changed to draw opaque objects first and sort translucent ones on October 19, 2026, 4:40 AM
+ */
+
+#include "IndexedVBORenderer.h"
+
+namespace parcel
+{
+
+    using namespace maths;
+
+    namespace graphics
+    {
+
+        IndexedVBORenderer::IndexedVBORenderer(RenderDevice* renderDevice, debug::Logger* log,
+            const bool& willDeleteAll) :
+            // Initialiser list
+            ARenderer(log, "IndexedVBORenderer", willDeleteAll), // Superclass constructor
+            dataVBO(0), indexVBO(0),
+            vboData(NULL), indexVBOData(NULL),
+            renderDevice(renderDevice), backend(renderDevice->GetBackend())
+        {
+            // Stores the currently bound buffers (or 0 for no buffer)
+            unsigned int arrBuffer = backend->GetBoundBuffer(BUFFERTARGET_ARRAY);
+            unsigned int elemBuffer = backend->GetBoundBuffer(BUFFERTARGET_ELEMENTARRAY);
+
+            // Creates the data and index (element) VBOs and stores IDs in appropriate variables
+            backend->GenerateBuffers(2, &dataVBO);
+            // Data VBO
+            backend->BindBuffer(BUFFERTARGET_ARRAY, dataVBO);
+            backend->BufferData(BUFFERTARGET_ARRAY, 0, NULL);
+            // Index VBO
+            backend->BindBuffer(BUFFERTARGET_ELEMENTARRAY, indexVBO);
+            backend->BufferData(BUFFERTARGET_ELEMENTARRAY, 0, NULL);
+
+            /* Makes sure to re-bind the buffers that were active BEFORE creating the buffers
+             * for this renderer. */
+            backend->BindBuffer(BUFFERTARGET_ARRAY, arrBuffer);
+            backend->BindBuffer(BUFFERTARGET_ELEMENTARRAY, elemBuffer);
+
+            logger->WriteTextAndNewLine(logID, "IndexedVBORenderer created.");
+        }
+
+
+        IndexedVBORenderer::~IndexedVBORenderer()
+        {
+            // Deletes both VBOs
+            backend->DeleteBuffers(2, &dataVBO);
+
+            logger->WriteTextAndNewLine(logID, "IndexedVBORenderer destroyed.");
+        }
+
+
+        void IndexedVBORenderer::ProcessRenderable(IRenderable* renderable,
+            unsigned int& dataVBOIndex, unsigned int& elementVBOIndex,
+            unsigned int& triangleNumber)
+        {
+            /* Stores start and end of this renderable's triangles in the INDEX
+             * (element) VBO array. */
+            general::ArrayIndices indices;
+            // Sets the start of the triangles
+            indices.start = elementVBOIndex;
+
+            unsigned int i; // Iterator for the loops
+            unsigned int amount = 0; // The amount of triangles this renderable has to draw
+            AABB bounds; // Box around the renderable's vertices
+
+
+            // If renderable holds geometry and triangle face data
+            IIndexedGeometry* geometry = dynamic_cast<IIndexedGeometry*>(renderable);
+            if (geometry)
+            {
+                // Gets the vertices from the renderable and fills the VBO with them
+                const std::vector<Vertex>& vertexData = geometry->GetVertices();
+
+                // Fills data VBO with the vertices
+                for (i = 0; (i < vertexData.size()); i++)
+                {
+                    // Stores vertex position
+                    vboData[dataVBOIndex++] = vertexData[i].position.x;
+                    vboData[dataVBOIndex++] = vertexData[i].position.y;
+                    vboData[dataVBOIndex++] = vertexData[i].position.z;
+                    // Stores texture coordinates
+                    vboData[dataVBOIndex++] = vertexData[i].texCoord.x;
+                    vboData[dataVBOIndex++] = vertexData[i].texCoord.y;
+                    // Stores normals
+                    vboData[dataVBOIndex++] = vertexData[i].normal.x;
+                    vboData[dataVBOIndex++] = vertexData[i].normal.y;
+                    vboData[dataVBOIndex++] = vertexData[i].normal.z;
+                    bounds.Expand(vertexData[i].position);
+                }
+
+
+                // Gets the triangles from the renderable
+                const std::vector<Triangle>& triangleData = geometry->GetFaces();
+
+                // Now fills the index VBO with the indices from the triangles
+                for (i = 0; (i < triangleData.size()); i++)
+                {
+                    // Stores vertex indices
+                    indexVBOData[elementVBOIndex++] = triangleData[i].v1;
+                    indexVBOData[elementVBOIndex++] = triangleData[i].v2;
+                    indexVBOData[elementVBOIndex++] = triangleData[i].v3;
+
+                    // Increases the amount of indices, so it draws all three of the triangle's points
+                    amount += 3;
+                    // Also increases the total triangle number
+                    triangleNumber++;
+                }
+            }
+
+            /* Sets the amount of elements this object will draw to the amount of indices from this
+             * object. This is done before the group's renderables are processed, since rendering and
+             * recording go through a group before its renderables too. */
+            indices.amount = amount;
+            arrayIndices.push_back(indices);
+            localBounds.push_back(bounds);
+
+            // Processes all the group's renderables too
+            IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
+            if (group)
+            {
+                for (i = 0; (i < group->GetAmountOfRenderables()); i++)
+                {
+                    if (group->GetRenderable(i) != NULL)
+                    {
+                        ProcessRenderable(group->GetRenderable(i), dataVBOIndex, elementVBOIndex, triangleNumber);
+                    }
+                }
+            }
+        }
+
+
+        void IndexedVBORenderer::Update()
+        {
+            // Gets the size the updated buffers will need to be
+            int dataVBOMemorySize = 0;
+            int indexVBOMemorySize = 0;
+
+            /* Iterates through all renderables, adding their memory size (for vertex
+             * data) to the total. */
+            for (unsigned int i = 0; (i < renderables.size()); i++)
+            {
+                dataVBOMemorySize += renderables[i]->GetMemorySize();
+
+                /* Checks if renderable contains indexed geometry. If it does, then it
+                 * adds the memory size of all the renderable's triangles to total of
+                 * the index VBO. */
+                IIndexedGeometry* geometry  = dynamic_cast<IIndexedGeometry*>(renderables[i]);
+                if (geometry)
+                {
+                    indexVBOMemorySize += geometry->GetTriangleMemorySize();
+                }
+            }
+
+
+            // Binds the renderer's data and index buffers to make them active
+            backend->BindBuffer(BUFFERTARGET_ARRAY, dataVBO);
+            backend->BindBuffer(BUFFERTARGET_ELEMENTARRAY, indexVBO);
+            // Clears VBOs and specifies how the data in the arrays will be packed
+            backend->BufferData(BUFFERTARGET_ARRAY, dataVBOMemorySize, NULL);
+            backend->BufferData(BUFFERTARGET_ELEMENTARRAY, indexVBOMemorySize, NULL);
+
+            /* If memory sizes of either data or indices is 0, just return since
+             * there is nothing to update. */
+            if (dataVBOMemorySize == 0 || indexVBOMemorySize == 0) return;
+
+            // Gets pointers to data and index VBOs to put our values into
+            vboData = (float*)backend->MapBuffer(BUFFERTARGET_ARRAY);
+            indexVBOData = (int*)backend->MapBuffer(BUFFERTARGET_ELEMENTARRAY);
+
+
+            // Used for accessing data and index VBOs array's elements
+            unsigned int dataVBOIndex = 0;
+            unsigned int elementVBOIndex = 0;
+            // Used for getting the start index for each renderable's ArrayIndices struct
+            unsigned int triangleNumber = 0;
+
+            // Clears the std::vector of its array indices and reserves needed amount of memory
+            arrayIndices.clear();
+            arrayIndices.reserve(renderables.size());
+            renderableIndices.clear();
+            renderableIndices.reserve(renderables.size());
+            localBounds.clear();
+            localBounds.reserve(renderables.size());
+
+            /* Processes all the renderables, adding data to the VBO and putting indices to that
+             * data into arrayIndices. */
+            for (unsigned int i = 0; (i < renderables.size()); i++)
+            {
+                // Remembers where this renderable's indices start
+                renderableIndices.push_back(arrayIndices.size());
+
+                if (renderables[i] != NULL)
+                {
+                    ProcessRenderable(renderables[i], dataVBOIndex, elementVBOIndex, triangleNumber);
+                }
+            }
+
+            /* Unmap buffer to send new data to the graphics card. If it returns false, the VBO data
+             * must have got corruped, so throw an exception that is to be caught higher up the chain. */
+            if (!backend->UnmapBuffer(BUFFERTARGET_ARRAY))
+            {
+                throw debug::Exception(
+                    "IndexedVBORenderer::Update - VBO data got corrupted when changing data.");
+            }
+            if (!backend->UnmapBuffer(BUFFERTARGET_ELEMENTARRAY))
+            {
+                throw debug::Exception(
+                    "IndexedVBORenderer::Update - VBO indices (elements) got corrupted when changing data.");
+            }
+
+            logger->WriteTextAndNewLine(logID, "IndexedVBORenderer successfully updated.");
+        }
+
+
+
+        void IndexedVBORenderer::GatherObject(IRenderable* renderable, const float* parentMatrix, bool transformed,
+            SkinHandle skin, unsigned int& index)
+        {
+            // Stays the parent's matrix unless the renderable has its own
+            const float* matrix = parentMatrix;
+            float combined[16];
+
+            try
+            {
+                // If renderable has its own matrix, combine it with its parent's
+                IMatrix* mat = dynamic_cast<IMatrix*>(renderable);
+                if (mat)
+                {
+                    float a[16];
+                    mat->GetMatrixAsArray(a);
+                    general::MultiplyMatrixArrays(parentMatrix, a, combined);
+                    matrix = combined;
+                    transformed = true;
+                }
+
+                // Its children use its skin if it has one, otherwise they use the parent's
+                ISkinned* skinned = dynamic_cast<ISkinned*>(renderable);
+                if (skinned)
+                {
+                    skin = skinned->GetSkinHandle();
+                }
+
+
+                // If the renderable has INDEXED geometry, add it to the items to draw
+                IIndexedGeometry* geometry = dynamic_cast<IIndexedGeometry*>(renderable);
+                if (geometry)
+                {
+                    // A skin that can't be found gets an error message from SetActiveSkin(), so it's just treated as opaque here
+                    bool translucent = false;
+                    if (skin != invalidHandle)
+                    {
+                        try { translucent = renderDevice->GetSkinManager()->IsSkinTranslucent(skin); }
+                        catch (debug::Exception&) { }
+                    }
+
+                    std::vector<DrawItem>& items = (translucent) ? translucentItems : opaqueItems;
+                    items.push_back(DrawItem());
+                    DrawItem& item = items.back();
+                    for (unsigned int i = 0; (i < 16); i++) item.matrix[i] = matrix[i];
+                    item.transformed = transformed;
+                    item.skin = skin;
+                    item.start = arrayIndices[index].start;
+                    item.amount = arrayIndices[index].amount;
+                    if (translucent) item.centre = localBounds[index].GetTransformedCentre(matrix);
+                }
+            }
+            catch (debug::Exception& ex)
+            {
+                ex.PrintMessage();
+            }
+            catch (std::exception& ex)
+            {
+                std::cout << ex.what() << std::endl;
+            }
+            catch (...)
+            {
+                std::cout
+                    << "IndexedVBORenderer - Renderable# " << (index + 1) << " failed to render for unknown reasons!"
+                    << std::endl;
+            }
+
+            // Increases the index of the arrayIndices
+            index++;
+
+
+            // If it's a group renderable, gather all of its child objects
+            IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
+            if (group)
+            {
+                for (unsigned int i = 0; (i < group->GetAmountOfRenderables()); i++)
+                {
+                    if (group->GetRenderable(i) != NULL)
+                    {
+                        GatherObject(group->GetRenderable(i), matrix, transformed, skin, index);
+                    }
+                }
+            }
+        }
+
+
+        void IndexedVBORenderer::DrawObject(const DrawItem& item)
+        {
+            // Makes sure the item's skin is active, if it has one
+            if (item.skin != invalidHandle && renderDevice->GetCurrentSkin() != item.skin)
+            {
+                renderDevice->SetActiveSkin(item.skin);
+            }
+
+            // Objects that aren't transformed at all don't need to touch the matrix stack
+            if (item.transformed)
+            {
+                backend->PushMatrix(); // Stores current matrix
+                backend->MultiplyMatrix(item.matrix); // Multiplies matrix by the current one
+            }
+
+            /* NOTE: Getting primitive type of the renderable is not needed here because
+             * all indexed geometry are assumed to be triangles. */
+            backend->DrawElements(PRIMITIVETYPE_TRIANGLE, item.start, item.amount);
+
+            // After rendering, restore previous matrix if needed
+            if (item.transformed)
+            {
+                backend->PopMatrix();
+            }
+        }
+
+
+        void IndexedVBORenderer::Render()
+        {
+            // Gathers every object, starting with no transformation and no skin
+            opaqueItems.clear();
+            translucentItems.clear();
+            float identity[16] = { 1.0f, 0.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f, 0.0f,
+                                   0.0f, 0.0f, 1.0f, 0.0f,  0.0f, 0.0f, 0.0f, 1.0f };
+            unsigned int index = 0;
+            for (unsigned int i = 0; (i < renderables.size()); i++)
+            {
+                if (renderables[i] != NULL)
+                {
+                    GatherObject(renderables[i], identity, false, invalidHandle, index);
+                }
+            }
+
+
+            // Bind the data and index VBOs
+            backend->BindBuffer(BUFFERTARGET_ARRAY, dataVBO);
+            backend->BindBuffer(BUFFERTARGET_ELEMENTARRAY, indexVBO);
+
+
+            // Calculates offsets for array
+            unsigned int vertexOffset = 0,
+                texCoordOffset = sizeof(vector3f),
+                normalOffset = sizeof(vector3f) + sizeof(vector2f);
+            // Points to the vertex arrays in the VBO
+            backend->SetVertexPointer(3, sizeof(Vertex), (void*)vertexOffset);
+            backend->SetTexCoordPointer(2, sizeof(Vertex), (void*)texCoordOffset);
+            backend->SetNormalPointer(sizeof(Vertex), (void*)normalOffset);
+
+
+            // Makes sure vertex arrays are enabled
+            if (!backend->IsClientArrayEnabled(CLIENTARRAY_VERTEX)) backend->EnableClientArray(CLIENTARRAY_VERTEX);
+            if (!backend->IsClientArrayEnabled(CLIENTARRAY_TEXCOORD)) backend->EnableClientArray(CLIENTARRAY_TEXCOORD);
+            if (!backend->IsClientArrayEnabled(CLIENTARRAY_NORMAL)) backend->EnableClientArray(CLIENTARRAY_NORMAL);
+
+
+            // Opaque objects don't need blending, which saves paying for it on most of the screen
+            backend->Disable(CAPABILITY_BLEND);
+            for (unsigned int i = 0; (i < opaqueItems.size()); i++)
+            {
+                DrawObject(opaqueItems[i]);
+            }
+            backend->Enable(CAPABILITY_BLEND);
+
+
+            /* Translucent objects are drawn from back to front, by the z of the centre of their
+             * vertices in view space (the smallest z is the furthest away). */
+            if (!translucentItems.empty())
+            {
+                float view[16];
+                renderDevice->GetViewMatrix().ToArray(view);
+
+                depths.resize(translucentItems.size());
+                for (unsigned int i = 0; (i < translucentItems.size()); i++)
+                {
+                    const vector3f& c = translucentItems[i].centre;
+                    depths[i] = (view[2] * c.x) + (view[6] * c.y) + (view[10] * c.z) + view[14];
+                }
+
+                const std::vector<unsigned int>& order = depthSorter.Sort(&depths[0], depths.size());
+                for (unsigned int i = 0; (i < order.size()); i++)
+                {
+                    DrawObject(translucentItems[order[i]]);
+                }
+            }
+
+
+            // Unbinds the buffers and returns to client mode
+            backend->BindBuffer(BUFFERTARGET_ARRAY, 0);
+            backend->BindBuffer(BUFFERTARGET_ELEMENTARRAY, 0);
+
+            logger->WriteTextAndNewLine(logID, "IndexedVBORenderer draws objects stored.");
+        }
+
+
+        void IndexedVBORenderer::RecordObject(IRenderable* renderable, CommandBuffer& buffer, unsigned int& index)
+        {
+            /* Takes this object's slot in arrayIndices before its children take theirs, the same
+             * order GatherObject() fills them in. */
+            unsigned int objectIndex = index++;
+
+            try
+            {
+                // If renderable has its own matrix, use it
+                IMatrix* mat = dynamic_cast<IMatrix*>(renderable);
+                if (mat)
+                {
+                    float a[16];
+                    mat->GetMatrixAsArray(a);
+                    buffer.PushMatrix(a);
+                }
+
+                // If it is textured, make sure that its texture is bound
+                ISkinned* skinned = dynamic_cast<ISkinned*>(renderable);
+                if (skinned)
+                {
+                    buffer.SetSkin(skinned->GetSkinHandle());
+                }
+
+                // If the renderable has INDEXED geometry, draw the elements with the correct indexes
+                IIndexedGeometry* geometry = dynamic_cast<IIndexedGeometry*>(renderable);
+                if (geometry)
+                {
+                    buffer.DrawElements(arrayIndices[objectIndex].start, arrayIndices[objectIndex].amount);
+                }
+
+                // If it's a group renderable, record all of its child objects
+                IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
+                if (group)
+                {
+                    for (unsigned int i = 0; (i < group->GetAmountOfRenderables()); i++)
+                    {
+                        if (group->GetRenderable(i) != NULL)
+                        {
+                            RecordObject(group->GetRenderable(i), buffer, index);
+                        }
+                    }
+                }
+
+                // After rendering, restore previous matrix if needed
+                if (mat)
+                {
+                    buffer.PopMatrix();
+                }
+            }
+            catch (debug::Exception& ex)
+            {
+                ex.PrintMessage();
+            }
+            catch (std::exception& ex)
+            {
+                std::cout << ex.what() << std::endl;
+            }
+            catch (...)
+            {
+                std::cout
+                    << "IndexedVBORenderer - Renderable# " << (objectIndex + 1) << " failed to record for unknown reasons!"
+                    << std::endl;
+            }
+        }
+
+
+        void IndexedVBORenderer::RecordCommands(CommandBuffer& buffer, unsigned int first, unsigned int last)
+        {
+            // Makes sure the range is inside the renderables that were processed in Update()
+            if (last > renderableIndices.size()) last = renderableIndices.size();
+            if (first >= last) return;
+
+            // Every range binds both VBOs itself, so buffers can be submitted in any order
+            buffer.BindGeometry(dataVBO, indexVBO, VERTEXLAYOUT_VERTEX);
+
+            unsigned int index = renderableIndices[first];
+            for (unsigned int i = first; (i < last); i++)
+            {
+                if (renderables[i] != NULL)
+                {
+                    RecordObject(renderables[i], buffer, index);
+                }
+            }
+        }
+
+    }
+
+}
@@ -0,0 +1,213 @@
+/*
+ * File:   LightClusters.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 11:30 PM
+ */
+
+#include <cmath>
+#include "LightClusters.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    LightClusterGrid::LightClusterGrid(const ClusterGridSettings& gridSettings) :
+        settings(gridSettings), nearDistance(0.0f), farDistance(0.0f), sliceScale(0.0f), sliceBias(0.0f),
+        currentLights(NULL)
+    {
+        if (settings.tilesX == 0 || settings.tilesY == 0 || settings.slices == 0)
+        {
+            throw debug::InvalidArgumentException("LightClusterGrid - Grid dimensions must be above zero.");
+        }
+
+        sliceBins.resize(settings.slices);
+        for (unsigned int i = 0; (i < settings.slices); i++)
+        {
+            sliceBins[i].counts.resize(settings.tilesX * settings.tilesY);
+        }
+        clusterRanges.resize(GetAmountOfClusters() * 2, 0);
+    }
+
+
+    void LightClusterGrid::SetProjection(float tanHalfFovX, float tanHalfFovY, float near, float far)
+    {
+        if (near <= 0.0f || far <= near)
+        {
+            throw debug::InvalidArgumentException(
+                "LightClusterGrid::SetProjection - Near distance must be above zero and below the far distance.");
+        }
+        if (tanHalfFovX <= 0.0f || tanHalfFovY <= 0.0f)
+        {
+            throw debug::InvalidArgumentException("LightClusterGrid::SetProjection - Fields of view must be above zero.");
+        }
+
+        nearDistance = near;
+        farDistance = far;
+
+        // slice = log(depth / near) / log(far / near) * slices, split into a scale and bias for shaders
+        float logRatio = std::log(far / near);
+        sliceScale = static_cast<float>(settings.slices) / logRatio;
+        sliceBias = -static_cast<float>(settings.slices) * std::log(near) / logRatio;
+
+        sliceDepths.resize(settings.slices + 1);
+        for (unsigned int i = 0; (i <= settings.slices); i++)
+        {
+            sliceDepths[i] = near * std::pow(far / near, static_cast<float>(i) / settings.slices);
+        }
+        sliceDepths[settings.slices] = far;
+
+        /* At a distance d, the screen covers -d * tan to d * tan along each axis. A cluster's
+         * sides slope outwards, so its box is the widest of its front and back edges. */
+        columnBounds.resize(settings.slices * settings.tilesX * 2);
+        rowBounds.resize(settings.slices * settings.tilesY * 2);
+        for (unsigned int slice = 0; (slice < settings.slices); slice++)
+        {
+            float front = sliceDepths[slice], back = sliceDepths[slice + 1];
+
+            for (unsigned int axis = 0; (axis < 2); axis++)
+            {
+                unsigned int tiles = (axis == 0) ? settings.tilesX : settings.tilesY;
+                float tangent = (axis == 0) ? tanHalfFovX : tanHalfFovY;
+                float* bounds = (axis == 0) ? &columnBounds[slice * tiles * 2] : &rowBounds[slice * tiles * 2];
+
+                for (unsigned int tile = 0; (tile < tiles); tile++)
+                {
+                    float low = -1.0f + ((2.0f * tile) / tiles);
+                    float high = -1.0f + ((2.0f * (tile + 1)) / tiles);
+                    float lowFront = low * front * tangent, lowBack = low * back * tangent;
+                    float highFront = high * front * tangent, highBack = high * back * tangent;
+                    bounds[tile * 2] = (lowFront < lowBack) ? lowFront : lowBack;
+                    bounds[(tile * 2) + 1] = (highFront > highBack) ? highFront : highBack;
+                }
+            }
+        }
+    }
+
+    void LightClusterGrid::SetProjection(const float* m)
+    {
+        /* For a perspective matrix, m[0] is 1 / (aspect * tan), m[5] is 1 / tan, and the near
+         * and far distances can be worked back out of m[10] = (f + n) / (n - f) and
+         * m[14] = 2fn / (n - f). */
+        if (m[0] == 0.0f || m[5] == 0.0f || m[10] == 1.0f || m[10] == -1.0f)
+        {
+            throw debug::InvalidArgumentException("LightClusterGrid::SetProjection - Matrix is not a perspective projection.");
+        }
+        SetProjection(1.0f / m[0], 1.0f / m[5], m[14] / (m[10] - 1.0f), m[14] / (m[10] + 1.0f));
+    }
+
+    unsigned int LightClusterGrid::GetSlice(float depth) const
+    {
+        if (depth <= nearDistance) return 0;
+        int slice = static_cast<int>((std::log(depth) * sliceScale) + sliceBias);
+        if (slice < 0) return 0;
+        if (slice >= static_cast<int>(settings.slices)) return settings.slices - 1;
+        return static_cast<unsigned int>(slice);
+    }
+
+
+    void LightClusterGrid::Bin(const std::vector<ClusterLight>& lights, general::ThreadPool* pool)
+    {
+        if (sliceDepths.empty())
+        {
+            throw debug::Exception("LightClusterGrid::Bin - SetProjection() has not been called.");
+        }
+
+        currentLights = &lights;
+        if (pool) pool->Dispatch(this, settings.slices);
+        else for (unsigned int i = 0; (i < settings.slices); i++) Execute(i, 0);
+        currentLights = NULL;
+
+        // Joins every slice's indices together, moving each slice's offsets along
+        unsigned int total = 0;
+        for (unsigned int slice = 0; (slice < settings.slices); slice++) total += sliceBins[slice].indices.size();
+        lightIndices.resize(total);
+
+        unsigned int clustersPerSlice = settings.tilesX * settings.tilesY;
+        unsigned int offset = 0;
+        for (unsigned int slice = 0; (slice < settings.slices); slice++)
+        {
+            const SliceBins& bins = sliceBins[slice];
+            for (unsigned int i = 0; (i < bins.indices.size()); i++) lightIndices[offset + i] = bins.indices[i];
+
+            unsigned int* ranges = &clusterRanges[slice * clustersPerSlice * 2];
+            for (unsigned int cluster = 0; (cluster < clustersPerSlice); cluster++)
+            {
+                ranges[cluster * 2] = offset;
+                ranges[(cluster * 2) + 1] = bins.counts[cluster];
+                offset += bins.counts[cluster];
+            }
+        }
+    }
+
+    void LightClusterGrid::Execute(unsigned int slice, unsigned int /*threadIndex*/)
+    {
+        const std::vector<ClusterLight>& lights = *currentLights;
+        SliceBins& bins = sliceBins[slice];
+        bins.hitClusters.clear();
+        bins.hitLights.clear();
+        for (unsigned int i = 0; (i < bins.counts.size()); i++) bins.counts[i] = 0;
+
+        float front = sliceDepths[slice], back = sliceDepths[slice + 1];
+        const float* columns = &columnBounds[slice * settings.tilesX * 2];
+        const float* rows = &rowBounds[slice * settings.tilesY * 2];
+
+        /* Tests each light's sphere against the boxes of the clusters in the slice. The
+         * distance from the centre to a box is worked out one axis at a time, so a whole
+         * slice, column or row can be skipped as soon as it's too far away. */
+        for (unsigned int light = 0; (light < lights.size()); light++)
+        {
+            const ClusterLight& l = lights[light];
+            float sqrRadius = l.radius * l.radius;
+
+            float depth = -l.z;
+            float dz = 0.0f;
+            if (depth < front) dz = front - depth;
+            else if (depth > back) dz = depth - back;
+            float sqrDistanceZ = dz * dz;
+            if (sqrDistanceZ > sqrRadius) continue;
+
+            for (unsigned int x = 0; (x < settings.tilesX); x++)
+            {
+                float dx = 0.0f;
+                if (l.x < columns[x * 2]) dx = columns[x * 2] - l.x;
+                else if (l.x > columns[(x * 2) + 1]) dx = l.x - columns[(x * 2) + 1];
+                float sqrDistanceXZ = sqrDistanceZ + (dx * dx);
+                if (sqrDistanceXZ > sqrRadius) continue;
+
+                for (unsigned int y = 0; (y < settings.tilesY); y++)
+                {
+                    float dy = 0.0f;
+                    if (l.y < rows[y * 2]) dy = rows[y * 2] - l.y;
+                    else if (l.y > rows[(y * 2) + 1]) dy = l.y - rows[(y * 2) + 1];
+                    if (sqrDistanceXZ + (dy * dy) > sqrRadius) continue;
+
+                    unsigned int cluster = x + (settings.tilesX * y);
+                    bins.hitClusters.push_back(cluster);
+                    bins.hitLights.push_back(light);
+                    bins.counts[cluster]++;
+                }
+            }
+        }
+
+        // Groups the lights by cluster (a counting sort), keeping them in the order given
+        bins.starts.resize(bins.counts.size());
+        unsigned int start = 0;
+        for (unsigned int i = 0; (i < bins.counts.size()); i++)
+        {
+            bins.starts[i] = start;
+            start += bins.counts[i];
+        }
+        bins.indices.resize(bins.hitLights.size());
+        for (unsigned int i = 0; (i < bins.hitLights.size()); i++)
+        {
+            bins.indices[bins.starts[bins.hitClusters[i]]++] = bins.hitLights[i];
+        }
+    }
+
+}
+
+}
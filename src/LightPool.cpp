@@ -0,0 +1,300 @@
+/*
+ * File:   LightPool.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 1:05 AM
+ */
+
+#include "LightPool.h"
+
+namespace parcel
+{
+
+using namespace maths;
+
+namespace graphics
+{
+
+    namespace
+    {
+
+        bool Same(const vector3f& a, const vector3f& b)
+        {
+            return (a.x == b.x) && (a.y == b.y) && (a.z == b.z);
+        }
+
+    }
+
+
+    LightPool::LightPool() : amountOfAdapters(0), lastHandle(0)
+    {
+    }
+
+
+    unsigned int LightPool::AddEntry()
+    {
+        ++lastHandle;
+        indices.push_back(handles.size());
+
+        handles.push_back(lastHandle);
+        types.push_back(LIGHTTYPE_POSITION);
+        enabled.push_back(1);
+        positions.push_back(vector3f(0.0f, 0.0f, 0.0f));
+        directions.push_back(vector3f(0.0f, 0.0f, -1.0f));
+        ambientColours.push_back(colourf(0.0f, 0.0f, 0.0f, 1.0f));
+        diffuseColours.push_back(colourf(1.0f, 1.0f, 1.0f, 1.0f));
+        specularColours.push_back(colourf(1.0f, 1.0f, 1.0f, 1.0f));
+        attenuations.push_back(vector3f(1.0f, 0.0f, 0.0f));
+        spotCutoffs.push_back(180.0f);
+        spotExponents.push_back(0.0f);
+        versions.push_back(1);
+        adapters.push_back(NULL);
+        adapterVersions.push_back(0);
+        return handles.size() - 1;
+    }
+
+    LightHandle LightPool::Create(LightType type)
+    {
+        unsigned int index = AddEntry();
+        types[index] = type;
+        return handles[index];
+    }
+
+    LightHandle LightPool::AddAdapter(ALight* light)
+    {
+        if (!light) throw debug::NullPointerException("LightPool::AddAdapter - Cannot adapt a NULL light!");
+
+        unsigned int index = AddEntry();
+        adapters[index] = light;
+        ++amountOfAdapters;
+        ReadAdapter(index);
+        return handles[index];
+    }
+
+    void LightPool::Remove(LightHandle handle)
+    {
+        if (!Contains(handle)) return;
+        unsigned int index = indices[handle - 1];
+
+        if (adapters[index]) --amountOfAdapters;
+        handles.erase(handles.begin() + index);
+        types.erase(types.begin() + index);
+        enabled.erase(enabled.begin() + index);
+        positions.erase(positions.begin() + index);
+        directions.erase(directions.begin() + index);
+        ambientColours.erase(ambientColours.begin() + index);
+        diffuseColours.erase(diffuseColours.begin() + index);
+        specularColours.erase(specularColours.begin() + index);
+        attenuations.erase(attenuations.begin() + index);
+        spotCutoffs.erase(spotCutoffs.begin() + index);
+        spotExponents.erase(spotExponents.begin() + index);
+        versions.erase(versions.begin() + index);
+        adapters.erase(adapters.begin() + index);
+        adapterVersions.erase(adapterVersions.begin() + index);
+
+        // The lights after it have moved down one
+        indices[handle - 1] = -1;
+        for (unsigned int i = index; (i < handles.size()); i++) indices[handles[i] - 1] = i;
+    }
+
+    void LightPool::Clear()
+    {
+        for (unsigned int i = 0; (i < handles.size()); i++) indices[handles[i] - 1] = -1;
+        handles.clear();
+        types.clear();
+        enabled.clear();
+        positions.clear();
+        directions.clear();
+        ambientColours.clear();
+        diffuseColours.clear();
+        specularColours.clear();
+        attenuations.clear();
+        spotCutoffs.clear();
+        spotExponents.clear();
+        versions.clear();
+        adapters.clear();
+        adapterVersions.clear();
+        amountOfAdapters = 0;
+    }
+
+
+    void LightPool::Changed(unsigned int index)
+    {
+        ++versions[index];
+        // Versions start at 1, so 0 always means a light hasn't been seen
+        if (versions[index] == 0) versions[index] = 1;
+    }
+
+    void LightPool::SyncAdapters()
+    {
+        if (amountOfAdapters == 0) return;
+
+        for (unsigned int i = 0; (i < adapters.size()); i++)
+        {
+            // Lights that track changes and haven't changed aren't read at all
+            if (!adapters[i]) continue;
+            unsigned int version = adapters[i]->GetVersion();
+            if (version != 0 && version == adapterVersions[i]) continue;
+
+            if (ReadAdapter(i)) Changed(i);
+        }
+    }
+
+    bool LightPool::ReadAdapter(unsigned int index)
+    {
+        ALight* light = adapters[index];
+        unsigned int version = light->GetVersion();
+
+        // Starts from what's there, so values the light's type doesn't have stay the same
+        LightType type = types[index];
+        bool isEnabled = false;
+        vector3f position = positions[index], direction = directions[index], attenuation = attenuations[index];
+        colourf ambient = ambientColours[index], diffuse = diffuseColours[index], specular = specularColours[index];
+        float cutoff = spotCutoffs[index], exponent = spotExponents[index];
+
+        try
+        {
+            isEnabled = light->IsEnabled();
+            if (isEnabled)
+            {
+                type = light->GetType();
+                ambient = light->GetAmbientColour();
+                diffuse = light->GetDiffuseColour();
+                specular = light->GetSpecularColour();
+
+                switch (type)
+                {
+                    case LIGHTTYPE_POSITION:
+                    case LIGHTTYPE_SPOTLIGHT:
+                        position = light->GetPosition();
+                        attenuation = vector3f(light->GetConstantAttenuation(), light->GetLinearAttenuation(),
+                            light->GetQuadraticAttenuation());
+                        if (type == LIGHTTYPE_SPOTLIGHT)
+                        {
+                            direction = light->GetDirection();
+                            cutoff = light->GetSpotlightCutoff();
+                            exponent = light->GetSpotlightFocus();
+                        }
+                        break;
+
+                    case LIGHTTYPE_DIRECTION:
+                        direction = light->GetDirection();
+                        break;
+
+                    default:
+                        throw debug::Exception("LightPool::SyncAdapters() - Cannot recognize this light's type.");
+                }
+            }
+            adapterVersions[index] = version;
+        }
+        // The light stays off and is read again next time
+        catch (debug::Exception&)
+        {
+            isEnabled = false;
+            adapterVersions[index] = 0;
+        }
+
+        unsigned char enabledValue = (isEnabled) ? 1 : 0;
+        bool changed = (enabled[index] != enabledValue);
+        enabled[index] = enabledValue;
+        // Disabled lights keep their values, since nothing reads them
+        if (!isEnabled) return changed;
+
+        changed = changed || (types[index] != type) || !Same(positions[index], position)
+            || !Same(directions[index], direction) || !Same(attenuations[index], attenuation)
+            || (ambientColours[index] != ambient) || (diffuseColours[index] != diffuse)
+            || (specularColours[index] != specular) || (spotCutoffs[index] != cutoff)
+            || (spotExponents[index] != exponent);
+        types[index] = type;
+        positions[index] = position;
+        directions[index] = direction;
+        attenuations[index] = attenuation;
+        ambientColours[index] = ambient;
+        diffuseColours[index] = diffuse;
+        specularColours[index] = specular;
+        spotCutoffs[index] = cutoff;
+        spotExponents[index] = exponent;
+        return changed;
+    }
+
+
+    bool LightPool::Contains(LightHandle handle) const
+    {
+        return (handle != 0) && (handle <= indices.size()) && (indices[handle - 1] >= 0);
+    }
+
+    unsigned int LightPool::IndexOf(LightHandle handle) const
+    {
+        if (!Contains(handle)) throw debug::InvalidArgumentException("LightPool - Light handle is not in the pool!");
+        return indices[handle - 1];
+    }
+
+
+    void LightPool::SetEnabled(LightHandle handle, bool isEnabled)
+    {
+        unsigned int index = IndexOf(handle);
+        unsigned char value = (isEnabled) ? 1 : 0;
+        if (enabled[index] == value) return;
+        enabled[index] = value;
+        Changed(index);
+    }
+
+    void LightPool::SetType(LightHandle handle, LightType type)
+    {
+        unsigned int index = IndexOf(handle);
+        if (types[index] == type) return;
+        types[index] = type;
+        Changed(index);
+    }
+
+    void LightPool::SetPosition(LightHandle handle, const vector3f& position)
+    {
+        unsigned int index = IndexOf(handle);
+        if (Same(positions[index], position)) return;
+        positions[index] = position;
+        Changed(index);
+    }
+
+    void LightPool::SetDirection(LightHandle handle, const vector3f& direction)
+    {
+        unsigned int index = IndexOf(handle);
+        if (Same(directions[index], direction)) return;
+        directions[index] = direction;
+        Changed(index);
+    }
+
+    void LightPool::SetColours(LightHandle handle, const colourf& ambient, const colourf& diffuse,
+        const colourf& specular)
+    {
+        unsigned int index = IndexOf(handle);
+        if (ambientColours[index] == ambient && diffuseColours[index] == diffuse && specularColours[index] == specular)
+        {
+            return;
+        }
+        ambientColours[index] = ambient;
+        diffuseColours[index] = diffuse;
+        specularColours[index] = specular;
+        Changed(index);
+    }
+
+    void LightPool::SetAttenuation(LightHandle handle, float constant, float linear, float quadratic)
+    {
+        unsigned int index = IndexOf(handle);
+        vector3f attenuation(constant, linear, quadratic);
+        if (Same(attenuations[index], attenuation)) return;
+        attenuations[index] = attenuation;
+        Changed(index);
+    }
+
+    void LightPool::SetSpotlight(LightHandle handle, float cutoff, float exponent)
+    {
+        unsigned int index = IndexOf(handle);
+        if (spotCutoffs[index] == cutoff && spotExponents[index] == exponent) return;
+        spotCutoffs[index] = cutoff;
+        spotExponents[index] = exponent;
+        Changed(index);
+    }
+
+}
+
+}
@@ -0,0 +1,367 @@
+/*
+ * File:   LightProbeGrid.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:35 AM
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <xmmintrin.h>
+#include "LightProbeGrid.h"
+#include "MCommon.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+using namespace maths;
+
+namespace graphics
+{
+
+    namespace
+    {
+
+        /* Constant parts of the basis functions. The first is 1 / (2 * sqrt(pi)), which is also
+         * what every direction's first basis function is. */
+        const float shBand0 = 0.282095f;
+        const float shBand1 = 0.488603f;
+        const float shBand2 = 1.092548f;
+        const float shBand2Z = 0.315392f;
+        const float shBand2XY = 0.546274f;
+
+        /* How much each band of the incoming light is kept when it's turned into irradiance
+         * (convolved with the cosine lobe of a diffuse surface). */
+        const float bandConvolution[3] = { static_cast<float>(constants::PI),
+            static_cast<float>(2.0 * constants::PI / 3.0), static_cast<float>(constants::PI / 4.0) };
+        const unsigned int coefficientBands[SHCoefficients::amountOfCoefficients] = { 0, 1, 1, 1, 2, 2, 2, 2, 2 };
+
+        // What's at the start of a saved grid, and the version of the format after it
+        const char fileIdentifier[4] = { 'P', 'L', 'P', 'G' };
+        const unsigned int fileVersion = 1;
+        // Floats saved for each probe, which leaves out the padding
+        const unsigned int savedFloatsPerProbe = SHCoefficients::amountOfCoefficients * 3;
+
+        // Everything in a saved grid before the probes
+        struct GridFileHeader
+        {
+            char identifier[4];
+            unsigned int version;
+            float origin[3];
+            float spacing[3];
+            unsigned int amount[3];
+        };
+
+    }
+
+
+    SHCoefficients::SHCoefficients()
+    {
+        for (unsigned int i = 0; (i < amountOfFloats); i++) values[i] = 0.0f;
+    }
+
+    colourf SHCoefficients::Evaluate(const vector3f& normal) const
+    {
+        float basis[amountOfCoefficients];
+        EvaluateBasis(normal, basis);
+
+        colourf result(0.0f, 0.0f, 0.0f, 1.0f);
+        for (unsigned int i = 0; (i < amountOfCoefficients); i++)
+        {
+            result.r += values[i * 3] * basis[i];
+            result.g += values[(i * 3) + 1] * basis[i];
+            result.b += values[(i * 3) + 2] * basis[i];
+        }
+        // Ringing can take directions facing away from all the light slightly below zero
+        if (result.r < 0.0f) result.r = 0.0f;
+        if (result.g < 0.0f) result.g = 0.0f;
+        if (result.b < 0.0f) result.b = 0.0f;
+        return result;
+    }
+
+    colourf SHCoefficients::GetAverage() const
+    {
+        // The other bands average out to nothing over the sphere
+        return colourf(values[0] * shBand0, values[1] * shBand0, values[2] * shBand0, 1.0f);
+    }
+
+    void SHCoefficients::GetUniformValues(std::vector<vector3f>& uniformValues) const
+    {
+        uniformValues.resize(amountOfCoefficients);
+        for (unsigned int i = 0; (i < amountOfCoefficients); i++)
+        {
+            uniformValues[i] = vector3f(values[i * 3], values[(i * 3) + 1], values[(i * 3) + 2]);
+        }
+    }
+
+    void SHCoefficients::AddDirectional(const vector3f& direction, const colourf& colour)
+    {
+        float basis[amountOfCoefficients];
+        EvaluateBasis(direction, basis);
+        for (unsigned int i = 0; (i < amountOfCoefficients); i++)
+        {
+            float scale = basis[i] * bandConvolution[coefficientBands[i]];
+            values[i * 3] += colour.r * scale;
+            values[(i * 3) + 1] += colour.g * scale;
+            values[(i * 3) + 2] += colour.b * scale;
+        }
+    }
+
+    void SHCoefficients::AddAmbient(const colourf& colour)
+    {
+        values[0] += colour.r / shBand0;
+        values[1] += colour.g / shBand0;
+        values[2] += colour.b / shBand0;
+    }
+
+    void SHCoefficients::EvaluateBasis(const vector3f& direction, float basis[amountOfCoefficients])
+    {
+        float x = direction.x, y = direction.y, z = direction.z;
+        basis[0] = shBand0;
+        basis[1] = shBand1 * y;
+        basis[2] = shBand1 * z;
+        basis[3] = shBand1 * x;
+        basis[4] = shBand2 * x * y;
+        basis[5] = shBand2 * y * z;
+        basis[6] = shBand2Z * ((3.0f * z * z) - 1.0f);
+        basis[7] = shBand2 * x * z;
+        basis[8] = shBand2XY * ((x * x) - (y * y));
+    }
+
+
+    LightProbeGrid::LightProbeGrid() : origin(0.0f, 0.0f, 0.0f), spacing(1.0f, 1.0f, 1.0f)
+    {
+        amount[0] = amount[1] = amount[2] = 0;
+    }
+
+    void LightProbeGrid::Create(const vector3f& gridOrigin, const vector3f& probeSpacing,
+        unsigned int amountX, unsigned int amountY, unsigned int amountZ)
+    {
+        if ((amountX == 0) || (amountY == 0) || (amountZ == 0))
+            throw debug::InvalidArgumentException("LightProbeGrid::Create - "
+                "A light probe grid needs at least one probe along each axis!");
+        if ((probeSpacing.x <= 0.0f) || (probeSpacing.y <= 0.0f) || (probeSpacing.z <= 0.0f))
+            throw debug::InvalidArgumentException("LightProbeGrid::Create - Light probe spacing must be above zero!");
+
+        origin = gridOrigin;
+        spacing = probeSpacing;
+        amount[0] = amountX;
+        amount[1] = amountY;
+        amount[2] = amountZ;
+        probes.assign(amountX * amountY * amountZ * SHCoefficients::amountOfFloats, 0.0f);
+    }
+
+    void LightProbeGrid::Clear()
+    {
+        amount[0] = amount[1] = amount[2] = 0;
+        std::vector<float>().swap(probes);
+    }
+
+    void LightProbeGrid::GetProbe(unsigned int x, unsigned int y, unsigned int z, SHCoefficients& coefficients) const
+    {
+        if ((x >= amount[0]) || (y >= amount[1]) || (z >= amount[2]))
+            throw debug::InvalidArgumentException("LightProbeGrid::GetProbe - Light probe index is out of range!");
+
+        const float* probe = &probes[(((z * amount[1]) + y) * amount[0] + x) * SHCoefficients::amountOfFloats];
+        memcpy(coefficients.values, probe, sizeof(float) * SHCoefficients::amountOfFloats);
+    }
+
+    void LightProbeGrid::SetProbe(unsigned int x, unsigned int y, unsigned int z, const SHCoefficients& coefficients)
+    {
+        if ((x >= amount[0]) || (y >= amount[1]) || (z >= amount[2]))
+            throw debug::InvalidArgumentException("LightProbeGrid::SetProbe - Light probe index is out of range!");
+
+        float* probe = &probes[(((z * amount[1]) + y) * amount[0] + x) * SHCoefficients::amountOfFloats];
+        memcpy(probe, coefficients.values, sizeof(float) * SHCoefficients::amountOfFloats);
+        // The padding is always kept at zero, so blending probes leaves it at zero too
+        probe[SHCoefficients::amountOfFloats - 1] = 0.0f;
+    }
+
+    vector3f LightProbeGrid::GetProbePosition(unsigned int x, unsigned int y, unsigned int z) const
+    {
+        return vector3f(origin.x + (spacing.x * x), origin.y + (spacing.y * y), origin.z + (spacing.z * z));
+    }
+
+    void LightProbeGrid::Locate(const vector3f& position, unsigned int& first, unsigned int steps[3],
+        float weights[3]) const
+    {
+        unsigned int cell[3];
+        unsigned int stride = SHCoefficients::amountOfFloats;
+        for (unsigned int i = 0; (i < 3); i++)
+        {
+            // Points outside the grid are clamped onto its edge
+            float along = (position.values[i] - origin.values[i]) / spacing.values[i];
+            float last = static_cast<float>(amount[i] - 1);
+            if (!(along > 0.0f)) along = 0.0f; // Also catches NaN
+            if (along > last) along = last;
+
+            if (amount[i] == 1)
+            {
+                cell[i] = 0;
+                weights[i] = 0.0f;
+                steps[i] = 0;
+            }
+            else
+            {
+                cell[i] = static_cast<unsigned int>(along);
+                if (cell[i] > amount[i] - 2) cell[i] = amount[i] - 2;
+                weights[i] = along - cell[i];
+                steps[i] = stride;
+            }
+            stride *= amount[i];
+        }
+        first = (((cell[2] * amount[1]) + cell[1]) * amount[0] + cell[0]) * SHCoefficients::amountOfFloats;
+    }
+
+    void LightProbeGrid::Sample(const vector3f& position, SHCoefficients& result) const
+    {
+        SampleBatch(&position, 1, &result);
+    }
+
+    void LightProbeGrid::SampleBatch(const vector3f* positions, unsigned int amountOfPositions,
+        SHCoefficients* results) const
+    {
+        if (amountOfPositions == 0) return;
+        if (probes.empty())
+            throw debug::Exception("LightProbeGrid::SampleBatch - Cannot sample an empty light probe grid!");
+        if ((!positions) || (!results))
+            throw debug::NullPointerException("LightProbeGrid::SampleBatch - "
+                "Cannot sample light probes with NULL arrays!");
+
+        const float* base = &probes[0];
+        for (unsigned int i = 0; (i < amountOfPositions); i++)
+        {
+            unsigned int first, steps[3];
+            float weights[3];
+            Locate(positions[i], first, steps, weights);
+
+            // The eight probes around the point and how much of each is used
+            const float* corners[8];
+            float cornerWeights[8];
+            for (unsigned int j = 0; (j < 8); j++)
+            {
+                unsigned int offset = first;
+                float weight = 1.0f;
+                for (unsigned int axis = 0; (axis < 3); axis++)
+                {
+                    if (j & (1 << axis))
+                    {
+                        offset += steps[axis];
+                        weight *= weights[axis];
+                    }
+                    else
+                    {
+                        weight *= 1.0f - weights[axis];
+                    }
+                }
+                corners[j] = base + offset;
+                cornerWeights[j] = weight;
+            }
+
+            // Blends four coefficient values at a time, seven registers for the whole set
+            __m128 cornerScales[8];
+            for (unsigned int j = 0; (j < 8); j++) cornerScales[j] = _mm_set1_ps(cornerWeights[j]);
+            float* output = results[i].values;
+            for (unsigned int k = 0; (k < SHCoefficients::amountOfFloats); k += 4)
+            {
+                __m128 sum = _mm_mul_ps(_mm_loadu_ps(corners[0] + k), cornerScales[0]);
+                for (unsigned int j = 1; (j < 8); j++)
+                {
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(corners[j] + k), cornerScales[j]));
+                }
+                _mm_storeu_ps(output + k, sum);
+            }
+        }
+    }
+
+    AABB LightProbeGrid::GetBounds() const
+    {
+        if (probes.empty()) return AABB();
+        return AABB(origin, GetProbePosition(amount[0] - 1, amount[1] - 1, amount[2] - 1));
+    }
+
+    bool LightProbeGrid::SaveToFile(const std::string& filename) const
+    {
+        if (probes.empty()) return false;
+
+        FILE* file = fopen(filename.c_str(), "wb");
+        if (!file) return false;
+
+        GridFileHeader header;
+        memcpy(header.identifier, fileIdentifier, sizeof(fileIdentifier));
+        header.version = fileVersion;
+        for (unsigned int i = 0; (i < 3); i++)
+        {
+            header.origin[i] = origin.values[i];
+            header.spacing[i] = spacing.values[i];
+            header.amount[i] = amount[i];
+        }
+        bool written = (fwrite(&header, 1, sizeof(GridFileHeader), file) == sizeof(GridFileHeader));
+
+        // The padding isn't saved
+        unsigned int amountOfProbes = GetAmountOfProbes();
+        for (unsigned int i = 0; (written) && (i < amountOfProbes); i++)
+        {
+            written = (fwrite(&probes[i * SHCoefficients::amountOfFloats], sizeof(float), savedFloatsPerProbe, file)
+                == savedFloatsPerProbe);
+        }
+
+        fclose(file);
+        return written;
+    }
+
+    bool LightProbeGrid::LoadFromFile(const std::string& filename)
+    {
+        FILE* file = fopen(filename.c_str(), "rb");
+        if (!file) return false;
+
+        std::vector<char> data;
+        char buffer[4096];
+        size_t amountRead;
+        while ((amountRead = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        {
+            data.insert(data.end(), buffer, buffer + amountRead);
+        }
+        fclose(file);
+
+        if (data.empty()) return false;
+        return LoadFromMemory(&data[0], data.size());
+    }
+
+    bool LightProbeGrid::LoadFromMemory(const void* data, unsigned int size)
+    {
+        if ((!data) || (size < sizeof(GridFileHeader))) return false;
+
+        GridFileHeader header;
+        memcpy(&header, data, sizeof(GridFileHeader));
+        if ((memcmp(header.identifier, fileIdentifier, sizeof(fileIdentifier)) != 0) || (header.version != fileVersion))
+            return false;
+        for (unsigned int i = 0; (i < 3); i++)
+        {
+            if ((header.amount[i] == 0) || (!(header.spacing[i] > 0.0f))) return false;
+        }
+
+        // Checked in steps so a corrupt header can't overflow the sum
+        unsigned int available = (size - sizeof(GridFileHeader)) / (sizeof(float) * savedFloatsPerProbe);
+        if ((header.amount[0] > available) || (header.amount[1] > available / header.amount[0]) ||
+            (header.amount[2] > available / (header.amount[0] * header.amount[1])))
+            return false;
+
+        Create(vector3f(header.origin[0], header.origin[1], header.origin[2]),
+            vector3f(header.spacing[0], header.spacing[1], header.spacing[2]),
+            header.amount[0], header.amount[1], header.amount[2]);
+        const char* source = static_cast<const char*>(data) + sizeof(GridFileHeader);
+        unsigned int amountOfProbes = GetAmountOfProbes();
+        for (unsigned int i = 0; (i < amountOfProbes); i++)
+        {
+            memcpy(&probes[i * SHCoefficients::amountOfFloats], source + (i * sizeof(float) * savedFloatsPerProbe),
+                sizeof(float) * savedFloatsPerProbe);
+        }
+        return true;
+    }
+
+}
+
+}
@@ -0,0 +1,177 @@
+/*
+ * File:   LightProbeSampler.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:35 AM
+ */
+
+#include <algorithm>
+#include "LightProbeSampler.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+using namespace maths;
+
+namespace graphics
+{
+
+    namespace
+    {
+
+        bool Contains(const AABB& box, const vector3f& point)
+        {
+            return (point.x >= box.minimum.x) && (point.x <= box.maximum.x) &&
+                (point.y >= box.minimum.y) && (point.y <= box.maximum.y) &&
+                (point.z >= box.minimum.z) && (point.z <= box.maximum.z);
+        }
+
+    }
+
+
+    LightProbeSampler::LightProbeSampler()
+    {
+    }
+
+    void LightProbeSampler::AddGrid(const LightProbeGrid* grid)
+    {
+        if (!grid)
+            throw debug::NullPointerException("LightProbeSampler::AddGrid - Cannot sample a NULL light probe grid!");
+        if (std::find(grids.begin(), grids.end(), grid) == grids.end()) grids.push_back(grid);
+    }
+
+    void LightProbeSampler::RemoveGrid(const LightProbeGrid* grid)
+    {
+        std::vector<const LightProbeGrid*>::iterator it = std::find(grids.begin(), grids.end(), grid);
+        if (it != grids.end()) grids.erase(it);
+    }
+
+    void LightProbeSampler::ClearGrids()
+    {
+        grids.clear();
+    }
+
+    void LightProbeSampler::SetPosition(const void* object, const vector3f& position)
+    {
+        std::map<const void*, unsigned int>::iterator it = indices.find(object);
+        if (it != indices.end())
+        {
+            positions[it->second] = position;
+            return;
+        }
+
+        indices[object] = objects.size();
+        objects.push_back(object);
+        positions.push_back(position);
+        coefficients.push_back(SHCoefficients());
+        ambientColours.push_back(colourf(0.0f, 0.0f, 0.0f, 1.0f));
+        sampled.push_back(false);
+    }
+
+    void LightProbeSampler::RemoveObject(const void* object)
+    {
+        std::map<const void*, unsigned int>::iterator it = indices.find(object);
+        if (it == indices.end()) return;
+
+        // The last object is moved into the removed one's place
+        unsigned int index = it->second;
+        unsigned int last = objects.size() - 1;
+        indices.erase(it);
+        if (index != last)
+        {
+            objects[index] = objects[last];
+            positions[index] = positions[last];
+            coefficients[index] = coefficients[last];
+            ambientColours[index] = ambientColours[last];
+            sampled[index] = sampled[last];
+            indices[objects[index]] = index;
+        }
+        objects.pop_back();
+        positions.pop_back();
+        coefficients.pop_back();
+        ambientColours.pop_back();
+        sampled.pop_back();
+    }
+
+    void LightProbeSampler::ClearObjects()
+    {
+        indices.clear();
+        objects.clear();
+        positions.clear();
+        coefficients.clear();
+        ambientColours.clear();
+        sampled.clear();
+    }
+
+    void LightProbeSampler::Update()
+    {
+        // Finds the grid every object is in
+        objectGrids.assign(objects.size(), -1);
+        for (unsigned int g = 0; (g < grids.size()); g++)
+        {
+            if (grids[g]->IsEmpty()) continue;
+            AABB bounds = grids[g]->GetBounds();
+            for (unsigned int i = 0; (i < objects.size()); i++)
+            {
+                if ((objectGrids[i] < 0) && (Contains(bounds, positions[i]))) objectGrids[i] = g;
+            }
+        }
+        for (unsigned int i = 0; (i < objects.size()); i++) sampled[i] = (objectGrids[i] >= 0);
+
+        // Then samples every grid's objects in one batch
+        for (unsigned int g = 0; (g < grids.size()); g++)
+        {
+            batchObjects.clear();
+            batchPositions.clear();
+            for (unsigned int i = 0; (i < objects.size()); i++)
+            {
+                if (objectGrids[i] != static_cast<int>(g)) continue;
+                batchObjects.push_back(i);
+                batchPositions.push_back(positions[i]);
+            }
+            if (batchObjects.empty()) continue;
+
+            batchResults.resize(batchObjects.size());
+            grids[g]->SampleBatch(&batchPositions[0], batchPositions.size(), &batchResults[0]);
+            for (unsigned int i = 0; (i < batchObjects.size()); i++)
+            {
+                coefficients[batchObjects[i]] = batchResults[i];
+                ambientColours[batchObjects[i]] = batchResults[i].GetAverage();
+            }
+        }
+    }
+
+    unsigned int LightProbeSampler::IndexOf(const void* object) const
+    {
+        std::map<const void*, unsigned int>::const_iterator it = indices.find(object);
+        if (it == indices.end())
+            throw debug::InvalidArgumentException("LightProbeSampler::IndexOf - "
+                "Object has not been added to the light probe sampler!");
+        return it->second;
+    }
+
+    bool LightProbeSampler::HasLighting(const void* object) const
+    {
+        std::map<const void*, unsigned int>::const_iterator it = indices.find(object);
+        return (it != indices.end()) && (sampled[it->second]);
+    }
+
+    const SHCoefficients& LightProbeSampler::GetCoefficients(const void* object) const
+    {
+        return coefficients[IndexOf(object)];
+    }
+
+    const colourf& LightProbeSampler::GetAmbientColour(const void* object) const
+    {
+        return ambientColours[IndexOf(object)];
+    }
+
+    void LightProbeSampler::GetUniformValues(const void* object, std::vector<vector3f>& uniformValues) const
+    {
+        coefficients[IndexOf(object)].GetUniformValues(uniformValues);
+    }
+
+}
+
+}
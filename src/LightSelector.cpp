@@ -0,0 +1,366 @@
+/*
+ * File:   LightSelector.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:05 AM
+ */
+
+#include <cmath>
+#include <algorithm>
+#include <functional>
+#include "LightSelector.h"
+#include "ClusteredLighting.h" // For ClusteredLighting::GetLightRange()
+
+namespace parcel
+{
+
+using namespace maths;
+
+namespace graphics
+{
+
+    namespace
+    {
+
+        bool SameBounds(const AABB& a, const AABB& b)
+        {
+            return (a.minimum.x == b.minimum.x) && (a.minimum.y == b.minimum.y) && (a.minimum.z == b.minimum.z)
+                && (a.maximum.x == b.maximum.x) && (a.maximum.y == b.maximum.y) && (a.maximum.z == b.maximum.z);
+        }
+
+    }
+
+
+    LightSelector::LightSelector(const LightSelectorSettings& selectorSettings) :
+        settings(selectorSettings), buckets(amountOfBuckets), version(1), frame(0),
+        selectionsMade(0), selectionsReused(0), queryStamp(0)
+    {
+        if (settings.cellSize <= 0.0f)
+        {
+            throw debug::InvalidArgumentException("LightSelector - The cell size must be more than 0!");
+        }
+    }
+
+
+    void LightSelector::Update(const LightPool& pool)
+    {
+        ++frame;
+        selectionsMade = selectionsReused = 0;
+
+        // Lights being added or removed moves the rest around, so everything starts again
+        const std::vector<LightHandle>& handles = pool.GetHandles();
+        bool sameLights = (handles.size() == lights.size());
+        for (unsigned int i = 0; (sameLights && i < handles.size()); i++)
+        {
+            if (handles[i] != lights[i].handle) sameLights = false;
+        }
+        if (!sameLights)
+        {
+            Clear();
+            lights.resize(handles.size());
+            for (unsigned int i = 0; (i < handles.size()); i++)
+            {
+                lights[i].handle = handles[i];
+                lights[i].version = 0;
+                lights[i].enabled = false;
+                lights[i].stamp = 0;
+                ReadLight(pool, i, lights[i]);
+                InsertLight(lights[i], i);
+            }
+        }
+        else
+        {
+            const std::vector<unsigned int>& versions = pool.GetVersions();
+            for (unsigned int i = 0; (i < lights.size()); i++)
+            {
+                // Lights that haven't changed aren't read at all
+                SelectorLight& entry = lights[i];
+                if (versions[i] == entry.version) continue;
+
+                SelectorLight previous = entry;
+                if (!ReadLight(pool, i, entry)) continue;
+
+                // Objects that could be lit by where the light was, or where it is now, pick again
+                RemoveLight(previous, i);
+                InsertLight(entry, i);
+                AddChange(AABB::Union(previous.bounds, entry.bounds), previous.global || entry.global);
+            }
+        }
+
+        // Forgets the picks of objects that haven't been drawn for a while
+        if ((frame % selectionLifetime) == 0)
+        {
+            SelectionMap::iterator it = selections.begin();
+            while (it != selections.end())
+            {
+                if ((frame - it->second.lastUsed) > selectionLifetime) selections.erase(it++);
+                else ++it;
+            }
+        }
+    }
+
+
+    bool LightSelector::ReadLight(const LightPool& pool, unsigned int index, SelectorLight& entry)
+    {
+        SelectorLight read = entry;
+        read.version = pool.GetVersions()[index];
+        read.enabled = (pool.GetEnabled()[index] != 0);
+        read.global = false;
+        read.bounds = AABB();
+
+        if (read.enabled)
+        {
+            const colourf& diffuse = pool.GetDiffuseColours()[index];
+            read.brightness = (0.299f * diffuse.r) + (0.587f * diffuse.g) + (0.114f * diffuse.b);
+
+            if (pool.GetTypes()[index] == LIGHTTYPE_DIRECTION)
+            {
+                read.global = true;
+                read.position = vector3f(0.0f, 0.0f, 0.0f);
+                read.attenuation[0] = 1.0f;
+                read.attenuation[1] = read.attenuation[2] = 0.0f;
+            }
+            else
+            {
+                const vector3f& attenuation = pool.GetAttenuations()[index];
+                read.position = pool.GetPositions()[index];
+                read.attenuation[0] = attenuation.x;
+                read.attenuation[1] = attenuation.y;
+                read.attenuation[2] = attenuation.z;
+
+                float range = ClusteredLighting::GetLightRange(read.attenuation[0], read.attenuation[1],
+                    read.attenuation[2], settings.attenuationThreshold);
+                if (range < 0.0f)
+                {
+                    read.global = true;
+                }
+                else
+                {
+                    vector3f extent(range, range, range);
+                    read.bounds = AABB(read.position - extent, read.position + extent);
+                    int first[3], last[3];
+                    if (!GetCells(read.bounds, first, last))
+                    {
+                        read.global = true;
+                        read.bounds = AABB();
+                    }
+                }
+            }
+        }
+
+        bool changed = (read.enabled != entry.enabled) || (read.global != entry.global)
+            || (read.enabled && (read.brightness != entry.brightness
+                || read.position.x != entry.position.x || read.position.y != entry.position.y
+                || read.position.z != entry.position.z || read.attenuation[0] != entry.attenuation[0]
+                || read.attenuation[1] != entry.attenuation[1] || read.attenuation[2] != entry.attenuation[2]));
+        entry = read;
+        return changed;
+    }
+
+
+    bool LightSelector::GetCells(const AABB& bounds, int* first, int* last) const
+    {
+        float amount = 1.0f;
+        for (unsigned int i = 0; (i < 3); i++)
+        {
+            float low = std::floor(bounds.minimum.values[i] / settings.cellSize);
+            float high = std::floor(bounds.maximum.values[i] / settings.cellSize);
+            amount *= (high - low) + 1.0f;
+            // Checked as floats, since huge boxes would overflow the cell coordinates
+            if (amount > settings.maxCellsPerLight) return false;
+            first[i] = static_cast<int>(low);
+            last[i] = static_cast<int>(high);
+        }
+        return true;
+    }
+
+    unsigned int LightSelector::GetBucket(int x, int y, int z) const
+    {
+        unsigned int hash = (static_cast<unsigned int>(x) * 73856093u) ^ (static_cast<unsigned int>(y) * 19349663u)
+            ^ (static_cast<unsigned int>(z) * 83492791u);
+        return hash % amountOfBuckets;
+    }
+
+
+    void LightSelector::InsertLight(const SelectorLight& entry, unsigned int index)
+    {
+        if (!entry.enabled) return;
+        if (entry.global)
+        {
+            globalLights.push_back(index);
+            return;
+        }
+
+        int first[3], last[3];
+        GetCells(entry.bounds, first, last);
+        for (int z = first[2]; (z <= last[2]); z++)
+        {
+            for (int y = first[1]; (y <= last[1]); y++)
+            {
+                for (int x = first[0]; (x <= last[0]); x++)
+                {
+                    // Cells that hash to the same bucket would add the light twice
+                    std::vector<unsigned int>& bucket = buckets[GetBucket(x, y, z)];
+                    if (bucket.empty() || bucket.back() != index) bucket.push_back(index);
+                }
+            }
+        }
+    }
+
+    void LightSelector::RemoveLight(const SelectorLight& entry, unsigned int index)
+    {
+        if (!entry.enabled) return;
+        if (entry.global)
+        {
+            globalLights.erase(std::remove(globalLights.begin(), globalLights.end(), index), globalLights.end());
+            return;
+        }
+
+        int first[3], last[3];
+        GetCells(entry.bounds, first, last);
+        for (int z = first[2]; (z <= last[2]); z++)
+        {
+            for (int y = first[1]; (y <= last[1]); y++)
+            {
+                for (int x = first[0]; (x <= last[0]); x++)
+                {
+                    std::vector<unsigned int>& bucket = buckets[GetBucket(x, y, z)];
+                    bucket.erase(std::remove(bucket.begin(), bucket.end(), index), bucket.end());
+                }
+            }
+        }
+    }
+
+
+    void LightSelector::AddChange(const AABB& bounds, bool everywhere)
+    {
+        // Keeps the newest half when there are too many
+        if (changes.size() >= maxChanges)
+        {
+            changes.erase(changes.begin(), changes.begin() + (maxChanges / 2));
+        }
+
+        LightChange change;
+        change.version = ++version;
+        change.bounds = bounds;
+        change.everywhere = everywhere;
+        changes.push_back(change);
+    }
+
+    bool LightSelector::IsCurrent(Selection& selection)
+    {
+        if (selection.version == version) return true;
+        // The changes it needs to be checked against might have been thrown away
+        if (changes.empty() || selection.version + 1 < changes.front().version) return false;
+
+        for (unsigned int i = changes.size(); (i > 0); i--)
+        {
+            const LightChange& change = changes[i - 1];
+            if (change.version <= selection.version) break;
+            if (change.everywhere || change.bounds.Overlaps(selection.bounds)) return false;
+        }
+
+        selection.version = version;
+        return true;
+    }
+
+
+    void LightSelector::ScoreLight(unsigned int index, const AABB& bounds)
+    {
+        SelectorLight& entry = lights[index];
+        if (entry.stamp == queryStamp) return;
+        entry.stamp = queryStamp;
+
+        if (!entry.global && !entry.bounds.Overlaps(bounds)) return;
+
+        // Directional lights have no attenuation, so the distance doesn't matter for them
+        float distance = std::sqrt(bounds.GetSqrDistanceTo(entry.position));
+        float attenuation = entry.attenuation[0] + (entry.attenuation[1] * distance)
+            + (entry.attenuation[2] * distance * distance);
+        if (!entry.global && (attenuation * settings.attenuationThreshold) > 1.0f) return;
+
+        float score = (attenuation > 0.0f) ? (entry.brightness / attenuation) : entry.brightness;
+        if (score > 0.0f) candidates.push_back(std::make_pair(score, index));
+    }
+
+    void LightSelector::Choose(const AABB& bounds, Selection& selection)
+    {
+        candidates.clear();
+        ++queryStamp;
+
+        for (unsigned int i = 0; (i < globalLights.size()); i++) ScoreLight(globalLights[i], bounds);
+
+        int first[3], last[3];
+        if (GetCells(bounds, first, last))
+        {
+            for (int z = first[2]; (z <= last[2]); z++)
+            {
+                for (int y = first[1]; (y <= last[1]); y++)
+                {
+                    for (int x = first[0]; (x <= last[0]); x++)
+                    {
+                        const std::vector<unsigned int>& bucket = buckets[GetBucket(x, y, z)];
+                        for (unsigned int i = 0; (i < bucket.size()); i++) ScoreLight(bucket[i], bounds);
+                    }
+                }
+            }
+        }
+        // Objects covering lots of cells just look at every light
+        else
+        {
+            for (unsigned int i = 0; (i < lights.size()); i++)
+            {
+                if (lights[i].enabled) ScoreLight(i, bounds);
+            }
+        }
+
+        unsigned int amount = std::min<unsigned int>(settings.lightsPerObject, candidates.size());
+        std::partial_sort(candidates.begin(), candidates.begin() + amount, candidates.end(),
+            std::greater<std::pair<float, unsigned int> >());
+
+        selection.lights.resize(amount);
+        for (unsigned int i = 0; (i < amount); i++) selection.lights[i] = candidates[i].second;
+        selection.bounds = bounds;
+        selection.version = version;
+    }
+
+
+    const std::vector<unsigned int>& LightSelector::Select(const void* object, const AABB& bounds)
+    {
+        std::pair<SelectionMap::iterator, bool> found = selections.insert(std::make_pair(object, Selection()));
+        Selection& selection = found.first->second;
+        selection.lastUsed = frame;
+
+        if (!found.second && SameBounds(selection.bounds, bounds) && IsCurrent(selection))
+        {
+            ++selectionsReused;
+        }
+        else
+        {
+            Choose(bounds, selection);
+            ++selectionsMade;
+        }
+
+        // The selector's lights are in the same order as the pool's
+        return selection.lights;
+    }
+
+
+    void LightSelector::Forget(const void* object)
+    {
+        selections.erase(object);
+    }
+
+    void LightSelector::Clear()
+    {
+        lights.clear();
+        globalLights.clear();
+        for (unsigned int i = 0; (i < buckets.size()); i++) buckets[i].clear();
+        changes.clear();
+        selections.clear();
+        ++version;
+    }
+
+}
+
+}
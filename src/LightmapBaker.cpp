@@ -0,0 +1,576 @@
+/*
+ * File:   LightmapBaker.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:20 AM
+ * Added light probe baking on October 19, 2026, 12:35 AM
+ */
+
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+#include "LightmapBaker.h"
+#include "TGAImage.h"
+#include "MCommon.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+using namespace maths;
+
+namespace graphics
+{
+
+    namespace
+    {
+
+        float Dot(const vector3f& a, const vector3f& b)
+        {
+            return (a.x * b.x) + (a.y * b.y) + (a.z * b.z);
+        }
+
+        vector3f Normalised(const vector3f& v)
+        {
+            float length = sqrt(Dot(v, v));
+            if (length <= 0.0f) return vector3f(0.0f, 0.0f, 0.0f);
+            return vector3f(v.x / length, v.y / length, v.z / length);
+        }
+
+        vector3f MultiplyAdd(const vector3f& a, const vector3f& b, float scale)
+        {
+            return vector3f(a.x + (b.x * scale), a.y + (b.y * scale), a.z + (b.z * scale));
+        }
+
+        // Transforms a point (w = 1) or a direction (w = 0) by a column major matrix
+        vector3f Transform(const float* matrix, const vector3f& v, float w)
+        {
+            return vector3f(
+                (matrix[0] * v.x) + (matrix[4] * v.y) + (matrix[8] * v.z) + (matrix[12] * w),
+                (matrix[1] * v.x) + (matrix[5] * v.y) + (matrix[9] * v.z) + (matrix[13] * w),
+                (matrix[2] * v.x) + (matrix[6] * v.y) + (matrix[10] * v.z) + (matrix[14] * w));
+        }
+
+        colourf Scaled(const colourf& colour, float scale)
+        {
+            return colourf(colour.r * scale, colour.g * scale, colour.b * scale, colour.a);
+        }
+
+        /* Small, fast random number generator (xorshift). The state must never be 0. */
+        float NextRandom(unsigned int& state)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return (state >> 8) * (1.0f / 16777216.0f); // Top 24 bits, from 0 up to (not including) 1
+        }
+
+        // Scrambles a texel's number into a seed, so neighbouring texels don't get similar sequences
+        unsigned int HashSeed(unsigned int value)
+        {
+            value = (value ^ 61) ^ (value >> 16);
+            value *= 9;
+            value ^= value >> 4;
+            value *= 0x27d4eb2d;
+            value ^= value >> 15;
+            return (value == 0) ? 1 : value;
+        }
+
+        // Edge function, twice the signed area of the triangle (a, b, p)
+        float EdgeFunction(const vector2f& a, const vector2f& b, float px, float py)
+        {
+            return ((b.x - a.x) * (py - a.y)) - ((b.y - a.y) * (px - a.x));
+        }
+
+        // Tolerance used when checking if a texel's centre is inside a triangle, in barycentric units
+        const float insideEpsilon = 1e-5f;
+
+    }
+
+
+    LightmapBaker::LightmapBaker(const LightmapBakeSettings& bakeSettings) : settings(bakeSettings), probeGrid(NULL)
+    {
+    }
+
+    unsigned int LightmapBaker::AddMesh(const LightmapMesh* mesh, const float* worldMatrix, const colourf& albedo)
+    {
+        if (!mesh)
+            throw debug::NullPointerException("LightmapBaker::AddMesh - Cannot bake a lightmap for a NULL mesh!");
+        if (!worldMatrix)
+            throw debug::NullPointerException("LightmapBaker::AddMesh - "
+                "Cannot bake a lightmap with a NULL world matrix!");
+        if (mesh->resolution == 0)
+            throw debug::InvalidArgumentException("LightmapBaker::AddMesh - "
+                "Mesh has not been given lightmap coordinates!");
+
+        BakeMesh bakeMesh;
+        bakeMesh.mesh = mesh;
+        bakeMesh.albedo = albedo;
+        bakeMesh.firstVertex = scenePositions.size();
+        meshes.push_back(bakeMesh);
+
+        unsigned int meshIndex = meshes.size() - 1;
+        for (unsigned int i = 0; (i < mesh->vertices.size()); i++)
+        {
+            scenePositions.push_back(Transform(worldMatrix, mesh->vertices[i].position, 1.0f));
+            sceneNormals.push_back(Normalised(Transform(worldMatrix, mesh->vertices[i].normal, 0.0f)));
+        }
+        for (unsigned int i = 0; (i < mesh->triangles.size()); i++)
+        {
+            Triangle triangle;
+            for (unsigned int j = 0; (j < 3); j++) triangle.values[j] = mesh->triangles[i].values[j] + bakeMesh.firstVertex;
+            sceneTriangles.push_back(triangle);
+            triangleMeshes.push_back(meshIndex);
+        }
+
+        return meshIndex;
+    }
+
+    void LightmapBaker::AddLight(ALight* light)
+    {
+        if (!light) throw debug::NullPointerException("LightmapBaker::AddLight - Cannot bake with a NULL light!");
+        if (!light->IsEnabled()) return;
+
+        BakeLight bakeLight;
+        bakeLight.type = light->GetType();
+        bakeLight.ambient = light->GetAmbientColour();
+        bakeLight.diffuse = light->GetDiffuseColour();
+        bakeLight.spotDirection = vector3f(0.0f, 0.0f, -1.0f);
+        bakeLight.constant = 1.0f;
+        bakeLight.linear = bakeLight.quadratic = 0.0f;
+        bakeLight.cosCutoff = -1.0f;
+        bakeLight.exponent = 0.0f;
+
+        // The same parameters are read for each type of light as the light managers read
+        if (bakeLight.type == LIGHTTYPE_DIRECTION)
+        {
+            bakeLight.position = Normalised(light->GetDirection());
+        }
+        else
+        {
+            bakeLight.position = light->GetPosition();
+            bakeLight.constant = light->GetConstantAttenuation();
+            bakeLight.linear = light->GetLinearAttenuation();
+            bakeLight.quadratic = light->GetQuadraticAttenuation();
+            if (bakeLight.type == LIGHTTYPE_SPOTLIGHT)
+            {
+                bakeLight.spotDirection = Normalised(light->GetDirection());
+                bakeLight.cosCutoff = static_cast<float>(cos(DegreesToRadians(light->GetSpotlightCutoff())));
+                bakeLight.exponent = light->GetSpotlightFocus();
+            }
+        }
+        lights.push_back(bakeLight);
+    }
+
+    void LightmapBaker::Clear()
+    {
+        meshes.clear();
+        lights.clear();
+        scenePositions.clear();
+        sceneNormals.clear();
+        sceneTriangles.clear();
+        triangleMeshes.clear();
+        bvh.Clear();
+    }
+
+    void LightmapBaker::Bake(general::ThreadPool* threadPool)
+    {
+        bvh.Build(scenePositions, sceneTriangles);
+
+        texels.clear();
+        for (unsigned int i = 0; (i < meshes.size()); i++)
+        {
+            unsigned int resolution = meshes[i].mesh->resolution;
+            meshes[i].lightmap.assign(resolution * resolution * 3, 0.0f);
+            meshes[i].covered.assign(resolution * resolution, 0);
+            Rasterize(i);
+        }
+
+        unsigned int amountOfTasks = (texels.size() + texelsPerTask - 1) / texelsPerTask;
+        if (threadPool)
+        {
+            threadPool->Dispatch(this, amountOfTasks);
+        }
+        else
+        {
+            for (unsigned int i = 0; (i < amountOfTasks); i++) Execute(i, 0);
+        }
+
+        for (unsigned int i = 0; (i < meshes.size()); i++) Dilate(i);
+        std::vector<Texel>().swap(texels);
+    }
+
+    void LightmapBaker::BakeProbes(LightProbeGrid& grid, general::ThreadPool* threadPool)
+    {
+        if (grid.IsEmpty())
+            throw debug::InvalidArgumentException("LightmapBaker::BakeProbes - Cannot bake an empty light probe grid!");
+
+        // Meshes might have been added since the last bake, so the tree is always built again
+        bvh.Build(scenePositions, sceneTriangles);
+
+        probeGrid = &grid;
+        unsigned int amountOfTasks = (grid.GetAmountOfProbes() + probesPerTask - 1) / probesPerTask;
+        try
+        {
+            if (threadPool)
+            {
+                threadPool->Dispatch(this, amountOfTasks);
+            }
+            else
+            {
+                for (unsigned int i = 0; (i < amountOfTasks); i++) Execute(i, 0);
+            }
+        }
+        catch (...)
+        {
+            probeGrid = NULL;
+            throw;
+        }
+        probeGrid = NULL;
+    }
+
+    void LightmapBaker::Execute(unsigned int index, unsigned int /*threadIndex*/)
+    {
+        if (probeGrid)
+        {
+            unsigned int first = index * probesPerTask;
+            unsigned int last = std::min(first + probesPerTask, probeGrid->GetAmountOfProbes());
+            for (unsigned int i = first; (i < last); i++) BakeProbe(i);
+            return;
+        }
+
+        unsigned int first = index * texelsPerTask;
+        unsigned int last = std::min(first + texelsPerTask, static_cast<unsigned int>(texels.size()));
+        for (unsigned int i = first; (i < last); i++)
+        {
+            const Texel& texel = texels[i];
+            colourf light = GatherDirect(texel.position, texel.normal);
+            if (settings.indirectSamples > 0)
+            {
+                unsigned int seed = HashSeed(i);
+                light += GatherIndirect(texel.position, texel.normal, seed);
+            }
+
+            // Every texel is only in one task, so no other thread writes to the same place
+            float* output = &meshes[texel.mesh].lightmap[texel.index * 3];
+            output[0] = light.r;
+            output[1] = light.g;
+            output[2] = light.b;
+        }
+    }
+
+    void LightmapBaker::Rasterize(unsigned int meshIndex)
+    {
+        BakeMesh& bakeMesh = meshes[meshIndex];
+        const LightmapMesh& mesh = *bakeMesh.mesh;
+        int resolution = static_cast<int>(mesh.resolution);
+
+        for (unsigned int i = 0; (i < mesh.triangles.size()); i++)
+        {
+            const Triangle& triangle = mesh.triangles[i];
+            vector2f corners[3];
+            for (unsigned int j = 0; (j < 3); j++)
+            {
+                corners[j] = vector2f(mesh.lightmapCoords[triangle.values[j]].x * resolution,
+                    mesh.lightmapCoords[triangle.values[j]].y * resolution);
+            }
+            unsigned int vertices[3] = { triangle.v1 + bakeMesh.firstVertex, triangle.v2 + bakeMesh.firstVertex,
+                triangle.v3 + bakeMesh.firstVertex };
+
+            float area = EdgeFunction(corners[0], corners[1], corners[2].x, corners[2].y);
+            int minimumX = std::max(0, static_cast<int>(floor(std::min(corners[0].x, std::min(corners[1].x, corners[2].x)))));
+            int minimumY = std::max(0, static_cast<int>(floor(std::min(corners[0].y, std::min(corners[1].y, corners[2].y)))));
+            int maximumX = std::min(resolution - 1, static_cast<int>(floor(std::max(corners[0].x, std::max(corners[1].x, corners[2].x)))));
+            int maximumY = std::min(resolution - 1, static_cast<int>(floor(std::max(corners[0].y, std::max(corners[1].y, corners[2].y)))));
+
+            bool coveredAny = false;
+            if (area != 0.0f)
+            {
+                // Every texel whose centre is inside the triangle gets the point on the surface at its centre
+                for (int y = minimumY; (y <= maximumY); y++)
+                {
+                    for (int x = minimumX; (x <= maximumX); x++)
+                    {
+                        float centreX = x + 0.5f, centreY = y + 0.5f;
+                        float w0 = EdgeFunction(corners[1], corners[2], centreX, centreY) / area;
+                        float w1 = EdgeFunction(corners[2], corners[0], centreX, centreY) / area;
+                        float w2 = 1.0f - w0 - w1;
+                        if ((w0 < -insideEpsilon) || (w1 < -insideEpsilon) || (w2 < -insideEpsilon)) continue;
+
+                        coveredAny = true;
+                        unsigned int texelIndex = (y * resolution) + x;
+                        if (bakeMesh.covered[texelIndex]) continue;
+
+                        Texel texel;
+                        texel.mesh = meshIndex;
+                        texel.index = texelIndex;
+                        texel.position = vector3f(0.0f, 0.0f, 0.0f);
+                        texel.normal = vector3f(0.0f, 0.0f, 0.0f);
+                        float weights[3] = { w0, w1, w2 };
+                        for (unsigned int j = 0; (j < 3); j++)
+                        {
+                            texel.position = MultiplyAdd(texel.position, scenePositions[vertices[j]], weights[j]);
+                            texel.normal = MultiplyAdd(texel.normal, sceneNormals[vertices[j]], weights[j]);
+                        }
+                        texel.normal = Normalised(texel.normal);
+                        bakeMesh.covered[texelIndex] = 1;
+                        texels.push_back(texel);
+                    }
+                }
+            }
+
+            /* Triangles too thin to cover any texel's centre still get the texel their middle is
+             * in, so they aren't left black. */
+            if (!coveredAny)
+            {
+                float centreX = (corners[0].x + corners[1].x + corners[2].x) / 3.0f;
+                float centreY = (corners[0].y + corners[1].y + corners[2].y) / 3.0f;
+                int x = std::max(0, std::min(resolution - 1, static_cast<int>(centreX)));
+                int y = std::max(0, std::min(resolution - 1, static_cast<int>(centreY)));
+                unsigned int texelIndex = (y * resolution) + x;
+                if (bakeMesh.covered[texelIndex]) continue;
+
+                Texel texel;
+                texel.mesh = meshIndex;
+                texel.index = texelIndex;
+                texel.position = vector3f(0.0f, 0.0f, 0.0f);
+                texel.normal = vector3f(0.0f, 0.0f, 0.0f);
+                for (unsigned int j = 0; (j < 3); j++)
+                {
+                    texel.position = MultiplyAdd(texel.position, scenePositions[vertices[j]], 1.0f / 3.0f);
+                    texel.normal = MultiplyAdd(texel.normal, sceneNormals[vertices[j]], 1.0f / 3.0f);
+                }
+                texel.normal = Normalised(texel.normal);
+                bakeMesh.covered[texelIndex] = 1;
+                texels.push_back(texel);
+            }
+        }
+    }
+
+    void LightmapBaker::Dilate(unsigned int meshIndex)
+    {
+        BakeMesh& bakeMesh = meshes[meshIndex];
+        int resolution = static_cast<int>(bakeMesh.mesh->resolution);
+        std::vector<unsigned char> coveredBefore;
+
+        for (unsigned int pass = 0; (pass < settings.dilation); pass++)
+        {
+            // Texels filled in this pass mustn't be used by others in the same pass
+            coveredBefore = bakeMesh.covered;
+            for (int y = 0; (y < resolution); y++)
+            {
+                for (int x = 0; (x < resolution); x++)
+                {
+                    unsigned int texelIndex = (y * resolution) + x;
+                    if (coveredBefore[texelIndex]) continue;
+
+                    float sum[3] = { 0.0f, 0.0f, 0.0f };
+                    unsigned int amount = 0;
+                    for (int offsetY = -1; (offsetY <= 1); offsetY++)
+                    {
+                        for (int offsetX = -1; (offsetX <= 1); offsetX++)
+                        {
+                            int neighbourX = x + offsetX, neighbourY = y + offsetY;
+                            if ((neighbourX < 0) || (neighbourY < 0) || (neighbourX >= resolution) || (neighbourY >= resolution)) continue;
+                            unsigned int neighbour = (neighbourY * resolution) + neighbourX;
+                            if (!coveredBefore[neighbour]) continue;
+
+                            for (unsigned int c = 0; (c < 3); c++) sum[c] += bakeMesh.lightmap[(neighbour * 3) + c];
+                            amount++;
+                        }
+                    }
+                    if (amount == 0) continue;
+
+                    for (unsigned int c = 0; (c < 3); c++) bakeMesh.lightmap[(texelIndex * 3) + c] = sum[c] / amount;
+                    bakeMesh.covered[texelIndex] = 1;
+                }
+            }
+        }
+    }
+
+    bool LightmapBaker::LightTowards(const BakeLight& light, const vector3f& position, vector3f& towardsLight,
+        float& distance, float& attenuation) const
+    {
+        distance = FLT_MAX;
+        attenuation = 1.0f;
+        if (light.type == LIGHTTYPE_DIRECTION)
+        {
+            towardsLight = light.position;
+            return true;
+        }
+
+        vector3f offset(light.position.x - position.x, light.position.y - position.y, light.position.z - position.z);
+        distance = sqrt(Dot(offset, offset));
+        if (distance <= 0.0f) return false;
+        towardsLight = vector3f(offset.x / distance, offset.y / distance, offset.z / distance);
+        attenuation = 1.0f / (light.constant + (light.linear * distance) + (light.quadratic * distance * distance));
+
+        if (light.type == LIGHTTYPE_SPOTLIGHT)
+        {
+            // Outside the cone the light has no effect at all, not even ambient
+            float spot = -Dot(towardsLight, light.spotDirection);
+            if (spot < light.cosCutoff) return false;
+            attenuation *= pow(std::max(spot, 0.0f), light.exponent);
+        }
+        return true;
+    }
+
+    colourf LightmapBaker::GatherDirect(const vector3f& position, const vector3f& normal) const
+    {
+        colourf result(0.0f, 0.0f, 0.0f, 1.0f);
+        vector3f origin = MultiplyAdd(position, normal, settings.rayBias);
+
+        for (unsigned int i = 0; (i < lights.size()); i++)
+        {
+            const BakeLight& light = lights[i];
+            vector3f towardsLight;
+            float distance, attenuation;
+            if (!LightTowards(light, position, towardsLight, distance, attenuation)) continue;
+
+            result += Scaled(light.ambient, attenuation);
+
+            float lambert = Dot(normal, towardsLight);
+            if (lambert <= 0.0f) continue;
+            if (bvh.IsOccluded(Ray(origin, towardsLight), distance - settings.rayBias)) continue;
+            result += Scaled(light.diffuse, attenuation * lambert);
+        }
+
+        return result;
+    }
+
+    colourf LightmapBaker::GatherIndirect(const vector3f& position, const vector3f& normal, unsigned int& seed) const
+    {
+        // Axes around the normal, to turn directions around (0, 0, 1) into ones around the normal
+        vector3f axis = (fabs(normal.x) > 0.9f) ? vector3f(0.0f, 1.0f, 0.0f) : vector3f(1.0f, 0.0f, 0.0f);
+        vector3f tangent = Normalised(vector3f((axis.y * normal.z) - (axis.z * normal.y),
+            (axis.z * normal.x) - (axis.x * normal.z), (axis.x * normal.y) - (axis.y * normal.x)));
+        vector3f bitangent((normal.y * tangent.z) - (normal.z * tangent.y), (normal.z * tangent.x) - (normal.x * tangent.z),
+            (normal.x * tangent.y) - (normal.y * tangent.x));
+        vector3f origin = MultiplyAdd(position, normal, settings.rayBias);
+
+        colourf sum(0.0f, 0.0f, 0.0f, 1.0f);
+        for (unsigned int i = 0; (i < settings.indirectSamples); i++)
+        {
+            /* Cosine weighted direction, so directions near the normal (which matter most) are
+             * picked more often and the samples can simply be averaged. */
+            float angle = static_cast<float>(2.0 * constants::PI) * NextRandom(seed);
+            float radiusSquared = NextRandom(seed);
+            float radius = sqrt(radiusSquared);
+            float localX = radius * cos(angle), localY = radius * sin(angle);
+            float localZ = sqrt(std::max(0.0f, 1.0f - radiusSquared));
+            vector3f direction = MultiplyAdd(MultiplyAdd(vector3f(normal.x * localZ, normal.y * localZ,
+                normal.z * localZ), tangent, localX), bitangent, localY);
+
+            TriangleBVH::Hit hit;
+            if (!bvh.Intersect(Ray(origin, direction), FLT_MAX, hit))
+            {
+                sum += settings.skyColour;
+                continue;
+            }
+
+            // The light bounced back towards the texel from the point the ray hit
+            const Triangle& triangle = sceneTriangles[hit.triangle];
+            float w0 = 1.0f - hit.u - hit.v;
+            vector3f hitPosition = MultiplyAdd(origin, direction, hit.distance);
+            vector3f hitNormal = Normalised(MultiplyAdd(MultiplyAdd(vector3f(sceneNormals[triangle.v1].x * w0,
+                sceneNormals[triangle.v1].y * w0, sceneNormals[triangle.v1].z * w0), sceneNormals[triangle.v2], hit.u),
+                sceneNormals[triangle.v3], hit.v));
+            // Light is bounced off whichever side the ray hit
+            if (Dot(hitNormal, direction) > 0.0f) hitNormal = vector3f(-hitNormal.x, -hitNormal.y, -hitNormal.z);
+
+            sum += GatherDirect(hitPosition, hitNormal) * meshes[triangleMeshes[hit.triangle]].albedo;
+        }
+
+        float scale = 1.0f / settings.indirectSamples;
+        return colourf(sum.r * scale, sum.g * scale, sum.b * scale, 1.0f);
+    }
+
+    void LightmapBaker::BakeProbe(unsigned int index)
+    {
+        unsigned int x = index % probeGrid->GetAmountX();
+        unsigned int y = (index / probeGrid->GetAmountX()) % probeGrid->GetAmountY();
+        unsigned int z = index / (probeGrid->GetAmountX() * probeGrid->GetAmountY());
+        vector3f position = probeGrid->GetProbePosition(x, y, z);
+        SHCoefficients coefficients;
+
+        // Lights the probe can see are added as light from a single direction
+        for (unsigned int i = 0; (i < lights.size()); i++)
+        {
+            const BakeLight& light = lights[i];
+            vector3f towardsLight;
+            float distance, attenuation;
+            if (!LightTowards(light, position, towardsLight, distance, attenuation)) continue;
+
+            coefficients.AddAmbient(Scaled(light.ambient, attenuation));
+            if (bvh.IsOccluded(Ray(position, towardsLight), distance)) continue;
+            coefficients.AddDirectional(towardsLight, Scaled(light.diffuse, attenuation));
+        }
+
+        if (settings.probeSamples > 0)
+        {
+            /* Each ray's light is what a surface facing straight at it would get from a sphere
+             * of that light (the same as the sky) split between the rays, which is 4 / rays of
+             * its colour when added as light from one direction. */
+            float share = 4.0f / settings.probeSamples;
+            unsigned int seed = HashSeed(index);
+            for (unsigned int i = 0; (i < settings.probeSamples); i++)
+            {
+                // Picks a direction evenly over the whole sphere
+                float directionZ = 1.0f - (2.0f * NextRandom(seed));
+                float angle = static_cast<float>(2.0 * constants::PI) * NextRandom(seed);
+                float radius = sqrt(std::max(0.0f, 1.0f - (directionZ * directionZ)));
+                vector3f direction(radius * cos(angle), radius * sin(angle), directionZ);
+
+                colourf light = settings.skyColour;
+                TriangleBVH::Hit hit;
+                if (bvh.Intersect(Ray(position, direction), FLT_MAX, hit))
+                {
+                    const Triangle& triangle = sceneTriangles[hit.triangle];
+                    float w0 = 1.0f - hit.u - hit.v;
+                    vector3f hitPosition = MultiplyAdd(position, direction, hit.distance);
+                    vector3f hitNormal = Normalised(MultiplyAdd(MultiplyAdd(vector3f(sceneNormals[triangle.v1].x * w0,
+                        sceneNormals[triangle.v1].y * w0, sceneNormals[triangle.v1].z * w0), sceneNormals[triangle.v2], hit.u),
+                        sceneNormals[triangle.v3], hit.v));
+                    if (Dot(hitNormal, direction) > 0.0f) hitNormal = vector3f(-hitNormal.x, -hitNormal.y, -hitNormal.z);
+
+                    light = GatherDirect(hitPosition, hitNormal) * meshes[triangleMeshes[hit.triangle]].albedo;
+                }
+                coefficients.AddDirectional(direction, Scaled(light, share));
+            }
+        }
+
+        // Every probe is only in one task, so no other thread writes to the same place
+        probeGrid->SetProbe(x, y, z, coefficients);
+    }
+
+    const std::vector<float>& LightmapBaker::GetLightmap(unsigned int mesh) const
+    {
+        if (mesh >= meshes.size())
+            throw debug::InvalidArgumentException("LightmapBaker::GetLightmap - Lightmap mesh index is out of range!");
+        return meshes[mesh].lightmap;
+    }
+
+    void LightmapBaker::GetPixels(unsigned int mesh, std::vector<unsigned char>& rgbPixels) const
+    {
+        const std::vector<float>& lightmap = GetLightmap(mesh);
+        rgbPixels.resize(lightmap.size());
+        for (unsigned int i = 0; (i < lightmap.size()); i++)
+        {
+            float value = std::min(std::max(lightmap[i], 0.0f), 1.0f);
+            rgbPixels[i] = static_cast<unsigned char>((value * 255.0f) + 0.5f);
+        }
+    }
+
+    bool LightmapBaker::SaveLightmap(unsigned int mesh, const std::string& filename) const
+    {
+        std::vector<unsigned char> pixels;
+        GetPixels(mesh, pixels);
+        if (pixels.empty()) return false;
+
+        unsigned int resolution = meshes[mesh].mesh->resolution;
+        return TGAImage::SaveToFile(filename, resolution, resolution, &pixels[0]);
+    }
+
+}
+
+}
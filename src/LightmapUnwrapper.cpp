@@ -0,0 +1,370 @@
+/*
+ * File:   LightmapUnwrapper.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:20 AM
+ */
+
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+#include "LightmapUnwrapper.h"
+#include "MCommon.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+using namespace maths;
+
+namespace graphics
+{
+
+    namespace
+    {
+
+        // An edge of a triangle, with its vertices in order so both triangles sharing it give the same edge
+        struct Edge
+        {
+            int first, second;
+            unsigned int triangle;
+
+            bool operator <(const Edge& other) const
+            {
+                if (first != other.first) return (first < other.first);
+                if (second != other.second) return (second < other.second);
+                return (triangle < other.triangle);
+            }
+        };
+
+        vector3f Subtract(const vector3f& a, const vector3f& b)
+        {
+            return vector3f(a.x - b.x, a.y - b.y, a.z - b.z);
+        }
+
+        vector3f Cross(const vector3f& a, const vector3f& b)
+        {
+            return vector3f((a.y * b.z) - (a.z * b.y), (a.z * b.x) - (a.x * b.z), (a.x * b.y) - (a.y * b.x));
+        }
+
+        float Dot(const vector3f& a, const vector3f& b)
+        {
+            return (a.x * b.x) + (a.y * b.y) + (a.z * b.z);
+        }
+
+        /* Sorts triangles biggest first, and by index when they're the same size, so the
+         * charts always grow from the same seeds. */
+        struct BiggerTriangle
+        {
+            const std::vector<float>* areas;
+
+            bool operator ()(unsigned int a, unsigned int b) const
+            {
+                if ((*areas)[a] != (*areas)[b]) return ((*areas)[a] > (*areas)[b]);
+                return (a < b);
+            }
+        };
+
+        /* Sorts charts tallest first (then widest, then by index) for packing. */
+        struct TallerChart
+        {
+            const std::vector<unsigned int>* heights;
+            const std::vector<unsigned int>* widths;
+
+            bool operator ()(unsigned int a, unsigned int b) const
+            {
+                if ((*heights)[a] != (*heights)[b]) return ((*heights)[a] > (*heights)[b]);
+                if ((*widths)[a] != (*widths)[b]) return ((*widths)[a] > (*widths)[b]);
+                return (a < b);
+            }
+        };
+
+        // Triangles smaller than this are treated as having no direction, and can go in any chart
+        const float degenerateArea = 1e-12f;
+        // Most times the charts are shrunk before giving up
+        const unsigned int maxPackAttempts = 64;
+
+    }
+
+
+    void LightmapMesh::Expand(std::vector<Vertex>& listVertices, std::vector<vector2f>& listCoords) const
+    {
+        listVertices.clear();
+        listCoords.clear();
+        listVertices.reserve(triangles.size() * 3);
+        listCoords.reserve(triangles.size() * 3);
+        for (unsigned int i = 0; (i < triangles.size()); i++)
+        {
+            for (unsigned int j = 0; (j < 3); j++)
+            {
+                listVertices.push_back(vertices[triangles[i].values[j]]);
+                listCoords.push_back(lightmapCoords[triangles[i].values[j]]);
+            }
+        }
+    }
+
+
+    LightmapUnwrapper::LightmapUnwrapper(const LightmapUnwrapSettings& unwrapSettings) :
+        settings(unwrapSettings)
+    {
+        if (settings.resolution == 0)
+            throw debug::InvalidArgumentException("LightmapUnwrapper::LightmapUnwrapper - "
+                "Lightmap resolution must be above zero!");
+        if (settings.texelsPerUnit <= 0.0f)
+            throw debug::InvalidArgumentException("LightmapUnwrapper::LightmapUnwrapper - "
+                "Lightmap texels per unit must be above zero!");
+        if ((settings.padding * 2) >= settings.resolution)
+            throw debug::InvalidArgumentException("LightmapUnwrapper::LightmapUnwrapper - "
+                "Lightmap padding leaves no room for any charts!");
+        if ((settings.chartAngle <= 0.0f) || (settings.chartAngle >= 90.0f))
+            throw debug::InvalidArgumentException("LightmapUnwrapper::LightmapUnwrapper - "
+                "Lightmap chart angle must be between 0 and 90 degrees!");
+    }
+
+    void LightmapUnwrapper::Unwrap(const std::vector<Vertex>& vertices, const std::vector<Triangle>& triangles,
+        LightmapMesh& mesh)
+    {
+        for (unsigned int i = 0; (i < triangles.size()); i++)
+        {
+            for (unsigned int j = 0; (j < 3); j++)
+            {
+                if ((triangles[i].values[j] < 0) || (triangles[i].values[j] >= static_cast<int>(vertices.size())))
+                    throw debug::InvalidArgumentException("LightmapUnwrapper::Unwrap - "
+                        "Triangle uses a vertex that doesn't exist!");
+            }
+        }
+
+        BuildCharts(vertices, triangles);
+
+        /* Start at the density asked for, unless the charts clearly can't fit at it, in which case
+         * start at the density that would make their total area fill most of the lightmap. */
+        float scale = settings.texelsPerUnit;
+        float totalArea = 0.0f;
+        for (unsigned int i = 0; (i < charts.size()); i++)
+        {
+            totalArea += ((charts[i].maximumU - charts[i].minimumU) * scale + (settings.padding * 2) + 1.0f)
+                * ((charts[i].maximumV - charts[i].minimumV) * scale + (settings.padding * 2) + 1.0f);
+        }
+        float lightmapArea = static_cast<float>(settings.resolution * settings.resolution);
+        if (totalArea > lightmapArea) scale *= sqrt((lightmapArea * 0.8f) / totalArea);
+
+        unsigned int attempt = 0;
+        while (!PackCharts(scale))
+        {
+            if (++attempt == maxPackAttempts)
+                throw debug::Exception("LightmapUnwrapper::Unwrap - "
+                    "The mesh's charts don't fit in the lightmap, it needs a higher resolution!");
+            scale *= 0.9f;
+        }
+
+        /* Every chart gets its own copy of each vertex it uses, since the same vertex is in a
+         * different place in every chart. */
+        mesh.vertices.clear();
+        mesh.lightmapCoords.clear();
+        mesh.sourceVertices.clear();
+        mesh.triangles.resize(triangles.size());
+        mesh.resolution = settings.resolution;
+        mesh.amountOfCharts = charts.size();
+        mesh.texelsPerUnit = scale;
+
+        std::vector<int> chartVertices(vertices.size(), -1); // Copy of each vertex in the current chart
+        std::vector<unsigned int> chartVertexStamps(vertices.size(), 0xFFFFFFFF); // Chart the copy is for
+        float texelSize = 1.0f / settings.resolution;
+        for (unsigned int i = 0; (i < charts.size()); i++)
+        {
+            const Chart& chart = charts[i];
+            for (unsigned int j = 0; (j < chart.amountOfTriangles); j++)
+            {
+                unsigned int triangle = chartTriangles[chart.firstTriangle + j];
+                for (unsigned int k = 0; (k < 3); k++)
+                {
+                    int source = triangles[triangle].values[k];
+                    if (chartVertexStamps[source] != i)
+                    {
+                        const vector3f& position = vertices[source].position;
+                        float u = ((Dot(position, chart.tangent) - chart.minimumU) * scale) + chart.x + settings.padding;
+                        float v = ((Dot(position, chart.bitangent) - chart.minimumV) * scale) + chart.y + settings.padding;
+
+                        chartVertexStamps[source] = i;
+                        chartVertices[source] = mesh.vertices.size();
+                        mesh.vertices.push_back(vertices[source]);
+                        mesh.lightmapCoords.push_back(vector2f(u * texelSize, v * texelSize));
+                        mesh.sourceVertices.push_back(source);
+                    }
+                    mesh.triangles[triangle].values[k] = chartVertices[source];
+                }
+            }
+        }
+    }
+
+    void LightmapUnwrapper::Unwrap(AModelLoader* model, LightmapMesh& mesh)
+    {
+        if (!model) throw debug::NullPointerException("LightmapUnwrapper::Unwrap - Cannot unwrap a NULL model!");
+        Unwrap(model->GetVertices(), model->GetTriangles(), mesh);
+    }
+
+    void LightmapUnwrapper::BuildCharts(const std::vector<Vertex>& vertices, const std::vector<Triangle>& triangles)
+    {
+        unsigned int amountOfTriangles = triangles.size();
+        faceNormals.resize(amountOfTriangles);
+        faceAreas.resize(amountOfTriangles);
+        triangleCharts.assign(amountOfTriangles, -1);
+        chartTriangles.clear();
+        charts.clear();
+
+        for (unsigned int i = 0; (i < amountOfTriangles); i++)
+        {
+            const vector3f& a = vertices[triangles[i].v1].position;
+            vector3f normal = Cross(Subtract(vertices[triangles[i].v2].position, a),
+                Subtract(vertices[triangles[i].v3].position, a));
+            float length = sqrt(Dot(normal, normal));
+            faceAreas[i] = length * 0.5f;
+            if (faceAreas[i] > degenerateArea) faceNormals[i] = vector3f(normal.x / length, normal.y / length, normal.z / length);
+            else faceNormals[i] = vector3f(0.0f, 0.0f, 0.0f);
+        }
+
+        /* Find the triangles sharing each edge by sorting every triangle's edges, so the ones
+         * with the same two vertices end up next to each other. */
+        std::vector<Edge> edges(amountOfTriangles * 3);
+        for (unsigned int i = 0; (i < amountOfTriangles); i++)
+        {
+            for (unsigned int j = 0; (j < 3); j++)
+            {
+                int a = triangles[i].values[j], b = triangles[i].values[(j + 1) % 3];
+                Edge& edge = edges[(i * 3) + j];
+                edge.first = std::min(a, b);
+                edge.second = std::max(a, b);
+                edge.triangle = i;
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+
+        std::vector< std::vector<unsigned int> > neighbours(amountOfTriangles);
+        for (unsigned int start = 0; (start < edges.size()); )
+        {
+            unsigned int end = start + 1;
+            while ((end < edges.size()) && (edges[end].first == edges[start].first)
+                && (edges[end].second == edges[start].second)) end++;
+            for (unsigned int i = start; (i < end); i++)
+            {
+                for (unsigned int j = start; (j < end); j++)
+                {
+                    if (edges[i].triangle != edges[j].triangle) neighbours[edges[i].triangle].push_back(edges[j].triangle);
+                }
+            }
+            start = end;
+        }
+
+        std::vector<unsigned int> seeds(amountOfTriangles);
+        for (unsigned int i = 0; (i < amountOfTriangles); i++) seeds[i] = i;
+        BiggerTriangle biggerTriangle;
+        biggerTriangle.areas = &faceAreas;
+        std::sort(seeds.begin(), seeds.end(), biggerTriangle);
+
+        float minimumDot = static_cast<float>(cos(DegreesToRadians(settings.chartAngle)));
+        for (unsigned int i = 0; (i < amountOfTriangles); i++)
+        {
+            unsigned int seed = seeds[i];
+            if (triangleCharts[seed] != -1) continue;
+
+            Chart chart;
+            chart.firstTriangle = chartTriangles.size();
+            vector3f normal = faceNormals[seed];
+            if (faceAreas[seed] <= degenerateArea) normal = vector3f(0.0f, 0.0f, 1.0f);
+
+            // Grow the chart outwards from the seed, a ring of neighbours at a time
+            int chartIndex = charts.size();
+            triangleCharts[seed] = chartIndex;
+            chartTriangles.push_back(seed);
+            for (unsigned int j = chart.firstTriangle; (j < chartTriangles.size()); j++)
+            {
+                const std::vector<unsigned int>& adjacent = neighbours[chartTriangles[j]];
+                for (unsigned int k = 0; (k < adjacent.size()); k++)
+                {
+                    unsigned int triangle = adjacent[k];
+                    if (triangleCharts[triangle] != -1) continue;
+                    if ((faceAreas[triangle] > degenerateArea) && (Dot(faceNormals[triangle], normal) < minimumDot)) continue;
+
+                    triangleCharts[triangle] = chartIndex;
+                    chartTriangles.push_back(triangle);
+                }
+            }
+            chart.amountOfTriangles = chartTriangles.size() - chart.firstTriangle;
+
+            /* Project onto the plane facing along the normal, with axes built from whichever
+             * world axis is furthest from the normal so they're never degenerate. */
+            vector3f axis(1.0f, 0.0f, 0.0f);
+            if ((fabs(normal.y) <= fabs(normal.x)) && (fabs(normal.y) <= fabs(normal.z))) axis = vector3f(0.0f, 1.0f, 0.0f);
+            else if ((fabs(normal.z) <= fabs(normal.x)) && (fabs(normal.z) <= fabs(normal.y))) axis = vector3f(0.0f, 0.0f, 1.0f);
+            chart.tangent = Cross(axis, normal);
+            float length = sqrt(Dot(chart.tangent, chart.tangent));
+            chart.tangent = vector3f(chart.tangent.x / length, chart.tangent.y / length, chart.tangent.z / length);
+            chart.bitangent = Cross(normal, chart.tangent);
+
+            chart.minimumU = chart.minimumV = FLT_MAX;
+            chart.maximumU = chart.maximumV = -FLT_MAX;
+            for (unsigned int j = 0; (j < chart.amountOfTriangles); j++)
+            {
+                const Triangle& triangle = triangles[chartTriangles[chart.firstTriangle + j]];
+                for (unsigned int k = 0; (k < 3); k++)
+                {
+                    const vector3f& position = vertices[triangle.values[k]].position;
+                    float u = Dot(position, chart.tangent), v = Dot(position, chart.bitangent);
+                    chart.minimumU = std::min(chart.minimumU, u);
+                    chart.maximumU = std::max(chart.maximumU, u);
+                    chart.minimumV = std::min(chart.minimumV, v);
+                    chart.maximumV = std::max(chart.maximumV, v);
+                }
+            }
+            chart.width = chart.height = chart.x = chart.y = 0;
+            charts.push_back(chart);
+        }
+    }
+
+    bool LightmapUnwrapper::PackCharts(float scale)
+    {
+        unsigned int amountOfCharts = charts.size();
+        std::vector<unsigned int> widths(amountOfCharts), heights(amountOfCharts);
+        for (unsigned int i = 0; (i < amountOfCharts); i++)
+        {
+            // Rounded up, with room for the last texel and the padding on both sides
+            widths[i] = static_cast<unsigned int>(ceil((charts[i].maximumU - charts[i].minimumU) * scale))
+                + 1 + (settings.padding * 2);
+            heights[i] = static_cast<unsigned int>(ceil((charts[i].maximumV - charts[i].minimumV) * scale))
+                + 1 + (settings.padding * 2);
+            if ((widths[i] > settings.resolution) || (heights[i] > settings.resolution)) return false;
+        }
+
+        packOrder.resize(amountOfCharts);
+        for (unsigned int i = 0; (i < amountOfCharts); i++) packOrder[i] = i;
+        TallerChart tallerChart;
+        tallerChart.heights = &heights;
+        tallerChart.widths = &widths;
+        std::sort(packOrder.begin(), packOrder.end(), tallerChart);
+
+        // Fill rows left to right; each row is as tall as its first (tallest) chart
+        unsigned int x = 0, rowY = 0, rowHeight = 0;
+        for (unsigned int i = 0; (i < amountOfCharts); i++)
+        {
+            Chart& chart = charts[packOrder[i]];
+            chart.width = widths[packOrder[i]];
+            chart.height = heights[packOrder[i]];
+            if ((x + chart.width) > settings.resolution)
+            {
+                rowY += rowHeight;
+                x = rowHeight = 0;
+            }
+            if ((rowY + chart.height) > settings.resolution) return false;
+
+            chart.x = x;
+            chart.y = rowY;
+            x += chart.width;
+            if (chart.height > rowHeight) rowHeight = chart.height;
+        }
+
+        return true;
+    }
+
+}
+
+}
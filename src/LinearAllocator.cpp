@@ -0,0 +1,69 @@
+/*
+ * File:   LinearAllocator.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 10:50 AM
+ */
+
+#include <cstddef>
+#include "LinearAllocator.h"
+
+namespace parcel
+{
+
+namespace general
+{
+
+    LinearAllocator::LinearAllocator(unsigned int initialCapacity) :
+        memory(NULL), capacity(AlignSize(initialCapacity)), offset(0), overflowed(false), largestFailure(0)
+    {
+        // A block with no space could never grow by doubling
+        if (capacity < minimumCapacity) capacity = minimumCapacity;
+        memory = new char[capacity];
+    }
+
+    LinearAllocator::~LinearAllocator()
+    {
+        delete[] memory;
+    }
+
+
+    void* LinearAllocator::Allocate(unsigned int size)
+    {
+        size = AlignSize(size);
+
+        // If there isn't enough space left, remember it so the block grows on Reset()
+        if (size > (capacity - offset))
+        {
+            overflowed = true;
+            if (size > largestFailure) largestFailure = size;
+            return NULL;
+        }
+
+        void* allocation = (memory + offset);
+        offset += size;
+        return allocation;
+    }
+
+
+    void LinearAllocator::Reset()
+    {
+        /* If the block ran out of space since the last reset, replace it with one twice
+         * the size (or big enough for the largest allocation that failed, if that's bigger).
+         * This is the only time the allocator touches the heap. */
+        if (overflowed)
+        {
+            delete[] memory;
+            capacity *= 2;
+            if (capacity < largestFailure) capacity = largestFailure;
+            memory = new char[capacity];
+            overflowed = false;
+            largestFailure = 0;
+        }
+
+        offset = 0;
+    }
+
+}
+
+}
@@ -0,0 +1,186 @@
+/*
+ * File:   LuaFFI.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 3:30 AM
+ */
+
+#include <cstring>
+#include "LuaFFI.h"
+#include "LuaManager.h"
+
+namespace parcel
+{
+
+namespace lua
+{
+
+    namespace
+    {
+
+        /* The FFI declarations below have to match the C++ types exactly, so this stops the
+         * engine compiling if one of them changes size. */
+        typedef char Vector2fMatchesFFI[(sizeof(maths::vector2f) == 2 * sizeof(float)) ? 1 : -1];
+        typedef char Vector3fMatchesFFI[(sizeof(maths::vector3f) == 3 * sizeof(float)) ? 1 : -1];
+        typedef char ColourfMatchesFFI[(sizeof(graphics::colourf) == 4 * sizeof(float)) ? 1 : -1];
+        typedef char VertexMatchesFFI[(sizeof(graphics::Vertex) == 8 * sizeof(float)) ? 1 : -1];
+        typedef char TriangleMatchesFFI[(sizeof(graphics::Triangle) == 3 * sizeof(int)) ? 1 : -1];
+
+#ifdef PARCEL_LUAJIT
+        /* The module's Lua source. It's given a table of the functions' addresses (as light
+         * userdata) and returns the module. */
+        const char moduleSource[] =
+            "local ffi = require(\"ffi\")\n"
+            "local functions = ...\n"
+            "\n"
+            "ffi.cdef[[\n"
+            "typedef struct { float x, y; } parcel_vector2f;\n"
+            "typedef struct { float x, y, z; } parcel_vector3f;\n"
+            "typedef struct { float r, g, b, a; } parcel_colourf;\n"
+            "typedef struct { parcel_vector3f position; parcel_vector2f texCoord; parcel_vector3f normal; } parcel_Vertex;\n"
+            "typedef struct { int v1, v2, v3; } parcel_Triangle;\n"
+            "]]\n"
+            "\n"
+            "local vector3f\n"
+            "vector3f = ffi.metatype(\"parcel_vector3f\", {\n"
+            "    __add = function(a, b) return vector3f(a.x + b.x, a.y + b.y, a.z + b.z) end,\n"
+            "    __sub = function(a, b) return vector3f(a.x - b.x, a.y - b.y, a.z - b.z) end,\n"
+            "    __mul = function(a, s) return vector3f(a.x * s, a.y * s, a.z * s) end,\n"
+            "    __unm = function(a) return vector3f(-a.x, -a.y, -a.z) end,\n"
+            "    __index = {\n"
+            "        Length = function(a) return math.sqrt(a.x * a.x + a.y * a.y + a.z * a.z) end,\n"
+            "        Dot = function(a, b) return a.x * b.x + a.y * b.y + a.z * b.z end,\n"
+            "        Cross = function(a, b)\n"
+            "            return vector3f(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x)\n"
+            "        end\n"
+            "    }\n"
+            "})\n"
+            "\n"
+            "local parcel = {\n"
+            "    vector2f = ffi.typeof(\"parcel_vector2f\"),\n"
+            "    vector3f = vector3f,\n"
+            "    colourf = ffi.typeof(\"parcel_colourf\"),\n"
+            "    Vertex = ffi.typeof(\"parcel_Vertex\"),\n"
+            "    Triangle = ffi.typeof(\"parcel_Triangle\"),\n"
+            "    TransformPoints = ffi.cast(\"void (*)(parcel_vector3f*, unsigned int, const float*)\", functions.TransformPoints),\n"
+            "    TransformVertices = ffi.cast(\"void (*)(parcel_Vertex*, unsigned int, const float*)\", functions.TransformVertices),\n"
+            "    CalculateNormals = ffi.cast(\"void (*)(parcel_Vertex*, unsigned int, const parcel_Triangle*, unsigned int)\",\n"
+            "        functions.CalculateNormals),\n"
+            "    LerpColours = ffi.cast(\"void (*)(parcel_colourf*, const parcel_colourf*, unsigned int, float)\", functions.LerpColours)\n"
+            "}\n"
+            "\n"
+            "function parcel.ArrayFrom(pointer, typeName)\n"
+            "    return ffi.cast(typeName .. \"*\", pointer)\n"
+            "end\n"
+            "\n"
+            "return parcel\n";
+
+        /* Adds a function's address to the table on the top of the stack. */
+        void SetFunctionField(lua_State* vm, const char* name, void* function)
+        {
+            lua_pushlightuserdata(vm, function);
+            lua_setfield(vm, -2, name);
+        }
+#endif
+
+    }
+
+
+#ifdef PARCEL_LUAJIT
+    bool RegisterFFIModule(lua_State* vm)
+    {
+        int top = lua_gettop(vm);
+        if (luaL_loadbuffer(vm, moduleSource, strlen(moduleSource), "=parcel.ffi") != 0)
+        {
+            std::string message = lua_tostring(vm, -1);
+            lua_settop(vm, top);
+            throw LuaException("RegisterFFIModule - " + message);
+        }
+
+        // The FFI casts these back to function pointers with the right signatures
+        lua_newtable(vm);
+        SetFunctionField(vm, "TransformPoints", reinterpret_cast<void*>(&TransformPoints));
+        SetFunctionField(vm, "TransformVertices", reinterpret_cast<void*>(&TransformVertices));
+        SetFunctionField(vm, "CalculateNormals", reinterpret_cast<void*>(&CalculateNormals));
+        SetFunctionField(vm, "LerpColours", reinterpret_cast<void*>(&LerpColours));
+        if (lua_pcall(vm, 1, 1, 0) != 0)
+        {
+            std::string message = (lua_isstring(vm, -1)) ? lua_tostring(vm, -1) : "Unknown error.";
+            lua_settop(vm, top);
+            throw LuaException("RegisterFFIModule - " + message);
+        }
+
+        // Puts the module where require() finds it
+        lua_getglobal(vm, "package");
+        lua_getfield(vm, -1, "loaded");
+        lua_pushvalue(vm, -3);
+        lua_setfield(vm, -2, "parcel.ffi");
+        lua_settop(vm, top);
+        return true;
+    }
+#else
+    bool RegisterFFIModule(lua_State* /*vm*/)
+    {
+        return false;
+    }
+#endif
+
+
+    void TransformPoints(maths::vector3f* points, unsigned int count, const float* matrix)
+    {
+        for (unsigned int i = 0; (i < count); i++)
+        {
+            const maths::vector3f p = points[i];
+            points[i].x = matrix[0] * p.x + matrix[4] * p.y + matrix[8] * p.z + matrix[12];
+            points[i].y = matrix[1] * p.x + matrix[5] * p.y + matrix[9] * p.z + matrix[13];
+            points[i].z = matrix[2] * p.x + matrix[6] * p.y + matrix[10] * p.z + matrix[14];
+        }
+    }
+
+    void TransformVertices(graphics::Vertex* vertices, unsigned int count, const float* matrix)
+    {
+        for (unsigned int i = 0; (i < count); i++)
+        {
+            TransformPoints(&vertices[i].position, 1, matrix);
+
+            const maths::vector3f n = vertices[i].normal;
+            vertices[i].normal.x = matrix[0] * n.x + matrix[4] * n.y + matrix[8] * n.z;
+            vertices[i].normal.y = matrix[1] * n.x + matrix[5] * n.y + matrix[9] * n.z;
+            vertices[i].normal.z = matrix[2] * n.x + matrix[6] * n.y + matrix[10] * n.z;
+        }
+    }
+
+    void CalculateNormals(graphics::Vertex* vertices, unsigned int vertexCount,
+        const graphics::Triangle* triangles, unsigned int triangleCount)
+    {
+        for (unsigned int i = 0; (i < vertexCount); i++) vertices[i].normal.Zero();
+
+        // The cross product's length is twice the triangle's area, so bigger triangles count for more
+        for (unsigned int i = 0; (i < triangleCount); i++)
+        {
+            const graphics::Triangle& triangle = triangles[i];
+            maths::vector3f a = vertices[triangle.v1].position;
+            maths::vector3f b = vertices[triangle.v2].position;
+            maths::vector3f c = vertices[triangle.v3].position;
+            maths::vector3f normal = maths::vector3f::Cross(b - a, c - a);
+
+            for (unsigned int j = 0; (j < 3); j++) vertices[triangle.values[j]].normal += normal;
+        }
+
+        for (unsigned int i = 0; (i < vertexCount); i++)
+        {
+            if (vertices[i].normal.Length() > 0.0f) vertices[i].normal.Normalise();
+        }
+    }
+
+    void LerpColours(graphics::colourf* colours, const graphics::colourf* targets, unsigned int count, float t)
+    {
+        for (unsigned int i = 0; (i < count); i++)
+        {
+            for (unsigned int j = 0; (j < 4); j++) colours[i].values[j] += (targets[i].values[j] - colours[i].values[j]) * t;
+        }
+    }
+
+}
+
+}
@@ -0,0 +1,696 @@
+/*
+ * File:   LuaMaths.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 3:10 AM
+ * Changed ToMatrix() to copy element by element on October 19, 2026, 5:25 AM
+ */
+
+#include <new>
+#include "LuaMaths.h"
+
+namespace parcel
+{
+
+namespace lua
+{
+
+    LuaMatrix::LuaMatrix()
+    {
+        for (int i = 0; (i < 16); i++) values[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+    }
+
+    LuaMatrix::LuaMatrix(const float* data)
+    {
+        for (int i = 0; (i < 16); i++) values[i] = data[i];
+    }
+
+    LuaMatrix::LuaMatrix(const maths::Matrix<float>& matrix)
+    {
+        for (int i = 0; (i < 16); i++) values[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+
+        int rows = (matrix.Rows() < 4) ? matrix.Rows() : 4;
+        int columns = (matrix.Columns() < 4) ? matrix.Columns() : 4;
+        for (int column = 0; (column < columns); column++)
+        {
+            for (int row = 0; (row < rows); row++) (*this)(row, column) = matrix(row, column);
+        }
+    }
+
+    maths::Matrix<float> LuaMatrix::ToMatrix() const
+    {
+        /* Matrix's data constructor reads its array a row at a time, but 'values' is
+         * column-major, so the elements are copied one by one instead of transposing them. */
+        maths::Matrix<float> matrix(4);
+        for (int column = 0; (column < 4); column++)
+        {
+            for (int row = 0; (row < 4); row++) matrix.SetElement(row, column, (*this)(row, column));
+        }
+        return matrix;
+    }
+
+
+    namespace
+    {
+
+        /* Name of each type's metatable in the registry, what it's called in error messages and
+         * tostring(), and how many components it has. */
+        template<typename T> struct LuaType;
+
+        template<> struct LuaType<maths::vector2f>
+        {
+            enum { SIZE = 2 };
+            static const char* Name() { return "parcel.Vector2"; }
+            static const char* Label() { return "Vector2"; }
+        };
+
+        template<> struct LuaType<maths::vector3f>
+        {
+            enum { SIZE = 3 };
+            static const char* Name() { return "parcel.Vector3"; }
+            static const char* Label() { return "Vector3"; }
+        };
+
+        template<> struct LuaType<maths::vector4f>
+        {
+            enum { SIZE = 4 };
+            static const char* Name() { return "parcel.Vector4"; }
+            static const char* Label() { return "Vector4"; }
+        };
+
+        template<> struct LuaType<maths::quaternionf>
+        {
+            enum { SIZE = 4 };
+            static const char* Name() { return "parcel.Quaternion"; }
+            static const char* Label() { return "Quaternion"; }
+        };
+
+        template<> struct LuaType<LuaMatrix>
+        {
+            enum { SIZE = 16 };
+            static const char* Name() { return "parcel.Matrix"; }
+            static const char* Label() { return "Matrix"; }
+        };
+
+
+        /* Returns the userdata at 'index', raising a Lua error if it isn't a T. */
+        template<typename T> T* Check(lua_State* vm, int index)
+        {
+            return static_cast<T*>(luaL_checkudata(vm, index, LuaType<T>::Name()));
+        }
+
+        /* Returns the userdata at 'index', or NULL if it isn't a T. */
+        template<typename T> T* Test(lua_State* vm, int index)
+        {
+            void* userdata = lua_touserdata(vm, index);
+            if (!userdata || !lua_getmetatable(vm, index)) return NULL;
+
+            lua_getfield(vm, LUA_REGISTRYINDEX, LuaType<T>::Name());
+            bool isType = (lua_rawequal(vm, -1, -2) != 0);
+            lua_pop(vm, 2);
+            return (isType) ? static_cast<T*>(userdata) : NULL;
+        }
+
+        /* Pushes a new T, which is stored in the userdata itself, and returns it. */
+        template<typename T> T* New(lua_State* vm)
+        {
+            T* value = new (lua_newuserdata(vm, sizeof(T))) T();
+            luaL_getmetatable(vm, LuaType<T>::Name());
+            lua_setmetatable(vm, -2);
+            return value;
+        }
+
+        /* Returns which component the key at 'index' is (x, y, z or w, or 1 to SIZE), starting
+         * from 0, or -1 if it isn't one. */
+        template<typename T> int GetComponent(lua_State* vm, int index)
+        {
+            int component = -1;
+            if (lua_type(vm, index) == LUA_TNUMBER)
+            {
+                component = static_cast<int>(lua_tointeger(vm, index)) - 1;
+            }
+            else if (LuaType<T>::SIZE <= 4 && lua_type(vm, index) == LUA_TSTRING)
+            {
+                size_t length = 0;
+                const char* name = lua_tolstring(vm, index, &length);
+                if (length == 1)
+                {
+                    switch (name[0])
+                    {
+                        case 'x': component = 0; break;
+                        case 'y': component = 1; break;
+                        case 'z': component = 2; break;
+                        case 'w': component = 3; break;
+                    }
+                }
+            }
+            return (component < LuaType<T>::SIZE) ? component : -1;
+        }
+
+
+        /* Metamethods every type has. */
+
+        template<typename T> int Index(lua_State* vm)
+        {
+            const T* value = Check<T>(vm, 1);
+            int component = GetComponent<T>(vm, 2);
+            if (component >= 0)
+            {
+                lua_pushnumber(vm, value->values[component]);
+                return 1;
+            }
+
+            // Anything else is a method, which are kept in a table in the first upvalue
+            lua_pushvalue(vm, 2);
+            lua_rawget(vm, lua_upvalueindex(1));
+            return 1;
+        }
+
+        template<typename T> int NewIndex(lua_State* vm)
+        {
+            T* value = Check<T>(vm, 1);
+            int component = GetComponent<T>(vm, 2);
+            if (component < 0)
+            {
+                return luaL_error(vm, "%s has no component called '%s'", LuaType<T>::Label(),
+                    (lua_isstring(vm, 2)) ? lua_tostring(vm, 2) : luaL_typename(vm, 2));
+            }
+            value->values[component] = static_cast<float>(luaL_checknumber(vm, 3));
+            return 0;
+        }
+
+        template<typename T> int Add(lua_State* vm)
+        {
+            const T* a = Check<T>(vm, 1);
+            const T* b = Check<T>(vm, 2);
+            T* result = New<T>(vm);
+            for (int i = 0; (i < LuaType<T>::SIZE); i++) result->values[i] = a->values[i] + b->values[i];
+            return 1;
+        }
+
+        template<typename T> int Subtract(lua_State* vm)
+        {
+            const T* a = Check<T>(vm, 1);
+            const T* b = Check<T>(vm, 2);
+            T* result = New<T>(vm);
+            for (int i = 0; (i < LuaType<T>::SIZE); i++) result->values[i] = a->values[i] - b->values[i];
+            return 1;
+        }
+
+        template<typename T> int Negate(lua_State* vm)
+        {
+            const T* value = Check<T>(vm, 1);
+            T* result = New<T>(vm);
+            for (int i = 0; (i < LuaType<T>::SIZE); i++) result->values[i] = -value->values[i];
+            return 1;
+        }
+
+        /* Multiplies the T at 'index' by a number, pushing the result. */
+        template<typename T> int Scale(lua_State* vm, int index, float scale)
+        {
+            const T* value = Check<T>(vm, index);
+            T* result = New<T>(vm);
+            for (int i = 0; (i < LuaType<T>::SIZE); i++) result->values[i] = value->values[i] * scale;
+            return 1;
+        }
+
+        template<typename T> int Equals(lua_State* vm)
+        {
+            const T* a = Check<T>(vm, 1);
+            const T* b = Check<T>(vm, 2);
+            bool equal = true;
+            for (int i = 0; (i < LuaType<T>::SIZE && equal); i++) equal = (a->values[i] == b->values[i]);
+            lua_pushboolean(vm, equal);
+            return 1;
+        }
+
+        template<typename T> int ToString(lua_State* vm)
+        {
+            const T* value = Check<T>(vm, 1);
+
+            luaL_Buffer buffer;
+            luaL_buffinit(vm, &buffer);
+            luaL_addstring(&buffer, LuaType<T>::Label());
+            luaL_addchar(&buffer, '(');
+            for (int i = 0; (i < LuaType<T>::SIZE); i++)
+            {
+                if (i > 0) luaL_addstring(&buffer, ", ");
+                lua_pushnumber(vm, value->values[i]);
+                luaL_addvalue(&buffer);
+            }
+            luaL_addchar(&buffer, ')');
+            luaL_pushresult(&buffer);
+            return 1;
+        }
+
+        /* Returns every component, so scripts can read them all without indexing each one. */
+        template<typename T> int Unpack(lua_State* vm)
+        {
+            const T* value = Check<T>(vm, 1);
+            luaL_checkstack(vm, LuaType<T>::SIZE, "too many components to unpack");
+            for (int i = 0; (i < LuaType<T>::SIZE); i++) lua_pushnumber(vm, value->values[i]);
+            return LuaType<T>::SIZE;
+        }
+
+        template<typename T> float Dot(const T* a, const T* b)
+        {
+            float dot = 0.0f;
+            for (int i = 0; (i < LuaType<T>::SIZE); i++) dot += a->values[i] * b->values[i];
+            return dot;
+        }
+
+
+        /* Vectors and quaternions. */
+
+        template<typename T> int NewVector(lua_State* vm)
+        {
+            // Components that aren't given are 0
+            float values[LuaType<T>::SIZE];
+            for (int i = 0; (i < LuaType<T>::SIZE); i++) values[i] = static_cast<float>(luaL_optnumber(vm, i + 1, 0.0));
+
+            T* result = New<T>(vm);
+            for (int i = 0; (i < LuaType<T>::SIZE); i++) result->values[i] = values[i];
+            return 1;
+        }
+
+        template<typename T> int MultiplyVector(lua_State* vm)
+        {
+            // Either side can be a number, otherwise they're multiplied component by component
+            if (lua_type(vm, 1) == LUA_TNUMBER) return Scale<T>(vm, 2, static_cast<float>(lua_tonumber(vm, 1)));
+            if (lua_type(vm, 2) == LUA_TNUMBER) return Scale<T>(vm, 1, static_cast<float>(lua_tonumber(vm, 2)));
+
+            const T* a = Check<T>(vm, 1);
+            const T* b = Check<T>(vm, 2);
+            T* result = New<T>(vm);
+            for (int i = 0; (i < LuaType<T>::SIZE); i++) result->values[i] = a->values[i] * b->values[i];
+            return 1;
+        }
+
+        template<typename T> int DivideVector(lua_State* vm)
+        {
+            float divisor = static_cast<float>(luaL_checknumber(vm, 2));
+            if (divisor == 0.0f) return luaL_error(vm, "%s divided by zero", LuaType<T>::Label());
+            return Scale<T>(vm, 1, 1.0f / divisor);
+        }
+
+        template<typename T> int Length(lua_State* vm)
+        {
+            const T* value = Check<T>(vm, 1);
+            lua_pushnumber(vm, sqrt(Dot(value, value)));
+            return 1;
+        }
+
+        template<typename T> int SqrLength(lua_State* vm)
+        {
+            const T* value = Check<T>(vm, 1);
+            lua_pushnumber(vm, Dot(value, value));
+            return 1;
+        }
+
+        template<typename T> int DotMethod(lua_State* vm)
+        {
+            lua_pushnumber(vm, Dot(Check<T>(vm, 1), Check<T>(vm, 2)));
+            return 1;
+        }
+
+        /* Returns a normalised copy. Vectors with no length are returned as they are. */
+        template<typename T> int Normalised(lua_State* vm)
+        {
+            const T* value = Check<T>(vm, 1);
+            float length = sqrt(Dot(value, value));
+            return Scale<T>(vm, 1, (length > 0.0f) ? (1.0f / length) : 1.0f);
+        }
+
+        template<typename T> int Lerp(lua_State* vm)
+        {
+            const T* a = Check<T>(vm, 1);
+            const T* b = Check<T>(vm, 2);
+            float t = static_cast<float>(luaL_checknumber(vm, 3));
+            T* result = New<T>(vm);
+            for (int i = 0; (i < LuaType<T>::SIZE); i++) result->values[i] = a->values[i] + (b->values[i] - a->values[i]) * t;
+            return 1;
+        }
+
+        int Cross(lua_State* vm)
+        {
+            const maths::vector3f* a = Check<maths::vector3f>(vm, 1);
+            const maths::vector3f* b = Check<maths::vector3f>(vm, 2);
+            *New<maths::vector3f>(vm) = maths::vector3f::Cross(*a, *b);
+            return 1;
+        }
+
+        int NewQuaternion(lua_State* vm)
+        {
+            maths::quaternionf quaternion;
+            if (lua_gettop(vm) == 2)
+            {
+                // An angle in degrees, and the axis to rotate around
+                float degrees = static_cast<float>(luaL_checknumber(vm, 1));
+                quaternion.FromAxisAngle(degrees, *Check<maths::vector3f>(vm, 2));
+            }
+            else if (lua_gettop(vm) > 0)
+            {
+                for (int i = 0; (i < 4); i++) quaternion.values[i] = static_cast<float>(luaL_checknumber(vm, i + 1));
+            }
+
+            *New<maths::quaternionf>(vm) = quaternion;
+            return 1;
+        }
+
+        int MultiplyQuaternion(lua_State* vm)
+        {
+            if (lua_type(vm, 1) == LUA_TNUMBER) return Scale<maths::quaternionf>(vm, 2, static_cast<float>(lua_tonumber(vm, 1)));
+            if (lua_type(vm, 2) == LUA_TNUMBER) return Scale<maths::quaternionf>(vm, 1, static_cast<float>(lua_tonumber(vm, 2)));
+
+            maths::quaternionf a = *Check<maths::quaternionf>(vm, 1);
+            // Quaternions times vectors rotate them
+            const maths::vector3f* vector = Test<maths::vector3f>(vm, 2);
+            if (vector)
+            {
+                *New<maths::vector3f>(vm) = a * (*vector);
+            }
+            else
+            {
+                *New<maths::quaternionf>(vm) = a * (*Check<maths::quaternionf>(vm, 2));
+            }
+            return 1;
+        }
+
+        int Conjugate(lua_State* vm)
+        {
+            const maths::quaternionf* quaternion = Check<maths::quaternionf>(vm, 1);
+            *New<maths::quaternionf>(vm) = quaternion->GetConjugate();
+            return 1;
+        }
+
+        int Slerp(lua_State* vm)
+        {
+            const maths::quaternionf* a = Check<maths::quaternionf>(vm, 1);
+            const maths::quaternionf* b = Check<maths::quaternionf>(vm, 2);
+            float t = static_cast<float>(luaL_checknumber(vm, 3));
+            *New<maths::quaternionf>(vm) = maths::quaternionf::Slerp(*a, *b, t);
+            return 1;
+        }
+
+        int Nlerp(lua_State* vm)
+        {
+            const maths::quaternionf* a = Check<maths::quaternionf>(vm, 1);
+            const maths::quaternionf* b = Check<maths::quaternionf>(vm, 2);
+            float t = static_cast<float>(luaL_checknumber(vm, 3));
+            *New<maths::quaternionf>(vm) = maths::quaternionf::Nlerp(*a, *b, t);
+            return 1;
+        }
+
+        int QuaternionToMatrix(lua_State* vm)
+        {
+            const maths::quaternionf* quaternion = Check<maths::quaternionf>(vm, 1);
+            *New<LuaMatrix>(vm) = LuaMatrix(quaternion->ToRotationMatrix());
+            return 1;
+        }
+
+
+        /* Matrices. */
+
+        int NewMatrix(lua_State* vm)
+        {
+            LuaMatrix matrix;
+            if (lua_gettop(vm) > 0)
+            {
+                for (int i = 0; (i < 16); i++) matrix.values[i] = static_cast<float>(luaL_checknumber(vm, i + 1));
+            }
+
+            *New<LuaMatrix>(vm) = matrix;
+            return 1;
+        }
+
+        int MultiplyMatrix(lua_State* vm)
+        {
+            if (lua_type(vm, 1) == LUA_TNUMBER) return Scale<LuaMatrix>(vm, 2, static_cast<float>(lua_tonumber(vm, 1)));
+            if (lua_type(vm, 2) == LUA_TNUMBER) return Scale<LuaMatrix>(vm, 1, static_cast<float>(lua_tonumber(vm, 2)));
+
+            const LuaMatrix* m = Check<LuaMatrix>(vm, 1);
+            const maths::vector4f* vector4 = Test<maths::vector4f>(vm, 2);
+            if (vector4)
+            {
+                maths::vector4f* result = New<maths::vector4f>(vm);
+                for (int row = 0; (row < 4); row++)
+                {
+                    result->values[row] = (*m)(row, 0) * vector4->x + (*m)(row, 1) * vector4->y +
+                        (*m)(row, 2) * vector4->z + (*m)(row, 3) * vector4->w;
+                }
+                return 1;
+            }
+
+            // Like Matrix, only the top-left 3x3 is used for a Vector3 (so it's a direction)
+            const maths::vector3f* vector3 = Test<maths::vector3f>(vm, 2);
+            if (vector3)
+            {
+                maths::vector3f* result = New<maths::vector3f>(vm);
+                for (int row = 0; (row < 3); row++)
+                {
+                    result->values[row] = (*m)(row, 0) * vector3->x + (*m)(row, 1) * vector3->y + (*m)(row, 2) * vector3->z;
+                }
+                return 1;
+            }
+
+            const LuaMatrix* n = Check<LuaMatrix>(vm, 2);
+            LuaMatrix* result = New<LuaMatrix>(vm);
+            for (int column = 0; (column < 4); column++)
+            {
+                for (int row = 0; (row < 4); row++)
+                {
+                    (*result)(row, column) = (*m)(row, 0) * (*n)(0, column) + (*m)(row, 1) * (*n)(1, column) +
+                        (*m)(row, 2) * (*n)(2, column) + (*m)(row, 3) * (*n)(3, column);
+                }
+            }
+            return 1;
+        }
+
+        /* Returns the position a point's moved to, including the matrix's translation. */
+        int TransformPoint(lua_State* vm)
+        {
+            const LuaMatrix* m = Check<LuaMatrix>(vm, 1);
+            const maths::vector3f* point = Check<maths::vector3f>(vm, 2);
+            maths::vector3f* result = New<maths::vector3f>(vm);
+            for (int row = 0; (row < 3); row++)
+            {
+                result->values[row] = (*m)(row, 0) * point->x + (*m)(row, 1) * point->y +
+                    (*m)(row, 2) * point->z + (*m)(row, 3);
+            }
+            return 1;
+        }
+
+        /* Rows and columns start from 1 in Lua, like everything else. */
+        int GetElement(lua_State* vm)
+        {
+            const LuaMatrix* m = Check<LuaMatrix>(vm, 1);
+            int row = luaL_checkint(vm, 2), column = luaL_checkint(vm, 3);
+            luaL_argcheck(vm, row >= 1 && row <= 4, 2, "row must be from 1 to 4");
+            luaL_argcheck(vm, column >= 1 && column <= 4, 3, "column must be from 1 to 4");
+            lua_pushnumber(vm, (*m)(row - 1, column - 1));
+            return 1;
+        }
+
+        int SetElement(lua_State* vm)
+        {
+            LuaMatrix* m = Check<LuaMatrix>(vm, 1);
+            int row = luaL_checkint(vm, 2), column = luaL_checkint(vm, 3);
+            luaL_argcheck(vm, row >= 1 && row <= 4, 2, "row must be from 1 to 4");
+            luaL_argcheck(vm, column >= 1 && column <= 4, 3, "column must be from 1 to 4");
+            (*m)(row - 1, column - 1) = static_cast<float>(luaL_checknumber(vm, 4));
+            return 0;
+        }
+
+        int Transposed(lua_State* vm)
+        {
+            const LuaMatrix* m = Check<LuaMatrix>(vm, 1);
+            LuaMatrix* result = New<LuaMatrix>(vm);
+            for (int column = 0; (column < 4); column++)
+            {
+                for (int row = 0; (row < 4); row++) (*result)(row, column) = (*m)(column, row);
+            }
+            return 1;
+        }
+
+        int Inverse(lua_State* vm)
+        {
+            const LuaMatrix* m = Check<LuaMatrix>(vm, 1);
+            *New<LuaMatrix>(vm) = LuaMatrix(m->ToMatrix().Inverse());
+            return 1;
+        }
+
+        int Determinant(lua_State* vm)
+        {
+            const LuaMatrix* m = Check<LuaMatrix>(vm, 1);
+            lua_pushnumber(vm, m->ToMatrix().Determinant());
+            return 1;
+        }
+
+
+        const luaL_Reg vector2Metamethods[] = {
+            { "__newindex", NewIndex<maths::vector2f> }, { "__add", Add<maths::vector2f> },
+            { "__sub", Subtract<maths::vector2f> }, { "__mul", MultiplyVector<maths::vector2f> },
+            { "__div", DivideVector<maths::vector2f> }, { "__unm", Negate<maths::vector2f> },
+            { "__eq", Equals<maths::vector2f> }, { "__tostring", ToString<maths::vector2f> },
+            { NULL, NULL }
+        };
+        const luaL_Reg vector2Methods[] = {
+            { "Length", Length<maths::vector2f> }, { "SqrLength", SqrLength<maths::vector2f> },
+            { "Dot", DotMethod<maths::vector2f> }, { "Normalised", Normalised<maths::vector2f> },
+            { "Lerp", Lerp<maths::vector2f> }, { "Unpack", Unpack<maths::vector2f> },
+            { NULL, NULL }
+        };
+
+        const luaL_Reg vector3Metamethods[] = {
+            { "__newindex", NewIndex<maths::vector3f> }, { "__add", Add<maths::vector3f> },
+            { "__sub", Subtract<maths::vector3f> }, { "__mul", MultiplyVector<maths::vector3f> },
+            { "__div", DivideVector<maths::vector3f> }, { "__unm", Negate<maths::vector3f> },
+            { "__eq", Equals<maths::vector3f> }, { "__tostring", ToString<maths::vector3f> },
+            { NULL, NULL }
+        };
+        const luaL_Reg vector3Methods[] = {
+            { "Length", Length<maths::vector3f> }, { "SqrLength", SqrLength<maths::vector3f> },
+            { "Dot", DotMethod<maths::vector3f> }, { "Cross", Cross },
+            { "Normalised", Normalised<maths::vector3f> }, { "Lerp", Lerp<maths::vector3f> },
+            { "Unpack", Unpack<maths::vector3f> },
+            { NULL, NULL }
+        };
+
+        const luaL_Reg vector4Metamethods[] = {
+            { "__newindex", NewIndex<maths::vector4f> }, { "__add", Add<maths::vector4f> },
+            { "__sub", Subtract<maths::vector4f> }, { "__mul", MultiplyVector<maths::vector4f> },
+            { "__div", DivideVector<maths::vector4f> }, { "__unm", Negate<maths::vector4f> },
+            { "__eq", Equals<maths::vector4f> }, { "__tostring", ToString<maths::vector4f> },
+            { NULL, NULL }
+        };
+        const luaL_Reg vector4Methods[] = {
+            { "Length", Length<maths::vector4f> }, { "SqrLength", SqrLength<maths::vector4f> },
+            { "Dot", DotMethod<maths::vector4f> }, { "Normalised", Normalised<maths::vector4f> },
+            { "Lerp", Lerp<maths::vector4f> }, { "Unpack", Unpack<maths::vector4f> },
+            { NULL, NULL }
+        };
+
+        const luaL_Reg quaternionMetamethods[] = {
+            { "__newindex", NewIndex<maths::quaternionf> }, { "__add", Add<maths::quaternionf> },
+            { "__mul", MultiplyQuaternion }, { "__unm", Negate<maths::quaternionf> },
+            { "__eq", Equals<maths::quaternionf> }, { "__tostring", ToString<maths::quaternionf> },
+            { NULL, NULL }
+        };
+        const luaL_Reg quaternionMethods[] = {
+            { "Length", Length<maths::quaternionf> }, { "Dot", DotMethod<maths::quaternionf> },
+            { "Normalised", Normalised<maths::quaternionf> }, { "Conjugate", Conjugate },
+            { "Slerp", Slerp }, { "Nlerp", Nlerp }, { "ToMatrix", QuaternionToMatrix },
+            { "Unpack", Unpack<maths::quaternionf> },
+            { NULL, NULL }
+        };
+
+        const luaL_Reg matrixMetamethods[] = {
+            { "__newindex", NewIndex<LuaMatrix> }, { "__add", Add<LuaMatrix> },
+            { "__sub", Subtract<LuaMatrix> }, { "__mul", MultiplyMatrix },
+            { "__unm", Negate<LuaMatrix> }, { "__eq", Equals<LuaMatrix> },
+            { "__tostring", ToString<LuaMatrix> },
+            { NULL, NULL }
+        };
+        const luaL_Reg matrixMethods[] = {
+            { "Get", GetElement }, { "Set", SetElement }, { "Transposed", Transposed },
+            { "Inverse", Inverse }, { "Determinant", Determinant },
+            { "TransformPoint", TransformPoint }, { "Unpack", Unpack<LuaMatrix> },
+            { NULL, NULL }
+        };
+
+        const luaL_Reg mathsLibrary[] = {
+            { "Vector2", NewVector<maths::vector2f> }, { "Vector3", NewVector<maths::vector3f> },
+            { "Vector4", NewVector<maths::vector4f> }, { "Quaternion", NewQuaternion },
+            { "Matrix", NewMatrix },
+            { NULL, NULL }
+        };
+
+
+        /* Creates a type's metatable, with __index looking up components and then methods. */
+        template<typename T> void RegisterType(lua_State* vm, const luaL_Reg* metamethods, const luaL_Reg* methods)
+        {
+            luaL_newmetatable(vm, LuaType<T>::Name());
+            luaL_register(vm, NULL, metamethods);
+
+            lua_newtable(vm);
+            luaL_register(vm, NULL, methods);
+            lua_pushcclosure(vm, Index<T>, 1);
+            lua_setfield(vm, -2, "__index");
+
+            lua_pop(vm, 1);
+        }
+
+    }
+
+
+    void RegisterMathsLibrary(lua_State* vm)
+    {
+        RegisterType<maths::vector2f>(vm, vector2Metamethods, vector2Methods);
+        RegisterType<maths::vector3f>(vm, vector3Metamethods, vector3Methods);
+        RegisterType<maths::vector4f>(vm, vector4Metamethods, vector4Methods);
+        RegisterType<maths::quaternionf>(vm, quaternionMetamethods, quaternionMethods);
+        RegisterType<LuaMatrix>(vm, matrixMetamethods, matrixMethods);
+
+        luaL_register(vm, "maths", mathsLibrary);
+        lua_pop(vm, 1);
+    }
+
+
+    void PushUserdata(lua_State* vm, const maths::vector2f& value) { *New<maths::vector2f>(vm) = value; }
+    void PushUserdata(lua_State* vm, const maths::vector3f& value) { *New<maths::vector3f>(vm) = value; }
+    void PushUserdata(lua_State* vm, const maths::vector4f& value) { *New<maths::vector4f>(vm) = value; }
+    void PushUserdata(lua_State* vm, const maths::quaternionf& value) { *New<maths::quaternionf>(vm) = value; }
+    void PushUserdata(lua_State* vm, const LuaMatrix& value) { *New<LuaMatrix>(vm) = value; }
+    void PushUserdata(lua_State* vm, const maths::Matrix<float>& value) { *New<LuaMatrix>(vm) = LuaMatrix(value); }
+
+    bool ToUserdata(lua_State* vm, int index, maths::vector2f& value)
+    {
+        const maths::vector2f* userdata = Test<maths::vector2f>(vm, index);
+        if (userdata) value = *userdata;
+        return (userdata != NULL);
+    }
+
+    bool ToUserdata(lua_State* vm, int index, maths::vector3f& value)
+    {
+        const maths::vector3f* userdata = Test<maths::vector3f>(vm, index);
+        if (userdata) value = *userdata;
+        return (userdata != NULL);
+    }
+
+    bool ToUserdata(lua_State* vm, int index, maths::vector4f& value)
+    {
+        const maths::vector4f* userdata = Test<maths::vector4f>(vm, index);
+        if (userdata) value = *userdata;
+        return (userdata != NULL);
+    }
+
+    bool ToUserdata(lua_State* vm, int index, maths::quaternionf& value)
+    {
+        const maths::quaternionf* userdata = Test<maths::quaternionf>(vm, index);
+        if (userdata) value = *userdata;
+        return (userdata != NULL);
+    }
+
+    bool ToUserdata(lua_State* vm, int index, LuaMatrix& value)
+    {
+        const LuaMatrix* userdata = Test<LuaMatrix>(vm, index);
+        if (userdata) value = *userdata;
+        return (userdata != NULL);
+    }
+
+    bool ToUserdata(lua_State* vm, int index, maths::Matrix<float>& value)
+    {
+        const LuaMatrix* userdata = Test<LuaMatrix>(vm, index);
+        if (userdata) value = userdata->ToMatrix();
+        return (userdata != NULL);
+    }
+
+    maths::vector2f* CheckVector2(lua_State* vm, int index) { return Check<maths::vector2f>(vm, index); }
+    maths::vector3f* CheckVector3(lua_State* vm, int index) { return Check<maths::vector3f>(vm, index); }
+    maths::vector4f* CheckVector4(lua_State* vm, int index) { return Check<maths::vector4f>(vm, index); }
+    maths::quaternionf* CheckQuaternion(lua_State* vm, int index) { return Check<maths::quaternionf>(vm, index); }
+    LuaMatrix* CheckMatrix(lua_State* vm, int index) { return Check<LuaMatrix>(vm, index); }
+
+}
+
+}
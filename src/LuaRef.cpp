@@ -0,0 +1,326 @@
+/*
+ * File:   LuaRef.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 2:50 AM
+ * Changed to check the stack is balanced after setting and calling on October 19, 2026, 5:15 AM
+ */
+
+#include "LuaRef.h"
+#include "LuaManager.h"
+#include "LuaStackGuard.h"
+
+namespace parcel
+{
+
+namespace lua
+{
+
+    LuaRegistryRef::LuaRegistryRef() : vm(NULL), reference(LUA_NOREF)
+    {
+    }
+
+    LuaRegistryRef::LuaRegistryRef(lua_State* state) : vm(state)
+    {
+        reference = luaL_ref(vm, LUA_REGISTRYINDEX);
+    }
+
+    LuaRegistryRef::LuaRegistryRef(const LuaRegistryRef& other) : vm(other.vm), reference(LUA_NOREF)
+    {
+        if (vm)
+        {
+            other.Push();
+            reference = luaL_ref(vm, LUA_REGISTRYINDEX);
+        }
+    }
+
+    LuaRegistryRef& LuaRegistryRef::operator=(const LuaRegistryRef& other)
+    {
+        if (this == &other) return *this;
+
+        // Takes the new reference before releasing the old one, in case they're the same value
+        int newReference = LUA_NOREF;
+        if (other.vm)
+        {
+            other.Push();
+            newReference = luaL_ref(other.vm, LUA_REGISTRYINDEX);
+        }
+        if (vm) luaL_unref(vm, LUA_REGISTRYINDEX, reference);
+
+        vm = other.vm;
+        reference = newReference;
+        return *this;
+    }
+
+    LuaRegistryRef::~LuaRegistryRef()
+    {
+        if (vm) luaL_unref(vm, LUA_REGISTRYINDEX, reference);
+    }
+
+    void LuaRegistryRef::Push() const
+    {
+        if (vm) lua_rawgeti(vm, LUA_REGISTRYINDEX, reference);
+    }
+
+
+    LuaRef::LuaRef(lua_State* state, const std::string& fieldName, const std::string& fullName)
+        : table(state), name(fullName)
+    {
+        // The name is interned once, so reading the field never hashes it again
+        lua_pushlstring(state, fieldName.c_str(), fieldName.size());
+        key = LuaRegistryRef(state);
+    }
+
+    lua_State* LuaRef::GetVM() const
+    {
+        if (!table.GetState()) throw LuaException("LuaRef - Cannot use an empty reference!");
+        return table.GetState();
+    }
+
+    void LuaRef::PushValue() const
+    {
+        lua_State* vm = GetVM();
+
+        table.Push();
+        key.Push();
+        lua_gettable(vm, -2);
+        lua_remove(vm, -2);
+        if (lua_isnil(vm, -1))
+        {
+            lua_pop(vm, 1);
+            throw LuaException("LuaRef - Cannot find variable '" + name + "'.");
+        }
+    }
+
+    void LuaRef::SetValue()
+    {
+        lua_State* vm = GetVM();
+
+        // Table and key go underneath the value
+        table.Push();
+        key.Push();
+        lua_pushvalue(vm, -3);
+        lua_settable(vm, -3);
+        lua_pop(vm, 2);
+    }
+
+    int LuaRef::GetInt() const
+    {
+        LuaStackGuard guard(GetVM());
+        PushValue();
+        if (!lua_isnumber(table.GetState(), -1)) throw LuaException("LuaRef::GetInt - '" + name + "' is not a number!");
+        return static_cast<int>(lua_tointeger(table.GetState(), -1));
+    }
+
+    float LuaRef::GetFloat() const
+    {
+        return static_cast<float>(GetDouble());
+    }
+
+    double LuaRef::GetDouble() const
+    {
+        LuaStackGuard guard(GetVM());
+        PushValue();
+        if (!lua_isnumber(table.GetState(), -1)) throw LuaException("LuaRef::GetDouble - '" + name + "' is not a number!");
+        return lua_tonumber(table.GetState(), -1);
+    }
+
+    bool LuaRef::GetBool() const
+    {
+        LuaStackGuard guard(GetVM());
+        PushValue();
+        if (!lua_isboolean(table.GetState(), -1)) throw LuaException("LuaRef::GetBool - '" + name + "' is not a boolean!");
+        return (lua_toboolean(table.GetState(), -1) != 0);
+    }
+
+    std::string LuaRef::GetString() const
+    {
+        LuaStackGuard guard(GetVM());
+        PushValue();
+        if (!lua_isstring(table.GetState(), -1)) throw LuaException("LuaRef::GetString - '" + name + "' is not a string!");
+        size_t length = 0;
+        const char* value = lua_tolstring(table.GetState(), -1, &length);
+        return std::string(value, length);
+    }
+
+    bool LuaRef::Exists() const
+    {
+        lua_State* vm = table.GetState();
+        if (!vm) return false;
+
+        LuaStackGuard guard(vm);
+        table.Push();
+        key.Push();
+        lua_gettable(vm, -2);
+        return !lua_isnil(vm, -1);
+    }
+
+    void LuaRef::SetInt(int value)
+    {
+        SetDouble(value);
+    }
+
+    void LuaRef::SetFloat(float value)
+    {
+        SetDouble(value);
+    }
+
+    void LuaRef::SetDouble(double value)
+    {
+        LuaStackGuard guard(GetVM());
+        lua_pushnumber(table.GetState(), value);
+        SetValue();
+        guard.CheckBalanced("LuaRef::SetDouble");
+    }
+
+    void LuaRef::SetBool(bool value)
+    {
+        LuaStackGuard guard(GetVM());
+        lua_pushboolean(table.GetState(), value);
+        SetValue();
+        guard.CheckBalanced("LuaRef::SetBool");
+    }
+
+    void LuaRef::SetString(const std::string& value)
+    {
+        LuaStackGuard guard(GetVM());
+        lua_pushlstring(table.GetState(), value.c_str(), value.size());
+        SetValue();
+        guard.CheckBalanced("LuaRef::SetString");
+    }
+
+
+    LuaTableRef::LuaTableRef(lua_State* state, const std::string& tableName) : name(tableName)
+    {
+        if (!lua_istable(state, -1))
+        {
+            lua_pop(state, 1);
+            throw LuaException("LuaTableRef - '" + tableName + "' is not a table!");
+        }
+        vm = state;
+        reference = luaL_ref(vm, LUA_REGISTRYINDEX);
+    }
+
+    LuaRef LuaTableRef::GetFieldRef(const std::string& field) const
+    {
+        if (!vm) throw LuaException("LuaTableRef - Cannot get a field of an empty reference!");
+        Push();
+        return LuaRef(vm, field, name + "." + field);
+    }
+
+    void LuaTableRef::PushField(const std::string& field) const
+    {
+        Push();
+        lua_getfield(vm, -1, field.c_str());
+        lua_remove(vm, -2);
+        if (lua_isnil(vm, -1))
+        {
+            lua_pop(vm, 1);
+            throw LuaException("LuaTableRef - Field '" + name + "." + field + "' does not exist.");
+        }
+    }
+
+    int LuaTableRef::GetInt(const std::string& field) const
+    {
+        if (!vm) throw LuaException("LuaTableRef - Cannot get a field of an empty reference!");
+        LuaStackGuard guard(vm);
+        PushField(field);
+        if (!lua_isnumber(vm, -1)) throw LuaException("LuaTableRef::GetInt - '" + name + "." + field + "' is not a number!");
+        return static_cast<int>(lua_tointeger(vm, -1));
+    }
+
+    float LuaTableRef::GetFloat(const std::string& field) const
+    {
+        return static_cast<float>(GetDouble(field));
+    }
+
+    double LuaTableRef::GetDouble(const std::string& field) const
+    {
+        if (!vm) throw LuaException("LuaTableRef - Cannot get a field of an empty reference!");
+        LuaStackGuard guard(vm);
+        PushField(field);
+        if (!lua_isnumber(vm, -1)) throw LuaException("LuaTableRef::GetDouble - '" + name + "." + field + "' is not a number!");
+        return lua_tonumber(vm, -1);
+    }
+
+    bool LuaTableRef::GetBool(const std::string& field) const
+    {
+        if (!vm) throw LuaException("LuaTableRef - Cannot get a field of an empty reference!");
+        LuaStackGuard guard(vm);
+        PushField(field);
+        if (!lua_isboolean(vm, -1)) throw LuaException("LuaTableRef::GetBool - '" + name + "." + field + "' is not a boolean!");
+        return (lua_toboolean(vm, -1) != 0);
+    }
+
+    std::string LuaTableRef::GetString(const std::string& field) const
+    {
+        if (!vm) throw LuaException("LuaTableRef - Cannot get a field of an empty reference!");
+        LuaStackGuard guard(vm);
+        PushField(field);
+        if (!lua_isstring(vm, -1)) throw LuaException("LuaTableRef::GetString - '" + name + "." + field + "' is not a string!");
+        size_t length = 0;
+        const char* value = lua_tolstring(vm, -1, &length);
+        return std::string(value, length);
+    }
+
+
+    LuaFunctionRef::LuaFunctionRef(lua_State* state, const std::string& functionName) : name(functionName)
+    {
+        if (!lua_isfunction(state, -1))
+        {
+            lua_pop(state, 1);
+            throw LuaException("LuaFunctionRef - '" + functionName + "' is not a function!");
+        }
+        vm = state;
+        reference = luaL_ref(vm, LUA_REGISTRYINDEX);
+    }
+
+    void LuaFunctionRef::Invoke(int amountOfArguments, int amountOfResults) const
+    {
+        // The function goes underneath its arguments
+        Push();
+        lua_insert(vm, -(amountOfArguments + 1));
+        if (lua_pcall(vm, amountOfArguments, amountOfResults, 0) != 0)
+        {
+            std::string message = (lua_isstring(vm, -1)) ? lua_tostring(vm, -1) : "Unknown error.";
+            lua_pop(vm, 1);
+            throw LuaException("LuaFunctionRef - Calling '" + name + "' failed: " + message);
+        }
+    }
+
+    void LuaFunctionRef::Call() const
+    {
+        if (!vm) throw LuaException("LuaFunctionRef - Cannot call an empty reference!");
+        LuaStackGuard guard(vm);
+        Invoke(0, 0);
+        guard.CheckBalanced("LuaFunctionRef::Call");
+    }
+
+    void LuaFunctionRef::Call(double argument) const
+    {
+        if (!vm) throw LuaException("LuaFunctionRef - Cannot call an empty reference!");
+        LuaStackGuard guard(vm);
+        lua_pushnumber(vm, argument);
+        Invoke(1, 0);
+        guard.CheckBalanced("LuaFunctionRef::Call");
+    }
+
+    double LuaFunctionRef::CallForNumber(double argument) const
+    {
+        if (!vm) throw LuaException("LuaFunctionRef - Cannot call an empty reference!");
+        LuaStackGuard guard(vm);
+        lua_pushnumber(vm, argument);
+        Invoke(1, 1);
+        // Exactly the one result should be left above where the stack started
+        if (guard.GetPushed() != 1)
+        {
+            throw LuaException("LuaFunctionRef::CallForNumber - Left " + general::ToString(guard.GetPushed())
+                + " values on the Lua stack instead of 1.");
+        }
+        if (!lua_isnumber(vm, -1)) throw LuaException("LuaFunctionRef - '" + name + "' did not return a number!");
+        return lua_tonumber(vm, -1);
+    }
+
+}
+
+}
@@ -0,0 +1,871 @@
+/*
+ * File:   NullBackend.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 2:55 PM
+ * Added SetDepthWrite() on October 19, 2026, 4:55 AM
+ */
+
+#include <cstring>
+#include "NullBackend.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    NullBackend::NullBackend() :
+        matrixMode(MATRIXSTACK_MODELVIEW), modelviewDepth(1), projectionDepth(1),
+        nextBufferID(1), nextTextureID(1), boundTexture(0), boundArrayTexture(0),
+        nextFramebufferID(1), boundFramebuffer(0), nextRenderbufferID(1), nextQueryID(1), runningQuery(0),
+        nextListID(1), listBase(0), compilingList(0), currentProgram(0)
+    {
+        // Everything starts disabled and unbound, like in a new OpenGL context
+        for (unsigned int i = 0; (i < amountOfCapabilities); i++) capabilities[i] = false;
+        for (unsigned int i = 0; (i < amountOfClientArrays); i++) clientArrays[i] = false;
+        for (unsigned int i = 0; (i < maxLights); i++) lights[i] = false;
+        for (unsigned int i = 0; (i < amountOfBufferTargets); i++) boundBuffers[i] = 0;
+
+        vertexPointer.buffer = vertexPointer.offset = vertexPointer.stride = vertexPointer.size = 0;
+    }
+
+
+    void NullBackend::ValidationError(const std::string& message)
+    {
+        statistics.validationErrors++;
+        throw debug::UnsupportedOperationException(message);
+    }
+
+    void NullBackend::StateChange()
+    {
+        if (!compilingList) statistics.stateChanges++;
+    }
+
+    void NullBackend::MatrixOperation()
+    {
+        if (!compilingList) statistics.matrixOperations++;
+    }
+
+    void NullBackend::CountDraw(unsigned int amount)
+    {
+        // Draws made while building a display list are counted when the list is called
+        if (compilingList)
+        {
+            lists[compilingList].drawCalls++;
+            lists[compilingList].verticesDrawn += amount;
+        }
+        else
+        {
+            statistics.drawCalls++;
+            statistics.verticesDrawn += amount;
+        }
+    }
+
+
+    NullBackend::Buffer& NullBackend::GetBound(BufferTarget target, const char* method)
+    {
+        if (boundBuffers[target] == 0)
+        {
+            ValidationError(std::string("NullBackend::") + method + " - No buffer is bound to the target.");
+        }
+        return buffers[boundBuffers[target]];
+    }
+
+    unsigned int& NullBackend::GetMatrixDepth()
+    {
+        return (matrixMode == MATRIXSTACK_PROJECTION) ? projectionDepth : modelviewDepth;
+    }
+
+
+
+    void NullBackend::Enable(RenderCapability capability)
+    {
+        if (capability >= amountOfCapabilities) ValidationError("NullBackend::Enable - Invalid capability.");
+        capabilities[capability] = true;
+        StateChange();
+    }
+
+    void NullBackend::Disable(RenderCapability capability)
+    {
+        if (capability >= amountOfCapabilities) ValidationError("NullBackend::Disable - Invalid capability.");
+        capabilities[capability] = false;
+        StateChange();
+    }
+
+    bool NullBackend::IsEnabled(RenderCapability capability)
+    {
+        if (capability >= amountOfCapabilities) ValidationError("NullBackend::IsEnabled - Invalid capability.");
+        return capabilities[capability];
+    }
+
+    void NullBackend::SetBlendMode(BlendMode /*mode*/)
+    {
+        StateChange();
+    }
+
+    void NullBackend::SetDepthWrite(bool /*enabled*/)
+    {
+        StateChange();
+    }
+
+
+    void NullBackend::SetClearColour(const colourf& /*colour*/)
+    {
+        StateChange();
+    }
+
+    void NullBackend::Clear(unsigned int flags)
+    {
+        if (flags & ~(CLEAR_COLOUR | CLEAR_DEPTH)) ValidationError("NullBackend::Clear - Invalid clear flags.");
+    }
+
+    void NullBackend::SetViewport(int /*x*/, int /*y*/, int width, int height)
+    {
+        if (width < 0 || height < 0) ValidationError("NullBackend::SetViewport - Negative viewport size.");
+        StateChange();
+    }
+
+
+    void NullBackend::SetColour(const colourf& /*colour*/)
+    {
+        StateChange();
+    }
+
+    void NullBackend::SetMaterialColour(MaterialColour /*property*/, const colourf& /*colour*/)
+    {
+        StateChange();
+    }
+
+    void NullBackend::SetMaterialShininess(float shininess)
+    {
+        // OpenGL only accepts specular exponents between 0 and 128
+        if (shininess < 0.0f || shininess > 128.0f)
+        {
+            ValidationError("NullBackend::SetMaterialShininess - Shininess must be between 0 and 128.");
+        }
+        StateChange();
+    }
+
+
+    unsigned int NullBackend::GetMaxLights()
+    {
+        return maxLights;
+    }
+
+    void NullBackend::EnableLight(unsigned int light)
+    {
+        if (light >= maxLights) ValidationError("NullBackend::EnableLight - Invalid light.");
+        lights[light] = true;
+        StateChange();
+    }
+
+    void NullBackend::DisableLight(unsigned int light)
+    {
+        if (light >= maxLights) ValidationError("NullBackend::DisableLight - Invalid light.");
+        lights[light] = false;
+        StateChange();
+    }
+
+    void NullBackend::SetLightVector(unsigned int light, LightParameter parameter, const float* values)
+    {
+        if (light >= maxLights) ValidationError("NullBackend::SetLightVector - Invalid light.");
+        if (parameter > LIGHTPARAMETER_SPOTDIRECTION) ValidationError("NullBackend::SetLightVector - Parameter is not a vector.");
+        if (!values) ValidationError("NullBackend::SetLightVector - Given null values.");
+        StateChange();
+    }
+
+    void NullBackend::SetLightValue(unsigned int light, LightParameter parameter, float value)
+    {
+        if (light >= maxLights) ValidationError("NullBackend::SetLightValue - Invalid light.");
+        if (parameter <= LIGHTPARAMETER_SPOTDIRECTION || parameter > LIGHTPARAMETER_SPOTEXPONENT)
+        {
+            ValidationError("NullBackend::SetLightValue - Parameter is not a single value.");
+        }
+        // Cutoff has to be in [0, 90] or exactly 180, exponent in [0, 128], attenuation positive
+        if (parameter == LIGHTPARAMETER_SPOTCUTOFF && (value < 0.0f || (value > 90.0f && value != 180.0f)))
+        {
+            ValidationError("NullBackend::SetLightValue - Spotlight cutoff must be between 0 and 90, or 180.");
+        }
+        if (parameter == LIGHTPARAMETER_SPOTEXPONENT && (value < 0.0f || value > 128.0f))
+        {
+            ValidationError("NullBackend::SetLightValue - Spotlight exponent must be between 0 and 128.");
+        }
+        if (value < 0.0f) ValidationError("NullBackend::SetLightValue - Attenuation cannot be negative.");
+        StateChange();
+    }
+
+    void NullBackend::SetLightModel(const colourf& /*globalAmbient*/, bool /*localViewer*/, bool /*twoSided*/)
+    {
+        StateChange();
+    }
+
+
+    void NullBackend::SetMatrixMode(MatrixStack stack)
+    {
+        matrixMode = stack;
+        MatrixOperation();
+    }
+
+    void NullBackend::LoadMatrix(const float* matrix)
+    {
+        if (!matrix) ValidationError("NullBackend::LoadMatrix - Given a null matrix.");
+        MatrixOperation();
+    }
+
+    void NullBackend::MultiplyMatrix(const float* matrix)
+    {
+        if (!matrix) ValidationError("NullBackend::MultiplyMatrix - Given a null matrix.");
+        MatrixOperation();
+    }
+
+    void NullBackend::PushMatrix()
+    {
+        unsigned int& depth = GetMatrixDepth();
+        unsigned int maxDepth = (matrixMode == MATRIXSTACK_PROJECTION) ? maxProjectionDepth : maxModelviewDepth;
+        if (depth >= maxDepth) ValidationError("NullBackend::PushMatrix - Matrix stack overflow.");
+
+        // Calls inside display lists are executed when the list is called, so they don't change the depth now
+        if (!compilingList) depth++;
+        MatrixOperation();
+    }
+
+    void NullBackend::PopMatrix()
+    {
+        unsigned int& depth = GetMatrixDepth();
+        if (!compilingList)
+        {
+            if (depth <= 1) ValidationError("NullBackend::PopMatrix - Matrix stack underflow.");
+            depth--;
+        }
+        MatrixOperation();
+    }
+
+    void NullBackend::Translate(float /*x*/, float /*y*/, float /*z*/)
+    {
+        MatrixOperation();
+    }
+
+    void NullBackend::Rotate(float /*angle*/, float /*x*/, float /*y*/, float /*z*/)
+    {
+        MatrixOperation();
+    }
+
+
+    void NullBackend::GenerateBuffers(unsigned int amount, unsigned int* ids)
+    {
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            ids[i] = nextBufferID++;
+            buffers[ids[i]].mapped = false;
+        }
+    }
+
+    void NullBackend::DeleteBuffers(unsigned int amount, const unsigned int* ids)
+    {
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            // Deleting a bound buffer unbinds it, like OpenGL does
+            for (unsigned int j = 0; (j < amountOfBufferTargets); j++)
+            {
+                if (boundBuffers[j] == ids[i]) boundBuffers[j] = 0;
+            }
+            // Unknown IDs (and 0) are silently ignored, like OpenGL does
+            buffers.erase(ids[i]);
+        }
+    }
+
+    void NullBackend::BindBuffer(BufferTarget target, unsigned int id)
+    {
+        if (target >= amountOfBufferTargets) ValidationError("NullBackend::BindBuffer - Invalid target.");
+        if (id != 0 && buffers.find(id) == buffers.end())
+        {
+            ValidationError("NullBackend::BindBuffer - Buffer was never created.");
+        }
+
+        boundBuffers[target] = id;
+        StateChange();
+    }
+
+    unsigned int NullBackend::GetBoundBuffer(BufferTarget target)
+    {
+        if (target >= amountOfBufferTargets) ValidationError("NullBackend::GetBoundBuffer - Invalid target.");
+        return boundBuffers[target];
+    }
+
+    void NullBackend::BufferData(BufferTarget target, unsigned int size, const void* data)
+    {
+        Buffer& buffer = GetBound(target, "BufferData");
+        if (buffer.mapped) ValidationError("NullBackend::BufferData - Buffer is mapped.");
+
+        buffer.data.assign(size, 0);
+        if (data && size > 0)
+        {
+            memcpy(&buffer.data[0], data, size);
+            statistics.bufferBytesUploaded += size;
+        }
+    }
+
+    void* NullBackend::MapBuffer(BufferTarget target)
+    {
+        Buffer& buffer = GetBound(target, "MapBuffer");
+        if (buffer.mapped) ValidationError("NullBackend::MapBuffer - Buffer is already mapped.");
+        if (buffer.data.empty()) ValidationError("NullBackend::MapBuffer - Buffer has no storage.");
+
+        buffer.mapped = true;
+        return &buffer.data[0];
+    }
+
+    bool NullBackend::UnmapBuffer(BufferTarget target)
+    {
+        Buffer& buffer = GetBound(target, "UnmapBuffer");
+        if (!buffer.mapped) ValidationError("NullBackend::UnmapBuffer - Buffer is not mapped.");
+
+        // The whole buffer is mapped for writing, so all of it counts as uploaded
+        buffer.mapped = false;
+        statistics.bufferBytesUploaded += buffer.data.size();
+        return true;
+    }
+
+
+    void NullBackend::EnableClientArray(ClientArray clientArray)
+    {
+        if (clientArray >= amountOfClientArrays) ValidationError("NullBackend::EnableClientArray - Invalid array.");
+        clientArrays[clientArray] = true;
+        StateChange();
+    }
+
+    void NullBackend::DisableClientArray(ClientArray clientArray)
+    {
+        if (clientArray >= amountOfClientArrays) ValidationError("NullBackend::DisableClientArray - Invalid array.");
+        clientArrays[clientArray] = false;
+        StateChange();
+    }
+
+    bool NullBackend::IsClientArrayEnabled(ClientArray clientArray)
+    {
+        if (clientArray >= amountOfClientArrays) ValidationError("NullBackend::IsClientArrayEnabled - Invalid array.");
+        return clientArrays[clientArray];
+    }
+
+    void NullBackend::SetVertexPointer(unsigned int components, unsigned int stride, const void* pointer)
+    {
+        if (components < 2 || components > 4) ValidationError("NullBackend::SetVertexPointer - Invalid amount of components.");
+
+        // Remembers where the vertices are, so draw calls can be checked against the buffer's size
+        vertexPointer.buffer = boundBuffers[BUFFERTARGET_ARRAY];
+        vertexPointer.offset = (unsigned int)((const char*)pointer - (const char*)0);
+        vertexPointer.size = (components * sizeof(float));
+        vertexPointer.stride = (stride == 0) ? vertexPointer.size : stride;
+        StateChange();
+    }
+
+    void NullBackend::SetTexCoordPointer(unsigned int components, unsigned int /*stride*/, const void* /*pointer*/)
+    {
+        if (components < 1 || components > 4) ValidationError("NullBackend::SetTexCoordPointer - Invalid amount of components.");
+        StateChange();
+    }
+
+    void NullBackend::SetNormalPointer(unsigned int /*stride*/, const void* /*pointer*/)
+    {
+        StateChange();
+    }
+
+    void NullBackend::SetColourPointer(unsigned int components, unsigned int /*stride*/, const void* /*pointer*/)
+    {
+        if (components < 3 || components > 4) ValidationError("NullBackend::SetColourPointer - Invalid amount of components.");
+        StateChange();
+    }
+
+    void NullBackend::EnableAttributeArray(unsigned int /*location*/)
+    {
+        StateChange();
+    }
+
+    void NullBackend::DisableAttributeArray(unsigned int /*location*/)
+    {
+        StateChange();
+    }
+
+    void NullBackend::SetAttributePointer(unsigned int /*location*/, unsigned int components,
+        unsigned int /*stride*/, const void* /*pointer*/)
+    {
+        if (components < 1 || components > 4) ValidationError("NullBackend::SetAttributePointer - Invalid amount of components.");
+        StateChange();
+    }
+
+
+    void NullBackend::DrawArrays(PrimitiveType type, unsigned int start, unsigned int amount)
+    {
+        if (type > PRIMITIVETYPE_POLYGON) ValidationError("NullBackend::DrawArrays - Invalid primitive type.");
+        if (!clientArrays[CLIENTARRAY_VERTEX]) ValidationError("NullBackend::DrawArrays - Vertex array is not enabled.");
+
+        // If the vertices come from a buffer, makes sure the buffer is big enough
+        if (amount > 0 && vertexPointer.buffer != 0)
+        {
+            BufferTable::iterator it = buffers.find(vertexPointer.buffer);
+            if (it == buffers.end()) ValidationError("NullBackend::DrawArrays - Vertex buffer was deleted.");
+            if (it->second.mapped) ValidationError("NullBackend::DrawArrays - Vertex buffer is mapped.");
+
+            unsigned int end = vertexPointer.offset + ((start + amount - 1) * vertexPointer.stride) + vertexPointer.size;
+            if (end > it->second.data.size())
+            {
+                ValidationError("NullBackend::DrawArrays - Draw reads past the end of the vertex buffer.");
+            }
+        }
+
+        CountDraw(amount);
+    }
+
+    void NullBackend::DrawElements(PrimitiveType type, unsigned int start, unsigned int amount)
+    {
+        if (type > PRIMITIVETYPE_POLYGON) ValidationError("NullBackend::DrawElements - Invalid primitive type.");
+        if (!clientArrays[CLIENTARRAY_VERTEX]) ValidationError("NullBackend::DrawElements - Vertex array is not enabled.");
+
+        // Indices are always read from the element array buffer
+        Buffer& indices = GetBound(BUFFERTARGET_ELEMENTARRAY, "DrawElements");
+        if (indices.mapped) ValidationError("NullBackend::DrawElements - Index buffer is mapped.");
+        if (((start + amount) * sizeof(unsigned int)) > indices.data.size())
+        {
+            ValidationError("NullBackend::DrawElements - Draw reads past the end of the index buffer.");
+        }
+
+        CountDraw(amount);
+    }
+
+
+    void NullBackend::GenerateTextures(unsigned int amount, unsigned int* ids)
+    {
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            ids[i] = nextTextureID++;
+            textures[ids[i]] = 0;
+        }
+    }
+
+    void NullBackend::DeleteTextures(unsigned int amount, const unsigned int* ids)
+    {
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            if (boundTexture == ids[i]) boundTexture = 0;
+            if (boundArrayTexture == ids[i]) boundArrayTexture = 0;
+            textures.erase(ids[i]);
+            arrayLayers.erase(ids[i]);
+        }
+    }
+
+    bool NullBackend::IsTexture(unsigned int id)
+    {
+        return (textures.find(id) != textures.end());
+    }
+
+    void NullBackend::BindTexture(unsigned int id)
+    {
+        if (id != 0 && textures.find(id) == textures.end())
+        {
+            ValidationError("NullBackend::BindTexture - Texture was never created.");
+        }
+
+        boundTexture = id;
+        StateChange();
+    }
+
+    void NullBackend::SetTextureFilter(TextureFilter filter, bool magnification)
+    {
+        if (boundTexture == 0) ValidationError("NullBackend::SetTextureFilter - No texture is bound.");
+        // Mipmap filters can't be used for magnification
+        if (magnification && filter != TEXTUREFILTER_LINEAR && filter != TEXTUREFILTER_NEAREST)
+        {
+            ValidationError("NullBackend::SetTextureFilter - Magnification filter cannot use mipmaps.");
+        }
+        StateChange();
+    }
+
+    void NullBackend::SetTextureWrapping(TextureWrapping /*wrapping*/, unsigned int coordinate)
+    {
+        if (boundTexture == 0) ValidationError("NullBackend::SetTextureWrapping - No texture is bound.");
+        if (coordinate > 2) ValidationError("NullBackend::SetTextureWrapping - Invalid wrapping coordinate.");
+        StateChange();
+    }
+
+    void NullBackend::UploadTexture(unsigned int /*level*/, unsigned int width, unsigned int height,
+        PixelFormat format, const void* pixels)
+    {
+        if (boundTexture == 0) ValidationError("NullBackend::UploadTexture - No texture is bound.");
+
+        unsigned int bytes = (width * height * ((format == PIXELFORMAT_LUMINANCEALPHA) ? 2 : 4));
+        textures[boundTexture] += bytes;
+        if (pixels) statistics.textureBytesUploaded += bytes;
+    }
+
+
+    unsigned int NullBackend::GenerateLists(unsigned int amount)
+    {
+        if (amount == 0) return 0;
+
+        unsigned int first = nextListID;
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            DisplayList& list = lists[nextListID++];
+            list.drawCalls = list.verticesDrawn = 0;
+        }
+        return first;
+    }
+
+    void NullBackend::DeleteLists(unsigned int first, unsigned int amount)
+    {
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            lists.erase(first + i);
+        }
+    }
+
+    void NullBackend::BeginList(unsigned int id)
+    {
+        if (compilingList) ValidationError("NullBackend::BeginList - Already building a display list.");
+        if (lists.find(id) == lists.end()) ValidationError("NullBackend::BeginList - List was never created.");
+
+        // Rebuilding a list replaces what was in it
+        lists[id].drawCalls = lists[id].verticesDrawn = 0;
+        compilingList = id;
+    }
+
+    void NullBackend::EndList()
+    {
+        if (!compilingList) ValidationError("NullBackend::EndList - Not building a display list.");
+        compilingList = 0;
+    }
+
+    void NullBackend::SetListBase(unsigned int base)
+    {
+        listBase = base;
+        StateChange();
+    }
+
+    void NullBackend::CallLists(unsigned int amount, const unsigned char* ids)
+    {
+        // Adds the draw calls stored in every list that is called, missing lists are ignored like in OpenGL
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            ListTable::iterator it = lists.find(listBase + ids[i]);
+            if (it != lists.end())
+            {
+                statistics.drawCalls += it->second.drawCalls;
+                statistics.verticesDrawn += it->second.verticesDrawn;
+            }
+        }
+    }
+
+
+    void NullBackend::UseProgram(unsigned int handle)
+    {
+        // Programs aren't created through the backend, so any handle is accepted
+        currentProgram = handle;
+        StateChange();
+    }
+
+
+    bool NullBackend::SupportsTextureBuffers()
+    {
+        return true;
+    }
+
+    void NullBackend::BindTextureBuffer(unsigned int /*unit*/, unsigned int texture, unsigned int buffer)
+    {
+        if (texture != 0)
+        {
+            if (textures.find(texture) == textures.end())
+            {
+                ValidationError("NullBackend::BindTextureBuffer - Texture was never created.");
+            }
+            if (buffers.find(buffer) == buffers.end())
+            {
+                ValidationError("NullBackend::BindTextureBuffer - Buffer was never created.");
+            }
+        }
+
+        StateChange();
+    }
+
+
+    bool NullBackend::SupportsArrayTextures()
+    {
+        return true;
+    }
+
+    void NullBackend::BindArrayTexture(unsigned int unit, unsigned int texture)
+    {
+        if (texture != 0 && textures.find(texture) == textures.end())
+        {
+            ValidationError("NullBackend::BindArrayTexture - Texture was never created.");
+        }
+
+        if (unit == 0) boundArrayTexture = texture;
+        StateChange();
+    }
+
+    void NullBackend::AllocateArrayTexture(unsigned int width, unsigned int height, unsigned int layers,
+        const TextureParameters& params)
+    {
+        if (boundArrayTexture == 0) ValidationError("NullBackend::AllocateArrayTexture - No array texture is bound.");
+        if (layers == 0) ValidationError("NullBackend::AllocateArrayTexture - Cannot allocate zero layers.");
+        // Array textures only have one level, so they can't use mipmap filters
+        if ((params.minFilter != TEXTUREFILTER_LINEAR && params.minFilter != TEXTUREFILTER_NEAREST) ||
+            (params.magFilter != TEXTUREFILTER_LINEAR && params.magFilter != TEXTUREFILTER_NEAREST))
+        {
+            ValidationError("NullBackend::AllocateArrayTexture - Array textures cannot use mipmap filters.");
+        }
+
+        textures[boundArrayTexture] = (width * height * 4 * layers);
+        arrayLayers[boundArrayTexture] = layers;
+        StateChange();
+    }
+
+    void NullBackend::UploadArrayTextureLayer(unsigned int layer, unsigned int width, unsigned int height,
+        PixelFormat format, const void* pixels)
+    {
+        if (boundArrayTexture == 0) ValidationError("NullBackend::UploadArrayTextureLayer - No array texture is bound.");
+        if (layer >= arrayLayers[boundArrayTexture])
+        {
+            ValidationError("NullBackend::UploadArrayTextureLayer - Layer is outside of the array texture.");
+        }
+        if (!pixels) ValidationError("NullBackend::UploadArrayTextureLayer - Given null pixels.");
+
+        statistics.textureBytesUploaded += (width * height * ((format == PIXELFORMAT_LUMINANCEALPHA) ? 2 : 4));
+    }
+
+
+    void NullBackend::BindUnitTexture(unsigned int unit, unsigned int texture)
+    {
+        if (unit == 0) ValidationError("NullBackend::BindUnitTexture - Unit 0 must be bound with BindTexture().");
+        if (texture != 0 && textures.find(texture) == textures.end())
+        {
+            ValidationError("NullBackend::BindUnitTexture - Texture was never created.");
+        }
+        StateChange();
+    }
+
+    void NullBackend::SetUnitTexCoordPointer(unsigned int unit, unsigned int components, unsigned int /*stride*/,
+        const void* /*pointer*/)
+    {
+        if (unit == 0) ValidationError("NullBackend::SetUnitTexCoordPointer - Unit 0 must use SetTexCoordPointer().");
+        if (components < 1 || components > 4) ValidationError("NullBackend::SetUnitTexCoordPointer - Invalid amount of components.");
+        StateChange();
+    }
+
+    void NullBackend::DisableUnitTexCoordArray(unsigned int unit)
+    {
+        if (unit == 0) ValidationError("NullBackend::DisableUnitTexCoordArray - Unit 0 must use DisableClientArray().");
+        StateChange();
+    }
+
+
+    bool NullBackend::SupportsRenderTargets()
+    {
+        return true;
+    }
+
+    void NullBackend::GenerateFramebuffers(unsigned int amount, unsigned int* ids)
+    {
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            ids[i] = nextFramebufferID++;
+            framebuffers[ids[i]] = false;
+        }
+    }
+
+    void NullBackend::DeleteFramebuffers(unsigned int amount, const unsigned int* ids)
+    {
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            // Deleting the bound framebuffer goes back to drawing into the window
+            if (boundFramebuffer == ids[i]) boundFramebuffer = 0;
+            framebuffers.erase(ids[i]);
+        }
+    }
+
+    void NullBackend::BindFramebuffer(unsigned int id)
+    {
+        if (id != 0 && framebuffers.find(id) == framebuffers.end())
+        {
+            ValidationError("NullBackend::BindFramebuffer - Framebuffer was never created.");
+        }
+
+        boundFramebuffer = id;
+        StateChange();
+    }
+
+    void NullBackend::GenerateRenderbuffers(unsigned int amount, unsigned int* ids)
+    {
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            ids[i] = nextRenderbufferID++;
+            renderbuffers[ids[i]] = 0;
+        }
+    }
+
+    void NullBackend::DeleteRenderbuffers(unsigned int amount, const unsigned int* ids)
+    {
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            renderbuffers.erase(ids[i]);
+        }
+    }
+
+    void NullBackend::AllocateDepthRenderbuffer(unsigned int id, unsigned int width, unsigned int height)
+    {
+        if (renderbuffers.find(id) == renderbuffers.end())
+        {
+            ValidationError("NullBackend::AllocateDepthRenderbuffer - Renderbuffer was never created.");
+        }
+        if (width == 0 || height == 0) ValidationError("NullBackend::AllocateDepthRenderbuffer - Size is zero.");
+
+        // 24 bit depth buffers are stored in four bytes per pixel
+        renderbuffers[id] = (width * height * 4);
+    }
+
+    bool NullBackend::AttachToFramebuffer(unsigned int colourTexture, unsigned int depthRenderbuffer)
+    {
+        if (boundFramebuffer == 0) ValidationError("NullBackend::AttachToFramebuffer - Cannot attach to the window.");
+
+        // Like in OpenGL, a framebuffer is incomplete if its attachments don't have any storage
+        std::map<unsigned int, unsigned int>::const_iterator texture = textures.find(colourTexture);
+        std::map<unsigned int, unsigned int>::const_iterator depth = renderbuffers.find(depthRenderbuffer);
+        bool complete = (texture != textures.end() && texture->second > 0 &&
+            depth != renderbuffers.end() && depth->second > 0);
+
+        framebuffers[boundFramebuffer] = complete;
+        StateChange();
+        return complete;
+    }
+
+    void NullBackend::BlitFramebuffer(unsigned int source, unsigned int /*sourceWidth*/, unsigned int /*sourceHeight*/,
+        unsigned int destination, unsigned int /*destinationWidth*/, unsigned int /*destinationHeight*/)
+    {
+        if (source == destination) ValidationError("NullBackend::BlitFramebuffer - Cannot blit a framebuffer onto itself.");
+        if (source != 0 && !framebuffers[source]) ValidationError("NullBackend::BlitFramebuffer - Source is incomplete.");
+        if (destination != 0 && !framebuffers[destination])
+        {
+            ValidationError("NullBackend::BlitFramebuffer - Destination is incomplete.");
+        }
+
+        boundFramebuffer = destination;
+        StateChange();
+    }
+
+
+    bool NullBackend::SupportsTimerQueries()
+    {
+        return true;
+    }
+
+    void NullBackend::GenerateQueries(unsigned int amount, unsigned int* ids)
+    {
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            ids[i] = nextQueryID++;
+            queries[ids[i]] = false;
+        }
+    }
+
+    void NullBackend::DeleteQueries(unsigned int amount, const unsigned int* ids)
+    {
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            if (runningQuery == ids[i]) ValidationError("NullBackend::DeleteQueries - Query is still running.");
+            queries.erase(ids[i]);
+        }
+    }
+
+    void NullBackend::BeginTimerQuery(unsigned int id)
+    {
+        if (runningQuery) ValidationError("NullBackend::BeginTimerQuery - A timer query is already running.");
+        if (queries.find(id) == queries.end()) ValidationError("NullBackend::BeginTimerQuery - Query was never created.");
+
+        queries[id] = false;
+        runningQuery = id;
+    }
+
+    void NullBackend::EndTimerQuery()
+    {
+        if (!runningQuery) ValidationError("NullBackend::EndTimerQuery - No timer query is running.");
+
+        queries[runningQuery] = true;
+        runningQuery = 0;
+    }
+
+    bool NullBackend::GetTimerQueryResult(unsigned int id, float& milliseconds)
+    {
+        std::map<unsigned int, bool>::const_iterator it = queries.find(id);
+        if (it == queries.end()) ValidationError("NullBackend::GetTimerQueryResult - Query was never created.");
+        if (!it->second) return false;
+
+        // Nothing is drawn, so the GPU never takes any time
+        milliseconds = 0.0f;
+        return true;
+    }
+
+
+    bool NullBackend::SupportsShadowMaps()
+    {
+        return true;
+    }
+
+    void NullBackend::AllocateDepthTexture(unsigned int width, unsigned int height)
+    {
+        if (boundTexture == 0) ValidationError("NullBackend::AllocateDepthTexture - No texture is bound.");
+        if (width == 0 || height == 0) ValidationError("NullBackend::AllocateDepthTexture - Size must be above zero.");
+
+        // 24 bit depth is stored in four bytes per pixel
+        textures[boundTexture] += width * height * 4;
+        StateChange();
+    }
+
+    bool NullBackend::AttachDepthTextureToFramebuffer(unsigned int depthTexture)
+    {
+        if (boundFramebuffer == 0)
+        {
+            ValidationError("NullBackend::AttachDepthTextureToFramebuffer - Cannot attach to the window.");
+        }
+
+        std::map<unsigned int, unsigned int>::const_iterator texture = textures.find(depthTexture);
+        bool complete = (texture != textures.end() && texture->second > 0);
+
+        framebuffers[boundFramebuffer] = complete;
+        StateChange();
+        return complete;
+    }
+
+    void NullBackend::BlitFramebufferDepth(unsigned int source, unsigned int destination, unsigned int /*width*/,
+        unsigned int /*height*/)
+    {
+        if (source == destination) ValidationError("NullBackend::BlitFramebufferDepth - Cannot blit a framebuffer onto itself.");
+        if (source != 0 && !framebuffers[source]) ValidationError("NullBackend::BlitFramebufferDepth - Source is incomplete.");
+        if (destination != 0 && !framebuffers[destination])
+        {
+            ValidationError("NullBackend::BlitFramebufferDepth - Destination is incomplete.");
+        }
+
+        boundFramebuffer = destination;
+        StateChange();
+    }
+
+    void NullBackend::BindDepthTexture(unsigned int unit, unsigned int texture)
+    {
+        if (unit == 0) ValidationError("NullBackend::BindDepthTexture - Unit 0 must be bound with BindTexture().");
+        if (texture != 0 && textures.find(texture) == textures.end())
+        {
+            ValidationError("NullBackend::BindDepthTexture - Texture was never created.");
+        }
+        StateChange();
+    }
+
+    void NullBackend::SetPolygonOffset(float /*factor*/, float /*units*/)
+    {
+        StateChange();
+    }
+
+}
+
+}
@@ -0,0 +1,714 @@
+/*
+ * File:   OpenGLBackend.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 2:10 PM
+ * Added SetDepthWrite() on October 19, 2026, 4:55 AM
+ */
+
+#include "GLExtensions.h"
+#include "OpenGLBackend.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Functions that convert the backend's enumerators to OpenGL's. */
+    namespace
+    {
+
+        GLenum GetGLCapability(RenderCapability capability)
+        {
+            switch (capability)
+            {
+                case CAPABILITY_BLEND: return GL_BLEND;
+                case CAPABILITY_TEXTURE2D: return GL_TEXTURE_2D;
+                case CAPABILITY_DEPTHTEST: return GL_DEPTH_TEST;
+                case CAPABILITY_LIGHTING: return GL_LIGHTING;
+                case CAPABILITY_CULLFACE: return GL_CULL_FACE;
+                case CAPABILITY_NORMALIZE: return GL_NORMALIZE;
+                case CAPABILITY_POLYGONOFFSET: return GL_POLYGON_OFFSET_FILL;
+
+                default: throw debug::InvalidArgumentException("OpenGLBackend - Cannot recognize given capability.");
+            }
+        }
+
+        GLenum GetGLClientArray(ClientArray clientArray)
+        {
+            switch (clientArray)
+            {
+                case CLIENTARRAY_VERTEX: return GL_VERTEX_ARRAY;
+                case CLIENTARRAY_TEXCOORD: return GL_TEXTURE_COORD_ARRAY;
+                case CLIENTARRAY_NORMAL: return GL_NORMAL_ARRAY;
+                case CLIENTARRAY_COLOUR: return GL_COLOR_ARRAY;
+
+                default: throw debug::InvalidArgumentException("OpenGLBackend - Cannot recognize given client array.");
+            }
+        }
+
+        GLenum GetGLBufferTarget(BufferTarget target)
+        {
+            switch (target)
+            {
+                case BUFFERTARGET_ELEMENTARRAY: return GL_ELEMENT_ARRAY_BUFFER;
+                case BUFFERTARGET_TEXTURE: return GL_TEXTURE_BUFFER_ARB;
+                default: return GL_ARRAY_BUFFER;
+            }
+        }
+
+        GLenum GetGLPrimitive(PrimitiveType type)
+        {
+            switch (type)
+            {
+                case PRIMITIVETYPE_POINT: return GL_POINTS;
+                case PRIMITIVETYPE_LINE: return GL_LINES;
+                case PRIMITIVETYPE_LINESTRIP: return GL_LINE_STRIP;
+                case PRIMITIVETYPE_LINELOOP: return GL_LINE_LOOP;
+                case PRIMITIVETYPE_TRIANGLE: return GL_TRIANGLES;
+                case PRIMITIVETYPE_TRIANGLESTRIP: return GL_TRIANGLE_STRIP;
+                case PRIMITIVETYPE_TRIANGLEFAN: return GL_TRIANGLE_FAN;
+                case PRIMITIVETYPE_QUAD: return GL_QUADS;
+                case PRIMITIVETYPE_QUADSTRIP: return GL_QUAD_STRIP;
+                case PRIMITIVETYPE_POLYGON: return GL_POLYGON;
+
+                default: throw debug::UnsupportedOperationException("OpenGLBackend - Cannot recognize given primitive type.");
+            }
+        }
+
+        GLenum GetGLMaterialColour(MaterialColour property)
+        {
+            switch (property)
+            {
+                case MATERIALCOLOUR_AMBIENT: return GL_AMBIENT;
+                case MATERIALCOLOUR_DIFFUSE: return GL_DIFFUSE;
+                case MATERIALCOLOUR_SPECULAR: return GL_SPECULAR;
+                case MATERIALCOLOUR_EMISSION: return GL_EMISSION;
+
+                default: throw debug::InvalidArgumentException("OpenGLBackend - Cannot recognize given material colour.");
+            }
+        }
+
+        GLenum GetGLLightParameter(LightParameter parameter)
+        {
+            switch (parameter)
+            {
+                case LIGHTPARAMETER_AMBIENT: return GL_AMBIENT;
+                case LIGHTPARAMETER_DIFFUSE: return GL_DIFFUSE;
+                case LIGHTPARAMETER_SPECULAR: return GL_SPECULAR;
+                case LIGHTPARAMETER_POSITION: return GL_POSITION;
+                case LIGHTPARAMETER_SPOTDIRECTION: return GL_SPOT_DIRECTION;
+                case LIGHTPARAMETER_CONSTANTATTENUATION: return GL_CONSTANT_ATTENUATION;
+                case LIGHTPARAMETER_LINEARATTENUATION: return GL_LINEAR_ATTENUATION;
+                case LIGHTPARAMETER_QUADRATICATTENUATION: return GL_QUADRATIC_ATTENUATION;
+                case LIGHTPARAMETER_SPOTCUTOFF: return GL_SPOT_CUTOFF;
+                case LIGHTPARAMETER_SPOTEXPONENT: return GL_SPOT_EXPONENT;
+
+                default: throw debug::InvalidArgumentException("OpenGLBackend - Cannot recognize given light parameter.");
+            }
+        }
+
+        GLenum GetGLTextureFilter(TextureFilter filter)
+        {
+            switch (filter)
+            {
+                case TEXTUREFILTER_LINEAR: return GL_LINEAR;
+                case TEXTUREFILTER_NEAREST: return GL_NEAREST;
+                case TEXTUREFILTER_LINEARLINEAR: return GL_LINEAR_MIPMAP_LINEAR;
+                case TEXTUREFILTER_LINEARNEAREST: return GL_LINEAR_MIPMAP_NEAREST;
+                case TEXTUREFILTER_NEARESTLINEAR: return GL_NEAREST_MIPMAP_LINEAR;
+                case TEXTUREFILTER_NEARESTNEAREST: return GL_NEAREST_MIPMAP_NEAREST;
+
+                default: throw debug::InvalidArgumentException("OpenGLBackend - Invalid filter specified.");
+            }
+        }
+
+        GLenum GetGLTextureWrapping(TextureWrapping wrapping)
+        {
+            switch (wrapping)
+            {
+                case TEXTUREWRAP_CLAMP: return GL_CLAMP;
+                case TEXTUREWRAP_CLAMPTOEDGE: return GL_CLAMP_TO_EDGE;
+                case TEXTUREWRAP_REPEAT: return GL_REPEAT;
+
+                default: throw debug::InvalidArgumentException("OpenGLBackend - Invalid wrapping option specified.");
+            }
+        }
+
+        // Coordinates are 0 for S, 1 for T and 2 for R
+        GLenum GetGLWrapCoordinate(unsigned int coordinate)
+        {
+            switch (coordinate)
+            {
+                case 0: return GL_TEXTURE_WRAP_S;
+                case 1: return GL_TEXTURE_WRAP_T;
+                case 2: return GL_TEXTURE_WRAP_R;
+
+                default: throw debug::InvalidArgumentException("OpenGLBackend - Invalid wrapping coordinate specified.");
+            }
+        }
+
+        GLenum GetGLPixelFormat(PixelFormat format)
+        {
+            return (format == PIXELFORMAT_LUMINANCEALPHA) ? GL_LUMINANCE_ALPHA : GL_RGBA;
+        }
+
+    }
+
+
+    void OpenGLBackend::Enable(RenderCapability capability)
+    {
+        glEnable(GetGLCapability(capability));
+    }
+
+    void OpenGLBackend::Disable(RenderCapability capability)
+    {
+        glDisable(GetGLCapability(capability));
+    }
+
+    bool OpenGLBackend::IsEnabled(RenderCapability capability)
+    {
+        return (glIsEnabled(GetGLCapability(capability)) == GL_TRUE);
+    }
+
+    void OpenGLBackend::SetBlendMode(BlendMode mode)
+    {
+        if (mode == BLENDMODE_ADDITIVE) glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+        else glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+    void OpenGLBackend::SetDepthWrite(bool enabled)
+    {
+        glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+    }
+
+
+    void OpenGLBackend::SetClearColour(const colourf& colour)
+    {
+        glClearColor(colour.r, colour.g, colour.b, colour.a);
+    }
+
+    void OpenGLBackend::Clear(unsigned int flags)
+    {
+        GLbitfield mask = 0;
+        if (flags & CLEAR_COLOUR) mask |= GL_COLOR_BUFFER_BIT;
+        if (flags & CLEAR_DEPTH) mask |= GL_DEPTH_BUFFER_BIT;
+        glClear(mask);
+    }
+
+    void OpenGLBackend::SetViewport(int x, int y, int width, int height)
+    {
+        glViewport(x, y, width, height);
+    }
+
+
+    void OpenGLBackend::SetColour(const colourf& colour)
+    {
+        glColor4fv(colour.values);
+    }
+
+    void OpenGLBackend::SetMaterialColour(MaterialColour property, const colourf& colour)
+    {
+        glMaterialfv(GL_FRONT_AND_BACK, GetGLMaterialColour(property), colour.values);
+    }
+
+    void OpenGLBackend::SetMaterialShininess(float shininess)
+    {
+        glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, shininess);
+    }
+
+
+    unsigned int OpenGLBackend::GetMaxLights()
+    {
+        GLint maxLights = 0;
+        glGetIntegerv(GL_MAX_LIGHTS, &maxLights);
+        return maxLights;
+    }
+
+    void OpenGLBackend::EnableLight(unsigned int light)
+    {
+        // The light enumerators are consecutive, so GL_LIGHT0 + i is light i
+        glEnable(GL_LIGHT0 + light);
+    }
+
+    void OpenGLBackend::DisableLight(unsigned int light)
+    {
+        glDisable(GL_LIGHT0 + light);
+    }
+
+    void OpenGLBackend::SetLightVector(unsigned int light, LightParameter parameter, const float* values)
+    {
+        glLightfv(GL_LIGHT0 + light, GetGLLightParameter(parameter), values);
+    }
+
+    void OpenGLBackend::SetLightValue(unsigned int light, LightParameter parameter, float value)
+    {
+        glLightf(GL_LIGHT0 + light, GetGLLightParameter(parameter), value);
+    }
+
+    void OpenGLBackend::SetLightModel(const colourf& globalAmbient, bool localViewer, bool twoSided)
+    {
+        glLightModelfv(GL_LIGHT_MODEL_AMBIENT, globalAmbient.values);
+        glLightModeli(GL_LIGHT_MODEL_LOCAL_VIEWER, localViewer);
+        glLightModeli(GL_LIGHT_MODEL_TWO_SIDE, twoSided);
+    }
+
+
+    void OpenGLBackend::SetMatrixMode(MatrixStack stack)
+    {
+        glMatrixMode((stack == MATRIXSTACK_PROJECTION) ? GL_PROJECTION : GL_MODELVIEW);
+    }
+
+    void OpenGLBackend::LoadMatrix(const float* matrix)
+    {
+        glLoadMatrixf(matrix);
+    }
+
+    void OpenGLBackend::MultiplyMatrix(const float* matrix)
+    {
+        glMultMatrixf(matrix);
+    }
+
+    void OpenGLBackend::PushMatrix()
+    {
+        glPushMatrix();
+    }
+
+    void OpenGLBackend::PopMatrix()
+    {
+        glPopMatrix();
+    }
+
+    void OpenGLBackend::Translate(float x, float y, float z)
+    {
+        glTranslatef(x, y, z);
+    }
+
+    void OpenGLBackend::Rotate(float angle, float x, float y, float z)
+    {
+        glRotatef(angle, x, y, z);
+    }
+
+
+    void OpenGLBackend::GenerateBuffers(unsigned int amount, unsigned int* ids)
+    {
+        glGenBuffers(amount, ids);
+    }
+
+    void OpenGLBackend::DeleteBuffers(unsigned int amount, const unsigned int* ids)
+    {
+        glDeleteBuffers(amount, ids);
+    }
+
+    void OpenGLBackend::BindBuffer(BufferTarget target, unsigned int id)
+    {
+        glBindBuffer(GetGLBufferTarget(target), id);
+    }
+
+    unsigned int OpenGLBackend::GetBoundBuffer(BufferTarget target)
+    {
+        int buffer = 0;
+        switch (target)
+        {
+            case BUFFERTARGET_ELEMENTARRAY: glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &buffer); break;
+            // The texture buffer target's name is also used to ask for its binding
+            case BUFFERTARGET_TEXTURE: glGetIntegerv(GL_TEXTURE_BUFFER_ARB, &buffer); break;
+            default: glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &buffer); break;
+        }
+        return buffer;
+    }
+
+    void OpenGLBackend::BufferData(BufferTarget target, unsigned int size, const void* data)
+    {
+        glBufferData(GetGLBufferTarget(target), size, data, GL_DYNAMIC_DRAW);
+    }
+
+    void* OpenGLBackend::MapBuffer(BufferTarget target)
+    {
+        return glMapBuffer(GetGLBufferTarget(target), GL_WRITE_ONLY);
+    }
+
+    bool OpenGLBackend::UnmapBuffer(BufferTarget target)
+    {
+        return (glUnmapBuffer(GetGLBufferTarget(target)) == GL_TRUE);
+    }
+
+
+    void OpenGLBackend::EnableClientArray(ClientArray clientArray)
+    {
+        glEnableClientState(GetGLClientArray(clientArray));
+    }
+
+    void OpenGLBackend::DisableClientArray(ClientArray clientArray)
+    {
+        glDisableClientState(GetGLClientArray(clientArray));
+    }
+
+    bool OpenGLBackend::IsClientArrayEnabled(ClientArray clientArray)
+    {
+        return (glIsEnabled(GetGLClientArray(clientArray)) == GL_TRUE);
+    }
+
+    void OpenGLBackend::SetVertexPointer(unsigned int components, unsigned int stride, const void* pointer)
+    {
+        glVertexPointer(components, GL_FLOAT, stride, pointer);
+    }
+
+    void OpenGLBackend::SetTexCoordPointer(unsigned int components, unsigned int stride, const void* pointer)
+    {
+        glTexCoordPointer(components, GL_FLOAT, stride, pointer);
+    }
+
+    void OpenGLBackend::SetNormalPointer(unsigned int stride, const void* pointer)
+    {
+        glNormalPointer(GL_FLOAT, stride, pointer);
+    }
+
+    void OpenGLBackend::SetColourPointer(unsigned int components, unsigned int stride, const void* pointer)
+    {
+        glColorPointer(components, GL_FLOAT, stride, pointer);
+    }
+
+    void OpenGLBackend::EnableAttributeArray(unsigned int location)
+    {
+        glEnableVertexAttribArray(location);
+    }
+
+    void OpenGLBackend::DisableAttributeArray(unsigned int location)
+    {
+        glDisableVertexAttribArray(location);
+    }
+
+    void OpenGLBackend::SetAttributePointer(unsigned int location, unsigned int components,
+        unsigned int stride, const void* pointer)
+    {
+        glVertexAttribPointer(location, components, GL_FLOAT, GL_FALSE, stride, pointer);
+    }
+
+
+    void OpenGLBackend::DrawArrays(PrimitiveType type, unsigned int start, unsigned int amount)
+    {
+        glDrawArrays(GetGLPrimitive(type), start, amount);
+    }
+
+    void OpenGLBackend::DrawElements(PrimitiveType type, unsigned int start, unsigned int amount)
+    {
+        // The start is an offset into the index buffer, so it's converted to bytes
+        glDrawElements(GetGLPrimitive(type), amount, GL_UNSIGNED_INT,
+            (GLvoid*)(start * sizeof(unsigned int)));
+    }
+
+
+    void OpenGLBackend::GenerateTextures(unsigned int amount, unsigned int* ids)
+    {
+        glGenTextures(amount, ids);
+    }
+
+    void OpenGLBackend::DeleteTextures(unsigned int amount, const unsigned int* ids)
+    {
+        glDeleteTextures(amount, ids);
+    }
+
+    bool OpenGLBackend::IsTexture(unsigned int id)
+    {
+        return (glIsTexture(id) == GL_TRUE);
+    }
+
+    void OpenGLBackend::BindTexture(unsigned int id)
+    {
+        glBindTexture(GL_TEXTURE_2D, id);
+    }
+
+    void OpenGLBackend::SetTextureFilter(TextureFilter filter, bool magnification)
+    {
+        // Gets what filter mode it applies to by using the given boolean
+        GLenum mag = (magnification) ? GL_TEXTURE_MAG_FILTER : GL_TEXTURE_MIN_FILTER;
+        glTexParameterf(GL_TEXTURE_2D, mag, GetGLTextureFilter(filter));
+    }
+
+    void OpenGLBackend::SetTextureWrapping(TextureWrapping wrapping, unsigned int coordinate)
+    {
+        glTexParameterf(GL_TEXTURE_2D, GetGLWrapCoordinate(coordinate), GetGLTextureWrapping(wrapping));
+    }
+
+    void OpenGLBackend::UploadTexture(unsigned int level, unsigned int width, unsigned int height,
+        PixelFormat format, const void* pixels)
+    {
+        glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, width, height, 0, GetGLPixelFormat(format),
+            GL_UNSIGNED_BYTE, pixels);
+    }
+
+
+    unsigned int OpenGLBackend::GenerateLists(unsigned int amount)
+    {
+        return glGenLists(amount);
+    }
+
+    void OpenGLBackend::DeleteLists(unsigned int first, unsigned int amount)
+    {
+        glDeleteLists(first, amount);
+    }
+
+    void OpenGLBackend::BeginList(unsigned int id)
+    {
+        glNewList(id, GL_COMPILE);
+    }
+
+    void OpenGLBackend::EndList()
+    {
+        glEndList();
+    }
+
+    void OpenGLBackend::SetListBase(unsigned int base)
+    {
+        glListBase(base);
+    }
+
+    void OpenGLBackend::CallLists(unsigned int amount, const unsigned char* lists)
+    {
+        glCallLists(amount, GL_UNSIGNED_BYTE, lists);
+    }
+
+
+    void OpenGLBackend::UseProgram(unsigned int handle)
+    {
+        glUseProgram(handle);
+    }
+
+
+    bool OpenGLBackend::SupportsTextureBuffers()
+    {
+        return (GLEE_ARB_texture_buffer_object || GLEE_EXT_texture_buffer_object);
+    }
+
+    void OpenGLBackend::BindTextureBuffer(unsigned int unit, unsigned int texture, unsigned int buffer)
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_BUFFER_ARB, texture);
+        // Every texel of the buffer is four floats
+        if (texture != 0) glTexBufferARB(GL_TEXTURE_BUFFER_ARB, GL_RGBA32F_ARB, buffer);
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+
+    bool OpenGLBackend::SupportsArrayTextures()
+    {
+        return GLEE_EXT_texture_array;
+    }
+
+    void OpenGLBackend::BindArrayTexture(unsigned int unit, unsigned int texture)
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D_ARRAY_EXT, texture);
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+    void OpenGLBackend::AllocateArrayTexture(unsigned int width, unsigned int height, unsigned int layers,
+        const TextureParameters& params)
+    {
+        glTexImage3D(GL_TEXTURE_2D_ARRAY_EXT, 0, GL_RGBA, width, height, layers, 0, GL_RGBA,
+            GL_UNSIGNED_BYTE, NULL);
+
+        glTexParameterf(GL_TEXTURE_2D_ARRAY_EXT, GL_TEXTURE_MIN_FILTER, GetGLTextureFilter(params.minFilter));
+        glTexParameterf(GL_TEXTURE_2D_ARRAY_EXT, GL_TEXTURE_MAG_FILTER, GetGLTextureFilter(params.magFilter));
+        glTexParameterf(GL_TEXTURE_2D_ARRAY_EXT, GL_TEXTURE_WRAP_S, GetGLTextureWrapping(params.sWrapping));
+        glTexParameterf(GL_TEXTURE_2D_ARRAY_EXT, GL_TEXTURE_WRAP_T, GetGLTextureWrapping(params.tWrapping));
+    }
+
+    void OpenGLBackend::UploadArrayTextureLayer(unsigned int layer, unsigned int width, unsigned int height,
+        PixelFormat format, const void* pixels)
+    {
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY_EXT, 0, 0, 0, layer, width, height, 1, GetGLPixelFormat(format),
+            GL_UNSIGNED_BYTE, pixels);
+    }
+
+
+    void OpenGLBackend::BindUnitTexture(unsigned int unit, unsigned int texture)
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        if (texture != 0)
+        {
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+            glEnable(GL_TEXTURE_2D);
+        }
+        else
+        {
+            glDisable(GL_TEXTURE_2D);
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+    void OpenGLBackend::SetUnitTexCoordPointer(unsigned int unit, unsigned int components, unsigned int stride,
+        const void* pointer)
+    {
+        // Texture coordinate arrays belong to the client active unit, not the active one
+        glClientActiveTexture(GL_TEXTURE0 + unit);
+        glTexCoordPointer(components, GL_FLOAT, stride, pointer);
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+        glClientActiveTexture(GL_TEXTURE0);
+    }
+
+    void OpenGLBackend::DisableUnitTexCoordArray(unsigned int unit)
+    {
+        glClientActiveTexture(GL_TEXTURE0 + unit);
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        glClientActiveTexture(GL_TEXTURE0);
+    }
+
+
+    bool OpenGLBackend::SupportsRenderTargets()
+    {
+        // Blitting is needed to get what was drawn into a render target onto the window
+        return (GLEE_EXT_framebuffer_object && GLEE_EXT_framebuffer_blit);
+    }
+
+    void OpenGLBackend::GenerateFramebuffers(unsigned int amount, unsigned int* ids)
+    {
+        glGenFramebuffersEXT(amount, ids);
+    }
+
+    void OpenGLBackend::DeleteFramebuffers(unsigned int amount, const unsigned int* ids)
+    {
+        glDeleteFramebuffersEXT(amount, ids);
+    }
+
+    void OpenGLBackend::BindFramebuffer(unsigned int id)
+    {
+        glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, id);
+    }
+
+    void OpenGLBackend::GenerateRenderbuffers(unsigned int amount, unsigned int* ids)
+    {
+        glGenRenderbuffersEXT(amount, ids);
+    }
+
+    void OpenGLBackend::DeleteRenderbuffers(unsigned int amount, const unsigned int* ids)
+    {
+        glDeleteRenderbuffersEXT(amount, ids);
+    }
+
+    void OpenGLBackend::AllocateDepthRenderbuffer(unsigned int id, unsigned int width, unsigned int height)
+    {
+        glBindRenderbufferEXT(GL_RENDERBUFFER_EXT, id);
+        glRenderbufferStorageEXT(GL_RENDERBUFFER_EXT, GL_DEPTH_COMPONENT24, width, height);
+        glBindRenderbufferEXT(GL_RENDERBUFFER_EXT, 0);
+    }
+
+    bool OpenGLBackend::AttachToFramebuffer(unsigned int colourTexture, unsigned int depthRenderbuffer)
+    {
+        glFramebufferTexture2DEXT(GL_FRAMEBUFFER_EXT, GL_COLOR_ATTACHMENT0_EXT, GL_TEXTURE_2D, colourTexture, 0);
+        glFramebufferRenderbufferEXT(GL_FRAMEBUFFER_EXT, GL_DEPTH_ATTACHMENT_EXT, GL_RENDERBUFFER_EXT,
+            depthRenderbuffer);
+        return (glCheckFramebufferStatusEXT(GL_FRAMEBUFFER_EXT) == GL_FRAMEBUFFER_COMPLETE_EXT);
+    }
+
+    void OpenGLBackend::BlitFramebuffer(unsigned int source, unsigned int sourceWidth, unsigned int sourceHeight,
+        unsigned int destination, unsigned int destinationWidth, unsigned int destinationHeight)
+    {
+        glBindFramebufferEXT(GL_READ_FRAMEBUFFER_EXT, source);
+        glBindFramebufferEXT(GL_DRAW_FRAMEBUFFER_EXT, destination);
+        glBlitFramebufferEXT(0, 0, sourceWidth, sourceHeight, 0, 0, destinationWidth, destinationHeight,
+            GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        // Binds the destination for both reading and drawing, like BindFramebuffer() does
+        glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, destination);
+    }
+
+
+    bool OpenGLBackend::SupportsTimerQueries()
+    {
+        return GetGLExtensions().timerQuery;
+    }
+
+    void OpenGLBackend::GenerateQueries(unsigned int amount, unsigned int* ids)
+    {
+        glGenQueries(amount, ids);
+    }
+
+    void OpenGLBackend::DeleteQueries(unsigned int amount, const unsigned int* ids)
+    {
+        glDeleteQueries(amount, ids);
+    }
+
+    void OpenGLBackend::BeginTimerQuery(unsigned int id)
+    {
+        glBeginQuery(GL_TIME_ELAPSED, id);
+    }
+
+    void OpenGLBackend::EndTimerQuery()
+    {
+        glEndQuery(GL_TIME_ELAPSED);
+    }
+
+    bool OpenGLBackend::GetTimerQueryResult(unsigned int id, float& milliseconds)
+    {
+        GLint available = 0;
+        glGetQueryObjectiv(id, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) return false;
+
+        // The result is in nanoseconds
+        UINT64 nanoseconds = 0;
+        GetGLExtensions().getQueryObjectui64v(id, GL_QUERY_RESULT, &nanoseconds);
+        milliseconds = static_cast<float>(nanoseconds / 1000000.0);
+        return true;
+    }
+
+
+    bool OpenGLBackend::SupportsShadowMaps()
+    {
+        // Depth textures are drawn into through framebuffers, then compared against when they're read
+        return (SupportsRenderTargets() && GLEE_ARB_depth_texture && GLEE_ARB_shadow);
+    }
+
+    void OpenGLBackend::AllocateDepthTexture(unsigned int width, unsigned int height)
+    {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, width, height, 0, GL_DEPTH_COMPONENT,
+            GL_UNSIGNED_INT, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        // Reading gives 1 where the depth given is in front of the texture's, 0 where it's behind
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE_ARB, GL_COMPARE_R_TO_TEXTURE_ARB);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_FUNC_ARB, GL_LEQUAL);
+    }
+
+    bool OpenGLBackend::AttachDepthTextureToFramebuffer(unsigned int depthTexture)
+    {
+        glFramebufferTexture2DEXT(GL_FRAMEBUFFER_EXT, GL_COLOR_ATTACHMENT0_EXT, GL_TEXTURE_2D, 0, 0);
+        glFramebufferRenderbufferEXT(GL_FRAMEBUFFER_EXT, GL_DEPTH_ATTACHMENT_EXT, GL_RENDERBUFFER_EXT, 0);
+        glFramebufferTexture2DEXT(GL_FRAMEBUFFER_EXT, GL_DEPTH_ATTACHMENT_EXT, GL_TEXTURE_2D, depthTexture, 0);
+        // Without a colour buffer, the framebuffer is only complete if nothing's drawn into or read from one
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+        return (glCheckFramebufferStatusEXT(GL_FRAMEBUFFER_EXT) == GL_FRAMEBUFFER_COMPLETE_EXT);
+    }
+
+    void OpenGLBackend::BlitFramebufferDepth(unsigned int source, unsigned int destination, unsigned int width,
+        unsigned int height)
+    {
+        glBindFramebufferEXT(GL_READ_FRAMEBUFFER_EXT, source);
+        glBindFramebufferEXT(GL_DRAW_FRAMEBUFFER_EXT, destination);
+        // Depth can't be filtered, so it's only ever copied at the same size
+        glBlitFramebufferEXT(0, 0, width, height, 0, 0, width, height, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+        glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, destination);
+    }
+
+    void OpenGLBackend::BindDepthTexture(unsigned int unit, unsigned int texture)
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+    void OpenGLBackend::SetPolygonOffset(float factor, float units)
+    {
+        glPolygonOffset(factor, units);
+    }
+
+}
+
+}
@@ -0,0 +1,432 @@
+/*
+ * File:   ParticleSystem.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 11:10 PM
+ * Changed to draw particles without writing depth on October 19, 2026, 4:55 AM
+ */
+
+#include <cstddef>
+#include <xmmintrin.h>
+#include "ParticleSystem.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+using namespace maths;
+
+namespace graphics
+{
+
+    ParticleEmitter::ParticleEmitter(const ParticleEmitterSettings& emitterSettings, unsigned int randomSeed) :
+        memory(NULL), laneCapacity(0), amountOfParticles(0), emissionRemainder(0.0f), emitting(true),
+        randomState(randomSeed)
+    {
+        SetSettings(emitterSettings);
+    }
+
+    ParticleEmitter::~ParticleEmitter()
+    {
+        delete[] memory;
+    }
+
+
+    void ParticleEmitter::SetSettings(const ParticleEmitterSettings& newSettings)
+    {
+        if (newSettings.maxParticles == 0)
+        {
+            throw debug::InvalidArgumentException("ParticleEmitter::SetSettings - Maximum amount of particles must be above zero.");
+        }
+        if (newSettings.minLifetime <= 0.0f || newSettings.minLifetime > newSettings.maxLifetime)
+        {
+            throw debug::InvalidArgumentException(
+                "ParticleEmitter::SetSettings - Lifetimes must be above zero, and the minimum can't be above the maximum.");
+        }
+        if (newSettings.emissionRate < 0.0f)
+        {
+            throw debug::InvalidArgumentException("ParticleEmitter::SetSettings - Emission rate can't be negative.");
+        }
+
+        bool reallocate = (memory == NULL || newSettings.maxParticles != settings.maxParticles);
+        settings = newSettings;
+        if (reallocate) AllocateLanes();
+    }
+
+    void ParticleEmitter::AllocateLanes()
+    {
+        unsigned int newCapacity = (settings.maxParticles + 3) & ~3u;
+        unsigned int laneBytes = newCapacity * sizeof(float);
+
+        /* Extra 15 bytes so the start can be moved up to a 16 byte boundary. Everything is
+         * zeroed, since the padding at the end of each array is updated along with the
+         * particles, and garbage in it could be slow denormals. */
+        char* newMemory = new char[(laneBytes * AMOUNT_OF_LANES) + 15];
+        for (unsigned int i = 0; (i < (laneBytes * AMOUNT_OF_LANES) + 15); i++) newMemory[i] = 0;
+        char* aligned = newMemory + ((16 - (reinterpret_cast<size_t>(newMemory) & 15)) & 15);
+
+        // Keeps the particles that fit
+        if (amountOfParticles > settings.maxParticles) amountOfParticles = settings.maxParticles;
+        for (unsigned int lane = 0; (lane < AMOUNT_OF_LANES); lane++)
+        {
+            float* newLane = reinterpret_cast<float*>(aligned + (lane * laneBytes));
+            for (unsigned int i = 0; (i < amountOfParticles); i++) newLane[i] = lanes[lane][i];
+            lanes[lane] = newLane;
+        }
+
+        delete[] memory;
+        memory = newMemory;
+        laneCapacity = newCapacity;
+    }
+
+    float ParticleEmitter::Random()
+    {
+        // Linear congruential generator, using the top 24 bits since the low ones repeat quickly
+        randomState = (randomState * 1664525u) + 1013904223u;
+        return static_cast<float>(randomState >> 8) * (1.0f / 16777216.0f);
+    }
+
+
+    void ParticleEmitter::Update(float deltaTime)
+    {
+        if (deltaTime <= 0.0f) return;
+
+        Integrate(deltaTime);
+        KillDeadParticles();
+
+        // New particles are added after the others, so they don't need compacting
+        if (emitting)
+        {
+            emissionRemainder += settings.emissionRate * deltaTime;
+            unsigned int amount = static_cast<unsigned int>(emissionRemainder);
+            emissionRemainder -= static_cast<float>(amount);
+            Emit(amount);
+        }
+    }
+
+    void ParticleEmitter::Integrate(float deltaTime)
+    {
+        float dragFactor = 1.0f - (settings.drag * deltaTime);
+        if (dragFactor < 0.0f) dragFactor = 0.0f;
+
+        const __m128 dt = _mm_set1_ps(deltaTime);
+        const __m128 drag = _mm_set1_ps(dragFactor);
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 acceleration[3] = { _mm_set1_ps(settings.acceleration.x * deltaTime),
+            _mm_set1_ps(settings.acceleration.y * deltaTime), _mm_set1_ps(settings.acceleration.z * deltaTime) };
+
+        const colourf& start = settings.startColour;
+        const colourf& end = settings.endColour;
+        const __m128 startColour[4] = { _mm_set1_ps(start.r), _mm_set1_ps(start.g), _mm_set1_ps(start.b), _mm_set1_ps(start.a) };
+        const __m128 colourChange[4] = { _mm_set1_ps(end.r - start.r), _mm_set1_ps(end.g - start.g),
+            _mm_set1_ps(end.b - start.b), _mm_set1_ps(end.a - start.a) };
+        const __m128 startSize = _mm_set1_ps(settings.startSize);
+        const __m128 sizeChange = _mm_set1_ps(settings.endSize - settings.startSize);
+
+        // Goes over whole groups of four, the padding after the last particle is updated too
+        for (unsigned int i = 0; (i < amountOfParticles); i += 4)
+        {
+            for (unsigned int axis = 0; (axis < 3); axis++)
+            {
+                float* velocityLane = lanes[LANE_VELOCITYX + axis] + i;
+                float* positionLane = lanes[LANE_POSITIONX + axis] + i;
+
+                __m128 velocity = _mm_mul_ps(_mm_add_ps(_mm_load_ps(velocityLane), acceleration[axis]), drag);
+                _mm_store_ps(velocityLane, velocity);
+                _mm_store_ps(positionLane, _mm_add_ps(_mm_load_ps(positionLane), _mm_mul_ps(velocity, dt)));
+            }
+
+            __m128 age = _mm_add_ps(_mm_load_ps(lanes[LANE_AGE] + i), dt);
+            _mm_store_ps(lanes[LANE_AGE] + i, age);
+
+            // How far through its life each particle is, from 0 to 1
+            __m128 t = _mm_min_ps(_mm_mul_ps(age, _mm_load_ps(lanes[LANE_INVERSELIFETIME] + i)), one);
+            for (unsigned int c = 0; (c < 4); c++)
+            {
+                _mm_store_ps(lanes[LANE_RED + c] + i, _mm_add_ps(startColour[c], _mm_mul_ps(colourChange[c], t)));
+            }
+            _mm_store_ps(lanes[LANE_SIZE] + i, _mm_add_ps(startSize, _mm_mul_ps(sizeChange, t)));
+        }
+    }
+
+    void ParticleEmitter::KillDeadParticles()
+    {
+        const __m128 one = _mm_set1_ps(1.0f);
+        unsigned int write = 0;
+
+        for (unsigned int read = 0; (read < amountOfParticles); read += 4)
+        {
+            // A bit is set for every particle in the group that still has some life left
+            __m128 t = _mm_mul_ps(_mm_load_ps(lanes[LANE_AGE] + read), _mm_load_ps(lanes[LANE_INVERSELIFETIME] + read));
+            int alive = _mm_movemask_ps(_mm_cmplt_ps(t, one));
+            // Padding after the last particle isn't alive
+            if (amountOfParticles - read < 4) alive &= (1 << (amountOfParticles - read)) - 1;
+
+            if (alive == 15)
+            {
+                // The whole group survived, so it's moved down four at a time (if it has to move at all)
+                if (write != read)
+                {
+                    for (unsigned int lane = 0; (lane < AMOUNT_OF_LANES); lane++)
+                    {
+                        _mm_storeu_ps(lanes[lane] + write, _mm_load_ps(lanes[lane] + read));
+                    }
+                }
+                write += 4;
+                continue;
+            }
+
+            for (unsigned int particle = 0; (particle < 4); particle++)
+            {
+                if (alive & (1 << particle))
+                {
+                    for (unsigned int lane = 0; (lane < AMOUNT_OF_LANES); lane++)
+                    {
+                        lanes[lane][write] = lanes[lane][read + particle];
+                    }
+                    write++;
+                }
+            }
+        }
+
+        amountOfParticles = write;
+    }
+
+    void ParticleEmitter::Emit(unsigned int amount)
+    {
+        if (amount > settings.maxParticles - amountOfParticles) amount = settings.maxParticles - amountOfParticles;
+
+        const ParticleEmitterSettings& s = settings;
+        for (unsigned int i = amountOfParticles; (i < amountOfParticles + amount); i++)
+        {
+            lanes[LANE_POSITIONX][i] = Vary(s.position.x, s.positionVariation.x);
+            lanes[LANE_POSITIONY][i] = Vary(s.position.y, s.positionVariation.y);
+            lanes[LANE_POSITIONZ][i] = Vary(s.position.z, s.positionVariation.z);
+            lanes[LANE_VELOCITYX][i] = Vary(s.velocity.x, s.velocityVariation.x);
+            lanes[LANE_VELOCITYY][i] = Vary(s.velocity.y, s.velocityVariation.y);
+            lanes[LANE_VELOCITYZ][i] = Vary(s.velocity.z, s.velocityVariation.z);
+            lanes[LANE_AGE][i] = 0.0f;
+            lanes[LANE_INVERSELIFETIME][i] = 1.0f / (s.minLifetime + ((s.maxLifetime - s.minLifetime) * Random()));
+            lanes[LANE_RED][i] = s.startColour.r;
+            lanes[LANE_GREEN][i] = s.startColour.g;
+            lanes[LANE_BLUE][i] = s.startColour.b;
+            lanes[LANE_ALPHA][i] = s.startColour.a;
+            lanes[LANE_SIZE][i] = s.startSize;
+        }
+        amountOfParticles += amount;
+    }
+
+
+    unsigned int ParticleEmitter::WriteQuads(float* vertices, const float* right, const float* up) const
+    {
+        // Corners of the quad in half sizes along the right and up directions, anticlockwise from the bottom left
+        static const float corners[4][2] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+
+        float* v = vertices;
+        for (unsigned int i = 0; (i < amountOfParticles); i++)
+        {
+            float halfSize = lanes[LANE_SIZE][i] * 0.5f;
+            float rx = right[0] * halfSize, ry = right[1] * halfSize, rz = right[2] * halfSize;
+            float ux = up[0] * halfSize, uy = up[1] * halfSize, uz = up[2] * halfSize;
+
+            for (unsigned int corner = 0; (corner < 4); corner++)
+            {
+                float cx = corners[corner][0], cy = corners[corner][1];
+                v[0] = lanes[LANE_POSITIONX][i] + (rx * cx) + (ux * cy);
+                v[1] = lanes[LANE_POSITIONY][i] + (ry * cx) + (uy * cy);
+                v[2] = lanes[LANE_POSITIONZ][i] + (rz * cx) + (uz * cy);
+                v[3] = (cx + 1.0f) * 0.5f;
+                v[4] = (cy + 1.0f) * 0.5f;
+                v[5] = lanes[LANE_RED][i];
+                v[6] = lanes[LANE_GREEN][i];
+                v[7] = lanes[LANE_BLUE][i];
+                v[8] = lanes[LANE_ALPHA][i];
+                v += 9;
+            }
+        }
+
+        return amountOfParticles;
+    }
+
+
+
+
+    ParticleSystem::ParticleSystem(RenderDevice* device, general::ThreadPool* pool) :
+        nextSeed(1), renderDevice(device), backend(NULL), threadPool(pool), vboID(0),
+        currentJob(JOB_UPDATE), jobDeltaTime(0.0f), jobVertices(NULL)
+    {
+        if (!renderDevice)
+        {
+            throw debug::NullPointerException("ParticleSystem - Given a null render device!");
+        }
+
+        backend = renderDevice->GetBackend();
+        backend->GenerateBuffers(1, &vboID);
+    }
+
+    ParticleSystem::~ParticleSystem()
+    {
+        for (unsigned int i = 0; (i < emitters.size()); i++)
+        {
+            delete emitters[i];
+        }
+        emitters.clear();
+
+        backend->DeleteBuffers(1, &vboID);
+    }
+
+
+    ParticleEmitter* ParticleSystem::AddEmitter(const ParticleEmitterSettings& settings)
+    {
+        ParticleEmitter* emitter = new ParticleEmitter(settings, nextSeed);
+        // Spreads the seeds out, so emitters added one after the other don't look alike
+        nextSeed = (nextSeed * 747796405u) + 2891336453u;
+        emitters.push_back(emitter);
+        return emitter;
+    }
+
+    void ParticleSystem::RemoveEmitter(ParticleEmitter* emitter)
+    {
+        for (unsigned int i = 0; (i < emitters.size()); i++)
+        {
+            if (emitters[i] == emitter)
+            {
+                delete emitters[i];
+                emitters.erase(emitters.begin() + i);
+                return;
+            }
+        }
+    }
+
+    unsigned int ParticleSystem::GetAmountOfParticles() const
+    {
+        unsigned int total = 0;
+        for (unsigned int i = 0; (i < emitters.size()); i++)
+        {
+            total += emitters[i]->GetAmountOfParticles();
+        }
+        return total;
+    }
+
+
+    void ParticleSystem::RunJob(Job job)
+    {
+        currentJob = job;
+        if (threadPool && emitters.size() > 1)
+        {
+            threadPool->Dispatch(this, emitters.size());
+        }
+        else
+        {
+            for (unsigned int i = 0; (i < emitters.size()); i++) Execute(i, 0);
+        }
+    }
+
+    void ParticleSystem::Execute(unsigned int index, unsigned int /*threadIndex*/)
+    {
+        if (currentJob == JOB_UPDATE)
+        {
+            emitters[index]->Update(jobDeltaTime);
+        }
+        else
+        {
+            emitters[index]->WriteQuads(jobVertices + (particleOffsets[index] * floatsPerParticle),
+                cameraRight, cameraUp);
+        }
+    }
+
+
+    void ParticleSystem::Update(float deltaTime)
+    {
+        jobDeltaTime = deltaTime;
+        RunJob(JOB_UPDATE);
+    }
+
+    void ParticleSystem::Render()
+    {
+        // Works out where each emitter's quads go in the buffer
+        particleOffsets.resize(emitters.size());
+        unsigned int total = 0;
+        for (unsigned int i = 0; (i < emitters.size()); i++)
+        {
+            particleOffsets[i] = total;
+            total += emitters[i]->GetAmountOfParticles();
+        }
+        if (total == 0) return;
+
+        /* The camera's right and up directions are the first two rows of the view matrix,
+         * which are every fourth element since it's in column-major order. */
+        float view[16];
+        renderDevice->GetViewMatrix().ToArray(view);
+        cameraRight[0] = view[0]; cameraRight[1] = view[4]; cameraRight[2] = view[8];
+        cameraUp[0] = view[1]; cameraUp[1] = view[5]; cameraUp[2] = view[9];
+
+        /* Giving the buffer new storage every frame lets the driver keep drawing from last
+         * frame's while this one is written, instead of waiting for it to finish. */
+        backend->BindBuffer(BUFFERTARGET_ARRAY, vboID);
+        backend->BufferData(BUFFERTARGET_ARRAY, total * floatsPerParticle * sizeof(float), NULL);
+        jobVertices = (float*)backend->MapBuffer(BUFFERTARGET_ARRAY);
+        if (!jobVertices)
+        {
+            throw debug::Exception("ParticleSystem::Render - Could not map the vertex buffer.");
+        }
+        RunJob(JOB_WRITEQUADS);
+        jobVertices = NULL;
+        if (!backend->UnmapBuffer(BUFFERTARGET_ARRAY))
+        {
+            throw debug::Exception("ParticleSystem::Render - Vertex data got corrupted when changing data.");
+        }
+
+
+        // Points to the vertex arrays in the VBO
+        unsigned int stride = floatsPerVertex * sizeof(float);
+        unsigned int vertexOffset = 0,
+            texCoordOffset = sizeof(float) * 3,
+            colourOffset = sizeof(float) * 5;
+        backend->SetVertexPointer(3, stride, (void*)vertexOffset);
+        backend->SetTexCoordPointer(2, stride, (void*)texCoordOffset);
+        backend->SetColourPointer(4, stride, (void*)colourOffset);
+
+        backend->EnableClientArray(CLIENTARRAY_VERTEX);
+        backend->EnableClientArray(CLIENTARRAY_TEXCOORD);
+        backend->EnableClientArray(CLIENTARRAY_COLOUR);
+        backend->DisableClientArray(CLIENTARRAY_NORMAL);
+
+        // Particles have no normals, so they're drawn without lighting
+        bool lit = backend->IsEnabled(CAPABILITY_LIGHTING);
+        if (lit) backend->Disable(CAPABILITY_LIGHTING);
+
+        /* Particles are blended and drawn in no particular order, so they're still tested
+         * against the depth buffer but don't write to it. Otherwise a particle drawn first
+         * would hide the ones behind it that are drawn later, cutting holes in the effect. */
+        bool blended = backend->IsEnabled(CAPABILITY_BLEND);
+        if (!blended) backend->Enable(CAPABILITY_BLEND);
+        backend->SetDepthWrite(false);
+
+        for (unsigned int i = 0; (i < emitters.size()); i++)
+        {
+            unsigned int amount = emitters[i]->GetAmountOfParticles();
+            if (amount == 0) continue;
+
+            const ParticleEmitterSettings& settings = emitters[i]->GetSettings();
+            if (settings.skin == invalidHandle) renderDevice->ClearSkinAndTexture();
+            else if (renderDevice->GetCurrentSkin() != settings.skin) renderDevice->SetActiveSkin(settings.skin);
+
+            backend->SetBlendMode(settings.blendMode);
+            backend->DrawArrays(PRIMITIVETYPE_QUAD, particleOffsets[i] * 4, amount * 4);
+        }
+
+        // Puts back the state the other renderers expect
+        backend->DisableClientArray(CLIENTARRAY_COLOUR);
+        backend->SetBlendMode(BLENDMODE_ALPHA);
+        backend->SetDepthWrite(true);
+        if (!blended) backend->Disable(CAPABILITY_BLEND);
+        if (lit) backend->Enable(CAPABILITY_LIGHTING);
+        // Drawing with a colour array left the current colour undefined, so this sets it again
+        renderDevice->ClearSkinAndTexture();
+        backend->BindBuffer(BUFFERTARGET_ARRAY, 0);
+    }
+
+}
+
+}
@@ -1,461 +1,751 @@
-/*
- * File:   Program.cpp
- * Author: Donald "Datriot" Whyte
- *
- * Created on April 11, 2009, 10:25 AM
- */
-
-#include "Program.h"
-#include "Exceptions.h"
-
-namespace parcel
-{
-
-namespace graphics
-{
-
-    Program::Program() : linked(false), enabled(false)
-    {
-        glHandle = glCreateProgram();
-    }
-
-    Program::~Program()
-    {
-        /* Makes sure to delete every shader held in this program by
-         * explicitly calling their Delete() method. */
-        for (std::map<std::string, Shader*>::iterator it = shaders.begin();
-            (it != shaders.end()); it++)
-        {
-            delete it->second;
-        }
-
-        // Then deletes the program
-        glDeleteProgram(glHandle);
-    }
-
-
-    bool Program::Link()
-    {
-        // Makes sure the program isn't already linked
-        if (linked) return true;
-
-        glLinkProgram(glHandle);
-
-        // Checks if the program linked successfully
-        glGetProgramiv(glHandle, GL_LINK_STATUS, (GLint*)&linked);
-        // Just return true if it linked successfully
-        if (linked)
-        {
-            return true;
-        }
-        // If it never linked successfully, prints error message and returns false
-        else
-        {
-            // Finds out what went wrong by reading the info log
-            GLint infologLength = 0; // Used to get how long the log is
-            GLsizei charsWritten = 0; // Stores how many characters that are written to infolog
-            std::string infolog = ""; // Stores info log characters
-
-            // Gets length of the infolog
-            glGetProgramiv(glHandle, GL_INFO_LOG_LENGTH, &infologLength);
-
-            if (infologLength > 0)
-            {
-                // Resizes string to correct size and then stores infolog in it
-                infolog.resize(infologLength);
-                glGetProgramInfoLog(glHandle, infologLength, &charsWritten, &infolog[0]);
-            }
-
-            // Prints the error message
-            std::cout << "Program::Link - Program failed to link!" << std::endl
-                << infolog << std::endl;
-
-            return false;
-        }
-    }
-
-
-    void Program::Enable()
-    {
-        // Make sure that the program is linked before using it
-        if (!linked) return;
-
-        glUseProgram(glHandle);
-
-        enabled = true;
-    }
-
-    void Program::Disable()
-    {
-        // Just returns if the program hasn't been linked yet
-        if (!linked) return;
-
-        // Disables the current program, returning to fixed functionality
-        glUseProgram(0);
-
-        enabled = false;
-    }
-
-
-    bool Program::AddShader(Shader* shader, const std::string& id, bool attach)
-    {
-        // Checks if given ID is already taken
-        std::map<std::string, Shader*>::iterator it = shaders.find(id);
-
-        // If it couldn't find a shader with the given ID...
-        if (it == shaders.end())
-        {
-            // ...add the shader to the map
-            shaders[id] = shader;
-            // Also sets the shader's program handle to this one
-            std::map<std::string, Shader*>::iterator it = shaders.find(id);
-            it->second->SetProgramHandle(glHandle);
-
-            // Attaches the shader to this program if specified
-            if (attach)
-            {
-                it->second->Attach();
-            }
-
-            return true;
-        }
-        /* Otherwise, it found a shader with the given ID so... don't add shader to
-         * the map, return false =( */
-        else
-        {
-            delete shader;
-
-            return false;
-        }
-    }
-
-    bool Program::RemoveShader(const std::string& id)
-    {
-        // Tries to find a shader with the given id
-        std::map<std::string, Shader*>::iterator it = shaders.find(id);
-
-        // If it found the shader delete it
-        if (it != shaders.end())
-        {
-            // Automatically detaches the shader from the program
-            it->second->Detach();
-            // Deletes shader and erases pointer from map
-            delete it->second;
-            shaders.erase(it);
-
-            return false;
-        }
-        // Otherwise, just return false
-        else
-        {
-            return false;
-        }
-    }
-
-
-    Shader* Program::GetShader(const std::string& id)
-    {
-        // Tries to find and return the shader with the given ID
-        std::map<std::string, Shader*>::iterator it = shaders.find(id);
-
-        if (it != shaders.end())
-        {
-            return it->second;
-        }
-        else
-        {
-            return NULL;
-        }
-    }
-
-
-    std::vector<float> Program::GetUniformFloat(const std::string& varName, unsigned int amount) const
-    {
-        // Gets the location of the specified variable
-        GLint location = GetVariableLocation(varName, true);
-        // Holds all the values retrieved
-        std::vector<float> values;
-        // Resizes vector to the amount of values to read
-        values.resize(amount);
-        // Retrives the values from the variable and returns them
-        glGetUniformfv(glHandle, location, &values[0]);
-
-        return values;
-    }
-    maths::matrixf Program::GetUniformMatrixFloat(const std::string& varName, unsigned int rows,
-        unsigned int columns) const
-    {
-        // First of all, makes sure that the given sizes for the matrix are compatible
-        if (rows < 2 || rows > 4 || columns < 2 || columns > 4)
-        {
-            throw debug::InvalidArgumentException(
-                "Program::GetUniformMatrix - Rows or columns is an invalid size, cannot get the values.");
-        }
-
-        // Gets the location of the uniform matrix
-        GLint location = GetVariableLocation(varName, true);
-        // Declares and initialises an array to hold the retrieved values
-        float* values = new float[rows * columns];
-        // Gets the values and stores the in the above array
-        glGetUniformfv(glHandle, location, &values[0]);
-
-        // Creates a matrix filled with the retrieved values
-        maths::matrixf mat(rows, columns, values);
-        // Makes sure to delete the values
-        delete values;
-        // Returns the matrix
-        return mat;
-    }
-
-    void Program::SetUniform(const std::string& varName, const std::vector<float>& values)
-    {
-        // Gets location of variable and the amount of values to set
-        GLint location = GetVariableLocation(varName, true);
-        unsigned int amount = values.size();
-
-        if (amount == 0)
-        {
-            throw debug::InvalidArgumentException(
-                "Program::SetUniform - Cannot pass zero amount of values!");
-        }
-
-        // Sets the values
-        glUniform1fv(location, amount, &values[0]);
-    }
-    void Program::SetUniform(const std::string& varName, const std::vector<maths::vector2f>& values)
-    {
-        GLint location = GetVariableLocation(varName, true);
-        unsigned int amount = values.size();
-        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
-        glUniform2fv(location, amount, &values[0].x);
-    }
-    void Program::SetUniform(const std::string& varName, const std::vector<maths::vector3f>& values)
-    {
-        GLint location = GetVariableLocation(varName, true);
-        unsigned int amount = values.size();
-        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
-        glUniform3fv(location, amount, &values[0].x);
-    }
-    void Program::SetUniform(const std::string& varName, const std::vector<maths::vector4f>& values)
-    {
-        GLint location = GetVariableLocation(varName, true);
-        unsigned int amount = values.size();
-        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
-        glUniform4fv(location, amount, &values[0].x);
-    }
-    void Program::SetUniformMatrix(const std::string& varName, const maths::matrixf& mat)
-    {
-        // Finds location of variable
-        GLint location = GetVariableLocation(varName, true);
-        // Gets size of the matrix
-        const int& rows = mat.Rows(), columns = mat.Columns();
-        // Puts matrix's values into an array
-        float* matValues = mat.ToArray();
-
-        // Checks the size of the given matrix to call the appropriate function
-        if (rows == 2 && columns == 2) glUniformMatrix2fv(location, 1, false, matValues);
-        else if (rows == 2 && columns == 3) glUniformMatrix2x3fv(location, 1, false, matValues);
-        else if (rows == 2 && columns == 4) glUniformMatrix2x4fv(location, 1, false, matValues);
-        else if (rows == 3 && columns == 2) glUniformMatrix3x2fv(location, 1, false, matValues);
-        else if (rows == 3 && columns == 3) glUniformMatrix3fv(location, 1, false, matValues);
-        else if (rows == 3 && columns == 4) glUniformMatrix3x4fv(location, 1, false, matValues);
-        else if (rows == 4 && columns == 2) glUniformMatrix4x2fv(location, 1, false, matValues);
-        else if (rows == 4 && columns == 3) glUniformMatrix4x3fv(location, 1, false, matValues);
-        else if (rows == 4 && columns == 4) glUniformMatrix4fv(location, 1, false, matValues);
-        // Otherwise, the size is not compatible; throw an exception
-        else
-        {
-            delete matValues;
-            throw debug::InvalidArgumentException("Program::SetUniformMatrix - A matrix with an invalid size has been passed.");
-        }
-
-        delete matValues; // Makes sure the allocated memory is released
-    }
-
-
-    std::vector<int> Program::GetUniformInt(const std::string& varName, unsigned int amount) const
-    {
-        GLint location = GetVariableLocation(varName, true);
-        std::vector<int> values;
-        values.resize(amount);
-        glGetUniformiv(glHandle, location, &values[0]);
-        return values;
-    }
-    maths::matrixi Program::GetUniformMatrixInt(const std::string& varName, unsigned int rows,
-        unsigned int columns) const
-    {
-        // First of all, makes sure that the given sizes for the matrix are compatible
-        if (rows < 2 || rows > 4 || columns < 2 || columns > 4)
-        {
-            throw debug::InvalidArgumentException(
-                "Program::GetUniformMatrix - Rows or columns is an invalid size, cannot get the values.");
-        }
-
-        // Gets the location of the uniform matrix
-        GLint location = GetVariableLocation(varName, true);
-        // Declares and initialises an array to hold the retrieved values
-        int* values = new int[rows * columns];
-        // Gets the values and stores the in the above array
-        glGetUniformfv(glHandle, location, (GLfloat*)&values[0]);
-
-        // Creates a matrix filled with the retrieved values
-        maths::matrixi mat(rows, columns, values);
-        // Makes sure to delete the values
-        delete values;
-        // Returns the matrix
-        return mat;
-    }
-
-    void Program::SetUniform(const std::string& varName, const std::vector<int>& values)
-    {
-        GLint location = GetVariableLocation(varName, true);
-        unsigned int amount = values.size();
-        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
-        glUniform1iv(location, amount, &values[0]);
-    }
-    void Program::SetUniform(const std::string& varName, const std::vector<maths::vector2i>& values)
-    {
-        GLint location = GetVariableLocation(varName, true);
-        unsigned int amount = values.size();
-        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
-        glUniform2iv(location, amount, &values[0].x);
-    }
-    void Program::SetUniform(const std::string& varName, const std::vector<maths::vector3i>& values)
-    {
-        GLint location = GetVariableLocation(varName, true);
-        unsigned int amount = values.size();
-        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
-        glUniform3iv(location, amount, &values[0].x);
-    }
-    void Program::SetUniform(const std::string& varName, const std::vector<maths::vector4i>& values)
-    {
-        GLint location = GetVariableLocation(varName, true);
-        unsigned int amount = values.size();
-        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
-        glUniform4iv(location, amount, &values[0].x);
-    }
-    void Program::SetUniformMatrix(const std::string& varName, const maths::matrixi& mat)
-    {
-        GLint location = GetVariableLocation(varName, true);
-        const int& rows = mat.Rows(), columns = mat.Columns();
-        int* matValues = mat.ToArray();
-
-        /* NOTE: No integer equivilents for matrices, so just pass the integers
-         * and make them act as floats. */
-        if (rows == 2 && columns == 2) glUniformMatrix2fv(location, 1, false, (GLfloat*)matValues);
-        else if (rows == 2 && columns == 3) glUniformMatrix2x3fv(location, 1, false, (GLfloat*)matValues);
-        else if (rows == 2 && columns == 4) glUniformMatrix2x4fv(location, 1, false, (GLfloat*)matValues);
-        else if (rows == 3 && columns == 2) glUniformMatrix3x2fv(location, 1, false, (GLfloat*)matValues);
-        else if (rows == 3 && columns == 3) glUniformMatrix3fv(location, 1, false, (GLfloat*)matValues);
-        else if (rows == 3 && columns == 4) glUniformMatrix3x4fv(location, 1, false, (GLfloat*)matValues);
-        else if (rows == 4 && columns == 2) glUniformMatrix4x2fv(location, 1, false, (GLfloat*)matValues);
-        else if (rows == 4 && columns == 3) glUniformMatrix4x3fv(location, 1, false, (GLfloat*)matValues);
-        else if (rows == 4 && columns == 4) glUniformMatrix4fv(location, 1, false, (GLfloat*)matValues);
-        else
-        {
-            delete matValues;
-            throw debug::InvalidArgumentException("Program::SetUniformMatrix - A matrix with an invalid size has been passed.");
-        }
-
-        delete matValues;
-    }
-
-
-    void Program::EnableAttributeArray(const std::string& varName)
-    {
-        // Gets location of the vertex attribute
-        GLint location = GetVariableLocation(varName, false);
-        // Enables a vertex attribute array that will fill the attribute specified every vertex
-        glEnableVertexAttribArray(location);
-    }
-    void Program::DisableAttributeArray(const std::string& varName)
-    {
-        // Same as above, but disables the array instead
-        GLint location = GetVariableLocation(varName, false);
-        glDisableVertexAttribArray(location);
-    }
-
-    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-        const std::vector<float>& values)
-    {
-        GLint location = GetVariableLocation(varName, false);
-        /* Fills the attribute array with the given values. Because floats are being passed,
-         * we use 1 as the amount of values for an individual vertex. */
-        glVertexAttribPointer(location, 1, GL_FLOAT, 0, memorySpacing, &values[0]);
-    }
-    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-        const std::vector<maths::vector2f>& values)
-    {
-        GLint location = GetVariableLocation(varName, false);
-        // 2 because vector2f contains two values
-        glVertexAttribPointer(location, 2, GL_FLOAT, 0, memorySpacing, &values[0].x);
-    }
-    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-        const std::vector<maths::vector3f>& values)
-    {
-        GLint location = GetVariableLocation(varName, false);
-        glVertexAttribPointer(location, 3, GL_FLOAT, 0, memorySpacing, &values[0].x);
-    }
-    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-        const std::vector<maths::vector4f>& values)
-    {
-        GLint location = GetVariableLocation(varName, false);
-        glVertexAttribPointer(location, 4, GL_FLOAT, 0, memorySpacing, &values[0].x);
-    }
-
-    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-        const std::vector<int>& values)
-    {
-        GLint location = GetVariableLocation(varName, false);
-        glVertexAttribPointer(location, 1, GL_INT, 0, memorySpacing, &values[0]);
-    }
-    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-        const std::vector<maths::vector2i>& values)
-    {
-        GLint location = GetVariableLocation(varName, false);
-        glVertexAttribPointer(location, 2, GL_INT, 0, memorySpacing, &values[0].x);
-    }
-    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-        const std::vector<maths::vector3i>& values)
-    {
-        GLint location = GetVariableLocation(varName, false);
-        glVertexAttribPointer(location, 3, GL_INT, 0, memorySpacing, &values[0].x);
-    }
-    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
-        const std::vector<maths::vector4i>& values)
-    {
-        GLint location = GetVariableLocation(varName, false);
-        glVertexAttribPointer(location, 4, GL_INT, 0, memorySpacing, &values[0].x);
-    }
-
-
-    GLint Program::GetVariableLocation(const std::string& varName, bool isUniform) const
-    {
-        // Depending on isUniform, search for a uniform or attribute variable
-        GLint location;
-        if (isUniform)
-        {
-            location = glGetUniformLocation(glHandle, varName.c_str());
-        }
-        else
-        {
-            location = glGetAttribLocation(glHandle, varName.c_str());
-        }
-
-        // If the returned location is -1, OpenGL could not find the specified variable
-        if (location == -1)
-        {
-            throw debug::InvalidArgumentException(
-                "Program::GetVariableLocation - Specified variable '"
-                + varName + "' could not be found.");
-        }
-        // Otherwise, it succeded, return the location
-        else
-        {
-            return location;
-        }
-    }
-
-}
-
-}
+/*
+ * File:   Program.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on April 11, 2009, 10:25 AM
+ * Added enabling through a render backend on October 18, 2026, 6:20 PM
+ * Added cached locations and location setters on October 19, 2026, 1:20 AM
+ * Added shadowed uniform values on October 19, 2026, 1:35 AM
+ * Added linking through a program cache on October 19, 2026, 1:50 AM
+ * Added starting a link without waiting for it on October 19, 2026, 2:30 AM
+ */
+
+#include <algorithm>
+#include <cstring>
+#include "Program.h"
+#include "GLExtensions.h"
+#include "Exceptions.h"
+#include "Util.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    namespace
+    {
+
+        /* Size of one element of a uniform of the given type. Every type that isn't a float,
+         * integer or boolean vector or matrix is a sampler, set with one integer. */
+        unsigned int UniformTypeBytes(GLenum type)
+        {
+            switch (type)
+            {
+                case GL_FLOAT: case GL_INT: case GL_BOOL: return 4;
+                case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_BOOL_VEC2: return 8;
+                case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_BOOL_VEC3: return 12;
+                case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_BOOL_VEC4: case GL_FLOAT_MAT2: return 16;
+                case GL_FLOAT_MAT2x3: case GL_FLOAT_MAT3x2: return 24;
+                case GL_FLOAT_MAT2x4: case GL_FLOAT_MAT4x2: return 32;
+                case GL_FLOAT_MAT3: return 36;
+                case GL_FLOAT_MAT3x4: case GL_FLOAT_MAT4x3: return 48;
+                case GL_FLOAT_MAT4: return 64;
+                default: return 4;
+            }
+        }
+
+    }
+
+
+    unsigned int Program::uniformUpdatesIssued = 0;
+    unsigned int Program::uniformUpdatesSkipped = 0;
+
+
+    Program::Program() : linked(false), linking(false), enabled(false), linkCache(NULL)
+    {
+        glHandle = glCreateProgram();
+    }
+
+    Program::~Program()
+    {
+        /* Makes sure to delete every shader held in this program by
+         * explicitly calling their Delete() method. */
+        for (std::map<std::string, Shader*>::iterator it = shaders.begin();
+            (it != shaders.end()); it++)
+        {
+            delete it->second;
+        }
+
+        // Then deletes the program
+        glDeleteProgram(glHandle);
+    }
+
+
+    bool Program::Link()
+    {
+        // Makes sure the program isn't already linked
+        if (linked) return true;
+
+        // Links the program, unless StartLink() already started it
+        if (!linking) glLinkProgram(glHandle);
+        linking = false;
+
+        // Checks if the program linked successfully (which waits for it to finish)
+        GLint status = GL_FALSE;
+        glGetProgramiv(glHandle, GL_LINK_STATUS, &status);
+        linked = (status == GL_TRUE);
+        // Reads every variable's location and returns true if it linked successfully
+        if (linked)
+        {
+            ReadVariables();
+            return true;
+        }
+        // If it never linked successfully, prints error message and returns false
+        else
+        {
+            // Finds out what went wrong by reading the info log
+            GLint infologLength = 0; // Used to get how long the log is
+            GLsizei charsWritten = 0; // Stores how many characters that are written to infolog
+            std::string infolog = ""; // Stores info log characters
+
+            // Gets length of the infolog
+            glGetProgramiv(glHandle, GL_INFO_LOG_LENGTH, &infologLength);
+
+            if (infologLength > 0)
+            {
+                // Resizes string to correct size and then stores infolog in it
+                infolog.resize(infologLength);
+                glGetProgramInfoLog(glHandle, infologLength, &charsWritten, &infolog[0]);
+            }
+
+            // Prints the error message
+            std::cout << "Program::Link - Program failed to link!" << std::endl
+                << infolog << std::endl;
+
+            return false;
+        }
+    }
+
+
+    bool Program::Link(ProgramCache* cache)
+    {
+        StartLink(cache);
+        return FinishLink();
+    }
+
+    void Program::StartLink(ProgramCache* cache)
+    {
+        if (linked || linking) return;
+
+        QueryPerformanceCounter(&linkStartTime);
+        linkCache = cache;
+
+        // Tries the cache first, which leaves the program unlinked if it doesn't have it
+        if (cache)
+        {
+            linkKey = GetCacheKey();
+            if (cache->Load(glHandle, linkKey))
+            {
+                linked = true;
+                ReadVariables();
+                RecordLinkTime(true);
+                linkCache = NULL;
+                return;
+            }
+        }
+
+        // Otherwise, it's compiled from its shaders like normal (and stored for next time)
+        for (std::map<std::string, Shader*>::iterator it = shaders.begin(); (it != shaders.end()); it++)
+        {
+            it->second->StartCompile();
+            if (!it->second->IsAttached()) it->second->Attach();
+        }
+        if (cache && cache->IsSupported())
+        {
+            GetGLExtensions().programParameteri(glHandle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+        glLinkProgram(glHandle);
+        linking = true;
+    }
+
+    bool Program::IsLinkComplete() const
+    {
+        if (!linking || !GetGLExtensions().parallelShaderCompile) return true;
+
+        GLint complete = GL_FALSE;
+        glGetProgramiv(glHandle, GL_COMPLETION_STATUS_KHR, &complete);
+        return (complete == GL_TRUE);
+    }
+
+    bool Program::FinishLink()
+    {
+        if (linked) return true;
+        if (!linking) return false;
+
+        // Reads the status of every shader, so compile errors are printed
+        for (std::map<std::string, Shader*>::iterator it = shaders.begin(); (it != shaders.end()); it++)
+        {
+            if (it->second->IsCompiling()) it->second->Compile();
+        }
+
+        if (!Link())
+        {
+            linkCache = NULL;
+            return false;
+        }
+        if (linkCache)
+        {
+            linkCache->Store(glHandle, linkKey);
+            RecordLinkTime(false);
+            linkCache = NULL;
+        }
+        return true;
+    }
+
+    void Program::RecordLinkTime(bool fromCache)
+    {
+        LARGE_INTEGER endTime, frequency;
+        QueryPerformanceCounter(&endTime);
+        QueryPerformanceFrequency(&frequency);
+        linkCache->RecordLink(fromCache, static_cast<double>(endTime.QuadPart - linkStartTime.QuadPart) / frequency.QuadPart);
+    }
+
+    std::string Program::GetCacheKey() const
+    {
+        std::string key;
+        for (std::map<std::string, Shader*>::const_iterator it = shaders.begin(); (it != shaders.end()); it++)
+        {
+            key += general::ToString(static_cast<int>(it->second->GetType())) + "\n" + it->second->GetSource() + "\n";
+        }
+        return key;
+    }
+
+
+    void Program::Enable()
+    {
+        // Make sure that the program is linked before using it
+        if (!linked) return;
+
+        glUseProgram(glHandle);
+
+        enabled = true;
+    }
+
+    void Program::Disable()
+    {
+        // Just returns if the program hasn't been linked yet
+        if (!linked) return;
+
+        // Disables the current program, returning to fixed functionality
+        glUseProgram(0);
+
+        enabled = false;
+    }
+
+    void Program::Enable(IRenderBackend* backend)
+    {
+        if (!linked) return;
+
+        backend->UseProgram(glHandle);
+        enabled = true;
+    }
+
+    void Program::Disable(IRenderBackend* backend)
+    {
+        if (!linked) return;
+
+        backend->UseProgram(0);
+        enabled = false;
+    }
+
+
+    bool Program::AddShader(Shader* shader, const std::string& id, bool attach)
+    {
+        // Checks if given ID is already taken
+        std::map<std::string, Shader*>::iterator it = shaders.find(id);
+
+        // If it couldn't find a shader with the given ID...
+        if (it == shaders.end())
+        {
+            // ...add the shader to the map
+            shaders[id] = shader;
+            // Also sets the shader's program handle to this one
+            std::map<std::string, Shader*>::iterator it = shaders.find(id);
+            it->second->SetProgramHandle(glHandle);
+
+            // Attaches the shader to this program if specified
+            if (attach)
+            {
+                it->second->Attach();
+            }
+
+            return true;
+        }
+        /* Otherwise, it found a shader with the given ID so... don't add shader to
+         * the map, return false =( */
+        else
+        {
+            delete shader;
+
+            return false;
+        }
+    }
+
+    bool Program::RemoveShader(const std::string& id)
+    {
+        // Tries to find a shader with the given id
+        std::map<std::string, Shader*>::iterator it = shaders.find(id);
+
+        // If it found the shader delete it
+        if (it != shaders.end())
+        {
+            // Automatically detaches the shader from the program
+            it->second->Detach();
+            // Deletes shader and erases pointer from map
+            delete it->second;
+            shaders.erase(it);
+
+            return false;
+        }
+        // Otherwise, just return false
+        else
+        {
+            return false;
+        }
+    }
+
+
+    Shader* Program::GetShader(const std::string& id)
+    {
+        // Tries to find and return the shader with the given ID
+        std::map<std::string, Shader*>::iterator it = shaders.find(id);
+
+        if (it != shaders.end())
+        {
+            return it->second;
+        }
+        else
+        {
+            return NULL;
+        }
+    }
+
+
+    std::vector<float> Program::GetUniformFloat(const std::string& varName, unsigned int amount) const
+    {
+        // Gets the location of the specified variable
+        GLint location = GetVariableLocation(varName, true);
+        // Holds all the values retrieved
+        std::vector<float> values;
+        // Resizes vector to the amount of values to read
+        values.resize(amount);
+        // Retrives the values from the variable and returns them
+        glGetUniformfv(glHandle, location, &values[0]);
+
+        return values;
+    }
+    maths::matrixf Program::GetUniformMatrixFloat(const std::string& varName, unsigned int rows,
+        unsigned int columns) const
+    {
+        // First of all, makes sure that the given sizes for the matrix are compatible
+        if (rows < 2 || rows > 4 || columns < 2 || columns > 4)
+        {
+            throw debug::InvalidArgumentException(
+                "Program::GetUniformMatrix - Rows or columns is an invalid size, cannot get the values.");
+        }
+
+        // Gets the location of the uniform matrix
+        GLint location = GetVariableLocation(varName, true);
+        // Declares and initialises an array to hold the retrieved values
+        float* values = new float[rows * columns];
+        // Gets the values and stores the in the above array
+        glGetUniformfv(glHandle, location, &values[0]);
+
+        // Creates a matrix filled with the retrieved values
+        maths::matrixf mat(rows, columns, values);
+        // Makes sure to delete the values
+        delete values;
+        // Returns the matrix
+        return mat;
+    }
+
+    void Program::SetUniform(const std::string& varName, const std::vector<float>& values)
+    {
+        // Gets location of variable and the amount of values to set
+        GLint location = GetVariableLocation(varName, true);
+        unsigned int amount = values.size();
+
+        if (amount == 0)
+        {
+            throw debug::InvalidArgumentException(
+                "Program::SetUniform - Cannot pass zero amount of values!");
+        }
+
+        // Sets the values
+        if (UniformChanged(location, &values[0], sizeof(values[0]) * amount)) glUniform1fv(location, amount, &values[0]);
+    }
+    void Program::SetUniform(const std::string& varName, const std::vector<maths::vector2f>& values)
+    {
+        GLint location = GetVariableLocation(varName, true);
+        unsigned int amount = values.size();
+        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
+        if (UniformChanged(location, &values[0].x, sizeof(values[0].x) * 2 * amount)) glUniform2fv(location, amount, &values[0].x);
+    }
+    void Program::SetUniform(const std::string& varName, const std::vector<maths::vector3f>& values)
+    {
+        GLint location = GetVariableLocation(varName, true);
+        unsigned int amount = values.size();
+        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
+        if (UniformChanged(location, &values[0].x, sizeof(values[0].x) * 3 * amount)) glUniform3fv(location, amount, &values[0].x);
+    }
+    void Program::SetUniform(const std::string& varName, const std::vector<maths::vector4f>& values)
+    {
+        GLint location = GetVariableLocation(varName, true);
+        unsigned int amount = values.size();
+        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
+        if (UniformChanged(location, &values[0].x, sizeof(values[0].x) * 4 * amount)) glUniform4fv(location, amount, &values[0].x);
+    }
+    void Program::SetUniformMatrix(const std::string& varName, const maths::matrixf& mat)
+    {
+        // Finds location of variable
+        GLint location = GetVariableLocation(varName, true);
+        // Gets size of the matrix
+        const int& rows = mat.Rows(), columns = mat.Columns();
+        // Puts matrix's values into an array, which isn't sent if it's the same as the shadow copy
+        float* matValues = mat.ToArray();
+        if (rows >= 2 && rows <= 4 && columns >= 2 && columns <= 4
+            && !UniformChanged(location, matValues, sizeof(float) * rows * columns))
+        {
+            delete matValues;
+            return;
+        }
+
+        // Checks the size of the given matrix to call the appropriate function
+        if (rows == 2 && columns == 2) glUniformMatrix2fv(location, 1, false, matValues);
+        else if (rows == 2 && columns == 3) glUniformMatrix2x3fv(location, 1, false, matValues);
+        else if (rows == 2 && columns == 4) glUniformMatrix2x4fv(location, 1, false, matValues);
+        else if (rows == 3 && columns == 2) glUniformMatrix3x2fv(location, 1, false, matValues);
+        else if (rows == 3 && columns == 3) glUniformMatrix3fv(location, 1, false, matValues);
+        else if (rows == 3 && columns == 4) glUniformMatrix3x4fv(location, 1, false, matValues);
+        else if (rows == 4 && columns == 2) glUniformMatrix4x2fv(location, 1, false, matValues);
+        else if (rows == 4 && columns == 3) glUniformMatrix4x3fv(location, 1, false, matValues);
+        else if (rows == 4 && columns == 4) glUniformMatrix4fv(location, 1, false, matValues);
+        // Otherwise, the size is not compatible; throw an exception
+        else
+        {
+            delete matValues;
+            throw debug::InvalidArgumentException("Program::SetUniformMatrix - A matrix with an invalid size has been passed.");
+        }
+
+        delete matValues; // Makes sure the allocated memory is released
+    }
+
+
+    std::vector<int> Program::GetUniformInt(const std::string& varName, unsigned int amount) const
+    {
+        GLint location = GetVariableLocation(varName, true);
+        std::vector<int> values;
+        values.resize(amount);
+        glGetUniformiv(glHandle, location, &values[0]);
+        return values;
+    }
+    maths::matrixi Program::GetUniformMatrixInt(const std::string& varName, unsigned int rows,
+        unsigned int columns) const
+    {
+        // First of all, makes sure that the given sizes for the matrix are compatible
+        if (rows < 2 || rows > 4 || columns < 2 || columns > 4)
+        {
+            throw debug::InvalidArgumentException(
+                "Program::GetUniformMatrix - Rows or columns is an invalid size, cannot get the values.");
+        }
+
+        // Gets the location of the uniform matrix
+        GLint location = GetVariableLocation(varName, true);
+        // Declares and initialises an array to hold the retrieved values
+        int* values = new int[rows * columns];
+        // Gets the values and stores the in the above array
+        glGetUniformfv(glHandle, location, (GLfloat*)&values[0]);
+
+        // Creates a matrix filled with the retrieved values
+        maths::matrixi mat(rows, columns, values);
+        // Makes sure to delete the values
+        delete values;
+        // Returns the matrix
+        return mat;
+    }
+
+    void Program::SetUniform(const std::string& varName, const std::vector<int>& values)
+    {
+        GLint location = GetVariableLocation(varName, true);
+        unsigned int amount = values.size();
+        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
+        if (UniformChanged(location, &values[0], sizeof(values[0]) * amount)) glUniform1iv(location, amount, &values[0]);
+    }
+    void Program::SetUniform(const std::string& varName, const std::vector<maths::vector2i>& values)
+    {
+        GLint location = GetVariableLocation(varName, true);
+        unsigned int amount = values.size();
+        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
+        if (UniformChanged(location, &values[0].x, sizeof(values[0].x) * 2 * amount)) glUniform2iv(location, amount, &values[0].x);
+    }
+    void Program::SetUniform(const std::string& varName, const std::vector<maths::vector3i>& values)
+    {
+        GLint location = GetVariableLocation(varName, true);
+        unsigned int amount = values.size();
+        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
+        if (UniformChanged(location, &values[0].x, sizeof(values[0].x) * 3 * amount)) glUniform3iv(location, amount, &values[0].x);
+    }
+    void Program::SetUniform(const std::string& varName, const std::vector<maths::vector4i>& values)
+    {
+        GLint location = GetVariableLocation(varName, true);
+        unsigned int amount = values.size();
+        if (amount == 0) throw debug::InvalidArgumentException("Program::SetUniform - Cannot pass zero amount of values!");
+        if (UniformChanged(location, &values[0].x, sizeof(values[0].x) * 4 * amount)) glUniform4iv(location, amount, &values[0].x);
+    }
+    void Program::SetUniformMatrix(const std::string& varName, const maths::matrixi& mat)
+    {
+        GLint location = GetVariableLocation(varName, true);
+        const int& rows = mat.Rows(), columns = mat.Columns();
+        int* matValues = mat.ToArray();
+        if (rows >= 2 && rows <= 4 && columns >= 2 && columns <= 4
+            && !UniformChanged(location, matValues, sizeof(int) * rows * columns))
+        {
+            delete matValues;
+            return;
+        }
+
+        /* NOTE: No integer equivilents for matrices, so just pass the integers
+         * and make them act as floats. */
+        if (rows == 2 && columns == 2) glUniformMatrix2fv(location, 1, false, (GLfloat*)matValues);
+        else if (rows == 2 && columns == 3) glUniformMatrix2x3fv(location, 1, false, (GLfloat*)matValues);
+        else if (rows == 2 && columns == 4) glUniformMatrix2x4fv(location, 1, false, (GLfloat*)matValues);
+        else if (rows == 3 && columns == 2) glUniformMatrix3x2fv(location, 1, false, (GLfloat*)matValues);
+        else if (rows == 3 && columns == 3) glUniformMatrix3fv(location, 1, false, (GLfloat*)matValues);
+        else if (rows == 3 && columns == 4) glUniformMatrix3x4fv(location, 1, false, (GLfloat*)matValues);
+        else if (rows == 4 && columns == 2) glUniformMatrix4x2fv(location, 1, false, (GLfloat*)matValues);
+        else if (rows == 4 && columns == 3) glUniformMatrix4x3fv(location, 1, false, (GLfloat*)matValues);
+        else if (rows == 4 && columns == 4) glUniformMatrix4fv(location, 1, false, (GLfloat*)matValues);
+        else
+        {
+            delete matValues;
+            throw debug::InvalidArgumentException("Program::SetUniformMatrix - A matrix with an invalid size has been passed.");
+        }
+
+        delete matValues;
+    }
+
+
+    void Program::EnableAttributeArray(const std::string& varName)
+    {
+        // Gets location of the vertex attribute
+        GLint location = GetVariableLocation(varName, false);
+        // Enables a vertex attribute array that will fill the attribute specified every vertex
+        glEnableVertexAttribArray(location);
+    }
+    void Program::DisableAttributeArray(const std::string& varName)
+    {
+        // Same as above, but disables the array instead
+        GLint location = GetVariableLocation(varName, false);
+        glDisableVertexAttribArray(location);
+    }
+
+    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+        const std::vector<float>& values)
+    {
+        GLint location = GetVariableLocation(varName, false);
+        /* Fills the attribute array with the given values. Because floats are being passed,
+         * we use 1 as the amount of values for an individual vertex. */
+        glVertexAttribPointer(location, 1, GL_FLOAT, 0, memorySpacing, &values[0]);
+    }
+    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+        const std::vector<maths::vector2f>& values)
+    {
+        GLint location = GetVariableLocation(varName, false);
+        // 2 because vector2f contains two values
+        glVertexAttribPointer(location, 2, GL_FLOAT, 0, memorySpacing, &values[0].x);
+    }
+    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+        const std::vector<maths::vector3f>& values)
+    {
+        GLint location = GetVariableLocation(varName, false);
+        glVertexAttribPointer(location, 3, GL_FLOAT, 0, memorySpacing, &values[0].x);
+    }
+    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+        const std::vector<maths::vector4f>& values)
+    {
+        GLint location = GetVariableLocation(varName, false);
+        glVertexAttribPointer(location, 4, GL_FLOAT, 0, memorySpacing, &values[0].x);
+    }
+
+    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+        const std::vector<int>& values)
+    {
+        GLint location = GetVariableLocation(varName, false);
+        glVertexAttribPointer(location, 1, GL_INT, 0, memorySpacing, &values[0]);
+    }
+    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+        const std::vector<maths::vector2i>& values)
+    {
+        GLint location = GetVariableLocation(varName, false);
+        glVertexAttribPointer(location, 2, GL_INT, 0, memorySpacing, &values[0].x);
+    }
+    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+        const std::vector<maths::vector3i>& values)
+    {
+        GLint location = GetVariableLocation(varName, false);
+        glVertexAttribPointer(location, 3, GL_INT, 0, memorySpacing, &values[0].x);
+    }
+    void Program::FillAttributeArray(const std::string& varName, unsigned char memorySpacing,
+        const std::vector<maths::vector4i>& values)
+    {
+        GLint location = GetVariableLocation(varName, false);
+        glVertexAttribPointer(location, 4, GL_INT, 0, memorySpacing, &values[0].x);
+    }
+
+
+    GLint Program::GetVariableLocation(const std::string& varName, bool isUniform) const
+    {
+        // Depending on isUniform, search for a uniform or attribute variable
+        const VariableTable& table = (isUniform) ? uniforms : attributes;
+        VariableTable::const_iterator it = table.find(varName);
+
+        // If it's not in the table, the linked program doesn't have the specified variable
+        if (it == table.end())
+        {
+            throw debug::InvalidArgumentException(
+                "Program::GetVariableLocation - Specified variable '"
+                + varName + "' could not be found.");
+        }
+        // Otherwise, it succeded, return the location
+        else
+        {
+            return it->second.location;
+        }
+    }
+
+    UniformLocation Program::Find(const std::string& varName) const
+    {
+        VariableTable::const_iterator it = uniforms.find(varName);
+        return (it != uniforms.end()) ? it->second.location : -1;
+    }
+
+    AttributeLocation Program::FindAttribute(const std::string& varName) const
+    {
+        VariableTable::const_iterator it = attributes.find(varName);
+        return (it != attributes.end()) ? it->second.location : -1;
+    }
+
+
+    bool Program::UniformChanged(UniformLocation location, const void* values, unsigned int bytes)
+    {
+        // OpenGL ignores location -1, so there's nothing to send
+        if (location < 0) return false;
+
+        // Values that don't fit the shadow copy (or don't have one) are always sent
+        if (static_cast<unsigned int>(location) >= uniformShadows.size()
+            || uniformShadows[location].elementBytes == 0 || bytes > uniformShadows[location].bytes)
+        {
+            ++uniformUpdatesIssued;
+            return true;
+        }
+
+        const UniformShadow& shadow = uniformShadows[location];
+        unsigned int elements = (bytes + shadow.elementBytes - 1) / shadow.elementBytes;
+        unsigned char* copy = &shadowValues[shadow.offset];
+        unsigned char* written = &shadowWritten[shadow.element];
+
+        bool same = (memcmp(copy, values, bytes) == 0);
+        for (unsigned int i = 0; (same && i < elements); i++) same = (written[i] != 0);
+        if (same)
+        {
+            ++uniformUpdatesSkipped;
+            return false;
+        }
+
+        memcpy(copy, values, bytes);
+        for (unsigned int i = 0; (i < elements); i++) written[i] = 1;
+        ++uniformUpdatesIssued;
+        return true;
+    }
+
+    void Program::ReadVariables()
+    {
+        uniforms.clear();
+        attributes.clear();
+        uniformShadows.clear();
+        shadowValues.clear();
+        shadowWritten.clear();
+
+        // Names are read into a buffer as long as the longest one
+        GLint amountOfUniforms = 0, amountOfAttributes = 0, uniformLength = 0, attributeLength = 0;
+        glGetProgramiv(glHandle, GL_ACTIVE_UNIFORMS, &amountOfUniforms);
+        glGetProgramiv(glHandle, GL_ACTIVE_UNIFORM_MAX_LENGTH, &uniformLength);
+        glGetProgramiv(glHandle, GL_ACTIVE_ATTRIBUTES, &amountOfAttributes);
+        glGetProgramiv(glHandle, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &attributeLength);
+        std::vector<GLchar> buffer(std::max(std::max(uniformLength, attributeLength), 1) + 1);
+
+        for (GLint i = 0; (i < amountOfUniforms); i++)
+        {
+            GLsizei length = 0;
+            VariableInfo info;
+            glGetActiveUniform(glHandle, i, buffer.size(), &length, &info.size, &info.type, &buffer[0]);
+            std::string name(&buffer[0], length);
+            // Built in uniforms (gl_ModelViewMatrix and so on) don't have locations
+            info.location = glGetUniformLocation(glHandle, name.c_str());
+            if (info.location == -1) continue;
+
+            /* Arrays are named "name[0]" by some drivers and "name" by others, so both are
+             * added, along with every element after the first (whose locations might not
+             * follow on from the first's). */
+            std::string arrayName = name;
+            if (arrayName.size() > 3 && arrayName.compare(arrayName.size() - 3, 3, "[0]") == 0)
+            {
+                arrayName.erase(arrayName.size() - 3);
+            }
+            uniforms[arrayName] = info;
+            if (info.size > 1 || arrayName != name)
+            {
+                uniforms[arrayName + "[0]"] = info;
+            }
+
+            // Every element gets room for its shadow copy, which starts off unwritten
+            UniformShadow shadow;
+            shadow.elementBytes = UniformTypeBytes(info.type);
+            shadow.offset = shadowValues.size();
+            shadow.element = shadowWritten.size();
+            shadowValues.resize(shadowValues.size() + (shadow.elementBytes * info.size), 0);
+            shadowWritten.resize(shadowWritten.size() + info.size, 0);
+
+            for (GLint j = 0; (j < info.size); j++)
+            {
+                GLint location = info.location;
+                if (j > 0)
+                {
+                    std::string elementName = arrayName + "[" + general::ToString(j) + "]";
+                    VariableInfo element = info;
+                    element.location = glGetUniformLocation(glHandle, elementName.c_str());
+                    element.size = info.size - j;
+                    if (element.location == -1) continue;
+                    uniforms[elementName] = element;
+                    location = element.location;
+                }
+
+                if (location > maxShadowedLocation) continue;
+                UniformShadow elementShadow = shadow;
+                elementShadow.offset += shadow.elementBytes * j;
+                elementShadow.bytes = shadow.elementBytes * (info.size - j);
+                elementShadow.element += j;
+                if (uniformShadows.size() <= static_cast<unsigned int>(location))
+                {
+                    UniformShadow unshadowed = { 0, 0, 0, 0 };
+                    uniformShadows.resize(location + 1, unshadowed);
+                }
+                uniformShadows[location] = elementShadow;
+            }
+        }
+
+        for (GLint i = 0; (i < amountOfAttributes); i++)
+        {
+            GLsizei length = 0;
+            VariableInfo info;
+            glGetActiveAttrib(glHandle, i, buffer.size(), &length, &info.size, &info.type, &buffer[0]);
+            std::string name(&buffer[0], length);
+            info.location = glGetAttribLocation(glHandle, name.c_str());
+            if (info.location != -1) attributes[name] = info;
+        }
+    }
+
+}
+
+}
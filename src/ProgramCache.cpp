@@ -0,0 +1,250 @@
+/*
+ * File:   ProgramCache.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 1:50 AM
+ * Added locking on October 19, 2026, 4:20 AM
+ */
+
+#include <fstream>
+#include <vector>
+#include "ProgramCache.h"
+#include "GLExtensions.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    namespace
+    {
+
+        // Start of every cache file, and the version of their layout
+        const char fileMagic[4] = { 'P', 'P', 'B', 'C' };
+        const unsigned int fileVersion = 1;
+
+        /* Two unrelated 32-bit hashes of the key (FNV-1a and djb2), which together name its file
+         * and are checked again when it's read, so two keys sharing a file is never a problem. */
+        unsigned int HashFNV(const std::string& text)
+        {
+            unsigned int hash = 2166136261u;
+            for (unsigned int i = 0; (i < text.size()); i++)
+            {
+                hash ^= static_cast<unsigned char>(text[i]);
+                hash *= 16777619u;
+            }
+            return hash;
+        }
+
+        unsigned int HashDJB(const std::string& text)
+        {
+            unsigned int hash = 5381;
+            for (unsigned int i = 0; (i < text.size()); i++)
+            {
+                hash = (hash * 33) + static_cast<unsigned char>(text[i]);
+            }
+            return hash;
+        }
+
+        std::string ToHex(unsigned int value)
+        {
+            const char* digits = "0123456789abcdef";
+            std::string hex(8, '0');
+            for (int i = 7; (i >= 0); i--)
+            {
+                hex[i] = digits[value & 0xF];
+                value >>= 4;
+            }
+            return hex;
+        }
+
+        void WriteUInt(std::ofstream& file, unsigned int value)
+        {
+            file.write(reinterpret_cast<const char*>(&value), sizeof(unsigned int));
+        }
+
+        bool ReadUInt(std::ifstream& file, unsigned int& value)
+        {
+            file.read(reinterpret_cast<char*>(&value), sizeof(unsigned int));
+            return file.good();
+        }
+
+        std::string GetGLString(GLenum name)
+        {
+            const GLubyte* value = glGetString(name);
+            return (value) ? std::string(reinterpret_cast<const char*>(value)) : std::string();
+        }
+
+        /* Holds a critical section for as long as it's in scope, so every return unlocks it. */
+        class ScopedLock
+        {
+
+        private:
+
+            CRITICAL_SECTION& section;
+
+        public:
+
+            ScopedLock(CRITICAL_SECTION& criticalSection) : section(criticalSection)
+            {
+                EnterCriticalSection(&section);
+            }
+
+            ~ScopedLock()
+            {
+                LeaveCriticalSection(&section);
+            }
+
+        };
+
+    }
+
+
+    ProgramCache::ProgramCache(const std::string& cacheDirectory) : directory(cacheDirectory),
+        hits(0), misses(0), loadSeconds(0.0), compileSeconds(0.0)
+    {
+        InitializeCriticalSection(&lock);
+        if (!directory.empty() && directory[directory.size() - 1] != '/' && directory[directory.size() - 1] != '\\')
+        {
+            directory += '/';
+        }
+    }
+
+    ProgramCache::~ProgramCache()
+    {
+        DeleteCriticalSection(&lock);
+    }
+
+    bool ProgramCache::IsSupported() const
+    {
+        return GetGLExtensions().programBinaries;
+    }
+
+
+    const std::string& ProgramCache::GetDriver()
+    {
+        if (driver.empty())
+        {
+            driver = GetGLString(GL_VENDOR) + "\n" + GetGLString(GL_RENDERER) + "\n" + GetGLString(GL_VERSION);
+        }
+        return driver;
+    }
+
+    std::string ProgramCache::GetFilename(const std::string& key)
+    {
+        std::string fullKey = GetDriver() + "\n" + key;
+        return directory + ToHex(HashFNV(fullKey)) + ToHex(HashDJB(fullKey)) + ".bin";
+    }
+
+
+    bool ProgramCache::Load(GLuint program, const std::string& key)
+    {
+        if (!IsSupported()) return false;
+        ScopedLock scopedLock(lock);
+
+        std::ifstream file(GetFilename(key).c_str(), std::ios::in | std::ios::binary);
+        if (!file.is_open()) return false;
+
+        // The header has to match this driver and key exactly
+        char magic[4];
+        file.read(magic, 4);
+        if (!file.good() || magic[0] != fileMagic[0] || magic[1] != fileMagic[1]
+            || magic[2] != fileMagic[2] || magic[3] != fileMagic[3])
+        {
+            return false;
+        }
+        const std::string& driverStrings = GetDriver();
+        unsigned int version = 0, driverLength = 0, keyLength = 0, keyHash = 0, format = 0, length = 0;
+        if (!ReadUInt(file, version) || version != fileVersion) return false;
+        if (!ReadUInt(file, driverLength) || driverLength != driverStrings.size()) return false;
+        std::string storedDriver(driverLength, '\0');
+        if (driverLength > 0) file.read(&storedDriver[0], driverLength);
+        if (!file.good() || storedDriver != driverStrings) return false;
+        if (!ReadUInt(file, keyLength) || keyLength != key.size()) return false;
+        if (!ReadUInt(file, keyHash) || keyHash != HashFNV(key)) return false;
+        if (!ReadUInt(file, format) || !ReadUInt(file, length) || length == 0) return false;
+
+        std::vector<char> binary(length);
+        file.read(&binary[0], length);
+        if (!file.good()) return false;
+
+        // The driver can still reject a binary it made, after an update for example
+        GetGLExtensions().programBinary(program, format, &binary[0], length);
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        return (linked == GL_TRUE);
+    }
+
+    void ProgramCache::Store(GLuint program, const std::string& key)
+    {
+        if (!IsSupported()) return;
+        ScopedLock scopedLock(lock);
+
+        GLint length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0) return;
+        std::vector<char> binary(length);
+        GLenum format = 0;
+        GLsizei written = 0;
+        GetGLExtensions().getProgramBinary(program, length, &written, &format, &binary[0]);
+        if (written <= 0) return;
+
+        std::ofstream file(GetFilename(key).c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return;
+
+        const std::string& driverStrings = GetDriver();
+        file.write(fileMagic, 4);
+        WriteUInt(file, fileVersion);
+        WriteUInt(file, driverStrings.size());
+        file.write(driverStrings.data(), driverStrings.size());
+        WriteUInt(file, key.size());
+        WriteUInt(file, HashFNV(key));
+        WriteUInt(file, format);
+        WriteUInt(file, written);
+        file.write(&binary[0], written);
+    }
+
+
+    void ProgramCache::RecordLink(bool fromCache, double seconds)
+    {
+        ScopedLock scopedLock(lock);
+        if (fromCache)
+        {
+            ++hits;
+            loadSeconds += seconds;
+        }
+        else
+        {
+            ++misses;
+            compileSeconds += seconds;
+        }
+    }
+
+    unsigned int ProgramCache::GetHits()
+    {
+        ScopedLock scopedLock(lock);
+        return hits;
+    }
+
+    unsigned int ProgramCache::GetMisses()
+    {
+        ScopedLock scopedLock(lock);
+        return misses;
+    }
+
+    double ProgramCache::GetLoadSeconds()
+    {
+        ScopedLock scopedLock(lock);
+        return loadSeconds;
+    }
+
+    double ProgramCache::GetCompileSeconds()
+    {
+        ScopedLock scopedLock(lock);
+        return compileSeconds;
+    }
+
+}
+
+}
@@ -0,0 +1,74 @@
+/*
+ * File:   RadixSort.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 9:45 PM
+ */
+
+#include <cstring>
+#include "RadixSort.h"
+
+namespace parcel
+{
+
+namespace general
+{
+
+    const std::vector<unsigned int>& FloatRadixSorter::Sort(const float* values, unsigned int amount)
+    {
+        keys.resize(amount);
+        order.resize(amount);
+        scratch.resize(amount);
+
+        /* Turns every float into an unsigned int that sorts the same way. Positive floats
+         * already sort correctly as integers once the sign bit is set, negative floats sort
+         * backwards, so all of their bits are flipped. While doing this, it counts how many
+         * keys have each value of each of the four bytes, so every pass is ready to go. */
+        unsigned int counts[4][256];
+        std::memset(counts, 0, sizeof(counts));
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            unsigned int bits;
+            std::memcpy(&bits, &values[i], sizeof(bits));
+            bits = (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+
+            keys[i] = bits;
+            order[i] = i;
+            counts[0][bits & 0xFF]++;
+            counts[1][(bits >> 8) & 0xFF]++;
+            counts[2][(bits >> 16) & 0xFF]++;
+            counts[3][bits >> 24]++;
+        }
+
+        // Sorts by one byte at a time, starting with the least significant
+        for (unsigned int pass = 0; (pass < 4); pass++)
+        {
+            unsigned int shift = pass * 8;
+            unsigned int* passCounts = counts[pass];
+
+            // If every key has the same byte here, this pass wouldn't change anything
+            if (amount == 0 || passCounts[(keys[order[0]] >> shift) & 0xFF] == amount) continue;
+
+            // Turns the counts into where each byte value starts in the output
+            unsigned int offset = 0;
+            for (unsigned int i = 0; (i < 256); i++)
+            {
+                unsigned int count = passCounts[i];
+                passCounts[i] = offset;
+                offset += count;
+            }
+
+            for (unsigned int i = 0; (i < amount); i++)
+            {
+                unsigned int index = order[i];
+                scratch[passCounts[(keys[index] >> shift) & 0xFF]++] = index;
+            }
+            order.swap(scratch);
+        }
+
+        return order;
+    }
+
+}
+
+}
@@ -0,0 +1,690 @@
+/*
+ * File:   RecordingBackend.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 3:45 PM
+ * Added SetDepthWrite() on October 19, 2026, 4:55 AM
+ */
+
+#include "RecordingBackend.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    /* Names written for every enumerator value, indexed by the value. */
+    namespace
+    {
+
+        const char* capabilityNames[] = { "BLEND", "TEXTURE2D", "DEPTHTEST", "LIGHTING", "CULLFACE", "NORMALIZE" };
+        const char* clientArrayNames[] = { "VERTEX", "TEXCOORD", "NORMAL", "COLOUR" };
+        const char* bufferTargetNames[] = { "ARRAY", "ELEMENTARRAY", "TEXTURE" };
+        const char* matrixStackNames[] = { "PROJECTION", "MODELVIEW" };
+        const char* materialColourNames[] = { "AMBIENT", "DIFFUSE", "SPECULAR", "EMISSION" };
+        const char* lightParameterNames[] = { "AMBIENT", "DIFFUSE", "SPECULAR", "POSITION", "SPOTDIRECTION",
+            "CONSTANTATTENUATION", "LINEARATTENUATION", "QUADRATICATTENUATION", "SPOTCUTOFF", "SPOTEXPONENT" };
+        const char* blendModeNames[] = { "ALPHA", "ADDITIVE" };
+        const char* pixelFormatNames[] = { "RGBA", "LUMINANCEALPHA" };
+        const char* primitiveNames[] = { "POINT", "LINE", "LINESTRIP", "LINELOOP", "TRIANGLE",
+            "TRIANGLESTRIP", "TRIANGLEFAN", "QUAD", "QUADSTRIP", "POLYGON" };
+        const char* filterNames[] = { "LINEAR", "NEAREST", "LINEARLINEAR", "LINEARNEAREST",
+            "NEARESTLINEAR", "NEARESTNEAREST" };
+        const char* wrappingNames[] = { "CLAMP", "CLAMPTOEDGE", "REPEAT" };
+
+        /* Returns the name at the given index, or "?" if it's out of range. */
+        template<typename T, unsigned int N>
+        const char* GetName(const char* (&names)[N], T value)
+        {
+            return ((unsigned int)value < N) ? names[value] : "?";
+        }
+
+        /* Pointers given to the backend are byte offsets when a buffer is bound. */
+        unsigned long PointerToOffset(const void* pointer)
+        {
+            return (unsigned long)((const char*)pointer - (const char*)0);
+        }
+
+    }
+
+
+    RecordingBackend::RecordingBackend(std::ostream& outputStream, IRenderBackend* targetBackend) :
+        stream(outputStream), target(targetBackend), callCount(0)
+    {
+        if (!target)
+        {
+            throw debug::NullPointerException("RecordingBackend - Given a null target backend!");
+        }
+    }
+
+
+    std::ostream& RecordingBackend::BeginCall(const char* name)
+    {
+        callCount++;
+        return (stream << name);
+    }
+
+    void RecordingBackend::WriteFloats(const float* values, unsigned int amount)
+    {
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            stream << ' ' << values[i];
+        }
+    }
+
+
+
+    void RecordingBackend::Enable(RenderCapability capability)
+    {
+        BeginCall("Enable") << ' ' << GetName(capabilityNames, capability) << '\n';
+        target->Enable(capability);
+    }
+
+    void RecordingBackend::Disable(RenderCapability capability)
+    {
+        BeginCall("Disable") << ' ' << GetName(capabilityNames, capability) << '\n';
+        target->Disable(capability);
+    }
+
+    bool RecordingBackend::IsEnabled(RenderCapability capability)
+    {
+        bool enabled = target->IsEnabled(capability);
+        BeginCall("IsEnabled") << ' ' << GetName(capabilityNames, capability) << " -> " << enabled << '\n';
+        return enabled;
+    }
+
+    void RecordingBackend::SetBlendMode(BlendMode mode)
+    {
+        BeginCall("SetBlendMode") << ' ' << GetName(blendModeNames, mode) << '\n';
+        target->SetBlendMode(mode);
+    }
+
+    void RecordingBackend::SetDepthWrite(bool enabled)
+    {
+        BeginCall("SetDepthWrite") << ' ' << enabled << '\n';
+        target->SetDepthWrite(enabled);
+    }
+
+
+    void RecordingBackend::SetClearColour(const colourf& colour)
+    {
+        BeginCall("SetClearColour");
+        WriteFloats(colour.values, 4);
+        stream << '\n';
+        target->SetClearColour(colour);
+    }
+
+    void RecordingBackend::Clear(unsigned int flags)
+    {
+        BeginCall("Clear") << ' ' << flags << '\n';
+        target->Clear(flags);
+    }
+
+    void RecordingBackend::SetViewport(int x, int y, int width, int height)
+    {
+        BeginCall("SetViewport") << ' ' << x << ' ' << y << ' ' << width << ' ' << height << '\n';
+        target->SetViewport(x, y, width, height);
+    }
+
+
+    void RecordingBackend::SetColour(const colourf& colour)
+    {
+        BeginCall("SetColour");
+        WriteFloats(colour.values, 4);
+        stream << '\n';
+        target->SetColour(colour);
+    }
+
+    void RecordingBackend::SetMaterialColour(MaterialColour property, const colourf& colour)
+    {
+        BeginCall("SetMaterialColour") << ' ' << GetName(materialColourNames, property);
+        WriteFloats(colour.values, 4);
+        stream << '\n';
+        target->SetMaterialColour(property, colour);
+    }
+
+    void RecordingBackend::SetMaterialShininess(float shininess)
+    {
+        BeginCall("SetMaterialShininess") << ' ' << shininess << '\n';
+        target->SetMaterialShininess(shininess);
+    }
+
+
+    unsigned int RecordingBackend::GetMaxLights()
+    {
+        unsigned int maxLights = target->GetMaxLights();
+        BeginCall("GetMaxLights") << " -> " << maxLights << '\n';
+        return maxLights;
+    }
+
+    void RecordingBackend::EnableLight(unsigned int light)
+    {
+        BeginCall("EnableLight") << ' ' << light << '\n';
+        target->EnableLight(light);
+    }
+
+    void RecordingBackend::DisableLight(unsigned int light)
+    {
+        BeginCall("DisableLight") << ' ' << light << '\n';
+        target->DisableLight(light);
+    }
+
+    void RecordingBackend::SetLightVector(unsigned int light, LightParameter parameter, const float* values)
+    {
+        BeginCall("SetLightVector") << ' ' << light << ' ' << GetName(lightParameterNames, parameter);
+        WriteFloats(values, (parameter == LIGHTPARAMETER_SPOTDIRECTION) ? 3 : 4);
+        stream << '\n';
+        target->SetLightVector(light, parameter, values);
+    }
+
+    void RecordingBackend::SetLightValue(unsigned int light, LightParameter parameter, float value)
+    {
+        BeginCall("SetLightValue") << ' ' << light << ' ' << GetName(lightParameterNames, parameter)
+            << ' ' << value << '\n';
+        target->SetLightValue(light, parameter, value);
+    }
+
+    void RecordingBackend::SetLightModel(const colourf& globalAmbient, bool localViewer, bool twoSided)
+    {
+        BeginCall("SetLightModel");
+        WriteFloats(globalAmbient.values, 4);
+        stream << ' ' << localViewer << ' ' << twoSided << '\n';
+        target->SetLightModel(globalAmbient, localViewer, twoSided);
+    }
+
+
+    void RecordingBackend::SetMatrixMode(MatrixStack stack)
+    {
+        BeginCall("SetMatrixMode") << ' ' << GetName(matrixStackNames, stack) << '\n';
+        target->SetMatrixMode(stack);
+    }
+
+    void RecordingBackend::LoadMatrix(const float* matrix)
+    {
+        BeginCall("LoadMatrix");
+        WriteFloats(matrix, 16);
+        stream << '\n';
+        target->LoadMatrix(matrix);
+    }
+
+    void RecordingBackend::MultiplyMatrix(const float* matrix)
+    {
+        BeginCall("MultiplyMatrix");
+        WriteFloats(matrix, 16);
+        stream << '\n';
+        target->MultiplyMatrix(matrix);
+    }
+
+    void RecordingBackend::PushMatrix()
+    {
+        BeginCall("PushMatrix") << '\n';
+        target->PushMatrix();
+    }
+
+    void RecordingBackend::PopMatrix()
+    {
+        BeginCall("PopMatrix") << '\n';
+        target->PopMatrix();
+    }
+
+    void RecordingBackend::Translate(float x, float y, float z)
+    {
+        BeginCall("Translate") << ' ' << x << ' ' << y << ' ' << z << '\n';
+        target->Translate(x, y, z);
+    }
+
+    void RecordingBackend::Rotate(float angle, float x, float y, float z)
+    {
+        BeginCall("Rotate") << ' ' << angle << ' ' << x << ' ' << y << ' ' << z << '\n';
+        target->Rotate(angle, x, y, z);
+    }
+
+
+    void RecordingBackend::GenerateBuffers(unsigned int amount, unsigned int* ids)
+    {
+        target->GenerateBuffers(amount, ids);
+        BeginCall("GenerateBuffers") << ' ' << amount << " ->";
+        for (unsigned int i = 0; (i < amount); i++) stream << ' ' << ids[i];
+        stream << '\n';
+    }
+
+    void RecordingBackend::DeleteBuffers(unsigned int amount, const unsigned int* ids)
+    {
+        BeginCall("DeleteBuffers") << ' ' << amount;
+        for (unsigned int i = 0; (i < amount); i++) stream << ' ' << ids[i];
+        stream << '\n';
+        target->DeleteBuffers(amount, ids);
+    }
+
+    void RecordingBackend::BindBuffer(BufferTarget bufferTarget, unsigned int id)
+    {
+        BeginCall("BindBuffer") << ' ' << GetName(bufferTargetNames, bufferTarget) << ' ' << id << '\n';
+        target->BindBuffer(bufferTarget, id);
+    }
+
+    unsigned int RecordingBackend::GetBoundBuffer(BufferTarget bufferTarget)
+    {
+        unsigned int id = target->GetBoundBuffer(bufferTarget);
+        BeginCall("GetBoundBuffer") << ' ' << GetName(bufferTargetNames, bufferTarget) << " -> " << id << '\n';
+        return id;
+    }
+
+    void RecordingBackend::BufferData(BufferTarget bufferTarget, unsigned int size, const void* data)
+    {
+        BeginCall("BufferData") << ' ' << GetName(bufferTargetNames, bufferTarget) << ' ' << size
+            << ' ' << (data ? "DATA" : "NULL") << '\n';
+        target->BufferData(bufferTarget, size, data);
+    }
+
+    void* RecordingBackend::MapBuffer(BufferTarget bufferTarget)
+    {
+        BeginCall("MapBuffer") << ' ' << GetName(bufferTargetNames, bufferTarget) << '\n';
+        return target->MapBuffer(bufferTarget);
+    }
+
+    bool RecordingBackend::UnmapBuffer(BufferTarget bufferTarget)
+    {
+        bool success = target->UnmapBuffer(bufferTarget);
+        BeginCall("UnmapBuffer") << ' ' << GetName(bufferTargetNames, bufferTarget) << " -> " << success << '\n';
+        return success;
+    }
+
+
+    void RecordingBackend::EnableClientArray(ClientArray clientArray)
+    {
+        BeginCall("EnableClientArray") << ' ' << GetName(clientArrayNames, clientArray) << '\n';
+        target->EnableClientArray(clientArray);
+    }
+
+    void RecordingBackend::DisableClientArray(ClientArray clientArray)
+    {
+        BeginCall("DisableClientArray") << ' ' << GetName(clientArrayNames, clientArray) << '\n';
+        target->DisableClientArray(clientArray);
+    }
+
+    bool RecordingBackend::IsClientArrayEnabled(ClientArray clientArray)
+    {
+        bool enabled = target->IsClientArrayEnabled(clientArray);
+        BeginCall("IsClientArrayEnabled") << ' ' << GetName(clientArrayNames, clientArray)
+            << " -> " << enabled << '\n';
+        return enabled;
+    }
+
+    void RecordingBackend::SetVertexPointer(unsigned int components, unsigned int stride, const void* pointer)
+    {
+        BeginCall("SetVertexPointer") << ' ' << components << ' ' << stride << ' ' << PointerToOffset(pointer) << '\n';
+        target->SetVertexPointer(components, stride, pointer);
+    }
+
+    void RecordingBackend::SetTexCoordPointer(unsigned int components, unsigned int stride, const void* pointer)
+    {
+        BeginCall("SetTexCoordPointer") << ' ' << components << ' ' << stride << ' ' << PointerToOffset(pointer) << '\n';
+        target->SetTexCoordPointer(components, stride, pointer);
+    }
+
+    void RecordingBackend::SetNormalPointer(unsigned int stride, const void* pointer)
+    {
+        BeginCall("SetNormalPointer") << ' ' << stride << ' ' << PointerToOffset(pointer) << '\n';
+        target->SetNormalPointer(stride, pointer);
+    }
+
+    void RecordingBackend::SetColourPointer(unsigned int components, unsigned int stride, const void* pointer)
+    {
+        BeginCall("SetColourPointer") << ' ' << components << ' ' << stride << ' ' << PointerToOffset(pointer) << '\n';
+        target->SetColourPointer(components, stride, pointer);
+    }
+
+    void RecordingBackend::EnableAttributeArray(unsigned int location)
+    {
+        BeginCall("EnableAttributeArray") << ' ' << location << '\n';
+        target->EnableAttributeArray(location);
+    }
+
+    void RecordingBackend::DisableAttributeArray(unsigned int location)
+    {
+        BeginCall("DisableAttributeArray") << ' ' << location << '\n';
+        target->DisableAttributeArray(location);
+    }
+
+    void RecordingBackend::SetAttributePointer(unsigned int location, unsigned int components,
+        unsigned int stride, const void* pointer)
+    {
+        BeginCall("SetAttributePointer") << ' ' << location << ' ' << components << ' ' << stride
+            << ' ' << PointerToOffset(pointer) << '\n';
+        target->SetAttributePointer(location, components, stride, pointer);
+    }
+
+
+    void RecordingBackend::DrawArrays(PrimitiveType type, unsigned int start, unsigned int amount)
+    {
+        BeginCall("DrawArrays") << ' ' << GetName(primitiveNames, type) << ' ' << start << ' ' << amount << '\n';
+        target->DrawArrays(type, start, amount);
+    }
+
+    void RecordingBackend::DrawElements(PrimitiveType type, unsigned int start, unsigned int amount)
+    {
+        BeginCall("DrawElements") << ' ' << GetName(primitiveNames, type) << ' ' << start << ' ' << amount << '\n';
+        target->DrawElements(type, start, amount);
+    }
+
+
+    void RecordingBackend::GenerateTextures(unsigned int amount, unsigned int* ids)
+    {
+        target->GenerateTextures(amount, ids);
+        BeginCall("GenerateTextures") << ' ' << amount << " ->";
+        for (unsigned int i = 0; (i < amount); i++) stream << ' ' << ids[i];
+        stream << '\n';
+    }
+
+    void RecordingBackend::DeleteTextures(unsigned int amount, const unsigned int* ids)
+    {
+        BeginCall("DeleteTextures") << ' ' << amount;
+        for (unsigned int i = 0; (i < amount); i++) stream << ' ' << ids[i];
+        stream << '\n';
+        target->DeleteTextures(amount, ids);
+    }
+
+    bool RecordingBackend::IsTexture(unsigned int id)
+    {
+        bool texture = target->IsTexture(id);
+        BeginCall("IsTexture") << ' ' << id << " -> " << texture << '\n';
+        return texture;
+    }
+
+    void RecordingBackend::BindTexture(unsigned int id)
+    {
+        BeginCall("BindTexture") << ' ' << id << '\n';
+        target->BindTexture(id);
+    }
+
+    void RecordingBackend::SetTextureFilter(TextureFilter filter, bool magnification)
+    {
+        BeginCall("SetTextureFilter") << ' ' << GetName(filterNames, filter)
+            << ' ' << (magnification ? "MAG" : "MIN") << '\n';
+        target->SetTextureFilter(filter, magnification);
+    }
+
+    void RecordingBackend::SetTextureWrapping(TextureWrapping wrapping, unsigned int coordinate)
+    {
+        BeginCall("SetTextureWrapping") << ' ' << GetName(wrappingNames, wrapping) << ' ' << coordinate << '\n';
+        target->SetTextureWrapping(wrapping, coordinate);
+    }
+
+    void RecordingBackend::UploadTexture(unsigned int level, unsigned int width, unsigned int height,
+        PixelFormat format, const void* pixels)
+    {
+        BeginCall("UploadTexture") << ' ' << level << ' ' << width << ' ' << height << ' '
+            << GetName(pixelFormatNames, format) << ' ' << (pixels ? "DATA" : "NULL") << '\n';
+        target->UploadTexture(level, width, height, format, pixels);
+    }
+
+
+    unsigned int RecordingBackend::GenerateLists(unsigned int amount)
+    {
+        unsigned int first = target->GenerateLists(amount);
+        BeginCall("GenerateLists") << ' ' << amount << " -> " << first << '\n';
+        return first;
+    }
+
+    void RecordingBackend::DeleteLists(unsigned int first, unsigned int amount)
+    {
+        BeginCall("DeleteLists") << ' ' << first << ' ' << amount << '\n';
+        target->DeleteLists(first, amount);
+    }
+
+    void RecordingBackend::BeginList(unsigned int id)
+    {
+        BeginCall("BeginList") << ' ' << id << '\n';
+        target->BeginList(id);
+    }
+
+    void RecordingBackend::EndList()
+    {
+        BeginCall("EndList") << '\n';
+        target->EndList();
+    }
+
+    void RecordingBackend::SetListBase(unsigned int base)
+    {
+        BeginCall("SetListBase") << ' ' << base << '\n';
+        target->SetListBase(base);
+    }
+
+    void RecordingBackend::CallLists(unsigned int amount, const unsigned char* lists)
+    {
+        BeginCall("CallLists") << ' ' << amount;
+        for (unsigned int i = 0; (i < amount); i++) stream << ' ' << (unsigned int)lists[i];
+        stream << '\n';
+        target->CallLists(amount, lists);
+    }
+
+
+    void RecordingBackend::UseProgram(unsigned int handle)
+    {
+        BeginCall("UseProgram") << ' ' << handle << '\n';
+        target->UseProgram(handle);
+    }
+
+
+    bool RecordingBackend::SupportsTextureBuffers()
+    {
+        bool supported = target->SupportsTextureBuffers();
+        BeginCall("SupportsTextureBuffers") << " -> " << supported << '\n';
+        return supported;
+    }
+
+    void RecordingBackend::BindTextureBuffer(unsigned int unit, unsigned int texture, unsigned int buffer)
+    {
+        BeginCall("BindTextureBuffer") << ' ' << unit << ' ' << texture << ' ' << buffer << '\n';
+        target->BindTextureBuffer(unit, texture, buffer);
+    }
+
+
+    bool RecordingBackend::SupportsArrayTextures()
+    {
+        bool supported = target->SupportsArrayTextures();
+        BeginCall("SupportsArrayTextures") << " -> " << supported << '\n';
+        return supported;
+    }
+
+    void RecordingBackend::BindArrayTexture(unsigned int unit, unsigned int texture)
+    {
+        BeginCall("BindArrayTexture") << ' ' << unit << ' ' << texture << '\n';
+        target->BindArrayTexture(unit, texture);
+    }
+
+    void RecordingBackend::AllocateArrayTexture(unsigned int width, unsigned int height, unsigned int layers,
+        const TextureParameters& params)
+    {
+        BeginCall("AllocateArrayTexture") << ' ' << width << ' ' << height << ' ' << layers << ' '
+            << GetName(filterNames, params.minFilter) << ' ' << GetName(filterNames, params.magFilter) << ' '
+            << GetName(wrappingNames, params.sWrapping) << ' ' << GetName(wrappingNames, params.tWrapping) << '\n';
+        target->AllocateArrayTexture(width, height, layers, params);
+    }
+
+    void RecordingBackend::UploadArrayTextureLayer(unsigned int layer, unsigned int width, unsigned int height,
+        PixelFormat format, const void* pixels)
+    {
+        BeginCall("UploadArrayTextureLayer") << ' ' << layer << ' ' << width << ' ' << height << ' '
+            << GetName(pixelFormatNames, format) << ' ' << (pixels ? "DATA" : "NULL") << '\n';
+        target->UploadArrayTextureLayer(layer, width, height, format, pixels);
+    }
+
+
+    void RecordingBackend::BindUnitTexture(unsigned int unit, unsigned int texture)
+    {
+        BeginCall("BindUnitTexture") << ' ' << unit << ' ' << texture << '\n';
+        target->BindUnitTexture(unit, texture);
+    }
+
+    void RecordingBackend::SetUnitTexCoordPointer(unsigned int unit, unsigned int components, unsigned int stride,
+        const void* pointer)
+    {
+        BeginCall("SetUnitTexCoordPointer") << ' ' << unit << ' ' << components << ' ' << stride << ' ' << PointerToOffset(pointer) << '\n';
+        target->SetUnitTexCoordPointer(unit, components, stride, pointer);
+    }
+
+    void RecordingBackend::DisableUnitTexCoordArray(unsigned int unit)
+    {
+        BeginCall("DisableUnitTexCoordArray") << ' ' << unit << '\n';
+        target->DisableUnitTexCoordArray(unit);
+    }
+
+
+    bool RecordingBackend::SupportsRenderTargets()
+    {
+        bool supported = target->SupportsRenderTargets();
+        BeginCall("SupportsRenderTargets") << " -> " << supported << '\n';
+        return supported;
+    }
+
+    void RecordingBackend::GenerateFramebuffers(unsigned int amount, unsigned int* ids)
+    {
+        target->GenerateFramebuffers(amount, ids);
+        BeginCall("GenerateFramebuffers") << ' ' << amount << " ->";
+        for (unsigned int i = 0; (i < amount); i++) stream << ' ' << ids[i];
+        stream << '\n';
+    }
+
+    void RecordingBackend::DeleteFramebuffers(unsigned int amount, const unsigned int* ids)
+    {
+        BeginCall("DeleteFramebuffers") << ' ' << amount;
+        for (unsigned int i = 0; (i < amount); i++) stream << ' ' << ids[i];
+        stream << '\n';
+        target->DeleteFramebuffers(amount, ids);
+    }
+
+    void RecordingBackend::BindFramebuffer(unsigned int id)
+    {
+        BeginCall("BindFramebuffer") << ' ' << id << '\n';
+        target->BindFramebuffer(id);
+    }
+
+    void RecordingBackend::GenerateRenderbuffers(unsigned int amount, unsigned int* ids)
+    {
+        target->GenerateRenderbuffers(amount, ids);
+        BeginCall("GenerateRenderbuffers") << ' ' << amount << " ->";
+        for (unsigned int i = 0; (i < amount); i++) stream << ' ' << ids[i];
+        stream << '\n';
+    }
+
+    void RecordingBackend::DeleteRenderbuffers(unsigned int amount, const unsigned int* ids)
+    {
+        BeginCall("DeleteRenderbuffers") << ' ' << amount;
+        for (unsigned int i = 0; (i < amount); i++) stream << ' ' << ids[i];
+        stream << '\n';
+        target->DeleteRenderbuffers(amount, ids);
+    }
+
+    void RecordingBackend::AllocateDepthRenderbuffer(unsigned int id, unsigned int width, unsigned int height)
+    {
+        BeginCall("AllocateDepthRenderbuffer") << ' ' << id << ' ' << width << ' ' << height << '\n';
+        target->AllocateDepthRenderbuffer(id, width, height);
+    }
+
+    bool RecordingBackend::AttachToFramebuffer(unsigned int colourTexture, unsigned int depthRenderbuffer)
+    {
+        bool complete = target->AttachToFramebuffer(colourTexture, depthRenderbuffer);
+        BeginCall("AttachToFramebuffer") << ' ' << colourTexture << ' ' << depthRenderbuffer
+            << " -> " << complete << '\n';
+        return complete;
+    }
+
+    void RecordingBackend::BlitFramebuffer(unsigned int source, unsigned int sourceWidth, unsigned int sourceHeight,
+        unsigned int destination, unsigned int destinationWidth, unsigned int destinationHeight)
+    {
+        BeginCall("BlitFramebuffer") << ' ' << source << ' ' << sourceWidth << ' ' << sourceHeight << ' '
+            << destination << ' ' << destinationWidth << ' ' << destinationHeight << '\n';
+        target->BlitFramebuffer(source, sourceWidth, sourceHeight, destination, destinationWidth, destinationHeight);
+    }
+
+
+    bool RecordingBackend::SupportsTimerQueries()
+    {
+        bool supported = target->SupportsTimerQueries();
+        BeginCall("SupportsTimerQueries") << " -> " << supported << '\n';
+        return supported;
+    }
+
+    void RecordingBackend::GenerateQueries(unsigned int amount, unsigned int* ids)
+    {
+        target->GenerateQueries(amount, ids);
+        BeginCall("GenerateQueries") << ' ' << amount << " ->";
+        for (unsigned int i = 0; (i < amount); i++) stream << ' ' << ids[i];
+        stream << '\n';
+    }
+
+    void RecordingBackend::DeleteQueries(unsigned int amount, const unsigned int* ids)
+    {
+        BeginCall("DeleteQueries") << ' ' << amount;
+        for (unsigned int i = 0; (i < amount); i++) stream << ' ' << ids[i];
+        stream << '\n';
+        target->DeleteQueries(amount, ids);
+    }
+
+    void RecordingBackend::BeginTimerQuery(unsigned int id)
+    {
+        BeginCall("BeginTimerQuery") << ' ' << id << '\n';
+        target->BeginTimerQuery(id);
+    }
+
+    void RecordingBackend::EndTimerQuery()
+    {
+        BeginCall("EndTimerQuery") << '\n';
+        target->EndTimerQuery();
+    }
+
+    bool RecordingBackend::GetTimerQueryResult(unsigned int id, float& milliseconds)
+    {
+        bool available = target->GetTimerQueryResult(id, milliseconds);
+        BeginCall("GetTimerQueryResult") << ' ' << id << " -> " << available;
+        if (available) stream << ' ' << milliseconds;
+        stream << '\n';
+        return available;
+    }
+
+
+    bool RecordingBackend::SupportsShadowMaps()
+    {
+        bool supported = target->SupportsShadowMaps();
+        BeginCall("SupportsShadowMaps") << " -> " << supported << '\n';
+        return supported;
+    }
+
+    void RecordingBackend::AllocateDepthTexture(unsigned int width, unsigned int height)
+    {
+        BeginCall("AllocateDepthTexture") << ' ' << width << ' ' << height << '\n';
+        target->AllocateDepthTexture(width, height);
+    }
+
+    bool RecordingBackend::AttachDepthTextureToFramebuffer(unsigned int depthTexture)
+    {
+        bool complete = target->AttachDepthTextureToFramebuffer(depthTexture);
+        BeginCall("AttachDepthTextureToFramebuffer") << ' ' << depthTexture << " -> " << complete << '\n';
+        return complete;
+    }
+
+    void RecordingBackend::BlitFramebufferDepth(unsigned int source, unsigned int destination, unsigned int width,
+        unsigned int height)
+    {
+        BeginCall("BlitFramebufferDepth") << ' ' << source << ' ' << destination << ' ' << width << ' ' << height << '\n';
+        target->BlitFramebufferDepth(source, destination, width, height);
+    }
+
+    void RecordingBackend::BindDepthTexture(unsigned int unit, unsigned int texture)
+    {
+        BeginCall("BindDepthTexture") << ' ' << unit << ' ' << texture << '\n';
+        target->BindDepthTexture(unit, texture);
+    }
+
+    void RecordingBackend::SetPolygonOffset(float factor, float units)
+    {
+        BeginCall("SetPolygonOffset") << ' ' << factor << ' ' << units << '\n';
+        target->SetPolygonOffset(factor, units);
+    }
+
+}
+
+}
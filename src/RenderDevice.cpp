@@ -1,328 +1,539 @@
-/*
- * File:   RenderDevice.cpp
- * Author: Donald "Datriot" Whyte
- *
- * Created on January 2, 2009, 3:15 PM
- */
-
-#include <windows.h>
-#include <GLee.h>
-#include "ALighting.h"
-#include "FixedFunctionLighting.h"
-#include "MCommon.h"
-#include "RenderDevice.h"
-
-namespace parcel
-{
-
-using namespace maths;
-using namespace debug;
-
-namespace graphics
-{
-
-    const std::string RenderDevice::noSkin = "NOSKIN!";
-    const std::string RenderDevice::noTexture = "NOTEXTURE!";
-
-    RenderDevice::RenderDevice(Logger* log)
-        :
-        skinManager(SkinManager(log)), lighting(new FixedFunctionLighting(log, true, true)), // Managers
-        logger(log), // Logger
-        mode(RENDERMODE_3D), renderStarted(false), // State of device
-        currentSkinID(noSkin), currentTextureID(noTexture), // Sets current skin and texture IDs to none
-        viewportSize(512, 512)
-    {
-        // Starts the log for the render device
-        logID = logger->StartLog("RenderDevice");
-        logger->WriteTextAndNewLine(logID, "RenderDevice has been created.");
-
-        // Initialises device and sets the default state of the device in 3D mode
-        Initialise();
-        Reset();
-    }
-
-
-    RenderDevice::~RenderDevice()
-    {
-        logger->WriteTextAndNewLine(logID, "RenderDevice has been destroyed.");
-
-        // Releases any resources used by RenderDevice
-        delete lighting;
-
-        // Make null pointers
-        logger = NULL;
-
-        // All managers are cleaned up automatically in their destructors
-        // OpenGL device context is also cleaned up automatically
-    }
-
-
-
-
-    void RenderDevice::Initialise()
-    {
-        // Sets default OpenGL state
-        glEnable(GL_BLEND);
-        glEnable(GL_TEXTURE_2D);
-        glEnable(GL_DEPTH_TEST);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-        // Sets the clear colour and clears the buffers
-        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-        // Sets world/view the matrices to identity
-        worldMatrix = matrixf::Identity(4);
-        viewMatrix = matrixf::Identity(4);
-        // Sets default projections for the two render modes
-        projectionMatrix2D = matrixf::Identity(4);
-        projectionMatrix3D = matrixf::Identity(4);
-
-        // Builds a viewport with dimensions of the device context
-        BuildViewport();
-    }
-
-
-    void RenderDevice::SetRenderMode(RenderMode renderMode)
-    {
-        // Sets new render mode...
-        mode = renderMode;
-        // ...then resets the device's state
-        Reset();
-    }
-
-
-    void RenderDevice::Reset()
-    {
-        float array[16]; // Temporarily holds matrix values
-
-        // Loads the projection matrix for this render mode
-        glMatrixMode(GL_PROJECTION);
-        if (mode == RENDERMODE_2D) projectionMatrix2D.ToArray(array);
-        if (mode == RENDERMODE_3D) projectionMatrix3D.ToArray(array);
-        glLoadMatrixf(array);
-
-        // Sets up the world (model) and view matrices
-        glMatrixMode(GL_MODELVIEW); // Switches to the modelview stack
-        // Loads the world matrix and then multiplies it with the view (camera) matrix
-        worldMatrix.ToArray(array);
-        glLoadMatrixf(array);
-        viewMatrix.ToArray(array);
-        glMultMatrixf(array);
-
-        /* Enables/disables certain states depending on the render mode the device
-         * is being swtiched to. */
-        if (mode == RENDERMODE_2D)
-        {
-            if (glIsEnabled(GL_DEPTH_TEST)) glDisable(GL_DEPTH_TEST);
-        }
-        else if (mode == RENDERMODE_3D)
-        {
-            if (!glIsEnabled(GL_DEPTH_TEST)) glEnable(GL_DEPTH_TEST);
-        }
-
-        // Logs the event
-        if (mode == RENDERMODE_2D)
-        {
-            logger->WriteTextAndNewLine(logID, "Render mode switched to 2D.");
-        }
-        else if (mode == RENDERMODE_3D)
-        {
-            logger->WriteTextAndNewLine(logID, "Render mode switched to 3D.");
-        }
-    }
-
-
-    void RenderDevice::StartRendering()
-    {
-        // Starts rendering if has not started already
-        if (!renderStarted) renderStarted = true;
-        // Otherwise, log an error message and return
-        else
-        {
-            logger->WriteTextAndNewLine(logID,
-                "RenderDevice::StartRendering - Render pass has already started.");
-            return;
-        }
-
-
-        // Also wipes texture and material clean
-        ClearSkinAndTexture();
-        // Updates the lighting
-        lighting->Update();
-
-
-        // Clears the colour and depth buffers
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    }
-
-
-    void RenderDevice::EndRendering()
-    {
-        // Stops rendering if has actually started
-        if (renderStarted) renderStarted = false;
-        // Otherwise, log an error message and return
-        else
-        {
-            logger->WriteTextAndNewLine(logID,
-                "RenderDevice::StartRendering - Render pass cannot end before being started.");
-            return;
-        }
-    }
-
-
-    void RenderDevice::SetActiveSkin(const std::string& skinID)
-    {
-        try
-        {
-            // Gets the needed skin from the skin manager
-            Skin* skin = skinManager.GetSkin(skinID);
-            // Now retrieves the material and list of textures
-            Material* mat = skinManager.GetMaterial(skin->material);
-            std::string* textures = NULL;
-            textures = &skin->textures[0];
-            // Sets the material of the skin
-            glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, mat->ambient.values);
-            glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, mat->diffuse.values);
-            glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, mat->specular.values);
-            glMaterialfv(GL_FRONT_AND_BACK, GL_EMISSION, mat->emmisive.values);
-            glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, mat->specularPower);
-            // Binds the skin's primary texture if it exists
-            if (textures[0] != skinNoTexture)
-            {
-                SetActiveTexture(textures[0]);
-            }
-            // Sets the current active skin and texture
-            currentSkinID = skinID;
-            currentTextureID = textures[0];
-        }
-        catch(debug::Exception& ex)
-        {
-            // Print error message carried by the thrown exception
-            ex.PrintMessage();
-        }
-        catch (...) { }
-    }
-
-
-    void RenderDevice::SetActiveTexture(const std::string& textureID)
-    {
-        // Binds the texture to the currently active texture unit
-        glBindTexture(GL_TEXTURE_2D, skinManager.GetTexture(textureID)->glID);
-        // Also sets the texture's transparency
-        SetTextureTransparency(textureID);
-
-        currentTextureID = textureID;
-    }
-    void RenderDevice::SetActiveTextureWithColourMask(const std::string& textureID, const colourf& colour)
-    {
-        // Binds the texture to the currently active texture unit
-        glBindTexture(GL_TEXTURE_2D, skinManager.GetTexture(textureID)->glID);
-        // Also sets the texture's transparency with an additional colour mask
-        SetTextureTransparencyWithColourMask(textureID, colour);
-
-        currentTextureID = textureID;
-    }
-
-
-    void RenderDevice::SetTextureTransparency(const std::string& textureID)
-    {
-        // Gets the needed texture
-        Texture* tex = skinManager.GetTexture(textureID);
-        // If texture was not found, return
-        if (!tex) return;
-
-        // Applies transparency by directly modifying the source colour
-        glColor4f(1.0f, 1.0f, 1.0f, tex->transparency);
-    }
-    void RenderDevice::SetTextureTransparencyWithColourMask(const std::string& textureID, const colourf& colour)
-    {
-        Texture* tex = skinManager.GetTexture(textureID);
-        if (!tex) return;
-        /* Applies transparency AND colour mask by directly modifying the source colour.
-         * The colour mask can include alpha transparency, the alpha component of
-         * the colour is mutliplied by the texture's preset transprency. */
-        glColor4f(colour.r, colour.g, colour.b, (colour.a * tex->transparency));
-    }
-
-
-    void RenderDevice::ClearSkinAndTexture()
-    {
-        // Sets colour to default just in case a colour was set that may affect other textures
-        glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
-
-        // Sets all material properties to white if lighting is enabled
-        glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, presetcolours::White.values);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, presetcolours::White.values);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, presetcolours::White.values);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_EMISSION, presetcolours::White.values);
-
-        // Unbinds texture in current texture unit
-        glBindTexture(GL_TEXTURE_2D, 0);
-
-        // Sets current active skin and texture to nothing
-        currentSkinID = currentTextureID = -1;
-    }
-
-
-    bool RenderDevice::IsRenderMode(const RenderMode& rMode)
-    {
-        if (rMode == mode) return true;
-        else return false;
-    }
-
-
-    void RenderDevice::SetViewMatrix(const matrixf&mat)
-    {
-        viewMatrix = mat;
-    }
-
-
-    void RenderDevice::SetProjectionMatrix(RenderMode renderMode,
-        const maths::matrixf& newProjMatrix)
-    {
-        // Sets the appropriate projection for the specified render mode
-        if (renderMode == RENDERMODE_2D)
-        {
-            projectionMatrix2D = newProjMatrix;
-        }
-        else if (renderMode == RENDERMODE_3D)
-        {
-            projectionMatrix3D = newProjMatrix;
-        }
-    }
-
-
-    void RenderDevice::SetViewportSize(const maths::vector2i& newSize)
-    {
-        // Assigns new viewport size...
-        viewportSize = newSize;
-        // ...then rebuilds the viewport
-        BuildViewport();
-    }
-
-    const maths::matrixf& RenderDevice::GetProjectionMatrix(RenderMode renderMode)
-    {
-        if (renderMode == RENDERMODE_2D)
-        {
-            return projectionMatrix2D;
-        }
-        else if (renderMode == RENDERMODE_3D)
-        {
-            return projectionMatrix3D;
-        }
-        else
-        {
-            return maths::matrixf::Identity(4);
-        }
-    }
-
-    void RenderDevice::BuildViewport()
-    {
-        // Changes viewport to the desired size
-        glViewport(0, 0, viewportSize.x, viewportSize.y);
-    }
-
-}
-
-}
+/*
+ * File:   RenderDevice.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on January 2, 2009, 3:15 PM
+ * Changed to draw through an IRenderBackend on October 18, 2026, 4:10 PM
+ * Added state cache on October 18, 2026, 6:10 PM
+ * Changed to track active skins and textures by handle on October 18, 2026, 7:20 PM
+ * Added dynamic resolution for the 3D scene on October 18, 2026, 10:35 PM
+ * Changed to record the scale each timed frame was drawn at on October 19, 2026, 4:50 AM
+ */
+
+#include "ALighting.h"
+#include "FixedFunctionLighting.h"
+#include "MCommon.h"
+#include "RenderDevice.h"
+#include "OpenGLBackend.h"
+#include "Program.h"
+
+namespace parcel
+{
+
+using namespace maths;
+using namespace debug;
+
+namespace graphics
+{
+
+    const std::string RenderDevice::noSkin = "NOSKIN!";
+    const std::string RenderDevice::noTexture = "NOTEXTURE!";
+
+    RenderDevice::RenderDevice(Logger* log)
+        :
+        viewportSize(512, 512),
+        targetBackend(new OpenGLBackend()), ownsBackend(true), stateCache(targetBackend), // Draws to OpenGL
+        skinManager(&stateCache, log), lighting(new FixedFunctionLighting(&stateCache, log, true, true)), // Managers
+        logger(log), // Logger
+        mode(RENDERMODE_3D), renderStarted(false), // State of device
+        currentSkin(invalidHandle), currentTexture(invalidHandle), // Sets current skin and texture to none
+        resolutionController(DynamicResolutionSettings()), sceneTarget(NULL), sceneTargetBound(false), // Dynamic resolution is off
+        timingGPU(false), queryRunning(false), queriesStarted(0), queriesRead(0), lastGPUTime(-1.0f), lastGPUScale(1.0f)
+    {
+        Create();
+    }
+
+    RenderDevice::RenderDevice(Logger* log, IRenderBackend* renderBackend)
+        :
+        viewportSize(512, 512),
+        targetBackend(renderBackend), ownsBackend(false), stateCache(targetBackend), // Backend is owned by whoever created it
+        skinManager(&stateCache, log), lighting(new FixedFunctionLighting(&stateCache, log, true, true)), // Managers
+        logger(log), // Logger
+        mode(RENDERMODE_3D), renderStarted(false), // State of device
+        currentSkin(invalidHandle), currentTexture(invalidHandle), // Sets current skin and texture to none
+        resolutionController(DynamicResolutionSettings()), sceneTarget(NULL), sceneTargetBound(false), // Dynamic resolution is off
+        timingGPU(false), queryRunning(false), queriesStarted(0), queriesRead(0), lastGPUTime(-1.0f), lastGPUScale(1.0f)
+    {
+        Create();
+    }
+
+
+    void RenderDevice::Create()
+    {
+        // Starts the log for the render device
+        logID = logger->StartLog("RenderDevice");
+        logger->WriteTextAndNewLine(logID, "RenderDevice has been created.");
+        loadedModelviewKnown = false;
+
+        // Initialises device and sets the default state of the device in 3D mode
+        Initialise();
+        Reset();
+    }
+
+
+    RenderDevice::~RenderDevice()
+    {
+        logger->WriteTextAndNewLine(logID, "RenderDevice has been destroyed.");
+
+        // Releases any resources used by RenderDevice
+        delete lighting;
+        // The scene target and queries are also deleted through the backend
+        DisableDynamicResolution();
+        /* The skin manager deletes its textures through the backend, so that has to be done
+         * before the backend is deleted (the skin manager itself is destroyed after this). */
+        skinManager.DeleteAll();
+        if (ownsBackend) delete targetBackend;
+
+        // Make null pointers
+        logger = NULL;
+
+        // All managers are cleaned up automatically in their destructors
+        // OpenGL device context is also cleaned up automatically
+    }
+
+
+
+
+    void RenderDevice::Initialise()
+    {
+        // Sets default OpenGL state
+        stateCache.Enable(CAPABILITY_BLEND);
+        stateCache.Enable(CAPABILITY_TEXTURE2D);
+        stateCache.Enable(CAPABILITY_DEPTHTEST);
+        stateCache.SetBlendMode(BLENDMODE_ALPHA);
+
+        // Sets the clear colour and clears the buffers
+        stateCache.SetClearColour(colourf(0.0f, 0.0f, 0.0f, 0.0f));
+        stateCache.Clear(CLEAR_COLOUR | CLEAR_DEPTH);
+
+        // Sets world/view the matrices to identity
+        worldMatrix = matrixf::Identity(4);
+        viewMatrix = matrixf::Identity(4);
+        // Sets default projections for the two render modes
+        projectionMatrix2D = matrixf::Identity(4);
+        projectionMatrix3D = matrixf::Identity(4);
+
+        // Builds a viewport with dimensions of the device context
+        BuildViewport();
+    }
+
+
+    void RenderDevice::SetRenderMode(RenderMode renderMode)
+    {
+        // The 3D scene has been drawn, so it's copied onto the window before anything in 2D
+        if (renderMode == RENDERMODE_2D && sceneTargetBound) ResolveScene();
+
+        // Sets new render mode...
+        mode = renderMode;
+        // ...then resets the device's state
+        Reset();
+    }
+
+
+    void RenderDevice::Reset()
+    {
+        float array[16]; // Temporarily holds matrix values
+
+        // Loads the projection matrix for this render mode
+        stateCache.SetMatrixMode(MATRIXSTACK_PROJECTION);
+        if (mode == RENDERMODE_2D) projectionMatrix2D.ToArray(array);
+        if (mode == RENDERMODE_3D) projectionMatrix3D.ToArray(array);
+        stateCache.LoadMatrix(array);
+
+        // Sets up the world (model) and view matrices
+        stateCache.SetMatrixMode(MATRIXSTACK_MODELVIEW); // Switches to the modelview stack
+        // Loads the world matrix and then multiplies it with the view (camera) matrix
+        float modelview[32];
+        worldMatrix.ToArray(modelview);
+        viewMatrix.ToArray(modelview + 16);
+        stateCache.LoadMatrix(modelview);
+        stateCache.MultiplyMatrix(modelview + 16);
+
+        // Lights set up under a different modelview matrix have to be set up again
+        bool modelviewChanged = !loadedModelviewKnown;
+        for (unsigned int i = 0; (i < 32); i++)
+        {
+            if (!modelviewChanged && loadedModelview[i] != modelview[i]) modelviewChanged = true;
+            loadedModelview[i] = modelview[i];
+        }
+        loadedModelviewKnown = true;
+        if (modelviewChanged) lighting->InvalidateTransforms();
+
+        /* Enables/disables certain states depending on the render mode the device
+         * is being swtiched to. The state cache skips these if nothing changes. */
+        if (mode == RENDERMODE_2D)
+        {
+            stateCache.Disable(CAPABILITY_DEPTHTEST);
+        }
+        else if (mode == RENDERMODE_3D)
+        {
+            stateCache.Enable(CAPABILITY_DEPTHTEST);
+        }
+
+        // Logs the event
+        if (mode == RENDERMODE_2D)
+        {
+            logger->WriteTextAndNewLine(logID, "Render mode switched to 2D.");
+        }
+        else if (mode == RENDERMODE_3D)
+        {
+            logger->WriteTextAndNewLine(logID, "Render mode switched to 3D.");
+        }
+    }
+
+
+    void RenderDevice::StartRendering()
+    {
+        // Starts rendering if has not started already
+        if (!renderStarted) renderStarted = true;
+        // Otherwise, log an error message and return
+        else
+        {
+            logger->WriteTextAndNewLine(logID,
+                "RenderDevice::StartRendering - Render pass has already started.");
+            return;
+        }
+        // Uniform counters count a frame
+        Program::ResetUniformCounters();
+
+        // Draws the scene into the target at the controller's scale
+        if (sceneTarget)
+        {
+            QueryPerformanceCounter(&passStartTime);
+
+            float scale = resolutionController.GetScale();
+            sceneSize.x = static_cast<int>(viewportSize.x * scale);
+            sceneSize.y = static_cast<int>(viewportSize.y * scale);
+            if (sceneSize.x < 1) sceneSize.x = 1;
+            if (sceneSize.y < 1) sceneSize.y = 1;
+
+            // Creating the target's attachments binds texture 0, so this is done before the skin is cleared
+            sceneTarget->Resize(viewportSize.x, viewportSize.y);
+            sceneTarget->Bind();
+            stateCache.SetViewport(0, 0, sceneSize.x, sceneSize.y);
+            sceneTargetBound = true;
+
+            // Only starts a query if the one that was last in its place has been read
+            queryRunning = (timingGPU && (queriesStarted - queriesRead) < amountOfFrameQueries);
+            if (queryRunning)
+            {
+                stateCache.BeginTimerQuery(frameQueries[queriesStarted % amountOfFrameQueries]);
+                frameQueryScales[queriesStarted % amountOfFrameQueries] = scale;
+                ++queriesStarted;
+            }
+        }
+
+
+        // Also wipes texture and material clean
+        ClearSkinAndTexture();
+        // Updates the lighting
+        lighting->Update();
+
+
+        // Clears the colour and depth buffers
+        stateCache.Clear(CLEAR_COLOUR | CLEAR_DEPTH);
+    }
+
+
+    void RenderDevice::EndRendering()
+    {
+        // Stops rendering if has actually started
+        if (renderStarted) renderStarted = false;
+        // Otherwise, log an error message and return
+        else
+        {
+            logger->WriteTextAndNewLine(logID,
+                "RenderDevice::StartRendering - Render pass cannot end before being started.");
+            return;
+        }
+
+        if (sceneTarget)
+        {
+            // Nothing was drawn in 2D, so the scene still has to be copied to the window
+            if (sceneTargetBound) ResolveScene();
+
+            // Measures how long the CPU took to get through the pass
+            LARGE_INTEGER passEndTime, frequency;
+            QueryPerformanceCounter(&passEndTime);
+            QueryPerformanceFrequency(&frequency);
+            float cpuTime = static_cast<float>(passEndTime.QuadPart - passStartTime.QuadPart) * 1000.0f /
+                static_cast<float>(frequency.QuadPart);
+
+            // GPU time is from a few frames ago, so it's given with the scale that frame was drawn at
+            ReadFrameQueries();
+            resolutionController.AddFrameTime(cpuTime, lastGPUTime, lastGPUScale);
+        }
+    }
+
+
+    bool RenderDevice::EnableDynamicResolution(const DynamicResolutionSettings& settings)
+    {
+        if (!stateCache.SupportsRenderTargets())
+        {
+            logger->WriteTextAndNewLine(logID,
+                "Dynamic resolution could not be enabled, render targets are not supported.");
+            return false;
+        }
+        // Throws before anything is created if the settings are wrong
+        resolutionController.SetSettings(settings);
+
+        if (!sceneTarget)
+        {
+            sceneTarget = new RenderTarget(&stateCache, viewportSize.x, viewportSize.y);
+            // Creating the target changed the bound texture
+            ClearSkinAndTexture();
+
+            timingGPU = stateCache.SupportsTimerQueries();
+            if (timingGPU) stateCache.GenerateQueries(amountOfFrameQueries, frameQueries);
+            queriesStarted = queriesRead = 0;
+            lastGPUTime = -1.0f;
+            lastGPUScale = 1.0f;
+        }
+
+        logger->WriteTextAndNewLine(logID, "Dynamic resolution enabled.");
+        return true;
+    }
+
+    void RenderDevice::DisableDynamicResolution()
+    {
+        if (!sceneTarget) return;
+
+        // Makes sure the window is being drawn to again if this is called in the middle of a pass
+        if (sceneTargetBound) ResolveScene();
+
+        if (timingGPU) stateCache.DeleteQueries(amountOfFrameQueries, frameQueries);
+        timingGPU = false;
+        delete sceneTarget;
+        sceneTarget = NULL;
+        resolutionController.Reset();
+    }
+
+    float RenderDevice::GetResolutionScale() const
+    {
+        if (sceneTarget) return resolutionController.GetScale();
+        else return 1.0f;
+    }
+
+
+    void RenderDevice::ResolveScene()
+    {
+        if (queryRunning)
+        {
+            stateCache.EndTimerQuery();
+            queryRunning = false;
+        }
+
+        sceneTarget->BlitToWindow(sceneSize.x, sceneSize.y, viewportSize.x, viewportSize.y);
+        sceneTargetBound = false;
+        BuildViewport();
+    }
+
+    void RenderDevice::ReadFrameQueries()
+    {
+        // Queries finish in the order they were started, so stops at the first one that hasn't
+        float milliseconds;
+        while (queriesRead < queriesStarted && !(queryRunning && queriesRead == queriesStarted - 1))
+        {
+            if (!stateCache.GetTimerQueryResult(frameQueries[queriesRead % amountOfFrameQueries], milliseconds)) break;
+            lastGPUTime = milliseconds;
+            lastGPUScale = frameQueryScales[queriesRead % amountOfFrameQueries];
+            ++queriesRead;
+        }
+    }
+
+
+    void RenderDevice::SetLighting(ALighting* newLighting)
+    {
+        if (!newLighting)
+        {
+            throw debug::NullPointerException("RenderDevice::SetLighting - Given a null lighting manager!");
+        }
+        if (newLighting == lighting) return;
+
+        lighting->DisableLighting();
+        delete lighting;
+        lighting = newLighting;
+    }
+
+
+    void RenderDevice::SetActiveSkin(SkinHandle skin)
+    {
+        try
+        {
+            // Gets the needed skin from the skin manager
+            Skin* skinData = skinManager.GetSkin(skin);
+            // Now retrieves the material and primary texture
+            Material* mat = skinManager.GetMaterial(skinData->material);
+            TextureHandle texture = skinData->textures[0];
+            // Sets the material of the skin
+            stateCache.SetMaterialColour(MATERIALCOLOUR_AMBIENT, mat->ambient);
+            stateCache.SetMaterialColour(MATERIALCOLOUR_DIFFUSE, mat->diffuse);
+            stateCache.SetMaterialColour(MATERIALCOLOUR_SPECULAR, mat->specular);
+            stateCache.SetMaterialColour(MATERIALCOLOUR_EMISSION, mat->emmisive);
+            stateCache.SetMaterialShininess(mat->specularPower);
+            // Binds the skin's primary texture if it exists
+            if (texture != skinNoTexture)
+            {
+                SetActiveTexture(texture);
+            }
+            // Sets the current active skin and texture
+            currentSkin = skin;
+            currentTexture = texture;
+        }
+        catch(debug::Exception& ex)
+        {
+            // Print error message carried by the thrown exception
+            ex.PrintMessage();
+        }
+        catch (...) { }
+    }
+    void RenderDevice::SetActiveSkin(const std::string& skinID)
+    {
+        try
+        {
+            SetActiveSkin(skinManager.GetSkinHandle(skinID));
+        }
+        catch(debug::Exception& ex)
+        {
+            ex.PrintMessage();
+        }
+    }
+
+
+    void RenderDevice::SetActiveTexture(TextureHandle texture)
+    {
+        Texture* tex = skinManager.GetTexture(texture);
+        // Binds the texture to the currently active texture unit
+        stateCache.BindTexture(tex->glID);
+        // Also sets the texture's transparency
+        SetTextureTransparency(tex);
+
+        currentTexture = texture;
+    }
+    void RenderDevice::SetActiveTexture(const std::string& textureID)
+    {
+        SetActiveTexture(skinManager.GetTextureHandle(textureID));
+    }
+    void RenderDevice::SetActiveTextureWithColourMask(TextureHandle texture, const colourf& colour)
+    {
+        Texture* tex = skinManager.GetTexture(texture);
+        // Binds the texture to the currently active texture unit
+        stateCache.BindTexture(tex->glID);
+        // Also sets the texture's transparency with an additional colour mask
+        SetTextureTransparencyWithColourMask(tex, colour);
+
+        currentTexture = texture;
+    }
+    void RenderDevice::SetActiveTextureWithColourMask(const std::string& textureID, const colourf& colour)
+    {
+        SetActiveTextureWithColourMask(skinManager.GetTextureHandle(textureID), colour);
+    }
+
+
+    void RenderDevice::SetTextureTransparency(const Texture* texture)
+    {
+        // Applies transparency by directly modifying the source colour
+        stateCache.SetColour(colourf(1.0f, 1.0f, 1.0f, texture->transparency));
+    }
+    void RenderDevice::SetTextureTransparencyWithColourMask(const Texture* texture, const colourf& colour)
+    {
+        /* Applies transparency AND colour mask by directly modifying the source colour.
+         * The colour mask can include alpha transparency, the alpha component of
+         * the colour is mutliplied by the texture's preset transprency. */
+        stateCache.SetColour(colourf(colour.r, colour.g, colour.b, (colour.a * texture->transparency)));
+    }
+
+
+    void RenderDevice::ClearSkinAndTexture()
+    {
+        // Sets colour to default just in case a colour was set that may affect other textures
+        stateCache.SetColour(colourf(1.0f, 1.0f, 1.0f, 1.0f));
+
+        // Sets all material properties to white if lighting is enabled
+        stateCache.SetMaterialColour(MATERIALCOLOUR_AMBIENT, presetcolours::White);
+        stateCache.SetMaterialColour(MATERIALCOLOUR_DIFFUSE, presetcolours::White);
+        stateCache.SetMaterialColour(MATERIALCOLOUR_SPECULAR, presetcolours::White);
+        stateCache.SetMaterialColour(MATERIALCOLOUR_EMISSION, presetcolours::White);
+
+        // Unbinds texture in current texture unit
+        stateCache.BindTexture(0);
+
+        // Sets current active skin and texture to nothing
+        currentSkin = currentTexture = invalidHandle;
+    }
+
+
+    const std::string& RenderDevice::GetCurrentSkinID()
+    {
+        if (currentSkin == invalidHandle) return noSkin;
+        else return skinManager.GetSkinID(currentSkin);
+    }
+
+    const std::string& RenderDevice::GetCurrentTextureID()
+    {
+        if (currentTexture == invalidHandle) return noTexture;
+        else return skinManager.GetTextureID(currentTexture);
+    }
+
+
+    bool RenderDevice::IsRenderMode(const RenderMode& rMode)
+    {
+        if (rMode == mode) return true;
+        else return false;
+    }
+
+
+    void RenderDevice::SetViewMatrix(const matrixf&mat)
+    {
+        viewMatrix = mat;
+    }
+
+
+    void RenderDevice::SetProjectionMatrix(RenderMode renderMode,
+        const maths::matrixf& newProjMatrix)
+    {
+        // Sets the appropriate projection for the specified render mode
+        if (renderMode == RENDERMODE_2D)
+        {
+            projectionMatrix2D = newProjMatrix;
+        }
+        else if (renderMode == RENDERMODE_3D)
+        {
+            projectionMatrix3D = newProjMatrix;
+        }
+    }
+
+
+    void RenderDevice::SetViewportSize(const maths::vector2i& newSize)
+    {
+        // Assigns new viewport size...
+        viewportSize = newSize;
+        // ...then rebuilds the viewport
+        BuildViewport();
+    }
+
+    const maths::matrixf& RenderDevice::GetProjectionMatrix(RenderMode renderMode)
+    {
+        if (renderMode == RENDERMODE_2D)
+        {
+            return projectionMatrix2D;
+        }
+        else if (renderMode == RENDERMODE_3D)
+        {
+            return projectionMatrix3D;
+        }
+        else
+        {
+            return maths::matrixf::Identity(4);
+        }
+    }
+
+    void RenderDevice::BuildViewport()
+    {
+        // Changes viewport to the desired size
+        stateCache.SetViewport(0, 0, viewportSize.x, viewportSize.y);
+    }
+
+}
+
+}
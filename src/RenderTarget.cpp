@@ -0,0 +1,115 @@
+/*
+ * File:   RenderTarget.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 10:20 PM
+ */
+
+#include "RenderTarget.h"
+#include "RenderDevice.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    RenderTarget::RenderTarget(IRenderBackend* renderBackend, unsigned int targetWidth, unsigned int targetHeight) :
+        backend(renderBackend), framebufferID(0), colourTextureID(0), depthBufferID(0),
+        width(targetWidth), height(targetHeight)
+    {
+        if (!backend)
+        {
+            throw debug::NullPointerException("RenderTarget - Given a null render backend!");
+        }
+        if (!backend->SupportsRenderTargets())
+        {
+            throw GLExtensionUnavailableException("RenderTarget - Render targets are not supported!");
+        }
+
+        backend->GenerateFramebuffers(1, &framebufferID);
+        try
+        {
+            CreateAttachments();
+        }
+        catch (...)
+        {
+            // Makes sure nothing is leaked if the target can't be used
+            DeleteAttachments();
+            backend->DeleteFramebuffers(1, &framebufferID);
+            throw;
+        }
+    }
+
+    RenderTarget::~RenderTarget()
+    {
+        DeleteAttachments();
+        backend->DeleteFramebuffers(1, &framebufferID);
+    }
+
+
+    void RenderTarget::CreateAttachments()
+    {
+        if (width == 0 || height == 0)
+        {
+            throw debug::InvalidArgumentException("RenderTarget - Width and height must be above zero!");
+        }
+
+        // Creates the texture the colour is drawn into. It's scaled when it's copied, so it's filtered linearly
+        backend->GenerateTextures(1, &colourTextureID);
+        backend->BindTexture(colourTextureID);
+        backend->UploadTexture(0, width, height, PIXELFORMAT_RGBA, NULL);
+        backend->SetTextureFilter(TEXTUREFILTER_LINEAR, false);
+        backend->SetTextureFilter(TEXTUREFILTER_LINEAR, true);
+        backend->SetTextureWrapping(TEXTUREWRAP_CLAMPTOEDGE, 0);
+        backend->SetTextureWrapping(TEXTUREWRAP_CLAMPTOEDGE, 1);
+        backend->BindTexture(0);
+
+        // Then the depth buffer
+        backend->GenerateRenderbuffers(1, &depthBufferID);
+        backend->AllocateDepthRenderbuffer(depthBufferID, width, height);
+
+        // Attaches both and makes sure the result can actually be drawn into
+        backend->BindFramebuffer(framebufferID);
+        bool complete = backend->AttachToFramebuffer(colourTextureID, depthBufferID);
+        backend->BindFramebuffer(0);
+        if (!complete)
+        {
+            throw debug::Exception("RenderTarget - Framebuffer is incomplete, cannot draw into it!");
+        }
+    }
+
+    void RenderTarget::DeleteAttachments()
+    {
+        if (colourTextureID != 0) backend->DeleteTextures(1, &colourTextureID);
+        if (depthBufferID != 0) backend->DeleteRenderbuffers(1, &depthBufferID);
+        colourTextureID = depthBufferID = 0;
+    }
+
+
+    void RenderTarget::Resize(unsigned int newWidth, unsigned int newHeight)
+    {
+        if (newWidth == width && newHeight == height) return;
+
+        DeleteAttachments();
+        width = newWidth;
+        height = newHeight;
+        CreateAttachments();
+    }
+
+
+    void RenderTarget::Bind()
+    {
+        backend->BindFramebuffer(framebufferID);
+    }
+
+    void RenderTarget::BlitToWindow(unsigned int usedWidth, unsigned int usedHeight,
+        unsigned int windowWidth, unsigned int windowHeight)
+    {
+        backend->BlitFramebuffer(framebufferID, usedWidth, usedHeight, 0, windowWidth, windowHeight);
+    }
+
+}
+
+}
@@ -0,0 +1,175 @@
+/*
+ * File:   ShaderPermutations.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 2:10 AM
+ */
+
+#include <fstream>
+#include <sstream>
+#include "ShaderPermutations.h"
+#include "Exceptions.h"
+#include "Util.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    ShaderPermutations::ShaderPermutations(ProgramCache* programCache) : cache(programCache)
+    {
+    }
+
+    ShaderPermutations::~ShaderPermutations()
+    {
+        for (std::map<FeatureMask, Program*>::iterator it = programs.begin(); (it != programs.end()); it++)
+        {
+            delete it->second;
+        }
+    }
+
+
+    void ShaderPermutations::AddShader(ShaderType type, const std::string& filename)
+    {
+        if (!programs.empty())
+        {
+            throw debug::Exception("ShaderPermutations - Cannot add a shader after variants have been compiled!");
+        }
+
+        Stage stage;
+        stage.type = type;
+        stage.source = Shader::LoadShaderFile(filename);
+        stages.push_back(stage);
+    }
+
+    FeatureMask ShaderPermutations::AddFeature(const std::string& define)
+    {
+        for (unsigned int i = 0; (i < features.size()); i++)
+        {
+            if (features[i] == define)
+            {
+                throw debug::InvalidArgumentException("ShaderPermutations - Feature '" + define + "' has already been added!");
+            }
+        }
+        if (features.size() >= maxFeatures)
+        {
+            throw debug::InvalidArgumentException("ShaderPermutations - Cannot add more than 32 features!");
+        }
+
+        features.push_back(define);
+        return 1u << (features.size() - 1);
+    }
+
+    FeatureMask ShaderPermutations::GetFeature(const std::string& define) const
+    {
+        for (unsigned int i = 0; (i < features.size()); i++)
+        {
+            if (features[i] == define) return 1u << i;
+        }
+        throw debug::InvalidArgumentException("ShaderPermutations - Feature '" + define + "' has not been added!");
+    }
+
+
+    Program* ShaderPermutations::GetProgram(FeatureMask mask)
+    {
+        std::map<FeatureMask, Program*>::iterator it = programs.find(mask);
+        if (it != programs.end()) return it->second;
+
+        // Every bit has to be a feature
+        if (features.size() < maxFeatures && (mask >> features.size()) != 0)
+        {
+            throw debug::InvalidArgumentException("ShaderPermutations - Feature mask has bits no feature was added for!");
+        }
+
+        std::vector<std::string> defines;
+        for (unsigned int i = 0; (i < features.size()); i++)
+        {
+            if (mask & (1u << i)) defines.push_back(features[i]);
+        }
+
+        // Shaders are compiled by the link, unless the cache already has the variant
+        Program* program = new Program();
+        for (unsigned int i = 0; (i < stages.size()); i++)
+        {
+            program->AddShader(new Shader(stages[i].type, stages[i].source, defines), "stage" + general::ToString(i), false);
+        }
+        if (!program->Link(cache))
+        {
+            delete program;
+            throw debug::Exception("ShaderPermutations - Variant '" + GetFeatureNames(mask) + "' failed to compile or link!");
+        }
+
+        programs[mask] = program;
+        return program;
+    }
+
+    bool ShaderPermutations::HasProgram(FeatureMask mask) const
+    {
+        return (programs.find(mask) != programs.end());
+    }
+
+
+    std::string ShaderPermutations::GetFeatureNames(FeatureMask mask) const
+    {
+        std::string names;
+        for (unsigned int i = 0; (i < features.size()); i++)
+        {
+            if ((mask & (1u << i)) == 0) continue;
+            if (!names.empty()) names += " ";
+            names += features[i];
+        }
+        return (names.empty()) ? "-" : names;
+    }
+
+    unsigned int ShaderPermutations::Prewarm(const std::string& manifestFilename)
+    {
+        std::ifstream file(manifestFilename.c_str());
+        if (!file.is_open()) return 0;
+
+        unsigned int compiled = 0;
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::istringstream names(line);
+            std::string name;
+            if (!(names >> name) || name[0] == '#') continue;
+
+            // Works out the line's mask, skipping it if any feature's missing
+            FeatureMask mask = 0;
+            bool known = true;
+            do
+            {
+                if (name == "-") continue;
+                unsigned int i = 0;
+                while (i < features.size() && features[i] != name) i++;
+                if (i == features.size()) known = false;
+                else mask |= (1u << i);
+            }
+            while (known && (names >> name));
+
+            if (known && !HasProgram(mask))
+            {
+                GetProgram(mask);
+                ++compiled;
+            }
+        }
+        return compiled;
+    }
+
+    bool ShaderPermutations::SaveManifest(const std::string& manifestFilename) const
+    {
+        std::ofstream file(manifestFilename.c_str());
+        if (!file.is_open()) return false;
+
+        file << "# Shader variants to compile at startup, one per line" << std::endl;
+        for (std::map<FeatureMask, Program*>::const_iterator it = programs.begin(); (it != programs.end()); it++)
+        {
+            file << GetFeatureNames(it->first) << std::endl;
+        }
+        return file.good();
+    }
+
+}
+
+}
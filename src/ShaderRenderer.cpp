@@ -0,0 +1,479 @@
+/*
+ * File:   ShaderRenderer.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 8:30 PM
+ */
+
+#include "ShaderRenderer.h"
+#include "ClusteredLighting.h"
+#include "Vertex.h"
+#include "Primitives.h"
+#include "Material.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+using namespace maths;
+
+namespace graphics
+{
+
+    namespace
+    {
+
+        /* Only lists of separate primitives can be joined into one draw call, drawing two
+         * strips or fans together would connect them. */
+        bool CanBatch(PrimitiveType type)
+        {
+            return (type == PRIMITIVETYPE_POINT || type == PRIMITIVETYPE_LINE ||
+                type == PRIMITIVETYPE_TRIANGLE || type == PRIMITIVETYPE_QUAD);
+        }
+
+    }
+
+
+    ShaderRenderer::ShaderRenderer(RenderDevice* renderDevice, Program* shaderProgram, debug::Logger* log,
+        const bool& willDeleteAll) :
+        ARenderer(log, "ShaderRenderer", willDeleteAll), // Calls superclass' constructor
+        vboID(0), vboData(NULL), objectBufferID(0), objectTextureID(0), program(shaderProgram),
+        objectIndexLocation(0), useTextureArrays(false), lighting(NULL), renderDevice(renderDevice),
+        backend(renderDevice->GetBackend())
+    {
+        if (!program)
+        {
+            throw debug::NullPointerException("ShaderRenderer - Given a null shader program!");
+        }
+        if (!backend->SupportsTextureBuffers())
+        {
+            throw GLExtensionUnavailableException("ShaderRenderer - Texture buffers are not supported!");
+        }
+
+        // Finds the program's variables and tells it which texture units the samplers use
+        objectIndexLocation = program->GetAttributeLocation("objectIndex");
+        useTextureArrays = backend->SupportsArrayTextures();
+        program->Enable(backend);
+        program->SetUniform("diffuseTexture", 0);
+        program->SetUniform("objectData", static_cast<int>(objectDataUnit));
+        if (useTextureArrays)
+        {
+            program->SetUniform("diffuseArray", static_cast<int>(textureArrayUnit));
+        }
+        program->Disable(backend);
+
+        // Stores currently bound buffers
+        unsigned int arrBuffer = backend->GetBoundBuffer(BUFFERTARGET_ARRAY);
+        unsigned int texBuffer = backend->GetBoundBuffer(BUFFERTARGET_TEXTURE);
+
+        // Creates the VBO and the buffer for the object data
+        backend->GenerateBuffers(1, &vboID);
+        backend->BindBuffer(BUFFERTARGET_ARRAY, vboID);
+        backend->BufferData(BUFFERTARGET_ARRAY, 0, NULL);
+        backend->GenerateBuffers(1, &objectBufferID);
+        backend->BindBuffer(BUFFERTARGET_TEXTURE, objectBufferID);
+        backend->BufferData(BUFFERTARGET_TEXTURE, 0, NULL);
+        // The texture the shaders read the object data buffer through
+        backend->GenerateTextures(1, &objectTextureID);
+
+        // Restores the buffers that were active BEFORE the creation of this renderer
+        backend->BindBuffer(BUFFERTARGET_ARRAY, arrBuffer);
+        backend->BindBuffer(BUFFERTARGET_TEXTURE, texBuffer);
+
+        logger->WriteTextAndNewLine(logID, "ShaderRenderer created.");
+    }
+
+
+    ShaderRenderer::~ShaderRenderer()
+    {
+        // Deletes the buffers and their contents
+        backend->DeleteTextures(1, &objectTextureID);
+        backend->DeleteBuffers(1, &objectBufferID);
+        backend->DeleteBuffers(1, &vboID);
+
+        logger->WriteTextAndNewLine(logID, "ShaderRenderer destroyed.");
+    }
+
+
+    void ShaderRenderer::SetLighting(ClusteredLighting* clusteredLighting)
+    {
+        if (clusteredLighting)
+        {
+            program->Enable(backend);
+            program->SetUniform("lightData", static_cast<int>(lightDataUnit));
+            program->Disable(backend);
+        }
+        lighting = clusteredLighting;
+    }
+
+
+    void ShaderRenderer::ProcessRenderable(IRenderable* renderable, unsigned int& vboIndex, unsigned int& vertexNumber)
+    {
+        unsigned int i; // Iterator for the loops
+
+        // If renderable holds geometry, it becomes the next object
+        IGeometry* geometry = dynamic_cast<IGeometry*>(renderable);
+        if (geometry)
+        {
+            // Every vertex stores the index of its object, as a float like the rest of the VBO
+            float objectIndex = static_cast<float>(arrayIndices.size());
+
+            general::ArrayIndices indices;
+            indices.start = vertexNumber;
+            indices.amount = 0;
+
+            // Fills VBO with the vertices
+            const std::vector<Vertex>& vertexData = geometry->GetVertices();
+            for (i = 0; (i < vertexData.size()); i++)
+            {
+                // Stores vertex position
+                vboData[vboIndex++] = vertexData[i].position.x;
+                vboData[vboIndex++] = vertexData[i].position.y;
+                vboData[vboIndex++] = vertexData[i].position.z;
+                // Stores texture coordinates
+                vboData[vboIndex++] = vertexData[i].texCoord.x;
+                vboData[vboIndex++] = vertexData[i].texCoord.y;
+                // Stores normals
+                vboData[vboIndex++] = vertexData[i].normal.x;
+                vboData[vboIndex++] = vertexData[i].normal.y;
+                vboData[vboIndex++] = vertexData[i].normal.z;
+                // Stores the object's index
+                vboData[vboIndex++] = objectIndex;
+
+                indices.amount++;
+                vertexNumber++;
+            }
+
+            arrayIndices.push_back(indices);
+        }
+
+        // Processes all the group's renderables too, after the group itself
+        IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
+        if (group)
+        {
+            for (i = 0; (i < group->GetAmountOfRenderables()); i++)
+            {
+                if (group->GetRenderable(i) != NULL)
+                {
+                    ProcessRenderable(group->GetRenderable(i), vboIndex, vertexNumber);
+                }
+            }
+        }
+    }
+
+
+    void ShaderRenderer::Update()
+    {
+        /* Gets the size the updated buffer will need to be. GetMemorySize() is the size of the
+         * renderables' Vertex structs, which don't have the object index. */
+        unsigned int vertexCount = 0;
+        for (unsigned int i = 0; (i < renderables.size()); i++)
+        {
+            if (renderables[i] != NULL)
+            {
+                vertexCount += renderables[i]->GetMemorySize() / sizeof(Vertex);
+            }
+        }
+        unsigned int vboMemorySize = vertexCount * floatsPerVertex * sizeof(float);
+
+        // Binds the renderer's buffer to make it active and clears it
+        backend->BindBuffer(BUFFERTARGET_ARRAY, vboID);
+        backend->BufferData(BUFFERTARGET_ARRAY, vboMemorySize, NULL);
+
+        arrayIndices.clear();
+
+        // If memory size is zero, just return since there is nothing to update
+        if (vboMemorySize == 0)
+        {
+            backend->BindBuffer(BUFFERTARGET_ARRAY, 0);
+            return;
+        }
+
+        // Gets pointer to VBO data to put our values into
+        vboData = (float*)backend->MapBuffer(BUFFERTARGET_ARRAY);
+
+        unsigned int vboIndex = 0, vertexNumber = 0;
+        for (unsigned int i = 0; (i < renderables.size()); i++)
+        {
+            if (renderables[i] != NULL)
+            {
+                ProcessRenderable(renderables[i], vboIndex, vertexNumber);
+            }
+        }
+
+        /* Unmap buffer to send new data to the graphics card. If it returns false, the VBO data
+         * must have got corruped, so throw an exception that is to be caught higher up the chain. */
+        if (!backend->UnmapBuffer(BUFFERTARGET_ARRAY))
+        {
+            throw debug::Exception("ShaderRenderer::Update - VBO data got corrupted when changing data.");
+        }
+        vboData = NULL;
+        backend->BindBuffer(BUFFERTARGET_ARRAY, 0);
+
+        logger->WriteTextAndNewLine(logID, "ShaderRenderer successfully updated.");
+    }
+
+
+    void ShaderRenderer::WriteTexel(unsigned int texel, float x, float y, float z, float w)
+    {
+        float* data = &objectData[texel * 4];
+        data[0] = x; data[1] = y; data[2] = z; data[3] = w;
+    }
+
+    void ShaderRenderer::AppendColour(const colourf& colour)
+    {
+        objectData.push_back(colour.r);
+        objectData.push_back(colour.g);
+        objectData.push_back(colour.b);
+        objectData.push_back(colour.a);
+    }
+
+
+    unsigned int ShaderRenderer::GetMaterialSlot(MaterialHandle material)
+    {
+        if (material == invalidHandle) return 0;
+
+        // Makes sure there's a slot entry for the handle
+        if (material >= materialSlots.size())
+        {
+            materialSlots.resize(material + 1, invalidHandle);
+        }
+        if (materialSlots[material] != invalidHandle) return materialSlots[material];
+
+        // The material hasn't been used this frame yet, so write it at the end of the data
+        const Material* mat = renderDevice->GetSkinManager()->GetMaterial(material);
+        unsigned int slot = usedMaterials.size() + 1; // Slot 0 is the default material
+        AppendColour(mat->ambient);
+        AppendColour(mat->diffuse);
+        AppendColour(mat->specular);
+        AppendColour(mat->emmisive);
+        AppendColour(colourf(mat->specularPower, 0.0f, 0.0f, 0.0f));
+
+        materialSlots[material] = slot;
+        usedMaterials.push_back(material);
+        return slot;
+    }
+
+
+    void ShaderRenderer::GatherObject(IRenderable* renderable, const float* parentMatrix, SkinHandle skin,
+        unsigned int& objectIndex)
+    {
+        // Combines the renderable's own matrix with its parent's, if it has one
+        float world[16];
+        IMatrix* mat = dynamic_cast<IMatrix*>(renderable);
+        if (mat)
+        {
+            float local[16];
+            mat->GetMatrixAsArray(local);
+            general::MultiplyMatrixArrays(parentMatrix, local, world);
+        }
+        else
+        {
+            for (unsigned int i = 0; (i < 16); i++) world[i] = parentMatrix[i];
+        }
+
+        // Children use their parent's skin unless they have their own
+        ISkinned* skinned = dynamic_cast<ISkinned*>(renderable);
+        if (skinned)
+        {
+            skin = skinned->GetSkinHandle();
+        }
+
+
+        IGeometry* geometry = dynamic_cast<IGeometry*>(renderable);
+        if (geometry)
+        {
+            unsigned int materialSlot = 0;
+            TextureHandle texture = invalidHandle;
+            unsigned int textureArray = 0, layer = 0;
+
+            /* A missing skin just means the object is drawn with the default material, it
+             * still has to be written so the object indices in the VBO stay valid. */
+            try
+            {
+                if (skin != invalidHandle)
+                {
+                    const Skin* skinData = renderDevice->GetSkinManager()->GetSkin(skin);
+                    materialSlot = GetMaterialSlot(skinData->material);
+                    texture = skinData->textures[0];
+
+                    // Uses the texture's array instead if it's in one
+                    if (useTextureArrays && texture != skinNoTexture)
+                    {
+                        const Texture* textureData = renderDevice->GetSkinManager()->GetTexture(texture);
+                        if (textureData->arrayID != 0)
+                        {
+                            textureArray = textureData->arrayID;
+                            layer = textureData->arrayLayer;
+                            texture = skinNoTexture;
+                        }
+                    }
+                }
+            }
+            catch (debug::Exception& ex)
+            {
+                ex.PrintMessage();
+            }
+
+            /* Writes the world matrix's columns, then the material, how it's textured (0 for not at
+             * all, 1 for a 2D texture and 2 for an array texture) and the array texture layer. */
+            unsigned int texel = headerTexels + (objectIndex * texelsPerObject);
+            for (unsigned int column = 0; (column < 4); column++)
+            {
+                WriteTexel(texel + column, world[column * 4], world[(column * 4) + 1],
+                    world[(column * 4) + 2], world[(column * 4) + 3]);
+            }
+            float textured = (textureArray != 0) ? 2.0f : ((texture != skinNoTexture) ? 1.0f : 0.0f);
+            WriteTexel(texel + 4, static_cast<float>(materialSlot), textured, static_cast<float>(layer), 0.0f);
+
+            // Joins the object onto the last batch if nothing needs to change between them
+            const general::ArrayIndices& indices = arrayIndices[objectIndex];
+            PrimitiveType type = static_cast<PrimitiveType>(geometry->GetPrimitiveType());
+            if (!batches.empty() && CanBatch(type) && batches.back().type == type &&
+                batches.back().texture == texture && batches.back().textureArray == textureArray &&
+                (batches.back().start + batches.back().amount) == indices.start)
+            {
+                batches.back().amount += indices.amount;
+            }
+            else
+            {
+                DrawBatch batch;
+                batch.type = type;
+                batch.texture = texture;
+                batch.textureArray = textureArray;
+                batch.start = indices.start;
+                batch.amount = indices.amount;
+                batches.push_back(batch);
+            }
+
+            objectIndex++;
+        }
+
+
+        // If it's a group renderable, gather all of its child objects
+        IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
+        if (group)
+        {
+            for (unsigned int i = 0; (i < group->GetAmountOfRenderables()); i++)
+            {
+                if (group->GetRenderable(i) != NULL)
+                {
+                    GatherObject(group->GetRenderable(i), world, skin, objectIndex);
+                }
+            }
+        }
+    }
+
+
+    void ShaderRenderer::Render()
+    {
+        // Forgets last frame's materials
+        for (unsigned int i = 0; (i < usedMaterials.size()); i++)
+        {
+            materialSlots[usedMaterials[i]] = invalidHandle;
+        }
+        usedMaterials.clear();
+        batches.clear();
+
+        /* The materials go after the objects, since the amount of objects is known but the
+         * amount of materials used isn't until every object has been gathered. */
+        unsigned int objectsStart = headerTexels;
+        unsigned int materialsStart = objectsStart + (arrayIndices.size() * texelsPerObject);
+        objectData.resize(materialsStart * 4);
+
+        // Writes the header and the camera matrices
+        WriteTexel(0, static_cast<float>(materialsStart), static_cast<float>(objectsStart), 0.0f, 0.0f);
+        float matrix[16];
+        renderDevice->GetViewMatrix().ToArray(matrix);
+        for (unsigned int column = 0; (column < 4); column++)
+        {
+            WriteTexel(1 + column, matrix[column * 4], matrix[(column * 4) + 1],
+                matrix[(column * 4) + 2], matrix[(column * 4) + 3]);
+        }
+        renderDevice->GetProjectionMatrix(renderDevice->IsRenderMode(RENDERMODE_2D) ?
+            RENDERMODE_2D : RENDERMODE_3D).ToArray(matrix);
+        for (unsigned int column = 0; (column < 4); column++)
+        {
+            WriteTexel(5 + column, matrix[column * 4], matrix[(column * 4) + 1],
+                matrix[(column * 4) + 2], matrix[(column * 4) + 3]);
+        }
+
+        // The default material, white and unlit
+        AppendColour(colourf(0.2f, 0.2f, 0.2f, 1.0f));
+        AppendColour(colourf(1.0f, 1.0f, 1.0f, 1.0f));
+        AppendColour(colourf(0.0f, 0.0f, 0.0f, 1.0f));
+        AppendColour(colourf(0.0f, 0.0f, 0.0f, 1.0f));
+        AppendColour(colourf(0.0f, 0.0f, 0.0f, 0.0f));
+
+        // Gathers every object, starting from no transformation and no skin
+        float identity[16] = { 1.0f, 0.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f, 0.0f,
+                               0.0f, 0.0f, 1.0f, 0.0f,  0.0f, 0.0f, 0.0f, 1.0f };
+        unsigned int objectIndex = 0;
+        for (unsigned int i = 0; (i < renderables.size()); i++)
+        {
+            if (renderables[i] != NULL)
+            {
+                GatherObject(renderables[i], identity, invalidHandle, objectIndex);
+            }
+        }
+
+        // Sends the whole frame's object data off in one go
+        backend->BindBuffer(BUFFERTARGET_TEXTURE, objectBufferID);
+        backend->BufferData(BUFFERTARGET_TEXTURE, objectData.size() * sizeof(float), &objectData[0]);
+        backend->BindBuffer(BUFFERTARGET_TEXTURE, 0);
+        backend->BindTextureBuffer(objectDataUnit, objectTextureID, objectBufferID);
+        if (lighting) lighting->Bind(lightDataUnit);
+
+
+        // Bind the vertex buffer object and points to the vertex arrays in it
+        backend->BindBuffer(BUFFERTARGET_ARRAY, vboID);
+        unsigned int stride = floatsPerVertex * sizeof(float);
+        unsigned int vertexOffset = 0,
+            texCoordOffset = sizeof(vector3f),
+            normalOffset = sizeof(vector3f) + sizeof(vector2f),
+            objectIndexOffset = (2 * sizeof(vector3f)) + sizeof(vector2f);
+        backend->SetVertexPointer(3, stride, (void*)vertexOffset);
+        backend->SetTexCoordPointer(2, stride, (void*)texCoordOffset);
+        backend->SetNormalPointer(stride, (void*)normalOffset);
+        backend->SetAttributePointer(objectIndexLocation, 1, stride, (void*)objectIndexOffset);
+
+        // Enables vertex arrays
+        backend->EnableClientArray(CLIENTARRAY_VERTEX);
+        backend->EnableClientArray(CLIENTARRAY_TEXCOORD);
+        backend->EnableClientArray(CLIENTARRAY_NORMAL);
+        backend->EnableAttributeArray(objectIndexLocation);
+
+        program->Enable(backend);
+
+        // Draws every batch, binding its texture if it has one that isn't already bound
+        unsigned int boundArray = 0;
+        for (unsigned int i = 0; (i < batches.size()); i++)
+        {
+            if (batches[i].texture != skinNoTexture && renderDevice->GetCurrentTexture() != batches[i].texture)
+            {
+                renderDevice->SetActiveTexture(batches[i].texture);
+            }
+            if (batches[i].textureArray != 0 && batches[i].textureArray != boundArray)
+            {
+                boundArray = batches[i].textureArray;
+                backend->BindArrayTexture(textureArrayUnit, boundArray);
+            }
+            backend->DrawArrays(batches[i].type, batches[i].start, batches[i].amount);
+        }
+
+        program->Disable(backend);
+        if (boundArray != 0) backend->BindArrayTexture(textureArrayUnit, 0);
+
+
+        // Unbinds everything and returns to client mode
+        backend->DisableAttributeArray(objectIndexLocation);
+        backend->BindTextureBuffer(objectDataUnit, 0, 0);
+        if (lighting) backend->BindTextureBuffer(lightDataUnit, 0, 0);
+        backend->BindBuffer(BUFFERTARGET_ARRAY, 0);
+
+        logger->WriteTextAndNewLine(logID, "ShaderRenderer draws objects stored.");
+    }
+
+}
+
+}
@@ -0,0 +1,699 @@
+/*
+ * File:   ShadowMaps.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:50 AM
+ * Changed to cache uniform locations and fit cascades to dynamic casters on October 19, 2026, 5:05 AM
+ */
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include "ShadowMaps.h"
+#include "ClusteredLighting.h"
+#include "Exceptions.h"
+#include "Util.h"
+
+namespace parcel
+{
+
+using namespace maths;
+
+namespace graphics
+{
+
+    namespace
+    {
+
+        const float identity[16] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+
+        // Takes x, y and z from -1 to 1 (after the divide by w) into 0 to 1
+        const float bias[16] = { 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f,
+            0.0f, 0.0f, 0.5f, 0.0f, 0.5f, 0.5f, 0.5f, 1.0f };
+
+        // Light further than this fraction of its brightness doesn't get a shadow
+        const float spotlightRangeThreshold = 1.0f / 256.0f;
+        // Added to both sides of a spotlight's cone so the edge of its light is still shadowed
+        const float spotlightAngleMargin = 2.0f;
+        const float maxSpotlightAngle = 170.0f;
+
+        float Dot(const vector3f& a, const vector3f& b)
+        {
+            return (a.x * b.x) + (a.y * b.y) + (a.z * b.z);
+        }
+
+        vector3f Cross(const vector3f& a, const vector3f& b)
+        {
+            return vector3f((a.y * b.z) - (a.z * b.y), (a.z * b.x) - (a.x * b.z), (a.x * b.y) - (a.y * b.x));
+        }
+
+        vector3f Normalised(const vector3f& v)
+        {
+            float length = std::sqrt(Dot(v, v));
+            if (length == 0.0f) return v;
+            return vector3f(v.x / length, v.y / length, v.z / length);
+        }
+
+        /* Builds a view matrix at 'eye' looking along 'forward' (which must be normalised),
+         * like gluLookAt(). */
+        void LookAlong(const vector3f& eye, const vector3f& forward, float* m)
+        {
+            // Any up vector works, as long as it's not along the forward vector
+            vector3f up = (std::fabs(forward.y) > 0.99f) ? vector3f(1.0f, 0.0f, 0.0f) : vector3f(0.0f, 1.0f, 0.0f);
+            vector3f side = Normalised(Cross(forward, up));
+            up = Cross(side, forward);
+
+            m[0] = side.x; m[4] = side.y; m[8] = side.z; m[12] = -Dot(side, eye);
+            m[1] = up.x; m[5] = up.y; m[9] = up.z; m[13] = -Dot(up, eye);
+            m[2] = -forward.x; m[6] = -forward.y; m[10] = -forward.z; m[14] = Dot(forward, eye);
+            m[3] = 0.0f; m[7] = 0.0f; m[11] = 0.0f; m[15] = 1.0f;
+        }
+
+        /* Same as glOrtho(). */
+        void Orthographic(float left, float right, float bottom, float top, float zNear, float zFar, float* m)
+        {
+            std::fill(m, m + 16, 0.0f);
+            m[0] = 2.0f / (right - left);
+            m[5] = 2.0f / (top - bottom);
+            m[10] = -2.0f / (zFar - zNear);
+            m[12] = -(right + left) / (right - left);
+            m[13] = -(top + bottom) / (top - bottom);
+            m[14] = -(zFar + zNear) / (zFar - zNear);
+            m[15] = 1.0f;
+        }
+
+        /* Same as gluPerspective() with an aspect ratio of 1. The angle is in degrees. */
+        void Perspective(float fieldOfView, float zNear, float zFar, float* m)
+        {
+            float f = 1.0f / static_cast<float>(std::tan(DegreesToRadians(fieldOfView) * 0.5f));
+            std::fill(m, m + 16, 0.0f);
+            m[0] = f;
+            m[5] = f;
+            m[10] = (zFar + zNear) / (zNear - zFar);
+            m[11] = -1.0f;
+            m[14] = (2.0f * zFar * zNear) / (zNear - zFar);
+        }
+
+        /* Inverts a view matrix, which only rotates and moves. */
+        void InvertView(const float* m, float* result)
+        {
+            for (unsigned int column = 0; (column < 3); column++)
+            {
+                for (unsigned int row = 0; (row < 3); row++) result[(column * 4) + row] = m[(row * 4) + column];
+                result[(column * 4) + 3] = 0.0f;
+            }
+            for (unsigned int row = 0; (row < 3); row++)
+            {
+                result[12 + row] = -((m[(row * 4)] * m[12]) + (m[(row * 4) + 1] * m[13]) + (m[(row * 4) + 2] * m[14]));
+            }
+            result[15] = 1.0f;
+        }
+
+        /* Distance of a point along the view matrix's z axis (negative in front of it). */
+        float ViewDepth(const float* m, const vector3f& p)
+        {
+            return (m[2] * p.x) + (m[6] * p.y) + (m[10] * p.z) + m[14];
+        }
+
+    }
+
+
+    ShadowMaps::ShadowMaps(RenderDevice* device, const ShadowSettings& shadowSettings) :
+        renderDevice(device), settings(shadowSettings), sun(NULL), staticMapsDrawn(0), castersDrawn(0)
+    {
+        if (!renderDevice) throw debug::NullPointerException("ShadowMaps::ShadowMaps - Cannot use a NULL render device!");
+        if ((settings.amountOfCascades == 0) || (settings.amountOfCascades > maxCascades))
+            throw debug::InvalidArgumentException("ShadowMaps - There must be between 1 and 4 cascades!");
+        if (settings.resolution == 0)
+            throw debug::InvalidArgumentException("ShadowMaps - Shadow maps must be bigger than zero!");
+        if ((settings.shadowDistance <= 0.0f) || (settings.cacheMargin <= 0.0f) || (settings.depthMargin <= 0.0f))
+            throw debug::InvalidArgumentException("ShadowMaps - The shadow distance and margins must be above zero!");
+        if ((settings.splitWeight < 0.0f) || (settings.splitWeight > 1.0f))
+            throw debug::InvalidArgumentException("ShadowMaps - The split weight must be from 0 to 1!");
+        if ((settings.spotlightNear <= 0.0f) || (settings.spotlightFar <= settings.spotlightNear))
+            throw debug::InvalidArgumentException("ShadowMaps - The spotlight near plane must be above zero and before the far plane!");
+
+        backend = renderDevice->GetBackend();
+        if (!backend->SupportsShadowMaps())
+            throw GLExtensionUnavailableException("ShadowMaps::ShadowMaps - "
+                "Shadow maps need framebuffers, depth textures and GL_ARB_shadow!");
+
+        for (unsigned int i = 0; (i < maxCascades); i++)
+        {
+            cascades[i].staticTexture = cascades[i].staticFramebuffer = 0;
+            cascades[i].texture = cascades[i].framebuffer = 0;
+            cascades[i].active = false;
+            cascadeEnds[i] = 0.0f;
+        }
+        try
+        {
+            for (unsigned int i = 0; (i < settings.amountOfCascades); i++) CreateView(cascades[i]);
+        }
+        catch (debug::Exception&)
+        {
+            for (unsigned int i = 0; (i < settings.amountOfCascades); i++) DeleteView(cascades[i]);
+            throw;
+        }
+    }
+
+    ShadowMaps::~ShadowMaps()
+    {
+        for (unsigned int i = 0; (i < settings.amountOfCascades); i++) DeleteView(cascades[i]);
+        for (unsigned int i = 0; (i < spotlightViews.size()); i++) DeleteView(spotlightViews[i]);
+    }
+
+
+    void ShadowMaps::CreateView(ShadowView& view)
+    {
+        view.staticValid = false;
+        view.hasDynamic = false;
+        view.active = false;
+        std::fill(view.cachedMatrix, view.cachedMatrix + 16, 0.0f);
+
+        unsigned int* textures[2] = { &view.staticTexture, &view.texture };
+        unsigned int* framebuffers[2] = { &view.staticFramebuffer, &view.framebuffer };
+        bool complete = true;
+        for (unsigned int i = 0; (i < 2); i++)
+        {
+            backend->GenerateTextures(1, textures[i]);
+            backend->BindTexture(*textures[i]);
+            backend->AllocateDepthTexture(settings.resolution, settings.resolution);
+            backend->BindTexture(0);
+
+            backend->GenerateFramebuffers(1, framebuffers[i]);
+            backend->BindFramebuffer(*framebuffers[i]);
+            complete = complete && backend->AttachDepthTextureToFramebuffer(*textures[i]);
+            backend->BindFramebuffer(0);
+        }
+        if (!complete)
+        {
+            DeleteView(view);
+            throw debug::Exception("ShadowMaps - Framebuffer is incomplete, cannot draw shadow maps!");
+        }
+    }
+
+    void ShadowMaps::DeleteView(ShadowView& view)
+    {
+        if (view.staticTexture != 0) backend->DeleteTextures(1, &view.staticTexture);
+        if (view.texture != 0) backend->DeleteTextures(1, &view.texture);
+        if (view.staticFramebuffer != 0) backend->DeleteFramebuffers(1, &view.staticFramebuffer);
+        if (view.framebuffer != 0) backend->DeleteFramebuffers(1, &view.framebuffer);
+        view.staticTexture = view.texture = view.staticFramebuffer = view.framebuffer = 0;
+    }
+
+
+    void ShadowMaps::SetSun(ALight* light)
+    {
+        sun = light;
+    }
+
+    unsigned int ShadowMaps::AddSpotlight(ALight* light)
+    {
+        if (!light) throw debug::NullPointerException("ShadowMaps::AddSpotlight - Cannot shadow a NULL spotlight!");
+
+        ShadowView view;
+        view.staticTexture = view.staticFramebuffer = view.texture = view.framebuffer = 0;
+        CreateView(view);
+        spotlights.push_back(light);
+        spotlightViews.push_back(view);
+        return spotlights.size() - 1;
+    }
+
+    void ShadowMaps::RemoveSpotlight(ALight* light)
+    {
+        for (unsigned int i = 0; (i < spotlights.size()); i++)
+        {
+            if (spotlights[i] != light) continue;
+            DeleteView(spotlightViews[i]);
+            spotlights.erase(spotlights.begin() + i);
+            spotlightViews.erase(spotlightViews.begin() + i);
+            return;
+        }
+    }
+
+
+    BoundingVolumeHierarchy::ProxyID ShadowMaps::AddStaticCaster(IRenderable* renderable)
+    {
+        BoundingVolumeHierarchy::ProxyID proxy = staticCasters.InsertRenderable(renderable);
+        const AABB& bounds = staticCasters.GetBounds(proxy);
+        staticBounds.Expand(bounds);
+        InvalidateStatic(bounds);
+        return proxy;
+    }
+
+    void ShadowMaps::RemoveStaticCaster(BoundingVolumeHierarchy::ProxyID proxy)
+    {
+        AABB bounds = staticCasters.GetBounds(proxy);
+        staticCasters.Remove(proxy);
+        InvalidateStatic(bounds);
+    }
+
+    void ShadowMaps::InvalidateStaticCasters()
+    {
+        for (unsigned int i = 0; (i < settings.amountOfCascades); i++) cascades[i].staticValid = false;
+        for (unsigned int i = 0; (i < spotlightViews.size()); i++) spotlightViews[i].staticValid = false;
+    }
+
+    void ShadowMaps::InvalidateStatic(const AABB& bounds)
+    {
+        // Each view's frustum is still the one its cached map was drawn with
+        for (unsigned int i = 0; (i < settings.amountOfCascades); i++)
+        {
+            if (cascades[i].frustum.Classify(bounds) != CONTAINMENT_OUTSIDE) cascades[i].staticValid = false;
+        }
+        for (unsigned int i = 0; (i < spotlightViews.size()); i++)
+        {
+            if (spotlightViews[i].frustum.Classify(bounds) != CONTAINMENT_OUTSIDE) spotlightViews[i].staticValid = false;
+        }
+    }
+
+    BoundingVolumeHierarchy::ProxyID ShadowMaps::AddDynamicCaster(IRenderable* renderable)
+    {
+        return dynamicCasters.InsertRenderable(renderable);
+    }
+
+    void ShadowMaps::RemoveDynamicCaster(BoundingVolumeHierarchy::ProxyID proxy)
+    {
+        dynamicCasters.Remove(proxy);
+    }
+
+
+    void ShadowMaps::UpdateCascades()
+    {
+        for (unsigned int i = 0; (i < settings.amountOfCascades); i++) cascades[i].active = false;
+        if (!sun) return;
+
+        vector3f towardsLight;
+        try
+        {
+            if (!sun->IsEnabled()) return;
+            towardsLight = Normalised(sun->GetDirection());
+        }
+        catch (debug::Exception&)
+        {
+            return; // Not a directional light
+        }
+        if (Dot(towardsLight, towardsLight) == 0.0f) return;
+
+        // Gets the camera's position, direction and planes back out of its matrices
+        float cameraView[16], cameraProjection[16];
+        renderDevice->GetViewMatrix().ToArray(cameraView);
+        renderDevice->GetProjectionMatrix(RENDERMODE_3D).ToArray(cameraProjection);
+        vector3f cameraPosition(
+            -((cameraView[0] * cameraView[12]) + (cameraView[1] * cameraView[13]) + (cameraView[2] * cameraView[14])),
+            -((cameraView[4] * cameraView[12]) + (cameraView[5] * cameraView[13]) + (cameraView[6] * cameraView[14])),
+            -((cameraView[8] * cameraView[12]) + (cameraView[9] * cameraView[13]) + (cameraView[10] * cameraView[14])));
+        vector3f forward(-cameraView[2], -cameraView[6], -cameraView[10]);
+
+        bool perspective = (cameraProjection[11] != 0.0f);
+        float zNear, zFar;
+        if (perspective)
+        {
+            zNear = cameraProjection[14] / (cameraProjection[10] - 1.0f);
+            zFar = cameraProjection[14] / (cameraProjection[10] + 1.0f);
+        }
+        else
+        {
+            zNear = (cameraProjection[14] + 1.0f) / cameraProjection[10];
+            zFar = (cameraProjection[14] - 1.0f) / cameraProjection[10];
+        }
+        // Slope of the view's sides for perspective, half its width and height for orthographic
+        float sideX = 1.0f / cameraProjection[0], sideY = 1.0f / cameraProjection[5];
+        float sideSquared = (sideX * sideX) + (sideY * sideY);
+
+        float end = std::min(zFar, settings.shadowDistance);
+        if ((zNear <= 0.0f && perspective) || (end <= zNear)) return;
+
+        // Every cascade uses the same rotation, looking along the light
+        float lightView[16];
+        LookAlong(vector3f(0.0f, 0.0f, 0.0f), vector3f(-towardsLight.x, -towardsLight.y, -towardsLight.z), lightView);
+
+        /* Depth range of every caster, the same for every cascade. Dynamic casters are in it
+         * too, or the ones outside the static casters' range would be clipped off the map. */
+        AABB casterBounds = staticBounds;
+        casterBounds.Expand(dynamicCasters.GetTotalBounds());
+        float casterNear = 0.0f, casterFar = 0.0f;
+        bool hasCasters = !casterBounds.IsEmpty();
+        if (hasCasters)
+        {
+            casterNear = -FLT_MAX;
+            casterFar = FLT_MAX;
+            for (unsigned int i = 0; (i < 8); i++)
+            {
+                vector3f corner((i & 1) ? casterBounds.maximum.x : casterBounds.minimum.x,
+                    (i & 2) ? casterBounds.maximum.y : casterBounds.minimum.y,
+                    (i & 4) ? casterBounds.maximum.z : casterBounds.minimum.z);
+                float depth = ViewDepth(lightView, corner);
+                casterNear = std::max(casterNear, depth);
+                casterFar = std::min(casterFar, depth);
+            }
+        }
+
+        float start = zNear;
+        for (unsigned int i = 0; (i < settings.amountOfCascades); i++)
+        {
+            ShadowView& cascade = cascades[i];
+
+            // Splits are a blend of logarithmic and even spacing
+            float fraction = static_cast<float>(i + 1) / static_cast<float>(settings.amountOfCascades);
+            float logarithmic = zNear * static_cast<float>(std::pow(end / zNear, fraction));
+            float even = zNear + ((end - zNear) * fraction);
+            cascadeEnds[i] = (settings.splitWeight * logarithmic) + ((1.0f - settings.splitWeight) * even);
+            if (!perspective) cascadeEnds[i] = even;
+            if (i == settings.amountOfCascades - 1) cascadeEnds[i] = end;
+            float sliceEnd = cascadeEnds[i];
+
+            // The smallest sphere around the slice, which only depends on the projection
+            float centreDistance, radius;
+            if (perspective)
+            {
+                centreDistance = std::min(sliceEnd, (start + sliceEnd) * (1.0f + sideSquared) * 0.5f);
+                float along = sliceEnd - centreDistance;
+                radius = std::sqrt((along * along) + (sliceEnd * sliceEnd * sideSquared));
+            }
+            else
+            {
+                centreDistance = (start + sliceEnd) * 0.5f;
+                float along = (sliceEnd - start) * 0.5f;
+                radius = std::sqrt((along * along) + sideSquared);
+            }
+            vector3f centre(cameraPosition.x + (forward.x * centreDistance),
+                cameraPosition.y + (forward.y * centreDistance),
+                cameraPosition.z + (forward.z * centreDistance));
+            start = sliceEnd;
+
+            // The cascade only moves in whole steps of the margin, lined up with its texels
+            float halfWidth = radius * (1.0f + settings.cacheMargin);
+            float texel = (2.0f * halfWidth) / static_cast<float>(settings.resolution);
+            float step = std::max(texel, std::floor((radius * settings.cacheMargin) / texel) * texel);
+            float x = (lightView[0] * centre.x) + (lightView[4] * centre.y) + (lightView[8] * centre.z);
+            float y = (lightView[1] * centre.x) + (lightView[5] * centre.y) + (lightView[9] * centre.z);
+            x = std::floor((x / step) + 0.5f) * step;
+            y = std::floor((y / step) + 0.5f) * step;
+
+            // Depth covers the casters and the margin beyond them, rounded out to the margin
+            // so it only changes when they've grown or moved a lot
+            float centreDepth = ViewDepth(lightView, centre);
+            float closest = hasCasters ? casterNear : centreDepth + radius;
+            float farthest = hasCasters ? casterFar : centreDepth - radius;
+            closest = std::ceil((closest + settings.depthMargin) / settings.depthMargin) * settings.depthMargin;
+            farthest = std::floor((farthest - settings.depthMargin) / settings.depthMargin) * settings.depthMargin;
+
+            std::copy(lightView, lightView + 16, cascade.view);
+            Orthographic(x - halfWidth, x + halfWidth, y - halfWidth, y + halfWidth, -closest, -farthest,
+                cascade.projection);
+            SetViewMatrices(cascade);
+            cascade.active = true;
+        }
+    }
+
+    bool ShadowMaps::UpdateSpotlight(ALight* light, ShadowView& view)
+    {
+        vector3f position, direction;
+        float angle, range;
+        try
+        {
+            if (!light->IsEnabled()) return false;
+            position = light->GetPosition();
+            direction = Normalised(light->GetDirection());
+            angle = std::min(maxSpotlightAngle, (light->GetSpotlightCutoff() + spotlightAngleMargin) * 2.0f);
+            range = ClusteredLighting::GetLightRange(light->GetConstantAttenuation(), light->GetLinearAttenuation(),
+                light->GetQuadraticAttenuation(), spotlightRangeThreshold);
+        }
+        catch (debug::Exception&)
+        {
+            return false; // Not a spotlight
+        }
+        if (Dot(direction, direction) == 0.0f) return false;
+        if (range <= 0.0f) range = settings.spotlightFar;
+        if (range <= settings.spotlightNear) return false;
+
+        LookAlong(position, direction, view.view);
+        Perspective(angle, settings.spotlightNear, range, view.projection);
+        SetViewMatrices(view);
+        return true;
+    }
+
+    void ShadowMaps::SetViewMatrices(ShadowView& view)
+    {
+        general::MultiplyMatrixArrays(view.projection, view.view, view.matrix);
+        general::MultiplyMatrixArrays(bias, view.matrix, view.textureMatrix);
+        view.frustum.ExtractFromMatrix(view.matrix);
+        if (std::memcmp(view.matrix, view.cachedMatrix, sizeof(view.matrix)) != 0) view.staticValid = false;
+    }
+
+
+    void ShadowMaps::Update()
+    {
+        staticMapsDrawn = 0;
+        castersDrawn = 0;
+
+        // The dynamic casters' boxes are needed for the cascades' depth range
+        dynamicCasters.UpdateRenderables();
+        UpdateCascades();
+        for (unsigned int i = 0; (i < spotlights.size()); i++)
+        {
+            spotlightViews[i].active = UpdateSpotlight(spotlights[i], spotlightViews[i]);
+        }
+
+        // Only depth is drawn, from vertex positions
+        bool lighting = backend->IsEnabled(CAPABILITY_LIGHTING);
+        bool texturing = backend->IsEnabled(CAPABILITY_TEXTURE2D);
+        bool depthTest = backend->IsEnabled(CAPABILITY_DEPTHTEST);
+        bool vertexArray = backend->IsClientArrayEnabled(CLIENTARRAY_VERTEX);
+        bool texCoordArray = backend->IsClientArrayEnabled(CLIENTARRAY_TEXCOORD);
+        bool normalArray = backend->IsClientArrayEnabled(CLIENTARRAY_NORMAL);
+        unsigned int arrayBuffer = backend->GetBoundBuffer(BUFFERTARGET_ARRAY);
+
+        if (lighting) backend->Disable(CAPABILITY_LIGHTING);
+        if (texturing) backend->Disable(CAPABILITY_TEXTURE2D);
+        if (!depthTest) backend->Enable(CAPABILITY_DEPTHTEST);
+        if (!vertexArray) backend->EnableClientArray(CLIENTARRAY_VERTEX);
+        if (texCoordArray) backend->DisableClientArray(CLIENTARRAY_TEXCOORD);
+        if (normalArray) backend->DisableClientArray(CLIENTARRAY_NORMAL);
+        if (arrayBuffer != 0) backend->BindBuffer(BUFFERTARGET_ARRAY, 0);
+        backend->Enable(CAPABILITY_POLYGONOFFSET);
+        backend->SetPolygonOffset(settings.slopeBias, settings.depthBias);
+        backend->SetMatrixMode(MATRIXSTACK_PROJECTION);
+        backend->PushMatrix();
+        backend->SetMatrixMode(MATRIXSTACK_MODELVIEW);
+        backend->PushMatrix();
+        backend->SetViewport(0, 0, settings.resolution, settings.resolution);
+
+        for (unsigned int i = 0; (i < settings.amountOfCascades); i++)
+        {
+            if (cascades[i].active) DrawView(cascades[i]);
+            else cascades[i].hasDynamic = false;
+        }
+        for (unsigned int i = 0; (i < spotlightViews.size()); i++)
+        {
+            if (spotlightViews[i].active) DrawView(spotlightViews[i]);
+            else spotlightViews[i].hasDynamic = false;
+        }
+
+        // Puts everything back the way it was
+        backend->BindFramebuffer(0);
+        vector2i viewportSize = renderDevice->GetViewportSize();
+        backend->SetViewport(0, 0, viewportSize.x, viewportSize.y);
+        backend->SetMatrixMode(MATRIXSTACK_PROJECTION);
+        backend->PopMatrix();
+        backend->SetMatrixMode(MATRIXSTACK_MODELVIEW);
+        backend->PopMatrix();
+        backend->Disable(CAPABILITY_POLYGONOFFSET);
+        if (arrayBuffer != 0) backend->BindBuffer(BUFFERTARGET_ARRAY, arrayBuffer);
+        if (normalArray) backend->EnableClientArray(CLIENTARRAY_NORMAL);
+        if (texCoordArray) backend->EnableClientArray(CLIENTARRAY_TEXCOORD);
+        if (!vertexArray) backend->DisableClientArray(CLIENTARRAY_VERTEX);
+        if (!depthTest) backend->Disable(CAPABILITY_DEPTHTEST);
+        if (texturing) backend->Enable(CAPABILITY_TEXTURE2D);
+        if (lighting) backend->Enable(CAPABILITY_LIGHTING);
+    }
+
+    void ShadowMaps::DrawView(ShadowView& view)
+    {
+        if (!view.staticValid)
+        {
+            backend->BindFramebuffer(view.staticFramebuffer);
+            backend->Clear(CLEAR_DEPTH);
+            staticCasters.QueryFrustum(view.frustum, casters);
+            DrawCasters(view);
+            std::copy(view.matrix, view.matrix + 16, view.cachedMatrix);
+            view.staticValid = true;
+            staticMapsDrawn++;
+        }
+
+        // Maps without any dynamic casters in them are read straight from the cached map
+        dynamicCasters.QueryFrustum(view.frustum, casters);
+        view.hasDynamic = !casters.empty();
+        if (!view.hasDynamic) return;
+
+        backend->BlitFramebufferDepth(view.staticFramebuffer, view.framebuffer, settings.resolution,
+            settings.resolution);
+        DrawCasters(view);
+    }
+
+    void ShadowMaps::DrawCasters(const ShadowView& view)
+    {
+        backend->SetMatrixMode(MATRIXSTACK_PROJECTION);
+        backend->LoadMatrix(view.projection);
+        backend->SetMatrixMode(MATRIXSTACK_MODELVIEW);
+        for (unsigned int i = 0; (i < casters.size()); i++)
+        {
+            DrawCaster(casters[i], view.view, identity);
+        }
+        castersDrawn += casters.size();
+    }
+
+    void ShadowMaps::DrawCaster(IRenderable* renderable, const float* view, const float* parentMatrix)
+    {
+        // Like the renderers, a renderable's matrix is relative to its parent's
+        const float* m = parentMatrix;
+        float combined[16];
+        IMatrix* mat = dynamic_cast<IMatrix*>(renderable);
+        if (mat)
+        {
+            float a[16];
+            mat->GetMatrixAsArray(a);
+            general::MultiplyMatrixArrays(parentMatrix, a, combined);
+            m = combined;
+        }
+
+        // Points and lines don't cast shadows
+        IGeometry* geometry = dynamic_cast<IGeometry*>(renderable);
+        IIndexedGeometry* indexedGeometry = dynamic_cast<IIndexedGeometry*>(renderable);
+        if (geometry && (geometry->GetPrimitiveType() >= PRIMITIVETYPE_TRIANGLE) && (!geometry->GetVertices().empty()))
+        {
+            const std::vector<Vertex>& vertices = geometry->GetVertices();
+            float modelview[16];
+            general::MultiplyMatrixArrays(view, m, modelview);
+            backend->LoadMatrix(modelview);
+            backend->SetVertexPointer(3, sizeof(Vertex), &vertices[0].position);
+            backend->DrawArrays(static_cast<PrimitiveType>(geometry->GetPrimitiveType()), 0, vertices.size());
+        }
+        else if (indexedGeometry && (!indexedGeometry->GetFaces().empty()))
+        {
+            // The faces are drawn as a plain triangle list, since element drawing needs a buffer
+            const std::vector<Vertex>& vertices = indexedGeometry->GetVertices();
+            const std::vector<Triangle>& faces = indexedGeometry->GetFaces();
+            expandedPositions.clear();
+            for (unsigned int i = 0; (i < faces.size()); i++)
+            {
+                expandedPositions.push_back(vertices[faces[i].v1].position);
+                expandedPositions.push_back(vertices[faces[i].v2].position);
+                expandedPositions.push_back(vertices[faces[i].v3].position);
+            }
+            float modelview[16];
+            general::MultiplyMatrixArrays(view, m, modelview);
+            backend->LoadMatrix(modelview);
+            backend->SetVertexPointer(3, sizeof(vector3f), &expandedPositions[0]);
+            backend->DrawArrays(PRIMITIVETYPE_TRIANGLE, 0, expandedPositions.size());
+        }
+
+        IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
+        if (group)
+        {
+            for (unsigned int i = 0; (i < group->GetAmountOfRenderables()); i++)
+            {
+                if (group->GetRenderable(i) != NULL)
+                {
+                    DrawCaster(group->GetRenderable(i), view, m);
+                }
+            }
+        }
+    }
+
+
+    void ShadowMaps::SetUniforms(Program* program, unsigned int firstUnit)
+    {
+        if (!program)
+            throw debug::NullPointerException("ShadowMaps::SetUniforms - Cannot set the uniforms of a NULL program!");
+        if (firstUnit == 0) throw debug::InvalidArgumentException("ShadowMaps - Shadow maps cannot be bound to texture unit 0!");
+
+        // Shaders have view space positions, so the matrices start by undoing the camera's view
+        float cameraView[16], inverseView[16];
+        renderDevice->GetViewMatrix().ToArray(cameraView);
+        InvertView(cameraView, inverseView);
+
+        const ProgramUniforms& uniforms = GetProgramUniforms(program);
+        bool active = cascades[0].active;
+        float ends[maxCascades] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        for (unsigned int i = 0; (i < maxCascades); i++)
+        {
+            // Unused cascades still need a map bound, so their samplers are valid
+            const ShadowView& cascade = cascades[std::min(i, settings.amountOfCascades - 1)];
+            unsigned int unit = firstUnit + i;
+            backend->BindDepthTexture(unit, cascade.hasDynamic ? cascade.texture : cascade.staticTexture);
+            program->Set(uniforms.cascades[i], static_cast<int>(unit));
+
+            // Matrices the shader doesn't read aren't worth multiplying out
+            if (uniforms.matrices[i] != -1)
+            {
+                float matrix[16];
+                general::MultiplyMatrixArrays(cascade.textureMatrix, inverseView, matrix);
+                program->SetMatrix(uniforms.matrices[i], matrix);
+            }
+            if (i < settings.amountOfCascades) ends[i] = cascadeEnds[i];
+        }
+        program->Set(uniforms.cascadeEnds, vector4f(ends[0], ends[1], ends[2], ends[3]));
+        program->Set(uniforms.amountOfCascades, active ? static_cast<int>(settings.amountOfCascades) : 0);
+    }
+
+    void ShadowMaps::ForgetProgram(const Program* program)
+    {
+        programUniforms.erase(program);
+    }
+
+    const ShadowMaps::ProgramUniforms& ShadowMaps::GetProgramUniforms(const Program* program)
+    {
+        ProgramUniformTable::iterator it = programUniforms.find(program);
+        if (it != programUniforms.end()) return it->second;
+
+        // Find() gives -1 for uniforms the compiler optimised out, which setting skips
+        ProgramUniforms uniforms;
+        for (unsigned int i = 0; (i < maxCascades); i++)
+        {
+            uniforms.cascades[i] = program->Find("shadowCascade" + general::ToString(i));
+            uniforms.matrices[i] = program->Find("shadowMatrices[" + general::ToString(i) + "]");
+        }
+        uniforms.cascadeEnds = program->Find("shadowCascadeEnds");
+        uniforms.amountOfCascades = program->Find("amountOfShadowCascades");
+        return programUniforms.insert(ProgramUniformTable::value_type(program, uniforms)).first->second;
+    }
+
+
+    unsigned int ShadowMaps::GetCascadeTexture(unsigned int cascade) const
+    {
+        if (cascade >= settings.amountOfCascades) throw debug::InvalidArgumentException("ShadowMaps - Cascade index out of range!");
+        const ShadowView& view = cascades[cascade];
+        return view.hasDynamic ? view.texture : view.staticTexture;
+    }
+
+    const float* ShadowMaps::GetCascadeMatrix(unsigned int cascade) const
+    {
+        if (cascade >= settings.amountOfCascades) throw debug::InvalidArgumentException("ShadowMaps - Cascade index out of range!");
+        return cascades[cascade].textureMatrix;
+    }
+
+    float ShadowMaps::GetCascadeEnd(unsigned int cascade) const
+    {
+        if (cascade >= settings.amountOfCascades) throw debug::InvalidArgumentException("ShadowMaps - Cascade index out of range!");
+        return cascadeEnds[cascade];
+    }
+
+    unsigned int ShadowMaps::GetSpotlightTexture(unsigned int spotlight) const
+    {
+        if (spotlight >= spotlightViews.size()) throw debug::InvalidArgumentException("ShadowMaps - Spotlight index out of range!");
+        const ShadowView& view = spotlightViews[spotlight];
+        return view.hasDynamic ? view.texture : view.staticTexture;
+    }
+
+    const float* ShadowMaps::GetSpotlightMatrix(unsigned int spotlight) const
+    {
+        if (spotlight >= spotlightViews.size()) throw debug::InvalidArgumentException("ShadowMaps - Spotlight index out of range!");
+        return spotlightViews[spotlight].textureMatrix;
+    }
+
+}
+
+}
@@ -1,248 +1,367 @@
-/*
- * File:   SpriteRenderer.cpp
- * Author: Donald "Datriot" Whyte
- *
- * Created on June 29, 2009, 7:05 PM
- */
-
-#include "SpriteRenderer.h"
-#include "Vertex.h"
-#include "Primitives.h"
-#include "Exceptions.h"
-
-namespace parcel
-{
-
-using namespace maths;
-
-namespace graphics
-{
-
-    SpriteRenderer::SpriteRenderer(RenderDevice* renderDevice, debug::Logger* log, const bool& willDeleteAll) :
-        ARenderer(log, "SpriteRenderer", willDeleteAll), // Calls superclass' constructor
-        vboID(0), vboData(NULL), renderDevice(renderDevice)
-    {
-        // Stores currently bound array buffer
-        int arrBuffer;
-        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &arrBuffer);
-        // Generates this renderer's VBO
-        glGenBuffers(1, &vboID);
-        glBindBuffer(GL_ARRAY_BUFFER, vboID);
-        glBufferData(GL_ARRAY_BUFFER, 0, NULL, GL_DYNAMIC_DRAW);
-        // Restores the array buffer that was active BEFORE the creation of this renderer
-        glBindBuffer(GL_ARRAY_BUFFER, arrBuffer);
-
-        logger->WriteTextAndNewLine(logID, "SpriteRenderer created.");
-    }
-
-    SpriteRenderer::~SpriteRenderer()
-    {
-        // Deletes VBO
-        glDeleteBuffers(1, &vboID);
-        logger->WriteTextAndNewLine(logID, "SpriteRenderer destroyed.");
-    }
-
-    void SpriteRenderer::ProcessRenderable(IRenderable* renderable, unsigned int& vboIndex, unsigned int& vertexNumber)
-    {
-        // Stores start and end of this renderable's vertices in the VBO array
-        general::ArrayIndices indices;
-        // Sets the start of the vertices
-        indices.start = vertexNumber;
-
-        unsigned int i; // Iterator for the loops
-        unsigned int amount = 0; // The amount of vertices this renderable has to draw
-
-        // If renderable holds geometry
-        ISprite* sprite = dynamic_cast<ISprite*>(renderable);
-        if (sprite)
-        {
-            // Gets the vertices from the renderable and fills the VBO with them
-            const std::vector<SpriteVertex>& vertexData = sprite->GetVertices();
-            for (i = 0; (i < vertexData.size()); i++)
-            {
-                // Stores vertex position and texture cooridnates
-                vboData[vboIndex++] = vertexData[i].position.x;
-                vboData[vboIndex++] = vertexData[i].position.y;
-                vboData[vboIndex++] = vertexData[i].texCoord.x;
-                vboData[vboIndex++] = vertexData[i].texCoord.y;
-                // Increases the amount of vertices, so it draws this vertex too
-                amount++;
-                // Also increases the total vertex number
-                vertexNumber++;
-            }
-        }
-        // Processes all the group's renderables too
-        IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
-        if (group)
-        {
-            for (i = 0; (i < group->GetAmountOfRenderables()); i++)
-            {
-                if (group->GetRenderable(i) != NULL)
-                {
-                    ProcessRenderable(group->GetRenderable(i), vboIndex, vertexNumber);
-                }
-            }
-        }
-
-        // Sets amount of vertices for indices and pushes the indices into the vector
-        indices.amount = amount;
-        arrayIndices.push_back(indices);
-    }
-
-    void SpriteRenderer::Update()
-    {
-        // Gets the size the updated buffer will need to be
-        vboMemorySize = 0; // Resets memory size to 0
-        // Iterates through all renderables, adding their memory size to the total
-        for (unsigned int i = 0; (i < renderables.size()); i++)
-        {
-            vboMemorySize += renderables[i]->GetMemorySize();
-        }
-
-        // Binds the renderer's buffer to make it active
-        glBindBuffer(GL_ARRAY_BUFFER, vboID);
-        // Clears VBO and specifies how the data in the arrays will be packed
-        glBufferData(GL_ARRAY_BUFFER, vboMemorySize, NULL, GL_DYNAMIC_DRAW);
-
-        // If memory size is zero, just return since there is nothing to update
-        if (vboMemorySize == 0) return;
-
-        // Gets pointer to VBO data to put our values into
-        vboData = (float*)glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
-
-        // Used for accessing VBO array's elements
-        unsigned int vboIndex = 0;
-        // Used for getting the start index for each renderable's ArrayIndices struct
-        unsigned int vertexNumber = 0;
-        // Clears the std::vector of its array indices and reserves needed amount of memory
-        arrayIndices.clear();
-        arrayIndices.reserve(renderables.size());
-
-        /* Processes all the renderables, adding data to the VBO and putting indices to that
-         * data into arrayIndices. */
-        for (unsigned int i = 0; (i < renderables.size()); i++)
-        {
-            if (renderables[i] != NULL)
-            {
-                ProcessRenderable(renderables[i], vboIndex, vertexNumber);
-            }
-        }
-
-        /* Unmap buffer to send new data to the graphics card. If it returns false, the VBO data
-         * must have got corruped, so throw an exception that is to be caught higher up the chain. */
-        if (!glUnmapBuffer(GL_ARRAY_BUFFER))
-        {
-            throw debug::Exception("SpriteRenderer::Update - VBO data got corrupted when changing data.");
-        }
-
-        logger->WriteTextAndNewLine(logID, "SpriteRenderer successfully updated.");
-    }
-
-    void SpriteRenderer::RenderObject(IRenderable* renderable, unsigned int& index)
-    {
-        try
-        {
-            // Just return if there is no gemoetry to draw
-            if (vboMemorySize <= 0) return;
-
-            // If renderable has its own matrix, use it
-            IMatrix* mat = dynamic_cast<IMatrix*>(renderable);
-            if (mat)
-            {
-                glPushMatrix();
-
-                float a[16];
-                mat->GetMatrixAsArray(a);
-
-                glMultMatrixf(a);
-            }
-
-            // If it is textured, make sure that its texture is bound
-            ISkinned* skinned = dynamic_cast<ISkinned*>(renderable);
-            if (skinned)
-            {
-                const std::string& skinID = skinned->GetSkinID();
-                if (renderDevice->GetCurrentSkinID() != skinID)
-                {
-                    renderDevice->SetActiveSkin(skinID);
-                }
-            }
-
-            // If the renderable has geometry, draw the arrays with the correct indexes
-            ISprite* sprite = dynamic_cast<ISprite*>(renderable);
-            if (sprite)
-            {
-                glDrawArrays(GL_QUADS, arrayIndices[index].start, arrayIndices[index].amount);
-            }
-
-            // If it's a group renderable, render all of its child objects
-            IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
-            if (group)
-            {
-                for (unsigned int i = 0; (i < group->GetAmountOfRenderables()); i++)
-                {
-                    if (group->GetRenderable(i) != NULL)
-                    {
-                        RenderObject(group->GetRenderable(i), index);
-                    }
-                }
-            }
-            // After rendering, restore previous matrix if needed
-            if (mat)
-            {
-                glPopMatrix();
-            }
-        }
-        catch (debug::Exception& ex)
-        {
-            ex.PrintMessage();
-        }
-        catch (std::exception& ex)
-        {
-            std::cout << ex.what() << std::endl;
-        }
-        catch (...)
-        {
-            std::cout
-                << "SpriteRenderer - Renderable " << (index + 1) << " failed to render for unknown reasons!"
-                << std::endl;
-        }
-
-
-        // Increases the index of the arrayIndices
-        index++;
-    }
-
-    void SpriteRenderer::Render()
-    {
-        // Bind the vertex buffer object
-        glBindBuffer(GL_ARRAY_BUFFER, vboID);
-
-        // Calculates offsets for array
-        unsigned int vertexOffset = 0, texCoordOffset = sizeof(vector2f);
-        // Points to the vertex arrays in the VBO
-        glVertexPointer(2, GL_FLOAT, sizeof(SpriteVertex), (GLvoid*)vertexOffset);
-        glTexCoordPointer(2, GL_FLOAT, sizeof(SpriteVertex), (GLvoid*)texCoordOffset);
-        // Enables vertex arrays
-        if (!glIsEnabled(GL_VERTEX_ARRAY)) glEnableClientState(GL_VERTEX_ARRAY);
-        if (!glIsEnabled(GL_TEXTURE_COORD_ARRAY)) glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-        // Used for accessing arrayIndices
-        unsigned int index = 0;
-        // Renders every object
-        for (unsigned int i = 0; (i < renderables.size()); i++)
-        {
-            if (renderables[i] != NULL)
-            {
-                RenderObject(renderables[i], index);
-            }
-        }
-
-        // Unbinds the buffer and returns to client mode
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-        logger->WriteTextAndNewLine(logID, "SpriteRenderer draws objects stored.");
-    }
-
-}
-
-}
+/*
+ * File:   SpriteRenderer.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on June 29, 2009, 7:05 PM
+ * Changed to only blend translucent sprites on October 19, 2026, 4:40 AM
+ */
+
+#include "SpriteRenderer.h"
+#include "Vertex.h"
+#include "Primitives.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+using namespace maths;
+
+namespace graphics
+{
+
+    SpriteRenderer::SpriteRenderer(RenderDevice* renderDevice, debug::Logger* log, const bool& willDeleteAll) :
+        ARenderer(log, "SpriteRenderer", willDeleteAll), // Calls superclass' constructor
+        vboID(0), vboData(NULL), blending(true), renderDevice(renderDevice), backend(renderDevice->GetBackend())
+    {
+        // Stores currently bound array buffer
+        unsigned int arrBuffer = backend->GetBoundBuffer(BUFFERTARGET_ARRAY);
+        // Generates this renderer's VBO
+        backend->GenerateBuffers(1, &vboID);
+        backend->BindBuffer(BUFFERTARGET_ARRAY, vboID);
+        backend->BufferData(BUFFERTARGET_ARRAY, 0, NULL);
+        // Restores the array buffer that was active BEFORE the creation of this renderer
+        backend->BindBuffer(BUFFERTARGET_ARRAY, arrBuffer);
+
+        logger->WriteTextAndNewLine(logID, "SpriteRenderer created.");
+    }
+
+    SpriteRenderer::~SpriteRenderer()
+    {
+        // Deletes VBO
+        backend->DeleteBuffers(1, &vboID);
+        logger->WriteTextAndNewLine(logID, "SpriteRenderer destroyed.");
+    }
+
+    void SpriteRenderer::ProcessRenderable(IRenderable* renderable, unsigned int& vboIndex, unsigned int& vertexNumber)
+    {
+        // Stores start and end of this renderable's vertices in the VBO array
+        general::ArrayIndices indices;
+        // Sets the start of the vertices
+        indices.start = vertexNumber;
+
+        unsigned int i; // Iterator for the loops
+        unsigned int amount = 0; // The amount of vertices this renderable has to draw
+
+        // If renderable holds geometry
+        ISprite* sprite = dynamic_cast<ISprite*>(renderable);
+        if (sprite)
+        {
+            // Gets the vertices from the renderable and fills the VBO with them
+            const std::vector<SpriteVertex>& vertexData = sprite->GetVertices();
+            for (i = 0; (i < vertexData.size()); i++)
+            {
+                // Stores vertex position and texture cooridnates
+                vboData[vboIndex++] = vertexData[i].position.x;
+                vboData[vboIndex++] = vertexData[i].position.y;
+                vboData[vboIndex++] = vertexData[i].texCoord.x;
+                vboData[vboIndex++] = vertexData[i].texCoord.y;
+                // Increases the amount of vertices, so it draws this vertex too
+                amount++;
+                // Also increases the total vertex number
+                vertexNumber++;
+            }
+        }
+        /* Sets amount of vertices for indices and pushes the indices into the vector. This is
+         * done before the group's renderables are processed, since rendering and recording
+         * go through a group before its renderables too. */
+        indices.amount = amount;
+        arrayIndices.push_back(indices);
+
+        // Processes all the group's renderables too
+        IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
+        if (group)
+        {
+            for (i = 0; (i < group->GetAmountOfRenderables()); i++)
+            {
+                if (group->GetRenderable(i) != NULL)
+                {
+                    ProcessRenderable(group->GetRenderable(i), vboIndex, vertexNumber);
+                }
+            }
+        }
+    }
+
+    void SpriteRenderer::Update()
+    {
+        // Gets the size the updated buffer will need to be
+        vboMemorySize = 0; // Resets memory size to 0
+        // Iterates through all renderables, adding their memory size to the total
+        for (unsigned int i = 0; (i < renderables.size()); i++)
+        {
+            vboMemorySize += renderables[i]->GetMemorySize();
+        }
+
+        // Binds the renderer's buffer to make it active
+        backend->BindBuffer(BUFFERTARGET_ARRAY, vboID);
+        // Clears VBO and specifies how the data in the arrays will be packed
+        backend->BufferData(BUFFERTARGET_ARRAY, vboMemorySize, NULL);
+
+        // If memory size is zero, just return since there is nothing to update
+        if (vboMemorySize == 0) return;
+
+        // Gets pointer to VBO data to put our values into
+        vboData = (float*)backend->MapBuffer(BUFFERTARGET_ARRAY);
+
+        // Used for accessing VBO array's elements
+        unsigned int vboIndex = 0;
+        // Used for getting the start index for each renderable's ArrayIndices struct
+        unsigned int vertexNumber = 0;
+        // Clears the std::vector of its array indices and reserves needed amount of memory
+        arrayIndices.clear();
+        arrayIndices.reserve(renderables.size());
+        renderableIndices.clear();
+        renderableIndices.reserve(renderables.size());
+
+        /* Processes all the renderables, adding data to the VBO and putting indices to that
+         * data into arrayIndices. */
+        for (unsigned int i = 0; (i < renderables.size()); i++)
+        {
+            // Remembers where this renderable's indices start
+            renderableIndices.push_back(arrayIndices.size());
+
+            if (renderables[i] != NULL)
+            {
+                ProcessRenderable(renderables[i], vboIndex, vertexNumber);
+            }
+        }
+
+        /* Unmap buffer to send new data to the graphics card. If it returns false, the VBO data
+         * must have got corruped, so throw an exception that is to be caught higher up the chain. */
+        if (!backend->UnmapBuffer(BUFFERTARGET_ARRAY))
+        {
+            throw debug::Exception("SpriteRenderer::Update - VBO data got corrupted when changing data.");
+        }
+
+        logger->WriteTextAndNewLine(logID, "SpriteRenderer successfully updated.");
+    }
+
+    void SpriteRenderer::SetBlending(SkinHandle skin)
+    {
+        // A skin that can't be found has already had an error printed, so it's just treated as opaque here
+        bool translucent = false;
+        if (skin != invalidHandle)
+        {
+            try { translucent = renderDevice->GetSkinManager()->IsSkinTranslucent(skin); }
+            catch (debug::Exception&) { }
+        }
+
+        if (translucent == blending) return;
+        if (translucent) backend->Enable(CAPABILITY_BLEND);
+        else backend->Disable(CAPABILITY_BLEND);
+        blending = translucent;
+    }
+
+    void SpriteRenderer::RenderObject(IRenderable* renderable, unsigned int& index)
+    {
+        /* Takes this object's slot in arrayIndices before its children take theirs, the same
+         * order ProcessRenderable() fills them in. */
+        unsigned int objectIndex = index++;
+
+        try
+        {
+            // Just return if there is no gemoetry to draw
+            if (vboMemorySize <= 0) return;
+
+            // If renderable has its own matrix, use it
+            IMatrix* mat = dynamic_cast<IMatrix*>(renderable);
+            if (mat)
+            {
+                backend->PushMatrix();
+
+                float a[16];
+                mat->GetMatrixAsArray(a);
+
+                backend->MultiplyMatrix(a);
+            }
+
+            // If it is textured, make sure that its texture is bound
+            ISkinned* skinned = dynamic_cast<ISkinned*>(renderable);
+            if (skinned)
+            {
+                SkinHandle skin = skinned->GetSkinHandle();
+                if (renderDevice->GetCurrentSkin() != skin)
+                {
+                    renderDevice->SetActiveSkin(skin);
+                }
+            }
+
+            // If the renderable has geometry, draw the arrays with the correct indexes
+            ISprite* sprite = dynamic_cast<ISprite*>(renderable);
+            if (sprite)
+            {
+                SetBlending(renderDevice->GetCurrentSkin());
+                backend->DrawArrays(PRIMITIVETYPE_QUAD, arrayIndices[objectIndex].start, arrayIndices[objectIndex].amount);
+            }
+
+            // If it's a group renderable, render all of its child objects
+            IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
+            if (group)
+            {
+                for (unsigned int i = 0; (i < group->GetAmountOfRenderables()); i++)
+                {
+                    if (group->GetRenderable(i) != NULL)
+                    {
+                        RenderObject(group->GetRenderable(i), index);
+                    }
+                }
+            }
+            // After rendering, restore previous matrix if needed
+            if (mat)
+            {
+                backend->PopMatrix();
+            }
+        }
+        catch (debug::Exception& ex)
+        {
+            ex.PrintMessage();
+        }
+        catch (std::exception& ex)
+        {
+            std::cout << ex.what() << std::endl;
+        }
+        catch (...)
+        {
+            std::cout
+                << "SpriteRenderer - Renderable " << (objectIndex + 1) << " failed to render for unknown reasons!"
+                << std::endl;
+        }
+    }
+
+    void SpriteRenderer::Render()
+    {
+        // Bind the vertex buffer object
+        backend->BindBuffer(BUFFERTARGET_ARRAY, vboID);
+
+        // Calculates offsets for array
+        unsigned int vertexOffset = 0, texCoordOffset = sizeof(vector2f);
+        // Points to the vertex arrays in the VBO
+        backend->SetVertexPointer(2, sizeof(SpriteVertex), (void*)vertexOffset);
+        backend->SetTexCoordPointer(2, sizeof(SpriteVertex), (void*)texCoordOffset);
+        // Enables vertex arrays
+        if (!backend->IsClientArrayEnabled(CLIENTARRAY_VERTEX)) backend->EnableClientArray(CLIENTARRAY_VERTEX);
+        if (!backend->IsClientArrayEnabled(CLIENTARRAY_TEXCOORD)) backend->EnableClientArray(CLIENTARRAY_TEXCOORD);
+        /* Sprites are drawn in the order they're stored, since that's the order they're layered
+         * in, but blending is only turned on while translucent ones are drawn. It's left how
+         * it was found afterwards. */
+        blending = backend->IsEnabled(CAPABILITY_BLEND);
+        bool wasBlending = blending;
+        // Used for accessing arrayIndices
+        unsigned int index = 0;
+        // Renders every object
+        for (unsigned int i = 0; (i < renderables.size()); i++)
+        {
+            if (renderables[i] != NULL)
+            {
+                RenderObject(renderables[i], index);
+            }
+        }
+        if (blending != wasBlending)
+        {
+            if (wasBlending) backend->Enable(CAPABILITY_BLEND);
+            else backend->Disable(CAPABILITY_BLEND);
+        }
+
+        // Unbinds the buffer and returns to client mode
+        backend->BindBuffer(BUFFERTARGET_ARRAY, 0);
+
+        logger->WriteTextAndNewLine(logID, "SpriteRenderer draws objects stored.");
+    }
+
+    void SpriteRenderer::RecordObject(IRenderable* renderable, CommandBuffer& buffer, unsigned int& index)
+    {
+        // Takes its slot before its children, like RenderObject()
+        unsigned int objectIndex = index++;
+
+        try
+        {
+            // If renderable has its own matrix, use it
+            IMatrix* mat = dynamic_cast<IMatrix*>(renderable);
+            if (mat)
+            {
+                float a[16];
+                mat->GetMatrixAsArray(a);
+                buffer.PushMatrix(a);
+            }
+
+            // If it is textured, make sure that its texture is bound
+            ISkinned* skinned = dynamic_cast<ISkinned*>(renderable);
+            if (skinned)
+            {
+                buffer.SetSkin(skinned->GetSkinHandle());
+            }
+
+            // If the renderable has geometry, draw the arrays with the correct indexes
+            ISprite* sprite = dynamic_cast<ISprite*>(renderable);
+            if (sprite)
+            {
+                buffer.DrawArrays(PRIMITIVETYPE_QUAD, arrayIndices[objectIndex].start, arrayIndices[objectIndex].amount);
+            }
+
+            // If it's a group renderable, record all of its child objects
+            IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
+            if (group)
+            {
+                for (unsigned int i = 0; (i < group->GetAmountOfRenderables()); i++)
+                {
+                    if (group->GetRenderable(i) != NULL)
+                    {
+                        RecordObject(group->GetRenderable(i), buffer, index);
+                    }
+                }
+            }
+            // After rendering, restore previous matrix if needed
+            if (mat)
+            {
+                buffer.PopMatrix();
+            }
+        }
+        catch (debug::Exception& ex)
+        {
+            ex.PrintMessage();
+        }
+        catch (std::exception& ex)
+        {
+            std::cout << ex.what() << std::endl;
+        }
+        catch (...)
+        {
+            std::cout
+                << "SpriteRenderer - Renderable " << (objectIndex + 1) << " failed to record for unknown reasons!"
+                << std::endl;
+        }
+    }
+
+    void SpriteRenderer::RecordCommands(CommandBuffer& buffer, unsigned int first, unsigned int last)
+    {
+        // Just return if there is no geometry to draw
+        if (vboMemorySize <= 0) return;
+
+        // Makes sure the range is inside the renderables that were processed in Update()
+        if (last > renderableIndices.size()) last = renderableIndices.size();
+        if (first >= last) return;
+
+        buffer.BindGeometry(vboID, 0, VERTEXLAYOUT_SPRITEVERTEX);
+
+        unsigned int index = renderableIndices[first];
+        for (unsigned int i = first; (i < last); i++)
+        {
+            if (renderables[i] != NULL)
+            {
+                RecordObject(renderables[i], buffer, index);
+            }
+        }
+    }
+
+}
+
+}
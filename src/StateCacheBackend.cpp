@@ -0,0 +1,681 @@
+/*
+ * File:   StateCacheBackend.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 5:50 PM
+ * Added SetDepthWrite() on October 19, 2026, 4:55 AM
+ */
+
+#include "StateCacheBackend.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace graphics
+{
+
+    StateCacheBackend::StateCacheBackend(IRenderBackend* targetBackend) :
+        target(targetBackend), redundantCallsAvoided(0), compilingList(false),
+        maxLights(0), maxLightsKnown(false)
+    {
+        if (!target)
+        {
+            throw debug::NullPointerException("StateCacheBackend - Given a null target backend!");
+        }
+
+        // Nothing is known about the state the context is in yet
+        Invalidate();
+    }
+
+
+    void StateCacheBackend::Invalidate()
+    {
+        InvalidateListableState();
+
+        // Buffers, client arrays and framebuffers can't be changed by display lists, so they're forgotten here
+        for (unsigned int i = 0; (i < amountOfClientArrays); i++) clientArrays[i] = SWITCH_UNKNOWN;
+        for (unsigned int i = 0; (i < amountOfBufferTargets); i++) boundBuffersKnown[i] = false;
+        boundFramebufferKnown = false;
+    }
+
+    void StateCacheBackend::InvalidateListableState()
+    {
+        for (unsigned int i = 0; (i < amountOfCapabilities); i++) capabilities[i] = SWITCH_UNKNOWN;
+        for (unsigned int i = 0; (i < amountOfLights); i++) lights[i] = SWITCH_UNKNOWN;
+
+        blendModeKnown = depthWriteKnown = clearColourKnown = viewportKnown = colourKnown = matrixModeKnown = false;
+        boundTextureKnown = currentProgramKnown = false;
+    }
+
+
+    bool StateCacheBackend::SkipCall(bool unchanged)
+    {
+        if (unchanged) redundantCallsAvoided++;
+        return unchanged;
+    }
+
+    bool StateCacheBackend::SkipListableCall(bool unchanged)
+    {
+        // The call has to end up in the list, even if it wouldn't change anything right now
+        if (compilingList) return false;
+        return SkipCall(unchanged);
+    }
+
+
+
+    void StateCacheBackend::Enable(RenderCapability capability)
+    {
+        if (SkipListableCall(capabilities[capability] == SWITCH_ON)) return;
+
+        target->Enable(capability);
+        if (!compilingList) capabilities[capability] = SWITCH_ON;
+    }
+
+    void StateCacheBackend::Disable(RenderCapability capability)
+    {
+        if (SkipListableCall(capabilities[capability] == SWITCH_OFF)) return;
+
+        target->Disable(capability);
+        if (!compilingList) capabilities[capability] = SWITCH_OFF;
+    }
+
+    bool StateCacheBackend::IsEnabled(RenderCapability capability)
+    {
+        // Only asks the target if the capability hasn't been set or asked for since it was forgotten
+        if (capabilities[capability] == SWITCH_UNKNOWN)
+        {
+            capabilities[capability] = (target->IsEnabled(capability)) ? SWITCH_ON : SWITCH_OFF;
+        }
+        return (capabilities[capability] == SWITCH_ON);
+    }
+
+    void StateCacheBackend::SetBlendMode(BlendMode mode)
+    {
+        if (SkipListableCall(blendModeKnown && blendMode == mode)) return;
+
+        target->SetBlendMode(mode);
+        if (!compilingList)
+        {
+            blendMode = mode;
+            blendModeKnown = true;
+        }
+    }
+
+    void StateCacheBackend::SetDepthWrite(bool enabled)
+    {
+        if (SkipListableCall(depthWriteKnown && depthWrite == enabled)) return;
+
+        target->SetDepthWrite(enabled);
+        if (!compilingList)
+        {
+            depthWrite = enabled;
+            depthWriteKnown = true;
+        }
+    }
+
+
+    void StateCacheBackend::SetClearColour(const colourf& newColour)
+    {
+        if (SkipListableCall(clearColourKnown && clearColour == newColour)) return;
+
+        target->SetClearColour(newColour);
+        if (!compilingList)
+        {
+            clearColour = newColour;
+            clearColourKnown = true;
+        }
+    }
+
+    void StateCacheBackend::Clear(unsigned int flags)
+    {
+        target->Clear(flags);
+    }
+
+    void StateCacheBackend::SetViewport(int x, int y, int width, int height)
+    {
+        if (SkipListableCall(viewportKnown && viewport[0] == x && viewport[1] == y &&
+            viewport[2] == width && viewport[3] == height)) return;
+
+        target->SetViewport(x, y, width, height);
+        if (!compilingList)
+        {
+            viewport[0] = x;
+            viewport[1] = y;
+            viewport[2] = width;
+            viewport[3] = height;
+            viewportKnown = true;
+        }
+    }
+
+
+    void StateCacheBackend::SetColour(const colourf& newColour)
+    {
+        if (SkipListableCall(colourKnown && colour == newColour)) return;
+
+        target->SetColour(newColour);
+        if (!compilingList)
+        {
+            colour = newColour;
+            colourKnown = true;
+        }
+    }
+
+    void StateCacheBackend::SetMaterialColour(MaterialColour property, const colourf& newColour)
+    {
+        target->SetMaterialColour(property, newColour);
+    }
+
+    void StateCacheBackend::SetMaterialShininess(float shininess)
+    {
+        target->SetMaterialShininess(shininess);
+    }
+
+
+    unsigned int StateCacheBackend::GetMaxLights()
+    {
+        if (!maxLightsKnown)
+        {
+            maxLights = target->GetMaxLights();
+            maxLightsKnown = true;
+        }
+        return maxLights;
+    }
+
+    void StateCacheBackend::EnableLight(unsigned int light)
+    {
+        // Lights above the ones shadowed are always passed on
+        if (light >= amountOfLights)
+        {
+            target->EnableLight(light);
+            return;
+        }
+        if (SkipListableCall(lights[light] == SWITCH_ON)) return;
+
+        target->EnableLight(light);
+        if (!compilingList) lights[light] = SWITCH_ON;
+    }
+
+    void StateCacheBackend::DisableLight(unsigned int light)
+    {
+        if (light >= amountOfLights)
+        {
+            target->DisableLight(light);
+            return;
+        }
+        if (SkipListableCall(lights[light] == SWITCH_OFF)) return;
+
+        target->DisableLight(light);
+        if (!compilingList) lights[light] = SWITCH_OFF;
+    }
+
+    void StateCacheBackend::SetLightVector(unsigned int light, LightParameter parameter, const float* values)
+    {
+        target->SetLightVector(light, parameter, values);
+    }
+
+    void StateCacheBackend::SetLightValue(unsigned int light, LightParameter parameter, float value)
+    {
+        target->SetLightValue(light, parameter, value);
+    }
+
+    void StateCacheBackend::SetLightModel(const colourf& globalAmbient, bool localViewer, bool twoSided)
+    {
+        target->SetLightModel(globalAmbient, localViewer, twoSided);
+    }
+
+
+    void StateCacheBackend::SetMatrixMode(MatrixStack stack)
+    {
+        if (SkipListableCall(matrixModeKnown && matrixMode == stack)) return;
+
+        target->SetMatrixMode(stack);
+        if (!compilingList)
+        {
+            matrixMode = stack;
+            matrixModeKnown = true;
+        }
+    }
+
+    void StateCacheBackend::LoadMatrix(const float* matrix)
+    {
+        target->LoadMatrix(matrix);
+    }
+
+    void StateCacheBackend::MultiplyMatrix(const float* matrix)
+    {
+        target->MultiplyMatrix(matrix);
+    }
+
+    void StateCacheBackend::PushMatrix()
+    {
+        target->PushMatrix();
+    }
+
+    void StateCacheBackend::PopMatrix()
+    {
+        target->PopMatrix();
+    }
+
+    void StateCacheBackend::Translate(float x, float y, float z)
+    {
+        target->Translate(x, y, z);
+    }
+
+    void StateCacheBackend::Rotate(float angle, float x, float y, float z)
+    {
+        target->Rotate(angle, x, y, z);
+    }
+
+
+    void StateCacheBackend::GenerateBuffers(unsigned int amount, unsigned int* ids)
+    {
+        target->GenerateBuffers(amount, ids);
+    }
+
+    void StateCacheBackend::DeleteBuffers(unsigned int amount, const unsigned int* ids)
+    {
+        target->DeleteBuffers(amount, ids);
+
+        // Deleting a bound buffer unbinds it
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            for (unsigned int j = 0; (j < amountOfBufferTargets); j++)
+            {
+                if (boundBuffersKnown[j] && boundBuffers[j] == ids[i]) boundBuffers[j] = 0;
+            }
+        }
+    }
+
+    void StateCacheBackend::BindBuffer(BufferTarget bufferTarget, unsigned int id)
+    {
+        if (SkipCall(boundBuffersKnown[bufferTarget] && boundBuffers[bufferTarget] == id)) return;
+
+        target->BindBuffer(bufferTarget, id);
+        boundBuffers[bufferTarget] = id;
+        boundBuffersKnown[bufferTarget] = true;
+    }
+
+    unsigned int StateCacheBackend::GetBoundBuffer(BufferTarget bufferTarget)
+    {
+        if (!boundBuffersKnown[bufferTarget])
+        {
+            boundBuffers[bufferTarget] = target->GetBoundBuffer(bufferTarget);
+            boundBuffersKnown[bufferTarget] = true;
+        }
+        return boundBuffers[bufferTarget];
+    }
+
+    void StateCacheBackend::BufferData(BufferTarget bufferTarget, unsigned int size, const void* data)
+    {
+        target->BufferData(bufferTarget, size, data);
+    }
+
+    void* StateCacheBackend::MapBuffer(BufferTarget bufferTarget)
+    {
+        return target->MapBuffer(bufferTarget);
+    }
+
+    bool StateCacheBackend::UnmapBuffer(BufferTarget bufferTarget)
+    {
+        return target->UnmapBuffer(bufferTarget);
+    }
+
+
+    void StateCacheBackend::EnableClientArray(ClientArray clientArray)
+    {
+        if (SkipCall(clientArrays[clientArray] == SWITCH_ON)) return;
+
+        target->EnableClientArray(clientArray);
+        clientArrays[clientArray] = SWITCH_ON;
+    }
+
+    void StateCacheBackend::DisableClientArray(ClientArray clientArray)
+    {
+        if (SkipCall(clientArrays[clientArray] == SWITCH_OFF)) return;
+
+        target->DisableClientArray(clientArray);
+        clientArrays[clientArray] = SWITCH_OFF;
+    }
+
+    bool StateCacheBackend::IsClientArrayEnabled(ClientArray clientArray)
+    {
+        if (clientArrays[clientArray] == SWITCH_UNKNOWN)
+        {
+            clientArrays[clientArray] = (target->IsClientArrayEnabled(clientArray)) ? SWITCH_ON : SWITCH_OFF;
+        }
+        return (clientArrays[clientArray] == SWITCH_ON);
+    }
+
+    /* Pointers aren't shadowed, since the same pointer means something different
+     * depending on the buffer that's bound. */
+    void StateCacheBackend::SetVertexPointer(unsigned int components, unsigned int stride, const void* pointer)
+    {
+        target->SetVertexPointer(components, stride, pointer);
+    }
+
+    void StateCacheBackend::SetTexCoordPointer(unsigned int components, unsigned int stride, const void* pointer)
+    {
+        target->SetTexCoordPointer(components, stride, pointer);
+    }
+
+    void StateCacheBackend::SetNormalPointer(unsigned int stride, const void* pointer)
+    {
+        target->SetNormalPointer(stride, pointer);
+    }
+
+    void StateCacheBackend::SetColourPointer(unsigned int components, unsigned int stride, const void* pointer)
+    {
+        target->SetColourPointer(components, stride, pointer);
+    }
+
+    void StateCacheBackend::EnableAttributeArray(unsigned int location)
+    {
+        target->EnableAttributeArray(location);
+    }
+
+    void StateCacheBackend::DisableAttributeArray(unsigned int location)
+    {
+        target->DisableAttributeArray(location);
+    }
+
+    void StateCacheBackend::SetAttributePointer(unsigned int location, unsigned int components,
+        unsigned int stride, const void* pointer)
+    {
+        target->SetAttributePointer(location, components, stride, pointer);
+    }
+
+
+    void StateCacheBackend::DrawArrays(PrimitiveType type, unsigned int start, unsigned int amount)
+    {
+        target->DrawArrays(type, start, amount);
+        // Drawing with colours from an array leaves the current colour undefined
+        if (!compilingList && clientArrays[CLIENTARRAY_COLOUR] != SWITCH_OFF) colourKnown = false;
+    }
+
+    void StateCacheBackend::DrawElements(PrimitiveType type, unsigned int start, unsigned int amount)
+    {
+        target->DrawElements(type, start, amount);
+        if (!compilingList && clientArrays[CLIENTARRAY_COLOUR] != SWITCH_OFF) colourKnown = false;
+    }
+
+
+    void StateCacheBackend::GenerateTextures(unsigned int amount, unsigned int* ids)
+    {
+        target->GenerateTextures(amount, ids);
+    }
+
+    void StateCacheBackend::DeleteTextures(unsigned int amount, const unsigned int* ids)
+    {
+        target->DeleteTextures(amount, ids);
+
+        // Deleting the bound texture binds texture 0 instead
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            if (boundTextureKnown && boundTexture == ids[i]) boundTexture = 0;
+        }
+    }
+
+    bool StateCacheBackend::IsTexture(unsigned int id)
+    {
+        return target->IsTexture(id);
+    }
+
+    void StateCacheBackend::BindTexture(unsigned int id)
+    {
+        if (SkipListableCall(boundTextureKnown && boundTexture == id)) return;
+
+        target->BindTexture(id);
+        if (!compilingList)
+        {
+            boundTexture = id;
+            boundTextureKnown = true;
+        }
+    }
+
+    void StateCacheBackend::SetTextureFilter(TextureFilter filter, bool magnification)
+    {
+        target->SetTextureFilter(filter, magnification);
+    }
+
+    void StateCacheBackend::SetTextureWrapping(TextureWrapping wrapping, unsigned int coordinate)
+    {
+        target->SetTextureWrapping(wrapping, coordinate);
+    }
+
+    void StateCacheBackend::UploadTexture(unsigned int level, unsigned int width, unsigned int height,
+        PixelFormat format, const void* pixels)
+    {
+        target->UploadTexture(level, width, height, format, pixels);
+    }
+
+
+    unsigned int StateCacheBackend::GenerateLists(unsigned int amount)
+    {
+        return target->GenerateLists(amount);
+    }
+
+    void StateCacheBackend::DeleteLists(unsigned int first, unsigned int amount)
+    {
+        target->DeleteLists(first, amount);
+    }
+
+    void StateCacheBackend::BeginList(unsigned int id)
+    {
+        target->BeginList(id);
+        compilingList = true;
+    }
+
+    void StateCacheBackend::EndList()
+    {
+        target->EndList();
+        compilingList = false;
+    }
+
+    void StateCacheBackend::SetListBase(unsigned int base)
+    {
+        target->SetListBase(base);
+    }
+
+    void StateCacheBackend::CallLists(unsigned int amount, const unsigned char* lists)
+    {
+        target->CallLists(amount, lists);
+        // There's no way of knowing what the lists changed
+        InvalidateListableState();
+    }
+
+
+    void StateCacheBackend::UseProgram(unsigned int handle)
+    {
+        if (SkipListableCall(currentProgramKnown && currentProgram == handle)) return;
+
+        target->UseProgram(handle);
+        if (!compilingList)
+        {
+            currentProgram = handle;
+            currentProgramKnown = true;
+        }
+    }
+
+
+    bool StateCacheBackend::SupportsTextureBuffers()
+    {
+        return target->SupportsTextureBuffers();
+    }
+
+    /* Only the buffer texture binding of the given unit changes, which isn't shadowed. */
+    void StateCacheBackend::BindTextureBuffer(unsigned int unit, unsigned int texture, unsigned int buffer)
+    {
+        target->BindTextureBuffer(unit, texture, buffer);
+    }
+
+
+    bool StateCacheBackend::SupportsArrayTextures()
+    {
+        return target->SupportsArrayTextures();
+    }
+
+    /* Array texture bindings aren't shadowed either, they change far less often than the 2D texture. */
+    void StateCacheBackend::BindArrayTexture(unsigned int unit, unsigned int texture)
+    {
+        target->BindArrayTexture(unit, texture);
+    }
+
+    void StateCacheBackend::AllocateArrayTexture(unsigned int width, unsigned int height, unsigned int layers,
+        const TextureParameters& params)
+    {
+        target->AllocateArrayTexture(width, height, layers, params);
+    }
+
+    void StateCacheBackend::UploadArrayTextureLayer(unsigned int layer, unsigned int width, unsigned int height,
+        PixelFormat format, const void* pixels)
+    {
+        target->UploadArrayTextureLayer(layer, width, height, format, pixels);
+    }
+
+
+    void StateCacheBackend::BindUnitTexture(unsigned int unit, unsigned int texture)
+    {
+        // Only unit 0's state is shadowed, so these always go through
+        target->BindUnitTexture(unit, texture);
+    }
+
+    void StateCacheBackend::SetUnitTexCoordPointer(unsigned int unit, unsigned int components, unsigned int stride,
+        const void* pointer)
+    {
+        target->SetUnitTexCoordPointer(unit, components, stride, pointer);
+    }
+
+    void StateCacheBackend::DisableUnitTexCoordArray(unsigned int unit)
+    {
+        target->DisableUnitTexCoordArray(unit);
+    }
+
+
+    bool StateCacheBackend::SupportsRenderTargets()
+    {
+        return target->SupportsRenderTargets();
+    }
+
+    void StateCacheBackend::GenerateFramebuffers(unsigned int amount, unsigned int* ids)
+    {
+        target->GenerateFramebuffers(amount, ids);
+    }
+
+    void StateCacheBackend::DeleteFramebuffers(unsigned int amount, const unsigned int* ids)
+    {
+        target->DeleteFramebuffers(amount, ids);
+
+        // Deleting the bound framebuffer binds the window
+        for (unsigned int i = 0; (i < amount); i++)
+        {
+            if (boundFramebufferKnown && boundFramebuffer == ids[i]) boundFramebuffer = 0;
+        }
+    }
+
+    void StateCacheBackend::BindFramebuffer(unsigned int id)
+    {
+        if (SkipCall(boundFramebufferKnown && boundFramebuffer == id)) return;
+
+        target->BindFramebuffer(id);
+        boundFramebuffer = id;
+        boundFramebufferKnown = true;
+    }
+
+    void StateCacheBackend::GenerateRenderbuffers(unsigned int amount, unsigned int* ids)
+    {
+        target->GenerateRenderbuffers(amount, ids);
+    }
+
+    void StateCacheBackend::DeleteRenderbuffers(unsigned int amount, const unsigned int* ids)
+    {
+        target->DeleteRenderbuffers(amount, ids);
+    }
+
+    void StateCacheBackend::AllocateDepthRenderbuffer(unsigned int id, unsigned int width, unsigned int height)
+    {
+        target->AllocateDepthRenderbuffer(id, width, height);
+    }
+
+    bool StateCacheBackend::AttachToFramebuffer(unsigned int colourTexture, unsigned int depthRenderbuffer)
+    {
+        return target->AttachToFramebuffer(colourTexture, depthRenderbuffer);
+    }
+
+    void StateCacheBackend::BlitFramebuffer(unsigned int source, unsigned int sourceWidth, unsigned int sourceHeight,
+        unsigned int destination, unsigned int destinationWidth, unsigned int destinationHeight)
+    {
+        target->BlitFramebuffer(source, sourceWidth, sourceHeight, destination, destinationWidth, destinationHeight);
+        boundFramebuffer = destination;
+        boundFramebufferKnown = true;
+    }
+
+
+    bool StateCacheBackend::SupportsTimerQueries()
+    {
+        return target->SupportsTimerQueries();
+    }
+
+    void StateCacheBackend::GenerateQueries(unsigned int amount, unsigned int* ids)
+    {
+        target->GenerateQueries(amount, ids);
+    }
+
+    void StateCacheBackend::DeleteQueries(unsigned int amount, const unsigned int* ids)
+    {
+        target->DeleteQueries(amount, ids);
+    }
+
+    void StateCacheBackend::BeginTimerQuery(unsigned int id)
+    {
+        target->BeginTimerQuery(id);
+    }
+
+    void StateCacheBackend::EndTimerQuery()
+    {
+        target->EndTimerQuery();
+    }
+
+    bool StateCacheBackend::GetTimerQueryResult(unsigned int id, float& milliseconds)
+    {
+        return target->GetTimerQueryResult(id, milliseconds);
+    }
+
+
+    bool StateCacheBackend::SupportsShadowMaps()
+    {
+        return target->SupportsShadowMaps();
+    }
+
+    void StateCacheBackend::AllocateDepthTexture(unsigned int width, unsigned int height)
+    {
+        target->AllocateDepthTexture(width, height);
+    }
+
+    bool StateCacheBackend::AttachDepthTextureToFramebuffer(unsigned int depthTexture)
+    {
+        return target->AttachDepthTextureToFramebuffer(depthTexture);
+    }
+
+    void StateCacheBackend::BlitFramebufferDepth(unsigned int source, unsigned int destination, unsigned int width,
+        unsigned int height)
+    {
+        target->BlitFramebufferDepth(source, destination, width, height);
+        boundFramebuffer = destination;
+        boundFramebufferKnown = true;
+    }
+
+    void StateCacheBackend::BindDepthTexture(unsigned int unit, unsigned int texture)
+    {
+        // Only unit 0's state is shadowed, so these always go through
+        target->BindDepthTexture(unit, texture);
+    }
+
+    void StateCacheBackend::SetPolygonOffset(float factor, float units)
+    {
+        target->SetPolygonOffset(factor, units);
+    }
+
+}
+
+}
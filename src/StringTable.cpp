@@ -0,0 +1,51 @@
+/*
+ * File:   StringTable.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 6:45 PM
+ */
+
+#include "StringTable.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace general
+{
+
+    unsigned int StringTable::Intern(const std::string& str)
+    {
+        // If the string has already been interned, just give back its integer
+        IndexTable::iterator it = indices.find(str);
+        if (it != indices.end()) return it->second;
+
+        // Otherwise, it gets the next integer. Keys in a map never move, so pointing at them is safe
+        unsigned int index = strings.size();
+        it = indices.insert(std::make_pair(str, index)).first;
+        strings.push_back(&it->first);
+        return index;
+    }
+
+    unsigned int StringTable::Find(const std::string& str) const
+    {
+        IndexTable::const_iterator it = indices.find(str);
+
+        if (it != indices.end()) return it->second;
+        else return notFound;
+    }
+
+
+    const std::string& StringTable::GetString(unsigned int index) const
+    {
+        if (index >= strings.size())
+        {
+            throw debug::InvalidArgumentException("StringTable::GetString - No string has the given index.");
+        }
+
+        return *strings[index];
+    }
+
+}
+
+}
@@ -0,0 +1,178 @@
+/*
+ * File:   ThreadPool.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 18, 2026, 10:20 AM
+ */
+
+#include <iostream>
+#include "ThreadPool.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+namespace general
+{
+
+    ThreadPool::ThreadPool(unsigned int numWorkers) :
+        currentTask(NULL), taskAmount(0), nextIndex(0), failed(0), quit(0)
+    {
+        // If no amount was given, use one worker per processor (minus the dispatching thread)
+        if (numWorkers == 0)
+        {
+            SYSTEM_INFO systemInfo;
+            GetSystemInfo(&systemInfo);
+            numWorkers = (systemInfo.dwNumberOfProcessors > 1) ? (systemInfo.dwNumberOfProcessors - 1) : 0;
+        }
+        // WaitForMultipleObjects() can only wait on a limited amount of events at once
+        if (numWorkers > MAXIMUM_WAIT_OBJECTS) numWorkers = MAXIMUM_WAIT_OBJECTS;
+
+        /* Reserves memory for every worker first, since the threads are given a pointer
+         * to their worker and it must NOT move when the vector grows. */
+        workers.resize(numWorkers);
+        finishEvents.resize(numWorkers);
+
+        for (unsigned int i = 0; (i < numWorkers); i++)
+        {
+            Worker& worker = workers[i];
+            worker.pool = this;
+            worker.threadIndex = (i + 1); // Index 0 belongs to the dispatching thread
+            // Both events auto-reset, so every signal wakes up its waiter exactly once
+            worker.startEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+            worker.finishEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+            finishEvents[i] = worker.finishEvent;
+
+            worker.thread = CreateThread(NULL, 0, WorkerMain, &worker, 0, NULL);
+            if (worker.thread == NULL)
+            {
+                throw debug::Exception("ThreadPool::ThreadPool - Could not create worker thread.");
+            }
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        // Tells every worker to exit and wakes them up so they see the flag
+        InterlockedExchange(&quit, 1);
+        for (unsigned int i = 0; (i < workers.size()); i++)
+        {
+            SetEvent(workers[i].startEvent);
+        }
+        // Waits for every thread to finish before releasing the handles
+        for (unsigned int i = 0; (i < workers.size()); i++)
+        {
+            WaitForSingleObject(workers[i].thread, INFINITE);
+            CloseHandle(workers[i].thread);
+            CloseHandle(workers[i].startEvent);
+            CloseHandle(workers[i].finishEvent);
+        }
+    }
+
+
+    DWORD WINAPI ThreadPool::WorkerMain(void* parameter)
+    {
+        Worker* worker = static_cast<Worker*>(parameter);
+        ThreadPool* pool = worker->pool;
+
+        while (true)
+        {
+            // Sleeps until there is work to do or the pool is being destroyed
+            WaitForSingleObject(worker->startEvent, INFINITE);
+            if (pool->quit) break;
+
+            pool->ExecuteTask(worker->threadIndex);
+
+            // Tells the dispatching thread that this worker has finished its share
+            SetEvent(worker->finishEvent);
+        }
+
+        return 0;
+    }
+
+
+    void ThreadPool::ExecuteTask(unsigned int threadIndex)
+    {
+        while (true)
+        {
+            // Atomically grabs the next index, stopping when there is none left
+            LONG index = InterlockedIncrement(&nextIndex) - 1;
+            if (index >= taskAmount) break;
+
+            try
+            {
+                currentTask->Execute(static_cast<unsigned int>(index), threadIndex);
+            }
+            // Exceptions cannot leave a worker thread, so they're passed back to Dispatch()
+            catch (debug::Exception& ex)
+            {
+                Fail(ex.Message());
+            }
+            catch (...)
+            {
+                Fail("ThreadPool - Task failed for unknown reasons!");
+            }
+        }
+    }
+
+    void ThreadPool::Fail(const std::string& message)
+    {
+        // Only the first failure is thrown, the others can only be printed
+        if (InterlockedCompareExchange(&failed, 1, 0) == 0)
+        {
+            failMessage = message;
+        }
+        else
+        {
+            std::cout << message << std::endl;
+        }
+        // The rest of the task's indices are skipped, since the task's failed anyway
+        InterlockedExchange(&nextIndex, taskAmount);
+    }
+
+
+    void ThreadPool::Dispatch(ITask* task, unsigned int amount)
+    {
+        if (task == NULL)
+        {
+            throw debug::NullPointerException("ThreadPool::Dispatch - Given a null task!");
+        }
+        if (amount == 0) return;
+
+        // Sets up the task for the workers before waking them up
+        currentTask = task;
+        taskAmount = static_cast<LONG>(amount);
+        InterlockedExchange(&nextIndex, 0);
+        InterlockedExchange(&failed, 0);
+
+        /* There's no point waking up workers for a single piece of work, the
+         * dispatching thread can just do it itself. */
+        unsigned int numWoken = (amount > 1) ? workers.size() : 0;
+        for (unsigned int i = 0; (i < numWoken); i++)
+        {
+            SetEvent(workers[i].startEvent);
+        }
+
+        // This thread does work too instead of just waiting
+        ExecuteTask(0);
+
+        // Waits for every woken worker to finish the work it grabbed
+        if (numWoken > 0)
+        {
+            WaitForMultipleObjects(numWoken, &finishEvents[0], TRUE, INFINITE);
+        }
+
+        currentTask = NULL;
+
+        // Every thread has stopped by now, so the message can be read safely
+        if (failed)
+        {
+            std::string message = failMessage;
+            failMessage.clear();
+            throw debug::Exception(message);
+        }
+    }
+
+}
+
+}
@@ -0,0 +1,346 @@
+/*
+ * File:   TriangleBVH.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on October 19, 2026, 12:20 AM
+ */
+
+#include <cfloat>
+#include <algorithm>
+#include <xmmintrin.h>
+#include "TriangleBVH.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+using namespace maths;
+
+namespace graphics
+{
+
+    namespace
+    {
+
+        // Rays can't hit triangles they're this parallel to, or they'd divide by almost zero
+        const float parallelEpsilon = 1e-12f;
+        // Most nodes waiting to be visited while tracing, which maxDepth keeps it under
+        const unsigned int traceStackSize = 128;
+
+        // Sorts build items along one axis, for when the range is split down the middle
+        struct CentreLess
+        {
+            unsigned int axis;
+
+            template<typename T>
+            bool operator ()(const T& a, const T& b) const
+            {
+                return (a.centre.values[axis] < b.centre.values[axis]);
+            }
+        };
+
+    }
+
+
+    TriangleBVH::TriangleBVH()
+    {
+    }
+
+    void TriangleBVH::Build(const std::vector<vector3f>& positions, const std::vector<Triangle>& triangles)
+    {
+        Clear();
+        if (triangles.empty()) return;
+
+        buildItems.resize(triangles.size());
+        for (unsigned int i = 0; (i < triangles.size()); i++)
+        {
+            BuildItem& item = buildItems[i];
+            item.bounds = AABB();
+            for (unsigned int j = 0; (j < 3); j++)
+            {
+                if ((triangles[i].values[j] < 0) || (triangles[i].values[j] >= static_cast<int>(positions.size())))
+                    throw debug::InvalidArgumentException("TriangleBVH::Build - "
+                        "Triangle uses a vertex that doesn't exist!");
+                item.bounds.Expand(positions[triangles[i].values[j]]);
+            }
+            item.centre = item.bounds.GetCentre();
+            item.triangle = i;
+        }
+
+        nodes.reserve((triangles.size() / trianglesPerLeaf) * 2 + 1);
+        packets.reserve((triangles.size() / trianglesPerLeaf) + 1);
+        BuildRange(0, buildItems.size(), 0, positions, triangles);
+
+        std::vector<BuildItem>().swap(buildItems); // Frees the memory, since it's not needed again
+    }
+
+    void TriangleBVH::Clear()
+    {
+        nodes.clear();
+        packets.clear();
+    }
+
+    const AABB& TriangleBVH::GetBounds() const
+    {
+        static const AABB empty;
+        return (nodes.empty()) ? empty : nodes[0].bounds;
+    }
+
+    unsigned int TriangleBVH::BuildRange(unsigned int first, unsigned int last, unsigned int depth,
+        const std::vector<vector3f>& positions, const std::vector<Triangle>& triangles)
+    {
+        unsigned int index = nodes.size();
+        nodes.push_back(Node());
+        AABB bounds, centreBounds;
+        for (unsigned int i = first; (i < last); i++)
+        {
+            bounds.Expand(buildItems[i].bounds);
+            centreBounds.Expand(buildItems[i].centre);
+        }
+        nodes[index].bounds = bounds;
+
+        unsigned int amount = last - first;
+        if (amount <= trianglesPerLeaf)
+        {
+            // Put the triangles into a packet, with the slots left over hit by nothing
+            Packet packet;
+            for (unsigned int lane = 0; (lane < 4); lane++)
+            {
+                packet.triangles[lane] = noTriangle;
+                for (unsigned int axis = 0; (axis < 3); axis++)
+                    packet.origin[axis][lane] = packet.edge1[axis][lane] = packet.edge2[axis][lane] = 0.0f;
+                if (lane >= amount) continue;
+
+                const Triangle& triangle = triangles[buildItems[first + lane].triangle];
+                const vector3f& a = positions[triangle.v1];
+                const vector3f& b = positions[triangle.v2];
+                const vector3f& c = positions[triangle.v3];
+                packet.triangles[lane] = buildItems[first + lane].triangle;
+                for (unsigned int axis = 0; (axis < 3); axis++)
+                {
+                    packet.origin[axis][lane] = a.values[axis];
+                    packet.edge1[axis][lane] = b.values[axis] - a.values[axis];
+                    packet.edge2[axis][lane] = c.values[axis] - a.values[axis];
+                }
+            }
+            nodes[index].leaf = true;
+            nodes[index].child = packets.size();
+            packets.push_back(packet);
+            return index;
+        }
+
+        /* Find the cheapest split using the surface area heuristic, trying a few places along
+         * each axis (bins) rather than between every triangle. */
+        float bestCost = FLT_MAX;
+        unsigned int bestAxis = 0, bestBin = 0;
+        if (depth < maxDepth)
+        {
+            for (unsigned int axis = 0; (axis < 3); axis++)
+            {
+                float minimum = centreBounds.minimum.values[axis];
+                float extent = centreBounds.maximum.values[axis] - minimum;
+                if (extent <= 0.0f) continue;
+
+                AABB binBounds[amountOfBins];
+                unsigned int binCounts[amountOfBins] = { 0 };
+                float binScale = amountOfBins / extent;
+                for (unsigned int i = first; (i < last); i++)
+                {
+                    unsigned int bin = static_cast<unsigned int>((buildItems[i].centre.values[axis] - minimum) * binScale);
+                    if (bin >= amountOfBins) bin = amountOfBins - 1;
+                    binBounds[bin].Expand(buildItems[i].bounds);
+                    binCounts[bin]++;
+                }
+
+                // Areas and counts of everything to the right of each split, swept from the right
+                float rightAreas[amountOfBins];
+                unsigned int rightCounts[amountOfBins];
+                AABB sweep;
+                unsigned int count = 0;
+                for (unsigned int bin = amountOfBins - 1; (bin > 0); bin--)
+                {
+                    sweep.Expand(binBounds[bin]);
+                    count += binCounts[bin];
+                    rightAreas[bin] = (count > 0) ? sweep.GetSurfaceArea() : 0.0f;
+                    rightCounts[bin] = count;
+                }
+
+                sweep = AABB();
+                count = 0;
+                for (unsigned int bin = 1; (bin < amountOfBins); bin++)
+                {
+                    sweep.Expand(binBounds[bin - 1]);
+                    count += binCounts[bin - 1];
+                    if ((count == 0) || (rightCounts[bin] == 0)) continue;
+
+                    float cost = (sweep.GetSurfaceArea() * count) + (rightAreas[bin] * rightCounts[bin]);
+                    if (cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestBin = bin;
+                    }
+                }
+            }
+        }
+
+        unsigned int middle = first;
+        if (bestCost < FLT_MAX)
+        {
+            float minimum = centreBounds.minimum.values[bestAxis];
+            float binScale = amountOfBins / (centreBounds.maximum.values[bestAxis] - minimum);
+            for (unsigned int i = first; (i < last); i++)
+            {
+                unsigned int bin = static_cast<unsigned int>((buildItems[i].centre.values[bestAxis] - minimum) * binScale);
+                if (bin >= amountOfBins) bin = amountOfBins - 1;
+                if (bin < bestBin) std::swap(buildItems[i], buildItems[middle++]);
+            }
+        }
+        else
+        {
+            /* Every centre is in the same place, or the tree's too deep already, so just split
+             * the range in half along its longest axis. */
+            vector3f extent(centreBounds.maximum.x - centreBounds.minimum.x, centreBounds.maximum.y - centreBounds.minimum.y,
+                centreBounds.maximum.z - centreBounds.minimum.z);
+            CentreLess less;
+            less.axis = (extent.x > extent.y) ? ((extent.x > extent.z) ? 0 : 2) : ((extent.y > extent.z) ? 1 : 2);
+            middle = first + (amount / 2);
+            std::nth_element(buildItems.begin() + first, buildItems.begin() + middle, buildItems.begin() + last, less);
+        }
+
+        nodes[index].leaf = false;
+        BuildRange(first, middle, depth + 1, positions, triangles);
+        unsigned int right = BuildRange(middle, last, depth + 1, positions, triangles);
+        nodes[index].child = right;
+        return index;
+    }
+
+    bool TriangleBVH::IntersectPacket(const Packet& packet, const Ray& ray, bool anyHit, Hit& hit)
+    {
+        // Möller-Trumbore, for four triangles at once
+        const __m128 dx = _mm_set1_ps(ray.direction.x);
+        const __m128 dy = _mm_set1_ps(ray.direction.y);
+        const __m128 dz = _mm_set1_ps(ray.direction.z);
+        const __m128 e1x = _mm_loadu_ps(packet.edge1[0]);
+        const __m128 e1y = _mm_loadu_ps(packet.edge1[1]);
+        const __m128 e1z = _mm_loadu_ps(packet.edge1[2]);
+        const __m128 e2x = _mm_loadu_ps(packet.edge2[0]);
+        const __m128 e2y = _mm_loadu_ps(packet.edge2[1]);
+        const __m128 e2z = _mm_loadu_ps(packet.edge2[2]);
+
+        // p = direction x edge2
+        __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+        __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+        __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+        __m128 determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+        __m128 absDeterminant = _mm_andnot_ps(_mm_set1_ps(-0.0f), determinant);
+        __m128 valid = _mm_cmpgt_ps(absDeterminant, _mm_set1_ps(parallelEpsilon));
+        if (_mm_movemask_ps(valid) == 0) return false;
+        __m128 inverse = _mm_div_ps(_mm_set1_ps(1.0f), determinant);
+
+        // s = origin - vertex, u = (s . p) / determinant
+        __m128 sx = _mm_sub_ps(_mm_set1_ps(ray.origin.x), _mm_loadu_ps(packet.origin[0]));
+        __m128 sy = _mm_sub_ps(_mm_set1_ps(ray.origin.y), _mm_loadu_ps(packet.origin[1]));
+        __m128 sz = _mm_sub_ps(_mm_set1_ps(ray.origin.z), _mm_loadu_ps(packet.origin[2]));
+        __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)), inverse);
+
+        // q = s x edge1, v = (direction . q) / determinant, t = (edge2 . q) / determinant
+        __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+        __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+        __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+        __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), inverse);
+        __m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), inverse);
+
+        const __m128 zero = _mm_setzero_ps();
+        valid = _mm_and_ps(valid, _mm_cmpge_ps(u, zero));
+        valid = _mm_and_ps(valid, _mm_cmpge_ps(v, zero));
+        valid = _mm_and_ps(valid, _mm_cmple_ps(_mm_add_ps(u, v), _mm_set1_ps(1.0f)));
+        valid = _mm_and_ps(valid, _mm_cmpge_ps(t, zero));
+        valid = _mm_and_ps(valid, _mm_cmplt_ps(t, _mm_set1_ps(hit.distance)));
+        int mask = _mm_movemask_ps(valid);
+        if (mask == 0) return false;
+
+        float distances[4], us[4], vs[4];
+        _mm_storeu_ps(distances, t);
+        _mm_storeu_ps(us, u);
+        _mm_storeu_ps(vs, v);
+        for (unsigned int lane = 0; (lane < 4); lane++)
+        {
+            if (((mask & (1 << lane)) == 0) || (distances[lane] >= hit.distance)) continue;
+
+            hit.triangle = packet.triangles[lane];
+            hit.distance = distances[lane];
+            hit.u = us[lane];
+            hit.v = vs[lane];
+            if (anyHit) break;
+        }
+        return true;
+    }
+
+    bool TriangleBVH::Trace(const Ray& ray, float maxDistance, bool anyHit, Hit& hit) const
+    {
+        if (nodes.empty()) return false;
+
+        vector3f inverseDirection(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+        hit.distance = maxDistance;
+        bool found = false;
+
+        float entry;
+        if (!ray.Intersects(nodes[0].bounds, inverseDirection, maxDistance, entry)) return false;
+
+        unsigned int stack[traceStackSize];
+        unsigned int stackSize = 0;
+        unsigned int current = 0;
+        while (true)
+        {
+            const Node& node = nodes[current];
+            if (node.leaf)
+            {
+                if (IntersectPacket(packets[node.child], ray, anyHit, hit))
+                {
+                    found = true;
+                    if (anyHit) return true;
+                }
+            }
+            else
+            {
+                // Visit whichever child the ray enters first, saving the other for later
+                unsigned int left = current + 1, right = node.child;
+                float leftDistance, rightDistance;
+                bool hitLeft = ray.Intersects(nodes[left].bounds, inverseDirection, hit.distance, leftDistance);
+                bool hitRight = ray.Intersects(nodes[right].bounds, inverseDirection, hit.distance, rightDistance);
+                if (hitLeft && hitRight)
+                {
+                    if (rightDistance < leftDistance) std::swap(left, right);
+                    stack[stackSize++] = right;
+                    current = left;
+                    continue;
+                }
+                else if (hitLeft || hitRight)
+                {
+                    current = (hitLeft) ? left : right;
+                    continue;
+                }
+            }
+
+            if (stackSize == 0) break;
+            current = stack[--stackSize];
+        }
+
+        return found;
+    }
+
+    bool TriangleBVH::Intersect(const Ray& ray, float maxDistance, Hit& hit) const
+    {
+        return Trace(ray, maxDistance, false, hit);
+    }
+
+    bool TriangleBVH::IsOccluded(const Ray& ray, float maxDistance) const
+    {
+        Hit hit;
+        return Trace(ray, maxDistance, true, hit);
+    }
+
+}
+
+}
@@ -1,304 +1,531 @@
-/*
- * File:   VBORenderer.cpp
- * Author: Donald "Datriot" Whyte
- *
- * Created on February 17, 2009, 10:37 AM
- */
-
-#include "VBORenderer.h"
-#include "Vertex.h"
-#include "Primitives.h"
-#include "Exceptions.h"
-
-namespace parcel
-{
-
-using namespace maths;
-
-namespace graphics
-{
-
-
-    VBORenderer::VBORenderer(RenderDevice* renderDevice, debug::Logger* log, const bool& willDeleteAll) :
-        ARenderer(log, "VBORenderer", willDeleteAll), // Calls superclass' constructor
-        vboID(0), vboData(NULL), renderDevice(renderDevice)
-    {
-        // Stores currently bound array buffer
-        int arrBuffer;
-        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &arrBuffer);
-
-        // Creates the VBO and stores ID in variable
-        glGenBuffers(1, &vboID);
-        glBindBuffer(GL_ARRAY_BUFFER, vboID);
-        glBufferData(GL_ARRAY_BUFFER, 0, NULL, GL_DYNAMIC_DRAW);
-
-        // Restores the array buffer that was active BEFORE the creation of this renderer
-        glBindBuffer(GL_ARRAY_BUFFER, arrBuffer);
-
-        logger->WriteTextAndNewLine(logID, "VBORenderer created.");
-    }
-
-
-    VBORenderer::~VBORenderer()
-    {
-        // Deletes VBO and its contents
-        glDeleteBuffers(1, &vboID);
-
-        logger->WriteTextAndNewLine(logID, "VBORenderer destroyed.");
-    }
-
-
-    void VBORenderer::ProcessRenderable(IRenderable* renderable, unsigned int& vboIndex, unsigned int& vertexNumber)
-    {
-        // Stores start and end of this renderable's vertices in the VBO array
-        general::ArrayIndices indices;
-        // Sets the start of the vertices
-        indices.start = vertexNumber;
-
-        unsigned int i; // Iterator for the loops
-        unsigned int amount = 0; // The amount of vertices this renderable has to draw
-
-
-        // If renderable holds geometry
-        IGeometry* geometry = dynamic_cast<IGeometry*>(renderable);
-        if (geometry)
-        {
-            // Gets the vertices from the renderable and fills the VBO with them
-            const std::vector<Vertex>& vertexData = geometry->GetVertices();
-
-            // Fills VBO with the vertices
-            for (i = 0; (i < vertexData.size()); i++)
-            {
-                // Stores vertex position
-                vboData[vboIndex++] = vertexData[i].position.x;
-                vboData[vboIndex++] = vertexData[i].position.y;
-                vboData[vboIndex++] = vertexData[i].position.z;
-                // Stores texture coordinates
-                vboData[vboIndex++] = vertexData[i].texCoord.x;
-                vboData[vboIndex++] = vertexData[i].texCoord.y;
-                // Stores normals
-                vboData[vboIndex++] = vertexData[i].normal.x;
-                vboData[vboIndex++] = vertexData[i].normal.y;
-                vboData[vboIndex++] = vertexData[i].normal.z;
-
-                // Increases the amount of vertices, so it draws this vertex too
-                amount++;
-                // Also increases the total vertex number
-                vertexNumber++;
-            }
-        }
-
-        // Processes all the group's renderables too
-        IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
-        if (group)
-        {
-            for (i = 0; (i < group->GetAmountOfRenderables()); i++)
-            {
-                if (group->GetRenderable(i) != NULL)
-                {
-                    ProcessRenderable(group->GetRenderable(i), vboIndex, vertexNumber);
-                }
-            }
-        }
-
-        // Sets amount of vertices for indices and pushes the indices into the vector
-        indices.amount = amount;
-        arrayIndices.push_back(indices);
-    }
-
-
-    void VBORenderer::Update()
-    {
-        // Gets the size the updated buffer will need to be
-        int vboMemorySize = 0;
-
-        // Iterates through all renderables, adding their memory size to the total
-        for (unsigned int i = 0; (i < renderables.size()); i++)
-        {
-            vboMemorySize += renderables[i]->GetMemorySize();
-        }
-
-
-        // Binds the renderer's buffer to make it active
-        glBindBuffer(GL_ARRAY_BUFFER, vboID);
-        // Clears VBO and specifies how the data in the arrays will be packed
-        glBufferData(GL_ARRAY_BUFFER, vboMemorySize, NULL, GL_DYNAMIC_DRAW);
-
-        // If memory size is zero, just return since there is nothing to update
-        if (vboMemorySize == 0) return;
-
-        // Gets pointer to VBO data to put our values into
-        vboData = (float*)glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
-
-        // Used for accessing VBO array's elements
-        unsigned int vboIndex = 0;
-        // Used for getting the start index for each renderable's ArrayIndices struct
-        unsigned int vertexNumber = 0;
-        // Clears the std::vector of its array indices and reserves needed amount of memory
-        arrayIndices.clear();
-        arrayIndices.reserve(renderables.size());
-
-        /* Processes all the renderables, adding data to the VBO and putting indices to that
-         * data into arrayIndices. */
-        for (unsigned int i = 0; (i < renderables.size()); i++)
-        {
-            if (renderables[i] != NULL)
-            {
-                ProcessRenderable(renderables[i], vboIndex, vertexNumber);
-            }
-        }
-
-        /* Unmap buffer to send new data to the graphics card. If it returns false, the VBO data
-         * must have got corruped, so throw an exception that is to be caught higher up the chain. */
-        if (!glUnmapBuffer(GL_ARRAY_BUFFER))
-        {
-            throw debug::Exception("VBORenderer::Update - VBO data got corrupted when changing data.");
-        }
-
-        logger->WriteTextAndNewLine(logID, "VBORenderer successfully updated.");
-    }
-
-
-    void VBORenderer::RenderObject(IRenderable* renderable, unsigned int& index)
-    {
-        try
-        {
-            // If renderable has its own matrix, use it
-            IMatrix* mat = dynamic_cast<IMatrix*>(renderable);
-            if (mat)
-            {
-                glPushMatrix(); // Stores current matrix
-
-                // Stores the matrix in the array format that OpenGL requires
-                float a[16];
-                mat->GetMatrixAsArray(a);
-
-                glMultMatrixf(a); // Multiplies matrix by the current one
-            }
-
-
-            // If it is textured, make sure that its texture is bound
-            ISkinned* skinned = dynamic_cast<ISkinned*>(renderable);
-            if (skinned)
-            {
-                const std::string& skinID = skinned->GetSkinID(); // Gets skin ID from renderable
-
-                // Makes sure current skin isn't already active
-                if (renderDevice->GetCurrentSkinID() != skinID)
-                {
-                    // Then makes the skin active
-                    renderDevice->SetActiveSkin(skinID);
-                }
-            }
-
-
-            // If the renderable has geometry, draw the arrays with the correct indexes!
-            IGeometry* geometry = dynamic_cast<IGeometry*>(renderable);
-            if (geometry)
-            {
-                int type; // Stores OpenGL enumerator
-
-                // Gets the OpenGl equivilent to the enumerator returned from GetPrimitiveType()
-                switch(geometry->GetPrimitiveType())
-                {
-                    case PRIMITIVETYPE_POINT: type = GL_POINT; break;
-                    case PRIMITIVETYPE_LINE: type = GL_LINE; break;
-                    case PRIMITIVETYPE_LINESTRIP: type = GL_LINE_STRIP; break;
-                    case PRIMITIVETYPE_LINELOOP: type = GL_LINE_LOOP; break;
-                    case PRIMITIVETYPE_TRIANGLE: type = GL_TRIANGLES; break;
-                    case PRIMITIVETYPE_TRIANGLESTRIP: type = GL_TRIANGLE_STRIP; break;
-                    case PRIMITIVETYPE_TRIANGLEFAN: type = GL_TRIANGLE_FAN; break;
-                    case PRIMITIVETYPE_QUAD: type = GL_QUADS; break;
-                    case PRIMITIVETYPE_QUADSTRIP: type = GL_QUAD_STRIP; break;
-                    case PRIMITIVETYPE_POLYGON: type = GL_POLYGON; break;
-
-                    default: throw debug::UnsupportedOperationException("VBORenderer::RenderObject - Cannot recognize given primitive type.");
-                }
-
-                glDrawArrays(type, arrayIndices[index].start, arrayIndices[index].amount);
-            }
-
-
-            // If it's a group renderable, render all of its child objects
-            IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
-            if (group)
-            {
-                for (unsigned int i = 0; (i < group->GetAmountOfRenderables()); i++)
-                {
-                    if (group->GetRenderable(i) != NULL)
-                    {
-                        RenderObject(group->GetRenderable(i), index);
-                    }
-                }
-            }
-
-
-            // After rendering, restore previous matrix if needed
-            if (mat)
-            {
-                glPopMatrix();
-            }
-        }
-        catch (debug::Exception& ex)
-        {
-            ex.PrintMessage();
-        }
-        catch (std::exception& ex)
-        {
-            std::cout << ex.what() << std::endl;
-        }
-        catch (...)
-        {
-            std::cout
-                << "VBORenderer - Renderable# " << (index + 1) << " failed to render for unknown reasons!"
-                << std::endl;
-        }
-
-
-        // Increases the index of the arrayIndices
-        index++;
-    }
-
-
-    void VBORenderer::Render()
-    {
-        // Bind the vertex buffer object
-        glBindBuffer(GL_ARRAY_BUFFER, vboID);
-
-
-        // Calculates offsets for array
-        unsigned int vertexOffset = 0,
-            texCoordOffset = sizeof(vector3f),
-            normalOffset = sizeof(vector3f) + sizeof(vector2f);
-        // Points to the vertex arrays in the VBO
-        glVertexPointer(3, GL_FLOAT, sizeof(Vertex), (GLvoid*)vertexOffset);
-        glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), (GLvoid*)texCoordOffset);
-        glNormalPointer(GL_FLOAT, sizeof(Vertex), (GLvoid*)normalOffset);
-
-
-        // Enables vertex arrays
-        if (!glIsEnabled(GL_VERTEX_ARRAY)) glEnableClientState(GL_VERTEX_ARRAY);
-        if (!glIsEnabled(GL_TEXTURE_COORD_ARRAY)) glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-        if (!glIsEnabled(GL_NORMAL_ARRAY)) glEnableClientState(GL_NORMAL_ARRAY);
-
-        // Used for accessing arrayIndices
-        unsigned int index = 0;
-        // Renders every object
-        for (unsigned int i = 0; (i < renderables.size()); i++)
-        {
-            if (renderables[i] != NULL)
-            {
-                RenderObject(renderables[i], index);
-            }
-        }
-
-
-        // Unbinds the buffer and returns to client mode
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-        logger->WriteTextAndNewLine(logID, "VBORenderer draws objects stored.");
-    }
-
-}
-
-}
+/*
+ * File:   VBORenderer.cpp
+ * Author: Donald "Datriot" Whyte
+ *
+ * Created on February 17, 2009, 10:37 AM
+ * Changed to draw opaque objects first and sort translucent ones on October 18, 2026, 9:50 PM
+ * Added per-object light selection on October 19, 2026, 12:05 AM
+ * Added lightmaps on October 19, 2026, 12:20 AM
+ */
+
+#include "VBORenderer.h"
+#include "Vertex.h"
+#include "Primitives.h"
+#include "Exceptions.h"
+
+namespace parcel
+{
+
+using namespace maths;
+
+namespace graphics
+{
+
+
+    VBORenderer::VBORenderer(RenderDevice* renderDevice, debug::Logger* log, const bool& willDeleteAll) :
+        ARenderer(log, "VBORenderer", willDeleteAll), // Calls superclass' constructor
+        vboID(0), vboData(NULL), lightmapVboID(0), hasLightmaps(false), selectLights(false), boundLightmap(0),
+        lightingWasEnabled(false), renderDevice(renderDevice), backend(renderDevice->GetBackend())
+    {
+        // Stores currently bound array buffer
+        unsigned int arrBuffer = backend->GetBoundBuffer(BUFFERTARGET_ARRAY);
+
+        // Creates the VBO and stores ID in variable
+        backend->GenerateBuffers(1, &vboID);
+        backend->BindBuffer(BUFFERTARGET_ARRAY, vboID);
+        backend->BufferData(BUFFERTARGET_ARRAY, 0, NULL);
+
+        // Restores the array buffer that was active BEFORE the creation of this renderer
+        backend->BindBuffer(BUFFERTARGET_ARRAY, arrBuffer);
+
+        logger->WriteTextAndNewLine(logID, "VBORenderer created.");
+    }
+
+
+    VBORenderer::~VBORenderer()
+    {
+        // Deletes VBO and its contents
+        backend->DeleteBuffers(1, &vboID);
+        if (lightmapVboID != 0) backend->DeleteBuffers(1, &lightmapVboID);
+
+        logger->WriteTextAndNewLine(logID, "VBORenderer destroyed.");
+    }
+
+
+    void VBORenderer::ProcessRenderable(IRenderable* renderable, unsigned int& vboIndex, unsigned int& vertexNumber)
+    {
+        // Stores start and end of this renderable's vertices in the VBO array
+        general::ArrayIndices indices;
+        // Sets the start of the vertices
+        indices.start = vertexNumber;
+
+        unsigned int i; // Iterator for the loops
+        unsigned int amount = 0; // The amount of vertices this renderable has to draw
+        AABB bounds; // Box around the renderable's vertices
+
+
+        // If renderable holds geometry
+        IGeometry* geometry = dynamic_cast<IGeometry*>(renderable);
+        if (geometry)
+        {
+            // Gets the vertices from the renderable and fills the VBO with them
+            const std::vector<Vertex>& vertexData = geometry->GetVertices();
+
+            /* Lightmap coordinates go in the same place in their own array. Renderables that
+             * aren't lightmapped (or are missing coordinates) get zeroes, which are never used. */
+            ILightmapped* lightmapped = dynamic_cast<ILightmapped*>(renderable);
+            const std::vector<vector2f>* coords = (lightmapped) ? &lightmapped->GetLightmapCoords() : NULL;
+            if (lightmapped) hasLightmaps = true;
+            for (i = 0; (i < vertexData.size()); i++)
+            {
+                bool hasCoords = (coords) && (i < coords->size());
+                lightmapCoords.push_back((hasCoords) ? (*coords)[i].x : 0.0f);
+                lightmapCoords.push_back((hasCoords) ? (*coords)[i].y : 0.0f);
+            }
+
+            // Fills VBO with the vertices
+            for (i = 0; (i < vertexData.size()); i++)
+            {
+                // Stores vertex position
+                vboData[vboIndex++] = vertexData[i].position.x;
+                vboData[vboIndex++] = vertexData[i].position.y;
+                vboData[vboIndex++] = vertexData[i].position.z;
+                // Stores texture coordinates
+                vboData[vboIndex++] = vertexData[i].texCoord.x;
+                vboData[vboIndex++] = vertexData[i].texCoord.y;
+                // Stores normals
+                vboData[vboIndex++] = vertexData[i].normal.x;
+                vboData[vboIndex++] = vertexData[i].normal.y;
+                vboData[vboIndex++] = vertexData[i].normal.z;
+                bounds.Expand(vertexData[i].position);
+
+                // Increases the amount of vertices, so it draws this vertex too
+                amount++;
+                // Also increases the total vertex number
+                vertexNumber++;
+            }
+        }
+
+        /* Sets amount of vertices for indices and pushes the indices into the vector. This is
+         * done before the group's renderables are processed, since rendering and recording
+         * go through a group before its renderables too. */
+        indices.amount = amount;
+        arrayIndices.push_back(indices);
+        localBounds.push_back(bounds);
+
+        // Processes all the group's renderables too
+        IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
+        if (group)
+        {
+            for (i = 0; (i < group->GetAmountOfRenderables()); i++)
+            {
+                if (group->GetRenderable(i) != NULL)
+                {
+                    ProcessRenderable(group->GetRenderable(i), vboIndex, vertexNumber);
+                }
+            }
+        }
+    }
+
+
+    void VBORenderer::Update()
+    {
+        // Gets the size the updated buffer will need to be
+        int vboMemorySize = 0;
+        lightmapCoords.clear();
+        hasLightmaps = false;
+
+        // Iterates through all renderables, adding their memory size to the total
+        for (unsigned int i = 0; (i < renderables.size()); i++)
+        {
+            vboMemorySize += renderables[i]->GetMemorySize();
+        }
+
+
+        // Binds the renderer's buffer to make it active
+        backend->BindBuffer(BUFFERTARGET_ARRAY, vboID);
+        // Clears VBO and specifies how the data in the arrays will be packed
+        backend->BufferData(BUFFERTARGET_ARRAY, vboMemorySize, NULL);
+
+        // If memory size is zero, just return since there is nothing to update
+        if (vboMemorySize == 0) return;
+
+        // Gets pointer to VBO data to put our values into
+        vboData = (float*)backend->MapBuffer(BUFFERTARGET_ARRAY);
+
+        // Used for accessing VBO array's elements
+        unsigned int vboIndex = 0;
+        // Used for getting the start index for each renderable's ArrayIndices struct
+        unsigned int vertexNumber = 0;
+        // Clears the std::vector of its array indices and reserves needed amount of memory
+        arrayIndices.clear();
+        arrayIndices.reserve(renderables.size());
+        renderableIndices.clear();
+        renderableIndices.reserve(renderables.size());
+        localBounds.clear();
+        localBounds.reserve(renderables.size());
+
+        /* Processes all the renderables, adding data to the VBO and putting indices to that
+         * data into arrayIndices. */
+        for (unsigned int i = 0; (i < renderables.size()); i++)
+        {
+            // Remembers where this renderable's indices start
+            renderableIndices.push_back(arrayIndices.size());
+
+            if (renderables[i] != NULL)
+            {
+                ProcessRenderable(renderables[i], vboIndex, vertexNumber);
+            }
+        }
+
+        /* Unmap buffer to send new data to the graphics card. If it returns false, the VBO data
+         * must have got corruped, so throw an exception that is to be caught higher up the chain. */
+        if (!backend->UnmapBuffer(BUFFERTARGET_ARRAY))
+        {
+            throw debug::Exception("VBORenderer::Update - VBO data got corrupted when changing data.");
+        }
+
+        // Only renderers that draw lightmapped objects need the second VBO
+        if (hasLightmaps)
+        {
+            if (lightmapVboID == 0) backend->GenerateBuffers(1, &lightmapVboID);
+            backend->BindBuffer(BUFFERTARGET_ARRAY, lightmapVboID);
+            backend->BufferData(BUFFERTARGET_ARRAY, lightmapCoords.size() * sizeof(float), &lightmapCoords[0]);
+        }
+
+        logger->WriteTextAndNewLine(logID, "VBORenderer successfully updated.");
+    }
+
+
+    void VBORenderer::GatherObject(IRenderable* renderable, const float* parentMatrix, bool transformed,
+        SkinHandle skin, unsigned int& index)
+    {
+        // Stays the parent's matrix unless the renderable has its own
+        const float* matrix = parentMatrix;
+        float combined[16];
+
+        try
+        {
+            // If renderable has its own matrix, combine it with its parent's
+            IMatrix* mat = dynamic_cast<IMatrix*>(renderable);
+            if (mat)
+            {
+                float a[16];
+                mat->GetMatrixAsArray(a);
+                general::MultiplyMatrixArrays(parentMatrix, a, combined);
+                matrix = combined;
+                transformed = true;
+            }
+
+            // Its children use its skin if it has one, otherwise they use the parent's
+            ISkinned* skinned = dynamic_cast<ISkinned*>(renderable);
+            if (skinned)
+            {
+                skin = skinned->GetSkinHandle();
+            }
+
+
+            // If the renderable has geometry, add it to the items to draw
+            IGeometry* geometry = dynamic_cast<IGeometry*>(renderable);
+            if (geometry)
+            {
+                // A skin that can't be found gets an error message from SetActiveSkin(), so it's just treated as opaque here
+                bool translucent = false;
+                if (skin != invalidHandle)
+                {
+                    try { translucent = renderDevice->GetSkinManager()->IsSkinTranslucent(skin); }
+                    catch (debug::Exception&) { }
+                }
+
+                std::vector<DrawItem>& items = (translucent) ? translucentItems : opaqueItems;
+                items.push_back(DrawItem());
+                DrawItem& item = items.back();
+                for (unsigned int i = 0; (i < 16); i++) item.matrix[i] = matrix[i];
+                item.transformed = transformed;
+                item.skin = skin;
+                item.type = static_cast<PrimitiveType>(geometry->GetPrimitiveType());
+                item.start = arrayIndices[index].start;
+                item.amount = arrayIndices[index].amount;
+                item.renderable = renderable;
+                if (selectLights) item.bounds = localBounds[index].Transformed(matrix);
+                if (translucent) item.centre = localBounds[index].GetTransformedCentre(matrix);
+
+                item.lightmap = 0;
+                ILightmapped* lightmapped = dynamic_cast<ILightmapped*>(renderable);
+                if (lightmapped && hasLightmaps)
+                {
+                    item.lightmap = renderDevice->GetSkinManager()->GetTexture(lightmapped->GetLightmap())->glID;
+                }
+            }
+        }
+        catch (debug::Exception& ex)
+        {
+            ex.PrintMessage();
+        }
+        catch (std::exception& ex)
+        {
+            std::cout << ex.what() << std::endl;
+        }
+        catch (...)
+        {
+            std::cout
+                << "VBORenderer - Renderable# " << (index + 1) << " failed to render for unknown reasons!"
+                << std::endl;
+        }
+
+        // Increases the index of the arrayIndices
+        index++;
+
+
+        // If it's a group renderable, gather all of its child objects
+        IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
+        if (group)
+        {
+            for (unsigned int i = 0; (i < group->GetAmountOfRenderables()); i++)
+            {
+                if (group->GetRenderable(i) != NULL)
+                {
+                    GatherObject(group->GetRenderable(i), matrix, transformed, skin, index);
+                }
+            }
+        }
+    }
+
+
+    void VBORenderer::DrawObject(const DrawItem& item)
+    {
+        // Done before the skin, so the colour it sets isn't replaced by the lightmap's white
+        if (item.lightmap != boundLightmap) SetLightmap(item.lightmap);
+
+        // Makes sure the item's skin is active, if it has one
+        if (item.skin != invalidHandle && renderDevice->GetCurrentSkin() != item.skin)
+        {
+            renderDevice->SetActiveSkin(item.skin);
+        }
+
+        // Lights are bound before the object's matrix is applied, which would move them
+        if (selectLights && item.lightmap == 0) renderDevice->GetLighting()->BindLightsFor(item.renderable, item.bounds);
+
+        // Objects that aren't transformed at all don't need to touch the matrix stack
+        if (item.transformed)
+        {
+            backend->PushMatrix(); // Stores current matrix
+            backend->MultiplyMatrix(item.matrix); // Multiplies matrix by the current one
+        }
+
+        backend->DrawArrays(item.type, item.start, item.amount);
+
+        // After rendering, restore previous matrix if needed
+        if (item.transformed)
+        {
+            backend->PopMatrix();
+        }
+    }
+
+
+    void VBORenderer::SetLightmap(unsigned int lightmap)
+    {
+        if (lightmap != 0)
+        {
+            /* The lightmap replaces the lighting, and it's multiplied with the colour rather than
+             * lit, so the colour's made white (textured skins set it to white themselves). */
+            if (boundLightmap == 0)
+            {
+                lightingWasEnabled = backend->IsEnabled(CAPABILITY_LIGHTING);
+                if (lightingWasEnabled) backend->Disable(CAPABILITY_LIGHTING);
+                backend->SetColour(colourf(1.0f, 1.0f, 1.0f, 1.0f));
+            }
+            backend->BindUnitTexture(lightmapUnit, lightmap);
+        }
+        else
+        {
+            backend->BindUnitTexture(lightmapUnit, 0);
+            if (lightingWasEnabled) backend->Enable(CAPABILITY_LIGHTING);
+        }
+        boundLightmap = lightmap;
+    }
+
+
+    void VBORenderer::Render()
+    {
+        // Gathers every object, starting with no transformation and no skin
+        opaqueItems.clear();
+        translucentItems.clear();
+        selectLights = renderDevice->GetLighting()->SelectsLightsPerObject();
+        float identity[16] = { 1.0f, 0.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f, 0.0f,
+                               0.0f, 0.0f, 1.0f, 0.0f,  0.0f, 0.0f, 0.0f, 1.0f };
+        unsigned int index = 0;
+        for (unsigned int i = 0; (i < renderables.size()); i++)
+        {
+            if (renderables[i] != NULL)
+            {
+                GatherObject(renderables[i], identity, false, invalidHandle, index);
+            }
+        }
+
+
+        /* Points the lightmap unit at the lightmap coordinates first, since pointers use the buffer
+         * that's bound when they're set. */
+        boundLightmap = 0;
+        if (hasLightmaps)
+        {
+            backend->BindBuffer(BUFFERTARGET_ARRAY, lightmapVboID);
+            backend->SetUnitTexCoordPointer(lightmapUnit, 2, 0, (void*)0);
+        }
+
+        // Bind the vertex buffer object
+        backend->BindBuffer(BUFFERTARGET_ARRAY, vboID);
+
+
+        // Calculates offsets for array
+        unsigned int vertexOffset = 0,
+            texCoordOffset = sizeof(vector3f),
+            normalOffset = sizeof(vector3f) + sizeof(vector2f);
+        // Points to the vertex arrays in the VBO
+        backend->SetVertexPointer(3, sizeof(Vertex), (void*)vertexOffset);
+        backend->SetTexCoordPointer(2, sizeof(Vertex), (void*)texCoordOffset);
+        backend->SetNormalPointer(sizeof(Vertex), (void*)normalOffset);
+
+
+        // Enables vertex arrays
+        if (!backend->IsClientArrayEnabled(CLIENTARRAY_VERTEX)) backend->EnableClientArray(CLIENTARRAY_VERTEX);
+        if (!backend->IsClientArrayEnabled(CLIENTARRAY_TEXCOORD)) backend->EnableClientArray(CLIENTARRAY_TEXCOORD);
+        if (!backend->IsClientArrayEnabled(CLIENTARRAY_NORMAL)) backend->EnableClientArray(CLIENTARRAY_NORMAL);
+
+
+        // Opaque objects don't need blending, which saves paying for it on most of the screen
+        backend->Disable(CAPABILITY_BLEND);
+        for (unsigned int i = 0; (i < opaqueItems.size()); i++)
+        {
+            DrawObject(opaqueItems[i]);
+        }
+        backend->Enable(CAPABILITY_BLEND);
+
+
+        /* Translucent objects are drawn from back to front. The depth of each one is the z of
+         * the centre of its vertices in view space; the camera looks down negative z, so the
+         * furthest object has the smallest z and sorting from smallest to largest gives the
+         * right order. */
+        if (!translucentItems.empty())
+        {
+            float view[16];
+            renderDevice->GetViewMatrix().ToArray(view);
+
+            depths.resize(translucentItems.size());
+            for (unsigned int i = 0; (i < translucentItems.size()); i++)
+            {
+                const vector3f& c = translucentItems[i].centre;
+                depths[i] = (view[2] * c.x) + (view[6] * c.y) + (view[10] * c.z) + view[14];
+            }
+
+            const std::vector<unsigned int>& order = depthSorter.Sort(&depths[0], depths.size());
+            for (unsigned int i = 0; (i < order.size()); i++)
+            {
+                DrawObject(translucentItems[order[i]]);
+            }
+        }
+
+
+        // Leaves the lightmap unit off, and lighting how it was, for whatever's drawn next
+        if (boundLightmap != 0) SetLightmap(0);
+        if (hasLightmaps) backend->DisableUnitTexCoordArray(lightmapUnit);
+
+        // Unbinds the buffer and returns to client mode
+        backend->BindBuffer(BUFFERTARGET_ARRAY, 0);
+
+        logger->WriteTextAndNewLine(logID, "VBORenderer draws objects stored.");
+    }
+
+
+    void VBORenderer::RecordObject(IRenderable* renderable, CommandBuffer& buffer, unsigned int& index)
+    {
+        /* Takes this object's slot in arrayIndices before its children take theirs, the same
+         * order GatherObject() fills them in. */
+        unsigned int objectIndex = index++;
+
+        try
+        {
+            // If renderable has its own matrix, use it
+            IMatrix* mat = dynamic_cast<IMatrix*>(renderable);
+            if (mat)
+            {
+                float a[16];
+                mat->GetMatrixAsArray(a);
+                buffer.PushMatrix(a);
+            }
+
+            /* If it is textured, make sure that its texture is bound. Whether the skin is
+             * already active can only be checked when the buffer is submitted. */
+            ISkinned* skinned = dynamic_cast<ISkinned*>(renderable);
+            if (skinned)
+            {
+                buffer.SetSkin(skinned->GetSkinHandle());
+            }
+
+            // If the renderable has geometry, draw the arrays with the correct indexes
+            IGeometry* geometry = dynamic_cast<IGeometry*>(renderable);
+            if (geometry)
+            {
+                buffer.DrawArrays(static_cast<PrimitiveType>(geometry->GetPrimitiveType()),
+                    arrayIndices[objectIndex].start, arrayIndices[objectIndex].amount);
+            }
+
+            // If it's a group renderable, record all of its child objects
+            IGroupRenderable* group = dynamic_cast<IGroupRenderable*>(renderable);
+            if (group)
+            {
+                for (unsigned int i = 0; (i < group->GetAmountOfRenderables()); i++)
+                {
+                    if (group->GetRenderable(i) != NULL)
+                    {
+                        RecordObject(group->GetRenderable(i), buffer, index);
+                    }
+                }
+            }
+
+            // After rendering, restore previous matrix if needed
+            if (mat)
+            {
+                buffer.PopMatrix();
+            }
+        }
+        catch (debug::Exception& ex)
+        {
+            ex.PrintMessage();
+        }
+        catch (std::exception& ex)
+        {
+            std::cout << ex.what() << std::endl;
+        }
+        catch (...)
+        {
+            std::cout
+                << "VBORenderer - Renderable# " << (objectIndex + 1) << " failed to record for unknown reasons!"
+                << std::endl;
+        }
+    }
+
+
+    void VBORenderer::RecordCommands(CommandBuffer& buffer, unsigned int first, unsigned int last)
+    {
+        // Makes sure the range is inside the renderables that were processed in Update()
+        if (last > renderableIndices.size()) last = renderableIndices.size();
+        if (first >= last) return;
+
+        // Every range binds the VBO itself, so buffers can be submitted in any order
+        buffer.BindGeometry(vboID, 0, VERTEXLAYOUT_VERTEX);
+
+        // Records every renderable in the range, starting at the first one's indices
+        unsigned int index = renderableIndices[first];
+        for (unsigned int i = first; (i < last); i++)
+        {
+            if (renderables[i] != NULL)
+            {
+                RecordObject(renderables[i], buffer, index);
+            }
+        }
+    }
+
+}
+
+}